@@ -23,6 +23,7 @@
 #include <qrutils/widgets/consoleDock.h>
 #include <kitBase/robotModel/robotParts/shell.h>
 #include <kitBase/robotModel/robotModelUtils.h>
+#include <interpreterCore/managers/saveConvertionManager.h>
 
 #include <twoDModel/engine/model/model.h>
 #include <twoDModel/engine/model/timeline.h>
@@ -33,6 +34,7 @@ Runner::Runner(const QString &report, const QString &trajectory)
 {
 	mQRealFacade.reset(new qReal::SystemFacade());
 	mProjectManager.reset(new qReal::ProjectManager(mQRealFacade->models()));
+	mProjectManager->addProjectConverters(interpreterCore::SaveConvertionManager::converters());
 	mErrorReporter.reset(new qReal::ConsoleErrorReporter());
 	mMainWindow.reset(new qReal::NullMainWindow(*mErrorReporter, mQRealFacade->events()
 				, &*mProjectManager, &mQRealFacade->models().graphicalModelAssistApi()));
@@ -57,6 +57,7 @@ HEADERS += \
 	$$PWD/include/ev3Kit/blocks/ev3BlocksFactory.h \
 	$$PWD/include/ev3Kit/communication/commandConstants.h \
 	$$PWD/include/ev3Kit/communication/ev3DirectCommand.h \
+	$$PWD/include/ev3Kit/communication/ev3DirectCommandBatch.h \
 	$$PWD/include/ev3Kit/communication/ev3RobotCommunicationThread.h \
 	$$PWD/include/ev3Kit/communication/bluetoothRobotCommunicationThread.h \
 	$$PWD/include/ev3Kit/communication/usbRobotCommunicationThread.h \
@@ -98,6 +99,7 @@ SOURCES += \
 	$$PWD/src/blocks/details/ledBlock.cpp \
 	$$PWD/src/blocks/details/ev3ReadRGBBlock.cpp \
 	$$PWD/src/communication/ev3DirectCommand.cpp \
+	$$PWD/src/communication/ev3DirectCommandBatch.cpp \
 	$$PWD/src/communication/ev3RobotCommunicationThread.cpp \
 	$$PWD/src/communication/bluetoothRobotCommunicationThread.cpp \
 	$$PWD/src/communication/hidapi.c \
@@ -0,0 +1,74 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <functional>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QVector>
+
+namespace ev3 {
+namespace communication {
+
+/// Merges several requests that return data in global variables into one direct command with reply.
+/// Each request gets its own 4-byte aligned area of global variables, so the brick answers all of them
+/// in one reply. The reply is then split back into responses having exactly the same layout as responses
+/// to the requests sent separately: 5 bytes of reply header followed by global variables of the request.
+class Ev3DirectCommandBatch
+{
+public:
+	/// Writes opcodes of a request into a command starting from the given index and advances the index.
+	/// Results must be stored in global variables starting from the given offset.
+	using Writer = std::function<void(QByteArray &command, int &index, quint8 globalOffset)>;
+
+	/// Adds a request to the batch.
+	/// @param bodySize Number of bytes written by the writer.
+	/// @param globalSize Number of bytes of global variables the request returns.
+	/// @returns index of the request in the batch or -1 if it does not fit, in that case the batch must be sent
+	/// and the request shall be added to a new batch.
+	int add(int bodySize, int globalSize, const Writer &writer);
+
+	/// Returns true if no requests were added.
+	bool isEmpty() const;
+
+	/// Returns the number of requests in the batch.
+	int size() const;
+
+	/// Forms direct command with all added requests.
+	QByteArray command(int messageCounter) const;
+
+	/// Returns size of reply to command().
+	int responseSize() const;
+
+	/// Extracts a response to the request with the given index from a reply to command().
+	/// @returns empty array if the reply is incomplete or reports an error.
+	QByteArray response(int request, const QByteArray &reply) const;
+
+private:
+	struct Request
+	{
+		int bodySize;
+		int globalOffset;
+		int globalSize;
+		Writer writer;
+	};
+
+	QVector<Request> mRequests;
+	int mBodySize = 0;
+	int mGlobalSize = 0;
+};
+
+}
+}
@@ -46,11 +46,28 @@ protected:
 	/// Must be reimplemented in each thread just to recieve the buffer of the given size.
 	virtual QByteArray receive(int size) const = 0;
 
-	/// Forth running counter.
-	quint16 mMessageCounter {0};
+	/// Returns how many commands may wait for replies at once during file upload.
+	virtual int uploadWindow() const;
+
+	/// Sends commands with reply keeping at most \a window of them unanswered. Message counters of commands
+	/// are replaced with unique ones and replies are matched to commands by counter, so the brick may answer
+	/// in any order; replies with unknown counters (for example, late replies to keep-alive requests) are dropped.
+	/// No more commands are sent after a reply reporting an error, but replies to already sent ones are awaited.
+	/// @returns replies in order of commands, a reply is empty if the command was not sent or was not answered.
+	QList<QByteArray> transmit(const QList<QByteArray> &commands, int responseSize, int window);
+
+	/// Sends one command with reply and returns a reply to it or empty array if it was not received.
+	QByteArray exchange(const QByteArray &command, int responseSize);
+
+	/// Returns next value of message counter, all commands except Bluetooth keep-alive shall take it from here.
+	quint16 nextMessageCounter();
 
 	/// Maximum filename length to upload to EV3
 	static const int EV3_MAX_ALLOWED_FILENAME_LENGTH = 27;
+
+private:
+	/// Forth running counter.
+	quint16 mMessageCounter {0};
 };
 
 template<typename T> char charOf(T x)
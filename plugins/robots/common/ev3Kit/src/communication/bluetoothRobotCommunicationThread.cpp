@@ -49,14 +49,14 @@ bool BluetoothRobotCommunicationThread::send(QObject *addressee, const QByteArra
 		return false;
 	}
 
-	const bool result = send1(buffer);
 	if (buffer.size() >= 5 && buffer[4] == enums::commandType::CommandTypeEnum::DIRECT_COMMAND_REPLY) {
-		QByteArray const result = receive(responseSize);
+		const QByteArray result = exchange(buffer, responseSize);
 		emit response(addressee, result);
-	} else {
-		emit response(addressee, QByteArray());
+		return !result.isEmpty();
 	}
 
+	const bool result = send1(buffer);
+	emit response(addressee, QByteArray());
 	return result;
 }
 
@@ -111,9 +111,8 @@ void BluetoothRobotCommunicationThread::allowLongJobs(bool allow)
 
 bool BluetoothRobotCommunicationThread::send(const QByteArray &buffer, int responseSize, QByteArray &outputBuffer)
 {
-	const bool result = send1(buffer);
-	outputBuffer = receive(responseSize);
-	return result;
+	outputBuffer = exchange(buffer, responseSize);
+	return !outputBuffer.isEmpty();
 }
 
 bool BluetoothRobotCommunicationThread::send1(const QByteArray &buffer) const
@@ -0,0 +1,89 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "ev3Kit/communication/ev3DirectCommandBatch.h"
+
+#include "ev3Kit/communication/commandConstants.h"
+#include "ev3Kit/communication/ev3DirectCommand.h"
+
+using namespace ev3;
+using namespace ev3::communication;
+
+/// Size of direct command header: length, message counter, command type and sizes of variables.
+static const int commandHeaderSize = 7;
+
+/// Size of reply header: length, message counter and reply type.
+static const int replyHeaderSize = 5;
+
+/// Global variables are addressed with one-byte offsets.
+static const int maxGlobalSize = 256;
+
+/// The whole command must fit into one USB HID report.
+static const int maxCommandSize = 1000;
+
+int Ev3DirectCommandBatch::add(int bodySize, int globalSize, const Writer &writer)
+{
+	const int globalOffset = (mGlobalSize + 3) / 4 * 4;
+	if (!mRequests.isEmpty() && (globalOffset + globalSize > maxGlobalSize
+			|| commandHeaderSize + mBodySize + bodySize > maxCommandSize)) {
+		return -1;
+	}
+
+	mRequests << Request{bodySize, globalOffset, globalSize, writer};
+	mBodySize += bodySize;
+	mGlobalSize = globalOffset + globalSize;
+	return mRequests.size() - 1;
+}
+
+bool Ev3DirectCommandBatch::isEmpty() const
+{
+	return mRequests.isEmpty();
+}
+
+int Ev3DirectCommandBatch::size() const
+{
+	return mRequests.size();
+}
+
+QByteArray Ev3DirectCommandBatch::command(int messageCounter) const
+{
+	QByteArray command = Ev3DirectCommand::formCommand(commandHeaderSize + mBodySize, messageCounter
+			, static_cast<ushort>(mGlobalSize), 0, enums::commandType::CommandTypeEnum::DIRECT_COMMAND_REPLY);
+	int index = commandHeaderSize;
+	for (const Request &request : mRequests) {
+		request.writer(command, index, static_cast<quint8>(request.globalOffset));
+	}
+
+	return command;
+}
+
+int Ev3DirectCommandBatch::responseSize() const
+{
+	return replyHeaderSize + mGlobalSize;
+}
+
+QByteArray Ev3DirectCommandBatch::response(int request, const QByteArray &reply) const
+{
+	if (reply.size() < responseSize()
+			|| static_cast<uchar>(reply[4]) != enums::replyType::ReplyTypeEnum::DIRECT_REPLY) {
+		return QByteArray();
+	}
+
+	const Request &target = mRequests[request];
+	QByteArray result = reply.left(replyHeaderSize);
+	result[0] = static_cast<char>((replyHeaderSize - 2 + target.globalSize) & 0xFF);
+	result[1] = static_cast<char>(((replyHeaderSize - 2 + target.globalSize) >> 8) & 0xFF);
+	result.append(reply.mid(replyHeaderSize + target.globalOffset, target.globalSize));
+	return result;
+}
@@ -15,6 +15,7 @@
 #include "ev3Kit/communication/ev3RobotCommunicationThread.h"
 
 #include <QtCore/QFileInfo>
+#include <QtCore/QHash>
 
 #include "ev3Kit/communication/commandConstants.h"
 #include "ev3Kit/communication/ev3DirectCommand.h"
@@ -32,6 +33,8 @@ static constexpr uchar EV3_BEGIN_DOWNLOAD_RESPONSE_SIZE =     8;
 static constexpr uchar EV3_CONTINUE_DOWNLOAD_RESPONSE_SIZE =  8;
 static constexpr uchar EV3_SYSTEM_COMMAND_REPLY_SUCCESS =  0x00;
 static constexpr uchar EV3_CONTINUE_DOWNLAD_STATUS_EOF =      0x08;
+static constexpr int EV3_UPLOAD_WINDOW =                      4;       //  Chunks sent before awaiting replies
+static constexpr int EV3_MAX_STRAY_REPLIES =                  16;      //  Unmatched replies tolerated per transfer
 
 using namespace ev3::communication;
 
@@ -44,6 +47,29 @@ static inline QString char2hex (char c)
 	return QString("0x%1").arg(static_cast<uint8_t>(c), 2, 16, QLatin1Char('0'));
 }
 
+static inline quint16 messageCounterOf(const QByteArray &message)
+{
+	return static_cast<quint16>(static_cast<uchar>(message.at(2)) | (static_cast<uchar>(message.at(3)) << 8));
+}
+
+static inline bool isErrorReply(const QByteArray &reply)
+{
+	return reply.size() >= 5 && (static_cast<uchar>(reply.at(4)) == EV3_SYSTEM_REPLY_ERROR
+			|| static_cast<uchar>(reply.at(4)) == ev3::enums::replyType::ReplyTypeEnum::DIRECT_NO_REPLY);
+}
+
+static void logErrorReply(const QByteArray &reply)
+{
+	const QByteArray padded = reply.leftJustified(7, '\0');
+	QLOG_ERROR() << "EV3USB"
+			<< "Reply to cmd" << char2hex(padded.at(5))
+			<< "msg#" << messageCounterOf(padded)
+			<< "status" << char2hex(padded.at(6));
+	if (reply.size() > 7) {
+		QLOG_INFO() << "EV3USB" << "Reply additional:" << reply.right(reply.size() - 7).toHex();
+	}
+}
+
 QString Ev3RobotCommunicationThread::uploadFile(const QString &sourceFile, const QString &targetDir)
 {
 	const QFileInfo fileInfo(sourceFile);
@@ -94,8 +120,6 @@ QString Ev3RobotCommunicationThread::uploadFile(const QString &sourceFile, const
 	QByteArray commandBegin(cmdBeginSize, 0);
 	commandBegin[0] = charOf(cmdBeginSize - 2);
 	commandBegin[1] = charOf((cmdBeginSize - 2) >> 8) ;
-	commandBegin[2] = charOf(++mMessageCounter);
-	commandBegin[3] = charOf(mMessageCounter >> 8);
 	commandBegin[4] = charOf(EV3_SYSTEM_COMMAND_REPLY);
 	commandBegin[5] = charOf(EV3_BEGIN_DOWNLOAD);
 	commandBegin[6] = charOf(data.size());
@@ -109,61 +133,44 @@ QString Ev3RobotCommunicationThread::uploadFile(const QString &sourceFile, const
 
 	commandBegin[index] = 0x00;
 
-	if (!send1(commandBegin)) {
+	const QByteArray commandBeginResponse = exchange(commandBegin, EV3_BEGIN_DOWNLOAD_RESPONSE_SIZE);
+	if (commandBeginResponse.size() < EV3_BEGIN_DOWNLOAD_RESPONSE_SIZE) {
 		QLOG_ERROR() << "EV3USB" << "Failed to start program upload to robot";
 		return QString();
 	}
 
-	QByteArray commandBeginResponse = receive(EV3_BEGIN_DOWNLOAD_RESPONSE_SIZE);
-
-	if (commandBeginResponse.at(4) == EV3_SYSTEM_REPLY_ERROR) {
-		QLOG_ERROR() << "EV3USB"
-						<< "Reply to cmd" << char2hex(commandBeginResponse.at(5))
-						<< "msg#" << (static_cast<uint32_t>(commandBeginResponse.at(3)) << 8)
-										+ static_cast<uint32_t>(static_cast<uint8_t>(commandBeginResponse.at(2)))
-						<< "status" << char2hex(commandBeginResponse.at(6));
-		if (commandBeginResponse.size() > 7) {
-			QLOG_INFO() << "EV3USB" << "Reply additional:"
-						<< commandBeginResponse.right(commandBeginResponse.size()-7).toHex();
-		}
-
+	if (isErrorReply(commandBeginResponse)) {
+		logErrorReply(commandBeginResponse);
 		return QString();
 	}
 
-	char handle = commandBeginResponse.at(7);
-	int sizeSent = 0;
-	while (sizeSent < data.size()) {
+	const char handle = commandBeginResponse.at(7);
+	QList<QByteArray> commandsContinue;
+	for (int sizeSent = 0; sizeSent < data.size(); sizeSent += chunkSize) {
 		const int sizeToSend = qMin(chunkSize, data.size() - sizeSent);
 		const int cmdContinueSize = 7 + sizeToSend;
-		QByteArray commandContinue(cmdContinueSize, 0);
+		QByteArray commandContinue(7, 0);
 		commandContinue[0] = charOf(cmdContinueSize - 2);
 		commandContinue[1] = charOf((cmdContinueSize - 2) >> 8);
-		commandContinue[2] = charOf(++mMessageCounter);
-		commandContinue[3] = charOf(mMessageCounter >> 8);
 		commandContinue[4] = charOf(EV3_SYSTEM_COMMAND_REPLY);
 		commandContinue[5] = charOf(EV3_CONTINUE_DOWNLOAD);
 		commandContinue[6] = handle;
-		for (int i = 0; i < sizeToSend; ++i) {
-			commandContinue[7 + i] = data.at(sizeSent++);
-		}
+		commandContinue.append(data.constData() + sizeSent, sizeToSend);
+		commandsContinue << commandContinue;
+	}
 
-		if (!send1(commandContinue)) {
+	// Chunks are pipelined: the next ones are sent while the brick is still writing the previous ones.
+	const QList<QByteArray> responses
+			= transmit(commandsContinue, EV3_CONTINUE_DOWNLOAD_RESPONSE_SIZE, uploadWindow());
+	for (int i = 0; i < responses.size(); ++i) {
+		if (responses[i].size() < EV3_CONTINUE_DOWNLOAD_RESPONSE_SIZE) {
 			QLOG_ERROR() << "EV3USB" << QString("Failed to send program data to robot bytes %1..%2")
-					.arg(sizeSent-sizeToSend).arg(sizeSent-1);
+					.arg(i * chunkSize).arg(qMin(data.size(), (i + 1) * chunkSize) - 1);
 			return QString();
 		}
 
-		QByteArray commandContinueResponse = receive(EV3_CONTINUE_DOWNLOAD_RESPONSE_SIZE);
-		if (commandContinueResponse.at(4) == EV3_SYSTEM_REPLY_ERROR) {
-			QLOG_ERROR() << "EV3USB"
-							<< "Reply to cmd" << char2hex(commandContinueResponse.at(5))
-							<< "msg#" << (static_cast<uint32_t>(commandContinueResponse.at(3)) << 8)
-							   + static_cast<uint32_t>(static_cast<uint8_t>(commandContinueResponse.at(2)))
-							<< "status" << char2hex(commandContinueResponse.at(6));
-			if (commandContinueResponse.size() > 7) {
-				QLOG_INFO() << "EV3USB" << "Reply additional:"
-							<< commandContinueResponse.right(commandContinueResponse.size()-7).toHex();
-			}
+		if (isErrorReply(responses[i])) {
+			logErrorReply(responses[i]);
 			return QString();
 		}
 	}
@@ -172,9 +179,86 @@ QString Ev3RobotCommunicationThread::uploadFile(const QString &sourceFile, const
 	return devicePath;
 }
 
+int Ev3RobotCommunicationThread::uploadWindow() const
+{
+	return EV3_UPLOAD_WINDOW;
+}
+
+QList<QByteArray> Ev3RobotCommunicationThread::transmit(const QList<QByteArray> &commands, int responseSize
+		, int window)
+{
+	QList<QByteArray> replies;
+	replies.reserve(commands.size());
+	for (int i = 0; i < commands.size(); ++i) {
+		replies << QByteArray();
+	}
+
+	QHash<quint16, int> pending;
+	int nextToSend = 0;
+	int strayReplies = 0;
+	bool failed = false;
+	while (!pending.isEmpty() || (!failed && nextToSend < commands.size())) {
+		while (!failed && nextToSend < commands.size() && pending.size() < qMax(1, window)) {
+			QByteArray command = commands[nextToSend];
+			const quint16 counter = nextMessageCounter();
+			command[2] = charOf(counter);
+			command[3] = charOf(counter >> 8);
+			if (!send1(command)) {
+				failed = true;
+				break;
+			}
+
+			pending.insert(counter, nextToSend);
+			++nextToSend;
+		}
+
+		if (pending.isEmpty()) {
+			break;
+		}
+
+		const QByteArray reply = receive(responseSize);
+		if (reply.size() < 5) {
+			QLOG_ERROR() << "EV3USB" << "No reply from robot," << pending.size() << "commands left unanswered";
+			break;
+		}
+
+		const auto command = pending.find(messageCounterOf(reply));
+		if (command == pending.end()) {
+			QLOG_WARN() << "EV3USB" << "Dropped reply to unknown message" << messageCounterOf(reply);
+			if (++strayReplies > EV3_MAX_STRAY_REPLIES) {
+				break;
+			}
+
+			continue;
+		}
+
+		replies[command.value()] = reply;
+		failed = failed || isErrorReply(reply);
+		pending.erase(command);
+	}
+
+	return replies;
+}
+
+QByteArray Ev3RobotCommunicationThread::exchange(const QByteArray &command, int responseSize)
+{
+	return transmit({command}, responseSize, 1).first();
+}
+
+quint16 Ev3RobotCommunicationThread::nextMessageCounter()
+{
+	// Zero is reserved for Bluetooth keep-alive requests, which are sent with a fixed counter and answered by
+	// the brick, so their replies must never be taken for replies to other commands.
+	if (++mMessageCounter == 0) {
+		++mMessageCounter;
+	}
+
+	return mMessageCounter;
+}
+
 bool Ev3RobotCommunicationThread::runProgram(const QString &pathOnRobot)
 {
-	QByteArray command = Ev3DirectCommand::formCommand(21 + pathOnRobot.size(), ++mMessageCounter, 0x08, 0
+	QByteArray command = Ev3DirectCommand::formCommand(21 + pathOnRobot.size(), nextMessageCounter(), 0x08, 0
 			, enums::commandType::CommandTypeEnum::DIRECT_COMMAND_NO_REPLY);
 	int index = 7;
 	command[index++] = charOf(0xC0);  // opFILE            Opcode file related
@@ -207,7 +291,7 @@ bool Ev3RobotCommunicationThread::runProgram(const QString &pathOnRobot)
 
 void Ev3RobotCommunicationThread::stopProgram()
 {
-	QByteArray command = Ev3DirectCommand::formCommand(9, ++mMessageCounter, 0, 0
+	QByteArray command = Ev3DirectCommand::formCommand(9, nextMessageCounter(), 0, 0
 			, enums::commandType::CommandTypeEnum::DIRECT_COMMAND_NO_REPLY);
 	command[7] = 0x02;  // opPROGRAM_STOP Opcode
 	command[8] = 0x01;  // LC0(USER_SLOT), User slot = 1 (program slot)
@@ -56,14 +56,14 @@ bool UsbRobotCommunicationThread::send(QObject *addressee, const QByteArray &buf
 		return false;
 	}
 
-	const bool result = send1(buffer);
 	if (buffer.size() >= 5 && buffer[4] == enums::commandType::CommandTypeEnum::DIRECT_COMMAND_REPLY) {
-		const QByteArray result = receive(responseSize);
+		const QByteArray result = exchange(buffer, responseSize);
 		emit response(addressee, result);
-	} else {
-		emit response(addressee, QByteArray());
+		return !result.isEmpty();
 	}
 
+	const bool result = send1(buffer);
+	emit response(addressee, QByteArray());
 	return result;
 }
 
@@ -139,8 +139,9 @@ void UsbRobotCommunicationThread::checkForConnection()
 	command.resize(10);
 	command[0] = 8;
 	command[1] = 0;
-	command[2] = charOf(++mMessageCounter);
-	command[3] = charOf(mMessageCounter >> 8);
+	const quint16 counter = nextMessageCounter();
+	command[2] = charOf(counter);
+	command[3] = charOf(counter >> 8);
 	command[4] = charOf(enums::commandType::CommandTypeEnum::DIRECT_COMMAND_NO_REPLY);
 	command[5] = 0;
 	command[6] = 0;
@@ -156,10 +157,8 @@ void UsbRobotCommunicationThread::checkForConnection()
 
 bool UsbRobotCommunicationThread::send(const QByteArray &buffer, int responseSize, QByteArray &outputBuffer)
 {
-	auto ok = send1(buffer);
-	if (ok)
-		outputBuffer = receive(responseSize);
-	return ok;
+	outputBuffer = exchange(buffer, responseSize);
+	return !outputBuffer.isEmpty();
 }
 
 bool UsbRobotCommunicationThread::send1(const QByteArray &buf) const
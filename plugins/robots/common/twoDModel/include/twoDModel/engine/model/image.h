@@ -18,18 +18,19 @@
 #include <QtCore/QString>
 #include <QtCore/QRect>
 
+#include <qrutils/blobStore.h>
 #include <qrutils/imagesCache.h>
 
 class QDomElement;
 class QSvgRenderer;
-class QImage;
 class QPainter;
 
 namespace twoDModel {
 namespace model {
 
 /// Represents external or internal image. External image is a path to image file, internal image -- memorized
-/// image bytes.
+/// image bytes. Raster images are kept encoded in the blob store, so identical pictures share memory and pixels
+/// are decoded only when drawn, at the resolution they are drawn with.
 class Image
 {
 	Q_DISABLE_COPY(Image)
@@ -75,10 +76,11 @@ private:
 	bool mIsSvg { false };
 	QString mPath;
 	QString mImageId;
-	QScopedPointer<QImage> mImage;
+	QSharedPointer<const utils::Blob> mBlob;
 	QByteArray mSvgBytes;
 	QScopedPointer<QSvgRenderer> mSvgRenderer;
 	const QSharedPointer<utils::ImagesCache> mImagesCache;
+	const QSharedPointer<utils::BlobStore> mBlobStore;
 };
 
 }
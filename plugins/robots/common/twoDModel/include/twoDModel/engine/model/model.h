@@ -88,6 +88,19 @@ public:
 	/// Activates or deactivates constraints checker.
 	void setConstraintsEnabled(bool enabled);
 
+	/// Captures the complete state of running simulation in binary form: model time, positions of movable items,
+	/// robot trace, robots with their motors and encoders, physics engines state and constraints checker state.
+	/// Scene layout, robot configuration and checker program are not included, the snapshot can be restored only
+	/// into this model or into a model with the same world, robots and constraints.
+	/// @note Realistic physics engine is rebuilt when saving (see PhysicsEngineBase::saveState()), so simulation
+	/// continued after this call and simulation continued after restoreSnapshot() go exactly the same.
+	QByteArray saveSnapshot();
+
+	/// Restores the state captured by saveSnapshot(). Must be called between timeline ticks.
+	/// Returns false if the snapshot is corrupted or does not match this model, the state may be partially
+	/// restored in that case.
+	bool restoreSnapshot(const QByteArray &snapshot);
+
 signals:
 	/// Emitted each time when some user actions lead to world model modifications
 	/// @param xml World model description in xml format
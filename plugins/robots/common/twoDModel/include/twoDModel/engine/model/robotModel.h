@@ -26,6 +26,7 @@
 #include "twoDModel/twoDModelDeclSpec.h"
 
 class QGraphicsItem;
+class QDataStream;
 
 namespace twoDModel {
 
@@ -116,6 +117,12 @@ public:
 	QDomElement serialize(QDomElement &parent) const;
 	void deserialize(const QDomElement &robotElement);
 
+	/// Writes the dynamic state of the robot (position, motors, encoders, inertial sensors history) into \a stream.
+	void saveState(QDataStream &stream) const;
+
+	/// Restores the state written by saveState(). Motors missing in current configuration are skipped.
+	void restoreState(QDataStream &stream);
+
 	void onRobotLiftedFromGround();
 	void onRobotReturnedOnGround();
 
@@ -29,6 +29,15 @@ class TWO_D_MODEL_EXPORT Settings : public QObject
 	Q_OBJECT
 
 public:
+	/// Default number of physics engine steps per one timeline tick.
+	static const int defaultPhysicsSubSteps = 1;
+
+	/// Default number of velocity iterations of physics engine constraints solver.
+	static const int defaultVelocityIterations = 10;
+
+	/// Default number of position iterations of physics engine constraints solver.
+	static const int defaultPositionIterations = 6;
+
 	Settings() = default;
 
 	/// Returns true is user selected realistic physical engine.
@@ -40,6 +49,15 @@ public:
 	/// Returns true is user wants to add some noise to motors work.
 	bool realisticMotors() const;
 
+	/// Returns the number of equal steps realistic physics makes per one timeline tick.
+	int physicsSubSteps() const;
+
+	/// Returns the number of velocity iterations realistic physics solver makes per step.
+	int velocityIterations() const;
+
+	/// Returns the number of position iterations realistic physics solver makes per step.
+	int positionIterations() const;
+
 	void serialize(QDomElement &parent) const;
 
 	void deserialize(const QDomElement &parent);
@@ -50,14 +68,23 @@ public:
 
 	void setRealisticMotors(bool set);
 
+	/// Sets parameters of realistic physics integration, values less than 1 are replaced with 1.
+	void setPhysicsStepParameters(int subSteps, int velocityIterations, int positionIterations);
+
 signals:
 	/// Emitted each time when user modifies physical preferences.
 	void physicsChanged(bool isRealistic);
 
+	/// Emitted when parameters of realistic physics integration are modified.
+	void physicsStepChanged();
+
 private:
 	bool mRealisticPhysics { false };
 	bool mRealisticSensors { false };
 	bool mRealisticMotors { false };
+	int mPhysicsSubSteps { defaultPhysicsSubSteps };
+	int mVelocityIterations { defaultVelocityIterations };
+	int mPositionIterations { defaultPositionIterations };
 };
 
 }
@@ -22,6 +22,8 @@
 #include "constants.h"
 #include "twoDModel/twoDModelDeclSpec.h"
 
+class QDataStream;
+
 namespace twoDModel {
 namespace model {
 
@@ -53,6 +55,12 @@ public:
 	/// Thus the immediate process modeling may be performed in background.
 	void setImmediateMode(bool immediateMode);
 
+	/// Writes model time into \a stream.
+	void saveState(QDataStream &stream) const;
+
+	/// Restores model time written by saveState(). Timers produced by this timeline are not affected.
+	void restoreState(QDataStream &stream);
+
 public slots:
 	void start();
 	void stop(qReal::interpretation::StopReason reason);
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <QtCore/QHash>
 #include <QtCore/QPoint>
 #include <QtCore/QList>
 #include <QtCore/QPair>
@@ -26,11 +27,16 @@
 #include "twoDModel/twoDModelDeclSpec.h"
 
 class QGraphicsItem;
+class QDataStream;
 
 namespace qReal {
 class ErrorReporterInterface;
 }
 
+namespace graphicsUtils {
+class AbstractItem;
+}
+
 namespace twoDModel {
 namespace items {
 class WallItem;
@@ -129,6 +135,13 @@ public:
 	/// Removes all the segments from the current robot`s trace.
 	void clearRobotTrace();
 
+	/// Writes the part of the world that changes during simulation into \a stream: positions of movable items
+	/// and robot trace. Layout of the world is not written, restoreState() expects the same items present.
+	void saveState(QDataStream &stream) const;
+
+	/// Restores the state written by saveState(). Items missing in the world are skipped.
+	void restoreState(QDataStream &stream);
+
 	/// Saves world to XML.
 	QDomElement serializeWorld(QDomElement &parent) const;
 
@@ -227,6 +240,12 @@ private:
 	QPainterPath buildSolidItemsPath() const;
 
 	void serializeBackground(QDomElement &background, const QRect &rect, const Image * const img) const;
+
+	/// Forgets serialized form of \a item each time it changes, so only changed items are serialized again.
+	void trackChanges(graphicsUtils::AbstractItem &item);
+
+	/// Appends serialized \a item to \a parent, serializes it only if it changed since the last time.
+	void serializeTrackedItem(const graphicsUtils::AbstractItem &item, QDomElement &parent) const;
 	QRectF deserializeRect(const QString &string) const;
 
 	QMap<QString, QSharedPointer<items::WallItem>> mWalls;
@@ -240,6 +259,15 @@ private:
 	QList<QSharedPointer<QGraphicsPathItem>> mRobotTrace;
 	QRect mBackgroundRect;
 	QScopedPointer<QDomDocument> mXmlFactory;
+
+	/// Serialized images by image ids. Encoding an embedded image is expensive, so each one is encoded once
+	/// and re-encoded only after it changes.
+	mutable QHash<QString, QDomElement> mSerializedImages;
+
+	/// Serialized walls, skittles, balls and color fields by item ids. An entry is dropped when its item reports
+	/// a change, so dragging one wall does not serialize the whole world again.
+	mutable QHash<QString, QDomElement> mSerializedItems;
+
 	qReal::ErrorReporterInterface *mErrorReporter;  // Doesn`t take ownership.
 };
 
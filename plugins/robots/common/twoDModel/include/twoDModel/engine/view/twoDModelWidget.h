@@ -15,6 +15,7 @@
 #pragma once
 
 #include <QtCore/QSignalMapper>
+#include <QtCore/QTimer>
 #include <QtWidgets/QButtonGroup>
 #include <QtWidgets/QGraphicsView>
 
@@ -109,6 +110,9 @@ public:
 	QDomDocument generateWorldModelXml() const;
 	QDomDocument generateBlobsXml() const;
 
+	/// Immediately writes postponed world model and blobs changes to the repository.
+	void flushChangesToRepo();
+
 public slots:
 	void zoomIn() override;
 	void zoomOut() override;
@@ -263,6 +267,14 @@ private:
 	bool mRobotPositionReadOnly {};
 
 	bool mBackgroundMode {false};
+
+	/// Postpones saving to the repository, so a burst of changes is serialized once.
+	QTimer mSaveTimer;
+	bool mWorldModelSavePending {};
+	bool mBlobsSavePending {};
+
+	/// True while mouse button is pressed on the scene, nothing is saved until user finishes editing.
+	bool mSceneInteraction {};
 };
 
 }
@@ -14,6 +14,8 @@
 
 #include "constraintsChecker.h"
 
+#include <QtCore/QDataStream>
+
 #include <qrutils/stringUtils.h>
 #include <qrgui/plugins/toolPluginInterface/usedInterfaces/errorReporterInterface.h>
 #include <utils/objectsSet.h>
@@ -105,6 +107,35 @@ void ConstraintsChecker::setEnabled(bool enabled)
 	mEnabled = enabled;
 }
 
+void ConstraintsChecker::saveState(QDataStream &stream) const
+{
+	stream << mEvents.keys() << mVariables << mSuccessTriggered << mDefferedSuccessTriggered << mFailTriggered;
+	for (const QSharedPointer<details::Event> &event : mEvents) {
+		event->saveState(stream);
+	}
+}
+
+bool ConstraintsChecker::restoreState(QDataStream &stream)
+{
+	QStringList eventIds;
+	stream >> eventIds;
+	if (eventIds != mEvents.keys()) {
+		return false;
+	}
+
+	stream >> mVariables >> mSuccessTriggered >> mDefferedSuccessTriggered >> mFailTriggered;
+	mActiveEvents.clear();
+	for (const QSharedPointer<details::Event> &event : mEvents) {
+		event->restoreState(stream);
+		if (event->isAlive()) {
+			mActiveEvents << event.data();
+		}
+	}
+
+	sortActiveEvents();
+	return stream.status() == QDataStream::Ok;
+}
+
 void ConstraintsChecker::reportParserError(const QString &message)
 {
 	const QString fullMessage = tr("Error while parsing constraints: %1").arg(message);
@@ -125,6 +156,11 @@ void ConstraintsChecker::prepareEvents()
 		}
 	}
 
+	sortActiveEvents();
+}
+
+void ConstraintsChecker::sortActiveEvents()
+{
 	std::sort(mActiveEvents.begin(), mActiveEvents.end()
 			, [](const details::Event *e1, const details::Event *e2) { return e1->id() > e2->id(); });
 }
@@ -137,8 +173,7 @@ void ConstraintsChecker::setUpEvent()
 		}
 	}
 
-	std::sort(mActiveEvents.begin(), mActiveEvents.end()
-			, [](const details::Event *e1, const details::Event *e2) { return e1->id() > e2->id(); });
+	sortActiveEvents();
 }
 
 void ConstraintsChecker::dropEvent()
@@ -76,6 +76,13 @@ public:
 	/// Enables or disables checker. Checker will be still disabled if true passed here but constraints list is empty.
 	void setEnabled(bool enabled);
 
+	/// Writes the state of running checker program (events aliveness, timers, variables and verdict flags)
+	/// into \a stream. Checker program itself is not written, restoreState() expects the same program parsed.
+	void saveState(QDataStream &stream) const;
+
+	/// Restores the state written by saveState(). Returns false if the state belongs to another checker program.
+	bool restoreState(QDataStream &stream);
+
 signals:
 	/// Emitted when program execution meets <success/> trigger. That means that robot successfully accomplished its
 	/// task without violation any constraint.
@@ -92,6 +99,7 @@ private:
 	void reportParserError(const QString &message);
 
 	void prepareEvents();
+	void sortActiveEvents();
 
 	void setUpEvent();
 	void dropEvent();
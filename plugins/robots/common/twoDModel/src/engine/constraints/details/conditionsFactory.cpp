@@ -14,8 +14,6 @@
 
 #include "conditionsFactory.h"
 
-#include <QtCore/QSharedPointer>
-
 #include <qrutils/mathUtils/geometry.h>
 
 #include "event.h"
@@ -192,16 +190,15 @@ Condition ConditionsFactory::dropped(const QString &eventId) const
 
 Condition ConditionsFactory::timerCondition(int timeout, bool forceDrop, const Value &timestamp, Event &event) const
 {
-	// We must remember somewhere timestamp when parent event was setted up.
-	// We can do this in the event itself, by why? There will be no need in it except here, so storing it in heap...
-	QSharedPointer<qint64> lastSetUpTimestamp(new qint64(-1));
-
-	QObject::connect(&event, &Event::settedUp, [lastSetUpTimestamp, timestamp]() {
-		*lastSetUpTimestamp = timestamp().toLongLong();
+	// Timestamp when parent event was setted up is stored in the event itself, so it is a part of its state
+	// and can be saved and restored with it.
+	QObject::connect(&event, &Event::settedUp, [&event, timestamp]() {
+		event.setSetUpTimestamp(timestamp().toLongLong());
 	});
 
-	return [timeout, forceDrop, timestamp, &event, lastSetUpTimestamp]() {
-		const bool timeElapsed = *lastSetUpTimestamp >= 0 && timestamp().toLongLong() - *lastSetUpTimestamp >= timeout;
+	return [timeout, forceDrop, timestamp, &event]() {
+		const qint64 lastSetUpTimestamp = event.setUpTimestamp();
+		const bool timeElapsed = lastSetUpTimestamp >= 0 && timestamp().toLongLong() - lastSetUpTimestamp >= timeout;
 		if (timeElapsed && forceDrop) {
 			// Someone may think that dropping here will not let the event fire even if all conditions are satisfied.
 			// But we get into this lambda after checking this event`s aliveness, so it will fire (but after drop).
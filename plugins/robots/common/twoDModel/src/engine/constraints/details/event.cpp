@@ -14,6 +14,8 @@
 
 #include "event.h"
 
+#include <QtCore/QDataStream>
+
 using namespace twoDModel::constraints::details;
 
 Event::Event(const QString &id
@@ -74,3 +76,23 @@ void Event::setCondition(const Condition &condition)
 {
 	mCondition = condition;
 }
+
+qint64 Event::setUpTimestamp() const
+{
+	return mSetUpTimestamp;
+}
+
+void Event::setSetUpTimestamp(qint64 timestamp)
+{
+	mSetUpTimestamp = timestamp;
+}
+
+void Event::saveState(QDataStream &stream) const
+{
+	stream << mIsAlive << mSetUpTimestamp;
+}
+
+void Event::restoreState(QDataStream &stream)
+{
+	stream >> mIsAlive >> mSetUpTimestamp;
+}
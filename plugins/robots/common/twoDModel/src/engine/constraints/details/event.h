@@ -16,6 +16,8 @@
 
 #include "defines.h"
 
+class QDataStream;
+
 namespace twoDModel {
 namespace constraints {
 namespace details {
@@ -67,6 +69,19 @@ public:
 	/// (like in case of "timer" condition).
 	void setCondition(const Condition &condition);
 
+	/// Returns model timestamp of the last setting up of this event or -1 if it was not memorized.
+	/// Used by "timer" condition.
+	qint64 setUpTimestamp() const;
+
+	/// Memorizes model timestamp of the last setting up of this event.
+	void setSetUpTimestamp(qint64 timestamp);
+
+	/// Writes aliveness and set up timestamp of this event into \a stream.
+	void saveState(QDataStream &stream) const;
+
+	/// Restores state written by saveState() without emitting settedUp() or dropped() signals.
+	void restoreState(QDataStream &stream);
+
 signals:
 	/// Emitted when this event was setted up by someone even if event was already alive.
 	void settedUp();
@@ -85,6 +100,7 @@ private:
 	const Trigger mTrigger;
 	bool mDropsOnFire;
 	const bool mIsSettedInitially;
+	qint64 mSetUpTimestamp = -1;
 };
 
 }
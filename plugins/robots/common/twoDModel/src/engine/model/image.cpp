@@ -29,12 +29,14 @@
 using namespace twoDModel::model;
 
 const quint64 maxSvgSize = 1000;
+const QByteArray pngSignature("\x89PNG\r\n\x1a\n");
 
 Image::~Image() = default;
 
 Image::Image(const QString &id)
 	: mImageId(id)
 	, mImagesCache(utils::ImagesCache::instance())
+	, mBlobStore(utils::BlobStore::instance())
 {
 }
 
@@ -42,6 +44,7 @@ Image::Image(const QString &path, bool memorize)
 	: mExternal(!memorize)
 	, mImageId(QUuid::createUuid().toString())
 	, mImagesCache(utils::ImagesCache::instance())
+	, mBlobStore(utils::BlobStore::instance())
 {
 	loadFrom(path);
 }
@@ -62,13 +65,11 @@ QSharedPointer<Image> Image::deserialize(const QDomElement &element)
 			image->mSvgBytes = std::move(content);
 			image->mSvgRenderer.reset(new QSvgRenderer(image->mSvgBytes));
 		} else {
-			auto bytes = QByteArray::fromBase64(content);
-			QBuffer buffer(&bytes);
-			QImage tempImage;
-			if (!tempImage.load(&buffer, "PNG")) {
+			// Pixels are not decoded here, only when the image is drawn for the first time.
+			image->mBlob = image->mBlobStore->put(QByteArray::fromBase64(content));
+			if (image->mBlob->imageSize().isEmpty()) {
 				QLOG_ERROR() << "Corrupted image" << image->mPath << "when loading from save";
 			}
-			image->mImage.reset(new QImage(tempImage));
 		}
 	}
 
@@ -102,11 +103,16 @@ void Image::serialize(QDomElement &target) const
 			const QDomText svgText = target.ownerDocument().createTextNode(mSvgBytes);
 			target.appendChild(svgText);
 		}
-	} else {
-		QByteArray bytes;
-		QBuffer buffer(&bytes);
-		mImage->save(&buffer, "PNG");
-		buffer.close();
+	} else if (mBlob) {
+		QByteArray bytes = mBlob->bytes();
+		if (!bytes.startsWith(pngSignature)) {
+			// Saves always contain PNG, other formats are converted.
+			bytes.clear();
+			QBuffer buffer(&bytes);
+			mBlob->image().save(&buffer, "PNG");
+			buffer.close();
+		}
+
 		const QDomText text = target.ownerDocument().createTextNode(bytes.toBase64());
 		target.appendChild(text);
 	}
@@ -119,7 +125,12 @@ bool Image::isValid() const
 
 QSize Image::preferedSize() const
 {
-	return mIsSvg ? preferedSvgSize() : mImage->size();
+	if (mIsSvg) {
+		return preferedSvgSize();
+	}
+
+	// Null size for unreadable images, like QImage does.
+	return mBlob ? mBlob->imageSize().expandedTo(QSize(0, 0)) : QSize(0, 0);
 }
 
 QSize Image::preferedSvgSize() const
@@ -153,12 +164,13 @@ void Image::loadFrom(const QString &path)
 {
 	mPath = path;
 	mIsSvg = path.endsWith(".svg");
-	mImage.reset();
+	mBlob.reset();
 	mSvgRenderer.reset();
 	if (mIsSvg) {
 		mSvgRenderer.reset(new QSvgRenderer(path));
 	} else {
-		mImage.reset(new QImage(path));
+		QFile file(path);
+		mBlob = mBlobStore->put(file.open(QFile::ReadOnly) ? file.readAll() : QByteArray());
 	}
 }
 
@@ -168,8 +180,8 @@ void Image::draw(QPainter &painter, const QRect &rect, qreal zoom) const
 		mImagesCache->drawImageWithoutCachingSize(mPath, painter, rect, zoom);
 	} else if (mIsSvg) {
 		mSvgRenderer->render(&painter, rect);
-	} else if (!mImage.isNull()) {
-		painter.drawImage(rect, *mImage);
+	} else if (mBlob) {
+		painter.drawImage(rect, mBlob->image(rect.size() * zoom));
 	} else {
 		painter.save();
 		painter.setBrush(Qt::gray);
@@ -14,6 +14,8 @@
 
 #include "twoDModel/engine/model/model.h"
 
+#include <QtCore/QDataStream>
+
 #include <qrkernel/settingsManager.h>
 #include <qrgui/plugins/toolPluginInterface/usedInterfaces/errorReporterInterface.h>
 #include <kitBase/interpreterControlInterface.h>
@@ -28,6 +30,11 @@ using namespace twoDModel::model;
 
 static auto XML_VERSION = "20190819";
 
+/// Marks binary snapshots of simulation state, "2DSS".
+static const quint32 snapshotMagic = 0x32445353;
+static const quint32 snapshotVersion = 1;
+static const QDataStream::Version snapshotStreamVersion = QDataStream::Qt_5_6;
+
 Model::Model(QObject *parent)
 	: QObject(parent)
 	, mChecker(nullptr)
@@ -298,6 +305,65 @@ void Model::initPhysics()
 	connect(&mTimeline, &Timeline::tick, this, &Model::recalculatePhysicsParams);
 	connect(&mTimeline, &Timeline::nextFrame
 			, mRealisticPhysicsEngine, &physics::PhysicsEngineBase::nextFrame, Qt::UniqueConnection);
+
+	connect(&mSettings, &Settings::physicsStepChanged, this, [this]() {
+		mRealisticPhysicsEngine->setStepParameters(mSettings.physicsSubSteps()
+				, mSettings.velocityIterations(), mSettings.positionIterations());
+	});
+}
+
+QByteArray Model::saveSnapshot()
+{
+	QByteArray result;
+	QDataStream stream(&result, QIODevice::WriteOnly);
+	stream.setVersion(snapshotStreamVersion);
+	stream << snapshotMagic << snapshotVersion << mRobotModels.count() << !mChecker.isNull();
+	mTimeline.saveState(stream);
+	mWorldModel.saveState(stream);
+	for (RobotModel * const robot : mRobotModels) {
+		robot->saveState(stream);
+	}
+
+	mSimplePhysicsEngine->saveState(stream);
+	mRealisticPhysicsEngine->saveState(stream);
+	if (mChecker) {
+		mChecker->saveState(stream);
+	}
+
+	return result;
+}
+
+bool Model::restoreSnapshot(const QByteArray &snapshot)
+{
+	QDataStream stream(snapshot);
+	stream.setVersion(snapshotStreamVersion);
+	quint32 magic = 0;
+	quint32 version = 0;
+	int robotsCount = 0;
+	bool hasChecker = false;
+	stream >> magic >> version >> robotsCount >> hasChecker;
+	if (magic != snapshotMagic || version != snapshotVersion
+			|| robotsCount != mRobotModels.count() || hasChecker != !mChecker.isNull())
+	{
+		return false;
+	}
+
+	// Robots and items must be placed before physics engines rebuild their worlds.
+	mTimeline.restoreState(stream);
+	mWorldModel.restoreState(stream);
+	for (RobotModel * const robot : mRobotModels) {
+		robot->restoreState(stream);
+	}
+
+	if (!mSimplePhysicsEngine->restoreState(stream) || !mRealisticPhysicsEngine->restoreState(stream)) {
+		return false;
+	}
+
+	if (mChecker && !mChecker->restoreState(stream)) {
+		return false;
+	}
+
+	return stream.status() == QDataStream::Ok;
 }
 
 void Model::recalculatePhysicsParams()
@@ -18,6 +18,8 @@
 
 #include "twoDModel/engine/model/robotModel.h"
 #include "twoDModel/engine/model/constants.h"
+#include "twoDModel/engine/model/settings.h"
+#include "twoDModel/engine/model/timeline.h"
 #include "twoDModel/engine/model/worldModel.h"
 #include "src/engine/view/scene/twoDModelScene.h"
 #include "src/engine/view/scene/robotItem.h"
@@ -37,14 +39,28 @@ using namespace mathUtils;
 
 const qreal scaleCoeff = 0.001;
 
+/// Sorts sensors by their ports, so the order of sensor bodies does not depend on memory layout.
+static void sortByPort(QList<const twoDModel::view::SensorItem *> &sensors)
+{
+	std::sort(sensors.begin(), sensors.end()
+			, [](const twoDModel::view::SensorItem *left, const twoDModel::view::SensorItem *right) {
+				return left->port() < right->port();
+			});
+}
+
 Box2DPhysicsEngine::Box2DPhysicsEngine (const WorldModel &worldModel
 		, const QList<RobotModel *> &robots)
 	: PhysicsEngineBase(worldModel, robots)
 	, mPixelsInCm(worldModel.pixelsInCm() * scaleCoeff)
 	, mWorld(new b2World(b2Vec2(0, 0)))
-	, mPrevPosition(b2Vec2(0, 0))
-	, mPrevAngle(0)
+	, mSubSteps(Settings::defaultPhysicsSubSteps)
+	, mVelocityIterations(Settings::defaultVelocityIterations)
+	, mPositionIterations(Settings::defaultPositionIterations)
+	, mPendingTime(0)
 {
+	// Walls and resting items fall asleep and are skipped by the solver until something touches them.
+	mWorld->SetAllowSleeping(true);
+
 	connect(&worldModel, &model::WorldModel::wallAdded,
 			this, [this](const QSharedPointer<QGraphicsItem> &i) {itemAdded(i.data());});
 	connect(&worldModel, &model::WorldModel::skittleAdded,
@@ -66,7 +82,7 @@ QVector2D Box2DPhysicsEngine::positionShift(model::RobotModel &robot) const
 		return QVector2D();
 	}
 
-	return QVector2D(positionToScene(mBox2DRobots[&robot]->getBody()->GetPosition() - mPrevPosition));
+	return QVector2D(positionToScene(mBox2DRobots[&robot]->getBody()->GetPosition() - mPrevPositions[&robot]));
 }
 
 qreal Box2DPhysicsEngine::rotation(model::RobotModel &robot) const
@@ -75,7 +91,7 @@ qreal Box2DPhysicsEngine::rotation(model::RobotModel &robot) const
 		return 0;
 	}
 
-	return angleToScene(mBox2DRobots[&robot]->getBody()->GetAngle() - mPrevAngle);
+	return angleToScene(mBox2DRobots[&robot]->getBody()->GetAngle() - mPrevAngles[&robot]);
 }
 
 void Box2DPhysicsEngine::onPressedReleasedSelectedItems(bool active)
@@ -98,8 +114,8 @@ void Box2DPhysicsEngine::addRobot(model::RobotModel * const robot)
 	PhysicsEngineBase::addRobot(robot);
 	addRobot(robot, robot->robotCenter(), robot->rotation());
 
-	mPrevPosition = mBox2DRobots[robot]->getBody()->GetPosition();
-	mPrevAngle = mBox2DRobots[robot]->getBody()->GetAngle();
+	mPrevPositions[robot] = mBox2DRobots[robot]->getBody()->GetPosition();
+	mPrevAngles[robot] = mBox2DRobots[robot]->getBody()->GetAngle();
 
 	connect(robot, &model::RobotModel::positionChanged, this, [&] (const QPointF &newPos) {
 		onRobotStartPositionChanged(newPos, dynamic_cast<model::RobotModel *>(sender()));
@@ -115,7 +131,7 @@ void Box2DPhysicsEngine::addRobot(model::RobotModel * const robot)
 		connect(mScene->robot(*robot), &view::RobotItem::mouseInteractionStopped, this, [=]() {
 			view::RobotItem *rItem = mScene->robot(*robot);
 			if (rItem != nullptr) {
-				onMouseReleased(rItem->pos(), rItem->rotation());
+				onMouseReleased(rItem->pos(), rItem->rotation(), robot);
 			}
 		});
 
@@ -123,7 +139,7 @@ void Box2DPhysicsEngine::addRobot(model::RobotModel * const robot)
 				, this, &Box2DPhysicsEngine::onMousePressed);
 
 		connect(mScene->robot(*robot), &view::RobotItem::recoverRobotPosition
-				, this, &Box2DPhysicsEngine::onRecoverRobotPosition);
+				, this, [this, robot](const QPointF &pos) { onRecoverRobotPosition(pos, robot); });
 
 		connect(mScene->robot(*robot), &view::RobotItem::sensorAdded, this, [&](twoDModel::view::SensorItem *sensor) {
 			auto rItem = dynamic_cast<view::RobotItem *>(sender());
@@ -144,7 +160,9 @@ void Box2DPhysicsEngine::addRobot(model::RobotModel * const robot)
 			mBox2DRobots[model]->reinitSensor(sensor);
 		});
 
-		connect(robot, &model::RobotModel::deserialized, this, &Box2DPhysicsEngine::onMouseReleased);
+		connect(robot, &model::RobotModel::deserialized, this, [this, robot](const QPointF &pos, qreal angle) {
+			onMouseReleased(pos, angle, robot);
+		});
 	});
 }
 
@@ -178,13 +196,15 @@ void Box2DPhysicsEngine::onRobotStartAngleChanged(const qreal newAngle, model::R
 	mBox2DRobots[robot]->setRotation(angleToBox2D(newAngle));
 }
 
-void Box2DPhysicsEngine::onMouseReleased(const QPointF &newPos, qreal newAngle)
+void Box2DPhysicsEngine::onMouseReleased(const QPointF &newPos, qreal newAngle, model::RobotModel *robot)
 {
-	Box2DRobot *robot = mBox2DRobots.first();
+	if (!mBox2DRobots.contains(robot)) {
+		return;
+	}
 
-	robot->finishStopping();
-	onRobotStartPositionChanged(newPos, robot->getRobotModel());
-	onRobotStartAngleChanged(newAngle, robot->getRobotModel());
+	mBox2DRobots[robot]->finishStopping();
+	onRobotStartPositionChanged(newPos, robot);
+	onRobotStartAngleChanged(newAngle, robot);
 
 	onPressedReleasedSelectedItems(true);
 }
@@ -198,8 +218,12 @@ void Box2DPhysicsEngine::onMousePressed()
 	onPressedReleasedSelectedItems(false);
 }
 
-void Box2DPhysicsEngine::onRecoverRobotPosition(const QPointF &pos)
+void Box2DPhysicsEngine::onRecoverRobotPosition(const QPointF &pos, model::RobotModel *robot)
 {
+	if (!mBox2DRobots.contains(robot)) {
+		return;
+	}
+
 	clearForcesAndStop();
 
 	auto stop = [=](b2Body *body){
@@ -207,11 +231,11 @@ void Box2DPhysicsEngine::onRecoverRobotPosition(const QPointF &pos)
 		body->SetLinearVelocity({0, 0});
 	};
 
-	stop(mBox2DRobots.first()->getBody());
-	stop(mBox2DRobots.first()->getWheelAt(0)->getBody());
-	stop(mBox2DRobots.first()->getWheelAt(1)->getBody());
+	stop(mBox2DRobots[robot]->getBody());
+	stop(mBox2DRobots[robot]->getWheelAt(0)->getBody());
+	stop(mBox2DRobots[robot]->getWheelAt(1)->getBody());
 
-	onMouseReleased(pos, mBox2DRobots.keys().first()->startPositionMarker()->rotation());
+	onMouseReleased(pos, robot->startPositionMarker()->rotation(), robot);
 }
 
 void Box2DPhysicsEngine::removeRobot(model::RobotModel * const robot)
@@ -221,47 +245,85 @@ void Box2DPhysicsEngine::removeRobot(model::RobotModel * const robot)
 	mBox2DRobots.remove(robot);
 	mLeftWheels.remove(robot);
 	mRightWheels.remove(robot);
+	mPrevPositions.remove(robot);
+	mPrevAngles.remove(robot);
 }
 
 void Box2DPhysicsEngine::recalculateParameters(qreal timeInterval)
 {
-	const int velocityIterations = 10;
-	const int positionIterations = 6;
+	for (RobotModel * const robot : mRobots) {
+		if (Box2DRobot * const box2DRobot = mBox2DRobots.value(robot)) {
+			mPrevPositions[robot] = box2DRobot->getBody()->GetPosition();
+			mPrevAngles[robot] = box2DRobot->getBody()->GetAngle();
+		}
+	}
+
+	// Time is counted in integer microseconds and simulated only by whole ticks split into equal sub-steps,
+	// so the result does not depend on how the timeline slices the time and on floating point drift.
+	const qint64 tickLength = Timeline::timeInterval * 1000;
+	const float subStepSeconds = Timeline::timeInterval / 1000.0f / mSubSteps;
+	mPendingTime += qRound64(timeInterval * 1000);
+	while (mPendingTime >= tickLength) {
+		mPendingTime -= tickLength;
+		for (int i = 0; i < mSubSteps; ++i) {
+			// Robots are processed in order of their addition, not in order of their addresses.
+			for (RobotModel * const robot : mRobots) {
+				applyWheelsControl(*robot);
+			}
 
-	model::RobotModel * const robot = mRobots.first();
-	if (!mBox2DRobots[robot]) {
+			mWorld->Step(subStepSeconds, mVelocityIterations, mPositionIterations);
+		}
+	}
+
+	static volatile auto sThisFlagHelpsToAvoidClangError = true;
+	if ("If you want debug BOX2D, fix this expression to be false" && sThisFlagHelpsToAvoidClangError) {
 		return;
 	}
 
-	b2Body *rBody = mBox2DRobots[robot]->getBody();
-	float secondsInterval = timeInterval / 1000.0f;
+	for (RobotModel * const robot : mRobots) {
+		drawDebugShapes(*robot);
+	}
+}
 
-	if (mBox2DRobots[robot]->isStopping()){
-		mBox2DRobots[robot]->stop();
-	} else {
-		// sAdpt is the speed adaptation coefficient for physics engines
-		const int sAdpt = 10;
-		const qreal speed1 = pxToM(wheelLinearSpeed(*robot, robot->leftWheel())) / secondsInterval * sAdpt;
-		const qreal speed2 = pxToM(wheelLinearSpeed(*robot, robot->rightWheel())) / secondsInterval * sAdpt;
-
-		if (qAbs(speed1) + qAbs(speed2) < b2_epsilon) {
-			mBox2DRobots[robot]->stop();
-			mLeftWheels[robot]->stop();
-			mRightWheels[robot]->stop();
-		}
-		else {
-			mLeftWheels[robot]->keepConstantSpeed(speed1);
-			mRightWheels[robot]->keepConstantSpeed(speed2);
-		}
+void Box2DPhysicsEngine::setStepParameters(int subSteps, int velocityIterations, int positionIterations)
+{
+	mSubSteps = qMax(1, subSteps);
+	mVelocityIterations = qMax(1, velocityIterations);
+	mPositionIterations = qMax(1, positionIterations);
+}
+
+void Box2DPhysicsEngine::applyWheelsControl(RobotModel &robot)
+{
+	Box2DRobot * const box2DRobot = mBox2DRobots.value(&robot);
+	if (!box2DRobot) {
+		return;
 	}
 
-	mPrevPosition = rBody->GetPosition();
-	mPrevAngle = rBody->GetAngle();
+	if (box2DRobot->isStopping()) {
+		box2DRobot->stop();
+		return;
+	}
 
-	mWorld->Step(secondsInterval, velocityIterations, positionIterations);
+	// Motor speeds are given per timeline tick, sub-steps only make the integration finer.
+	const float secondsInterval = Timeline::timeInterval / 1000.0f;
+	// sAdpt is the speed adaptation coefficient for physics engines
+	const int sAdpt = 10;
+	const qreal speed1 = pxToM(wheelLinearSpeed(robot, robot.leftWheel())) / secondsInterval * sAdpt;
+	const qreal speed2 = pxToM(wheelLinearSpeed(robot, robot.rightWheel())) / secondsInterval * sAdpt;
+
+	if (qAbs(speed1) + qAbs(speed2) < b2_epsilon) {
+		box2DRobot->stop();
+		mLeftWheels[&robot]->stop();
+		mRightWheels[&robot]->stop();
+	} else {
+		mLeftWheels[&robot]->keepConstantSpeed(speed1);
+		mRightWheels[&robot]->keepConstantSpeed(speed2);
+	}
+}
 
-	static volatile auto sThisFlagHelpsToAvoidClangError = true;
-	if ("If you want debug BOX2D, fix this expression to be false" && sThisFlagHelpsToAvoidClangError) {
+void Box2DPhysicsEngine::drawDebugShapes(RobotModel &robot)
+{
+	if (!mBox2DRobots.contains(&robot) || !mScene) {
 		return;
 	}
 
@@ -286,8 +348,8 @@ void Box2DPhysicsEngine::recalculateParameters(qreal timeInterval)
 		}
 	}
 
-	qreal angleRobot= angleToScene(mBox2DRobots[robot]->getBody()->GetAngle());
-	QPointF posRobot = positionToScene(mBox2DRobots[robot]->getBody()->GetPosition());
+	qreal angleRobot= angleToScene(mBox2DRobots[&robot]->getBody()->GetAngle());
+	QPointF posRobot = positionToScene(mBox2DRobots[&robot]->getBody()->GetPosition());
 	QGraphicsRectItem *rect1 = new QGraphicsRectItem(-25, -25, 60, 50);
 	QGraphicsRectItem *rect2 = new QGraphicsRectItem(-10, -6, 20, 10);
 	QGraphicsRectItem *rect3 = new QGraphicsRectItem(-10, -6, 20, 10);
@@ -296,11 +358,11 @@ void Box2DPhysicsEngine::recalculateParameters(qreal timeInterval)
 	rect1->setRotation(angleRobot);
 	rect1->setPos(posRobot);
 	rect2->setTransformOriginPoint(0, 0);
-	rect2->setRotation(angleToScene(mBox2DRobots[robot]->getWheelAt(0)->getBody()->GetAngle()));
-	rect2->setPos(positionToScene(mBox2DRobots[robot]->getWheelAt(0)->getBody()->GetPosition()));
+	rect2->setRotation(angleToScene(mBox2DRobots[&robot]->getWheelAt(0)->getBody()->GetAngle()));
+	rect2->setPos(positionToScene(mBox2DRobots[&robot]->getWheelAt(0)->getBody()->GetPosition()));
 	rect3->setTransformOriginPoint(0, 0);
-	rect3->setRotation(angleToScene(mBox2DRobots[robot]->getWheelAt(1)->getBody()->GetAngle()));
-	rect3->setPos(positionToScene(mBox2DRobots[robot]->getWheelAt(1)->getBody()->GetPosition()));
+	rect3->setRotation(angleToScene(mBox2DRobots[&robot]->getWheelAt(1)->getBody()->GetAngle()));
+	rect3->setPos(positionToScene(mBox2DRobots[&robot]->getWheelAt(1)->getBody()->GetPosition()));
 	mScene->addItem(rect1);
 	mScene->addItem(rect2);
 	mScene->addItem(rect3);
@@ -313,11 +375,11 @@ void Box2DPhysicsEngine::recalculateParameters(qreal timeInterval)
 
 
 //		 uncomment it for watching mutual position of robot and wheels (polygon form)
-//		path.addPolygon(mBox2DRobots[robot]->getDebuggingPolygon());
-//		path.addPolygon(mBox2DRobots[robot]->getWheelAt(0)->mDebuggingDrawPolygon);
-//		path.addPolygon(mBox2DRobots[robot]->getWheelAt(1)->mDebuggingDrawPolygon);
+//		path.addPolygon(mBox2DRobots[&robot]->getDebuggingPolygon());
+//		path.addPolygon(mBox2DRobots[&robot]->getWheelAt(0)->mDebuggingDrawPolygon);
+//		path.addPolygon(mBox2DRobots[&robot]->getWheelAt(1)->mDebuggingDrawPolygon);
 
-	const QMap<const view::SensorItem *, Box2DItem *> sensors = mBox2DRobots[robot]->getSensors();
+	const QMap<const view::SensorItem *, Box2DItem *> sensors = mBox2DRobots[&robot]->getSensors();
 	for (Box2DItem * sensor : sensors.values()) {
 		const b2Vec2 position = sensor->getBody()->GetPosition();
 		QPointF scenePos = positionToScene(position);
@@ -358,6 +420,7 @@ void Box2DPhysicsEngine::nextFrame()
 
 void Box2DPhysicsEngine::clearForcesAndStop()
 {
+	mPendingTime = 0;
 	mWorld->ClearForces();
 	for (auto item : mBox2DDynamicItems) {
 		b2Body *body = item->getBody();
@@ -371,6 +434,169 @@ bool Box2DPhysicsEngine::isRobotStuck() const
 	return false;
 }
 
+void Box2DPhysicsEngine::saveState(QDataStream &stream)
+{
+	QByteArray state;
+	QDataStream stateStream(&state, QIODevice::WriteOnly);
+	stateStream.setVersion(stream.version());
+	stateStream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+	stateStream << mPendingTime;
+	for (RobotModel * const robot : mRobots) {
+		Box2DRobot * const box2DRobot = mBox2DRobots.value(robot);
+		stateStream << mPrevPositions.value(robot).x << mPrevPositions.value(robot).y << mPrevAngles.value(robot)
+				<< (box2DRobot && box2DRobot->isStopping())
+				<< (box2DRobot ? box2DRobot->getWheelAt(0)->previousSpeed() : 0.0f)
+				<< (box2DRobot ? box2DRobot->getWheelAt(1)->previousSpeed() : 0.0f);
+	}
+
+	const QList<b2Body *> bodies = canonicalBodies();
+	stateStream << bodies.count();
+	for (const b2Body *body : bodies) {
+		stateStream << body->GetPosition().x << body->GetPosition().y << body->GetAngle()
+				<< body->GetLinearVelocity().x << body->GetLinearVelocity().y << body->GetAngularVelocity()
+				<< body->IsAwake() << body->IsEnabled();
+	}
+
+	stream << state;
+
+	// Contacts and warm starting impulses are lost on restoring, so the live world drops them too and continues
+	// from exactly the state a world restored from this snapshot would have.
+	QDataStream restoreStream(state);
+	restoreStream.setVersion(stream.version());
+	restoreStream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+	applyState(restoreStream);
+}
+
+bool Box2DPhysicsEngine::restoreState(QDataStream &stream)
+{
+	QByteArray state;
+	stream >> state;
+	QDataStream restoreStream(state);
+	restoreStream.setVersion(stream.version());
+	restoreStream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+	return applyState(restoreStream);
+}
+
+bool Box2DPhysicsEngine::applyState(QDataStream &stream)
+{
+	rebuildWorld();
+
+	stream >> mPendingTime;
+	for (RobotModel * const robot : mRobots) {
+		b2Vec2 previousPosition;
+		float previousAngle = 0;
+		bool isStopping = false;
+		float leftSpeed = 0;
+		float rightSpeed = 0;
+		stream >> previousPosition.x >> previousPosition.y >> previousAngle >> isStopping >> leftSpeed >> rightSpeed;
+		mPrevPositions[robot] = previousPosition;
+		mPrevAngles[robot] = previousAngle;
+		if (Box2DRobot * const box2DRobot = mBox2DRobots.value(robot)) {
+			if (isStopping) {
+				box2DRobot->startStopping();
+			}
+
+			box2DRobot->getWheelAt(0)->setPreviousSpeed(leftSpeed);
+			box2DRobot->getWheelAt(1)->setPreviousSpeed(rightSpeed);
+		}
+	}
+
+	const QList<b2Body *> bodies = canonicalBodies();
+	int bodiesCount = 0;
+	stream >> bodiesCount;
+	if (bodiesCount != bodies.count()) {
+		return false;
+	}
+
+	for (b2Body *body : bodies) {
+		b2Vec2 position;
+		float angle = 0;
+		b2Vec2 linearVelocity;
+		float angularVelocity = 0;
+		bool isAwake = false;
+		bool isEnabled = false;
+		stream >> position.x >> position.y >> angle >> linearVelocity.x >> linearVelocity.y >> angularVelocity
+				>> isAwake >> isEnabled;
+		body->SetEnabled(isEnabled);
+		body->SetTransform(position, angle);
+		body->SetLinearVelocity(linearVelocity);
+		body->SetAngularVelocity(angularVelocity);
+		// Must be the last: setting velocities wakes body up, and putting it asleep resets velocities.
+		body->SetAwake(isAwake);
+	}
+
+	return stream.status() == QDataStream::Ok;
+}
+
+QList<b2Body *> Box2DPhysicsEngine::canonicalBodies() const
+{
+	QList<b2Body *> result;
+	for (RobotModel * const robot : mRobots) {
+		Box2DRobot * const box2DRobot = mBox2DRobots.value(robot);
+		if (!box2DRobot) {
+			continue;
+		}
+
+		result << box2DRobot->getBody() << box2DRobot->getWheelAt(0)->getBody()
+				<< box2DRobot->getWheelAt(1)->getBody();
+		QList<const view::SensorItem *> sensors = box2DRobot->getSensors().keys();
+		sortByPort(sensors);
+		for (const view::SensorItem *sensor : sensors) {
+			result << box2DRobot->getSensors()[sensor]->getBody();
+		}
+	}
+
+	auto appendItems = [this, &result](const auto &items) {
+		for (const auto &item : items) {
+			if (const Box2DItem * const box2DItem = mBox2DResizableItems.value(item.data())) {
+				result << box2DItem->getBody();
+			}
+		}
+	};
+
+	appendItems(mWorldModel.walls());
+	appendItems(mWorldModel.skittles());
+	appendItems(mWorldModel.balls());
+	return result;
+}
+
+void Box2DPhysicsEngine::rebuildWorld()
+{
+	qDeleteAll(mBox2DRobots);
+	mBox2DRobots.clear();
+	mLeftWheels.clear();
+	mRightWheels.clear();
+	qDeleteAll(mBox2DResizableItems);
+	mBox2DResizableItems.clear();
+	mBox2DDynamicItems.clear();
+
+	mWorld.reset(new b2World(b2Vec2(0, 0)));
+	mWorld->SetAllowSleeping(true);
+
+	for (RobotModel * const robot : mRobots) {
+		addRobot(robot, robot->robotCenter(), robot->rotation());
+		QList<const view::SensorItem *> sensors;
+		for (const view::SensorItem *sensor : mRobotSensors.value(robot)) {
+			sensors << sensor;
+		}
+
+		sortByPort(sensors);
+		for (const view::SensorItem *sensor : sensors) {
+			mBox2DRobots[robot]->addSensor(sensor);
+		}
+	}
+
+	auto addItems = [this](const auto &items) {
+		for (const auto &item : items) {
+			onItemDragged(item.data());
+		}
+	};
+
+	addItems(mWorldModel.walls());
+	addItems(mWorldModel.skittles());
+	addItems(mWorldModel.balls());
+}
+
 void Box2DPhysicsEngine::onPixelsInCmChanged(qreal value)
 {
 	mPixelsInCm = value * scaleCoeff;
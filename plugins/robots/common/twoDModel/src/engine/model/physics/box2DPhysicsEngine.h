@@ -42,6 +42,9 @@ namespace twoDModel {
 		class Box2DItem;
 	}
 
+/// Realistic physics engine based on Box2D. World is integrated with a fixed step: each timeline tick is split
+/// into a configured number of equal sub-steps, and time that does not make a whole tick is carried over to the
+/// next call, so the same sequence of ticks always produces the same sequence of world steps for all robots.
 class Box2DPhysicsEngine : public PhysicsEngineBase
 {
 public:
@@ -53,11 +56,18 @@ public:
 	void addRobot(RobotModel * const robot, const QPointF &pos, qreal angle);
 	void removeRobot(RobotModel * const robot) override;
 	void recalculateParameters(qreal timeInterval) override;
+	void setStepParameters(int subSteps, int velocityIterations, int positionIterations) override;
 	void wakeUp() override;
 	void nextFrame() override;
 	void clearForcesAndStop() override;
 	bool isRobotStuck() const override;
 
+	/// Writes state of all bodies and rebuilds Box2D world from scratch with this state, because contacts,
+	/// broad-phase tree and solver caches can not be saved. The same is done on restoring, so simulation
+	/// continued after saving goes exactly like simulation continued after restoring.
+	void saveState(QDataStream &stream) override;
+	bool restoreState(QDataStream &stream) override;
+
 	float pxToCm(qreal px) const;
 	b2Vec2 pxToCm(const QPointF &posInPx) const;
 	qreal cmToPx(float cm) const;
@@ -80,9 +90,9 @@ public slots:
 	void onItemDragged(graphicsUtils::AbstractItem *item);
 	void onRobotStartPositionChanged(const QPointF &newPos, twoDModel::model::RobotModel *robot);
 	void onRobotStartAngleChanged(const qreal newAngle, twoDModel::model::RobotModel *robot);
-	void onMouseReleased(const QPointF &newPos, qreal newAngle);
+	void onMouseReleased(const QPointF &newPos, qreal newAngle, twoDModel::model::RobotModel *robot);
 	void onMousePressed();
-	void onRecoverRobotPosition(const QPointF &pos);
+	void onRecoverRobotPosition(const QPointF &pos, twoDModel::model::RobotModel *robot);
 
 protected:
 	void onPixelsInCmChanged(qreal value) override;
@@ -92,6 +102,21 @@ protected:
 private:
 	void onPressedReleasedSelectedItems(bool active);
 
+	/// Makes wheels of \a robot keep speeds requested by its motors.
+	void applyWheelsControl(RobotModel &robot);
+
+	/// Draws Box2D bodies of \a robot and dynamic items on the scene, for debugging only.
+	void drawDebugShapes(RobotModel &robot);
+
+	/// Returns all bodies in an order that depends only on robots order and world items ids.
+	QList<b2Body *> canonicalBodies() const;
+
+	/// Recreates Box2D world and all bodies in it in canonical order with current positions of items and robots.
+	void rebuildWorld();
+
+	/// Rebuilds the world and applies state written by saveState() to it.
+	bool applyState(QDataStream &stream);
+
 	bool itemTracked(QGraphicsItem * const item);
 
 	twoDModel::view::TwoDModelScene *mScene {}; // Doesn't take ownership
@@ -105,8 +130,15 @@ private:
 	QMap<QGraphicsItem *, parts::Box2DItem *> mBox2DDynamicItems;  // Doesn't take ownership
 	QMap<RobotModel *, QSet<twoDModel::view::SensorItem *>> mRobotSensors; // Doesn't take ownership
 
-	b2Vec2 mPrevPosition;
-	float mPrevAngle;
+	QMap<RobotModel *, b2Vec2> mPrevPositions;
+	QMap<RobotModel *, float> mPrevAngles;
+
+	int mSubSteps;
+	int mVelocityIterations;
+	int mPositionIterations;
+
+	/// Model time in microseconds that was passed to recalculateParameters() but not simulated yet.
+	qint64 mPendingTime;
 };
 
 }
@@ -33,9 +33,13 @@ Box2DItem::Box2DItem(twoDModel::model::physics::Box2DPhysicsEngine *engine
 	} else if (item->bodyType() == SolidItem::KINEMATIC) {
 		bodyDef.type = b2_kinematicBody;
 	} else if (item->bodyType() == SolidItem::STATIC) {
+		// Static bodies (walls) are never integrated, they start asleep and only participate in contacts.
 		bodyDef.type = b2_staticBody;
+		bodyDef.awake = false;
 	}
 
+	bodyDef.allowSleep = true;
+
 	mBody = this->mEngine.box2DWorld().CreateBody(&bodyDef);
 	mBody->SetAngularDamping(item->angularDamping());
 	mBody->SetLinearDamping(item->linearDamping());
@@ -125,6 +125,16 @@ b2Body *Box2DWheel::getBody()
 	return mBody;
 }
 
+float Box2DWheel::previousSpeed() const
+{
+	return prevSpeed;
+}
+
+void Box2DWheel::setPreviousSpeed(float speed)
+{
+	prevSpeed = speed;
+}
+
 void Box2DWheel::stop() {
 	mBody->SetLinearVelocity(b2Vec2(0, 0));
 	mBody->SetAngularVelocity(0);
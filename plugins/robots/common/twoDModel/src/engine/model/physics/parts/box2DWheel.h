@@ -44,6 +44,12 @@ public:
 	void stop();
 	b2Body *getBody();
 
+	/// Returns the speed wheel was asked to keep last time.
+	float previousSpeed() const;
+
+	/// Sets the speed wheel was asked to keep last time, used when simulation state is restored.
+	void setPreviousSpeed(float speed);
+
 	QPolygonF mDebuggingDrawPolygon;
 protected:
 	float prevSpeed = 0;
@@ -44,6 +44,13 @@ void PhysicsEngineBase::removeRobot(twoDModel::model::RobotModel * const robot)
 	mRobots.removeAll(robot);
 }
 
+void PhysicsEngineBase::setStepParameters(int subSteps, int velocityIterations, int positionIterations)
+{
+	Q_UNUSED(subSteps)
+	Q_UNUSED(velocityIterations)
+	Q_UNUSED(positionIterations)
+}
+
 void PhysicsEngineBase::wakeUp()
 {
 }
@@ -56,6 +63,17 @@ void PhysicsEngineBase::nextFrame()
 {
 }
 
+void PhysicsEngineBase::saveState(QDataStream &stream)
+{
+	Q_UNUSED(stream)
+}
+
+bool PhysicsEngineBase::restoreState(QDataStream &stream)
+{
+	Q_UNUSED(stream)
+	return true;
+}
+
 void PhysicsEngineBase::onPixelsInCmChanged(qreal value)
 {
 	Q_UNUSED(value)
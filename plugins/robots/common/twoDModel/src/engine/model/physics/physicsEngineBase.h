@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <QtCore/QDataStream>
 #include <QtGui/QVector2D>
 #include <QtGui/QPainterPath>
 
@@ -52,6 +53,11 @@ public:
 	/// Recalculates all solid items positions and angles.
 	virtual void recalculateParameters(qreal timeInterval) = 0;
 
+	/// Configures integration of the world: each timeline tick is simulated with \a subSteps equal steps,
+	/// constraint solver makes the given number of velocity and position iterations on each of them.
+	/// Engines that do not integrate the world step by step ignore it.
+	virtual void setStepParameters(int subSteps, int velocityIterations, int positionIterations);
+
 	/// A hacky method to understand when robot in simple physics mode got stuck in the wall.
 	virtual bool isRobotStuck() const = 0;
 
@@ -64,6 +70,13 @@ public:
 	/// Recalculates all solid items positions and angles correspond to world model changes.
 	virtual void nextFrame();
 
+	/// Writes internal state of the engine into \a stream. Engine may normalize its internal structures while
+	/// saving, so that simulation continued after saving and after restoring the saved state goes exactly the same.
+	virtual void saveState(QDataStream &stream);
+
+	/// Restores the state written by saveState(). Returns false if the state does not match current world.
+	virtual bool restoreState(QDataStream &stream);
+
 protected:
 	/// A useful method for counting wheel linear speed from interpreter`s speed.
 	qreal wheelLinearSpeed(RobotModel &robot, const RobotModel::Wheel &wheel) const;
@@ -93,3 +93,21 @@ void SimplePhysicsEngine::recalculateParameters(qreal timeInterval, RobotModel &
 		mPositionShift[&robot] = averageSpeed * timeInterval * Geometry::directionVector(robot.rotation());
 	}
 }
+
+void SimplePhysicsEngine::saveState(QDataStream &stream)
+{
+	stream << mStuck;
+	for (RobotModel * const robot : mRobots) {
+		stream << mPositionShift.value(robot) << mRotation.value(robot);
+	}
+}
+
+bool SimplePhysicsEngine::restoreState(QDataStream &stream)
+{
+	stream >> mStuck;
+	for (RobotModel * const robot : mRobots) {
+		stream >> mPositionShift[robot] >> mRotation[robot];
+	}
+
+	return stream.status() == QDataStream::Ok;
+}
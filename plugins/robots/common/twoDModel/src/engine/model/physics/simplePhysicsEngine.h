@@ -30,6 +30,8 @@ public:
 	qreal rotation(RobotModel &robot) const override;
 	void recalculateParameters(qreal timeInterval) override;
 	bool isRobotStuck() const override;
+	void saveState(QDataStream &stream) override;
+	bool restoreState(QDataStream &stream) override;
 
 private:
 	void recalculateParameters(qreal timeInterval, RobotModel &robot);
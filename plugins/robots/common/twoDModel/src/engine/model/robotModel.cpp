@@ -16,6 +16,7 @@
 
 #include <qmath.h>
 #include <QtCore/QtMath>
+#include <QtCore/QDataStream>
 #include <QtGui/QTransform>
 
 #include <qrutils/mathUtils/math.h>
@@ -477,6 +478,65 @@ void RobotModel::serializeWheels(QDomElement &robotElement) const
 	robotElement.appendChild(wheels);
 }
 
+void RobotModel::saveState(QDataStream &stream) const
+{
+	stream << mMotors.count();
+	for (auto it = mMotors.cbegin(); it != mMotors.cend(); ++it) {
+		const Wheel &wheel = *it.value();
+		stream << it.key().toString() << wheel.radius << wheel.speed << wheel.spoiledSpeed << wheel.degrees
+				<< static_cast<int>(wheel.activeTimeType) << wheel.isUsed << wheel.breakMode
+				<< mTurnoverEngines.value(it.key());
+	}
+
+	stream << mPos << mAngle << mGyroAngle << mDeltaDegreesOfAngle << mBeepTime << mIsOnTheGround << mMarker
+			<< mAcceleration << mIsFirstAngleStamp << mAngleStampPrevious;
+
+	stream << mPosStamps.size();
+	for (int i = 0; i < mPosStamps.size(); ++i) {
+		stream << mPosStamps.nthFromHead(i);
+	}
+}
+
+void RobotModel::restoreState(QDataStream &stream)
+{
+	int motorsCount = 0;
+	stream >> motorsCount;
+	for (int i = 0; i < motorsCount; ++i) {
+		QString port;
+		Wheel wheel;
+		int activeTimeType = 0;
+		qreal turnover = 0;
+		stream >> port >> wheel.radius >> wheel.speed >> wheel.spoiledSpeed >> wheel.degrees
+				>> activeTimeType >> wheel.isUsed >> wheel.breakMode >> turnover;
+		wheel.activeTimeType = static_cast<ATime>(activeTimeType);
+		const PortInfo portInfo = PortInfo::fromString(port);
+		if (mMotors.contains(portInfo)) {
+			*mMotors[portInfo] = wheel;
+			mTurnoverEngines[portInfo] = turnover;
+		}
+	}
+
+	QPointF position;
+	qreal angle = 0;
+	stream >> position >> angle >> mGyroAngle >> mDeltaDegreesOfAngle >> mBeepTime >> mIsOnTheGround >> mMarker
+			>> mAcceleration >> mIsFirstAngleStamp >> mAngleStampPrevious;
+
+	int stampsCount = 0;
+	stream >> stampsCount;
+	mPosStamps.clear();
+	for (int i = 0; i < stampsCount; ++i) {
+		QPointF stamp;
+		stream >> stamp;
+		mPosStamps.enqueue(stamp);
+	}
+
+	// Values are assigned exactly, without fuzzy comparison made by setters, then views are notified.
+	mPos = position;
+	mAngle = angle;
+	emit positionChanged(mPos);
+	emit rotationChanged(mAngle);
+}
+
 void RobotModel::deserializeWheels(const QDomElement &robotElement)
 {
 	const QDomElement wheels = robotElement.firstChildElement("wheels");
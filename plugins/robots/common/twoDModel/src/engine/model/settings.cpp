@@ -35,6 +35,21 @@ bool Settings::realisticMotors() const
 	return mRealisticMotors;
 }
 
+int Settings::physicsSubSteps() const
+{
+	return mPhysicsSubSteps;
+}
+
+int Settings::velocityIterations() const
+{
+	return mVelocityIterations;
+}
+
+int Settings::positionIterations() const
+{
+	return mPositionIterations;
+}
+
 void Settings::serialize(QDomElement &parent) const
 {
 	auto result = parent.ownerDocument().createElement("settings");
@@ -42,6 +57,18 @@ void Settings::serialize(QDomElement &parent) const
 	result.setAttribute("realisticPhysics", mRealisticPhysics ? "true" : "false");
 	result.setAttribute("realisticSensors", mRealisticSensors ? "true" : "false");
 	result.setAttribute("realisticMotors", mRealisticMotors ? "true" : "false");
+	// Step parameters are written only when changed to keep existing worlds untouched.
+	if (mPhysicsSubSteps != defaultPhysicsSubSteps) {
+		result.setAttribute("physicsSubSteps", mPhysicsSubSteps);
+	}
+
+	if (mVelocityIterations != defaultVelocityIterations) {
+		result.setAttribute("velocityIterations", mVelocityIterations);
+	}
+
+	if (mPositionIterations != defaultPositionIterations) {
+		result.setAttribute("positionIterations", mPositionIterations);
+	}
 }
 
 void Settings::deserialize(const QDomElement &parent)
@@ -49,6 +76,9 @@ void Settings::deserialize(const QDomElement &parent)
 	mRealisticPhysics = parent.attribute("realisticPhysics") == "true";
 	mRealisticSensors = parent.attribute("realisticSensors") == "true";
 	mRealisticMotors = parent.attribute("realisticMotors") == "true";
+	setPhysicsStepParameters(parent.attribute("physicsSubSteps", QString::number(defaultPhysicsSubSteps)).toInt()
+			, parent.attribute("velocityIterations", QString::number(defaultVelocityIterations)).toInt()
+			, parent.attribute("positionIterations", QString::number(defaultPositionIterations)).toInt());
 	emit physicsChanged(mRealisticPhysics);
 }
 
@@ -67,3 +97,11 @@ void Settings::setRealisticMotors(bool set)
 {
 	mRealisticMotors = set;
 }
+
+void Settings::setPhysicsStepParameters(int subSteps, int velocityIterations, int positionIterations)
+{
+	mPhysicsSubSteps = qMax(1, subSteps);
+	mVelocityIterations = qMax(1, velocityIterations);
+	mPositionIterations = qMax(1, positionIterations);
+	emit physicsStepChanged();
+}
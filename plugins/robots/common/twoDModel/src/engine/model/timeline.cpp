@@ -13,6 +13,7 @@
  * limitations under the License. */
 
 #include <QtCore/QCoreApplication>
+#include <QtCore/QDataStream>
 #include <QtCore/QDateTime>
 #include <QThread>
 
@@ -131,6 +132,16 @@ void Timeline::setImmediateMode(bool immediateMode)
 	mFrameLength = immediateMode ? 0 : defaultFrameLength;
 }
 
+void Timeline::saveState(QDataStream &stream) const
+{
+	stream << mTimestamp;
+}
+
+void Timeline::restoreState(QDataStream &stream)
+{
+	stream >> mTimestamp;
+}
+
 void Timeline::setSpeedFactor(int factor)
 {
 	if (mSpeedFactor != factor) {
@@ -12,6 +12,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License. */
 
+#include <QtCore/QDataStream>
 #include <QtGui/QTransform>
 #include <QtCore/QStringList>
 #include <QtCore/QUuid>
@@ -163,12 +164,14 @@ void WorldModel::addWall(const QSharedPointer<items::WallItem> &wall)
 
 	mWalls[id] = wall;
 	mOrder[id] = mOrder.size();
+	trackChanges(*wall);
 	emit wallAdded(wall);
 }
 
 void WorldModel::removeWall(QSharedPointer<items::WallItem> wall)
 {
 	mWalls.remove(wall->id());
+	mSerializedItems.remove(wall->id());
 	emit itemRemoved(wall);
 }
 
@@ -181,12 +184,14 @@ void WorldModel::addSkittle(const QSharedPointer<items::SkittleItem> &skittle)
 	}
 
 	mSkittles[id] = skittle;
+	trackChanges(*skittle);
 	emit skittleAdded(skittle);
 }
 
 void WorldModel::removeSkittle(QSharedPointer<items::SkittleItem> skittle)
 {
 	mSkittles.remove(skittle->id());
+	mSerializedItems.remove(skittle->id());
 	emit itemRemoved(skittle);
 }
 
@@ -199,12 +204,14 @@ void WorldModel::addBall(const QSharedPointer<items::BallItem> &ball)
 	}
 
 	mBalls[id] = ball;
+	trackChanges(*ball);
 	emit ballAdded(ball);
 }
 
 void WorldModel::removeBall(QSharedPointer<items::BallItem> ball)
 {
 	mBalls.remove(ball->id());
+	mSerializedItems.remove(ball->id());
 	emit itemRemoved(ball);
 }
 
@@ -238,12 +245,17 @@ void WorldModel::addColorField(const QSharedPointer<items::ColorFieldItem> &colo
 
 	mColorFields[id] = colorField;
 	mOrder[id] = mOrder.size();
+	trackChanges(*colorField);
+	if (auto stylus = qobject_cast<items::StylusItem *>(colorField.data())) {
+		connect(stylus, &items::StylusItem::segmentAdded, this, [this, id]() { mSerializedItems.remove(id); });
+	}
 	emit colorItemAdded(colorField);
 }
 
 void WorldModel::removeColorField(QSharedPointer<items::ColorFieldItem> colorField)
 {
 	mColorFields.remove(colorField->id());
+	mSerializedItems.remove(colorField->id());
 	emit itemRemoved(colorField);
 }
 
@@ -258,6 +270,10 @@ void WorldModel::addImageItem(const QSharedPointer<items::ImageItem> &imageItem)
 	mImageItems[id] = imageItem;
 	mImages[imageItem->image()->imageId()] = imageItem->image();
 	mOrder[id] = mOrder.size();
+	const items::ImageItem * const rawImageItem = imageItem.data();
+	connect(&*imageItem, &items::ImageItem::internalImageChanged, this, [this, rawImageItem]() {
+		mSerializedImages.remove(rawImageItem->image()->imageId());
+	});
 	connect(&*imageItem, &items::ImageItem::internalImageChanged, this, &WorldModel::blobsChanged);
 	connect(&*imageItem, &items::ImageItem::internalImageChanged, this, [this, id](){
 			if (auto item = mImageItems.value(id))	{
@@ -274,6 +290,7 @@ void WorldModel::addImageItem(const QSharedPointer<items::ImageItem> &imageItem)
 void WorldModel::removeImageItem(QSharedPointer<items::ImageItem> imageItem)
 {
 	mImageItems.remove(imageItem->id());
+	mSerializedImages.remove(imageItem->image()->imageId());
 
 	emit itemRemoved(imageItem);
 	emit blobsChanged();
@@ -310,6 +327,8 @@ void WorldModel::clear()
 	mOrder.clear();
 
 	mImages.clear();
+	mSerializedImages.clear();
+	mSerializedItems.clear();
 
 	clearRobotTrace();
 
@@ -350,6 +369,69 @@ void WorldModel::clearRobotTrace()
 	emit robotTraceAppearedOrDisappeared(false);
 }
 
+/// Writes scene position and rotation of each item along with its id.
+template<typename T>
+static void saveItemsPlacement(QDataStream &stream, const QMap<QString, QSharedPointer<T>> &items)
+{
+	stream << items.count();
+	for (auto it = items.cbegin(); it != items.cend(); ++it) {
+		stream << it.key() << it.value()->pos() << it.value()->rotation();
+	}
+}
+
+/// Restores placement written by saveItemsPlacement() for items that still exist.
+template<typename T>
+static void restoreItemsPlacement(QDataStream &stream, const QMap<QString, QSharedPointer<T>> &items)
+{
+	int count = 0;
+	stream >> count;
+	for (int i = 0; i < count; ++i) {
+		QString id;
+		QPointF position;
+		qreal rotation = 0;
+		stream >> id >> position >> rotation;
+		if (const QSharedPointer<T> item = items.value(id)) {
+			item->setPos(position);
+			item->setRotation(rotation);
+		}
+	}
+}
+
+void WorldModel::saveState(QDataStream &stream) const
+{
+	saveItemsPlacement(stream, mSkittles);
+	saveItemsPlacement(stream, mBalls);
+
+	stream << mRobotTrace.count();
+	for (const QSharedPointer<QGraphicsPathItem> &traceItem : mRobotTrace) {
+		stream << traceItem->pen() << traceItem->path();
+	}
+}
+
+void WorldModel::restoreState(QDataStream &stream)
+{
+	restoreItemsPlacement(stream, mSkittles);
+	restoreItemsPlacement(stream, mBalls);
+
+	clearRobotTrace();
+	int traceItemsCount = 0;
+	stream >> traceItemsCount;
+	for (int i = 0; i < traceItemsCount; ++i) {
+		QPen pen;
+		QPainterPath path;
+		stream >> pen >> path;
+		auto traceItem = QSharedPointer<QGraphicsPathItem>::create(path);
+		traceItem->setPen(pen);
+		traceItem->setZValue(graphicsUtils::AbstractItem::ZValue::Marker);
+		mRobotTrace << traceItem;
+		emit traceItemAddedOrChanged(traceItem, false);
+	}
+
+	if (!mRobotTrace.isEmpty()) {
+		emit robotTraceAppearedOrDisappeared(true);
+	}
+}
+
 QPainterPath WorldModel::buildSolidItemsPath() const
 {
 	/// @todo Maintain a cache for this.
@@ -408,19 +490,19 @@ QDomElement WorldModel::serializeWorld(QDomElement &parent) const
 	QList<QString> wallsIds = mWalls.keys();
 	std::sort(wallsIds.begin(), wallsIds.end(), comparator);
 	for (const QString &wall : wallsIds) {
-		mWalls[wall]->serialize(walls);
+		serializeTrackedItem(*mWalls[wall], walls);
 	}
 
 	QDomElement skittles = parent.ownerDocument().createElement("skittles");
 	result.appendChild(skittles);
 	for (auto &&skittle : mSkittles) {
-		skittle->serialize(skittles);
+		serializeTrackedItem(*skittle, skittles);
 	}
 
 	QDomElement balls = parent.ownerDocument().createElement("balls");
 	result.appendChild(balls);
 	for (auto &&ball : mBalls) {
-		ball->serialize(balls);
+		serializeTrackedItem(*ball, balls);
 	}
 
 	QDomElement colorFields = parent.ownerDocument().createElement("colorFields");
@@ -428,7 +510,7 @@ QDomElement WorldModel::serializeWorld(QDomElement &parent) const
 	QList<QString> colorFieldsIds = mColorFields.keys();
 	std::sort(colorFieldsIds.begin(), colorFieldsIds.end(), comparator);
 	for (const QString &colorField : colorFieldsIds) {
-		mColorFields[colorField]->serialize(colorFields);
+		serializeTrackedItem(*mColorFields[colorField], colorFields);
 	}
 
 	QDomElement images = parent.ownerDocument().createElement("images");
@@ -454,6 +536,33 @@ QDomElement WorldModel::serializeWorld(QDomElement &parent) const
 	return result;
 }
 
+void WorldModel::trackChanges(graphicsUtils::AbstractItem &item)
+{
+	const QString id = item.id();
+	const auto forget = [this, id]() { mSerializedItems.remove(id); };
+	connect(&item, &graphicsUtils::AbstractItem::positionChanged, this, forget);
+	connect(&item, &graphicsUtils::AbstractItem::x1Changed, this, forget);
+	connect(&item, &graphicsUtils::AbstractItem::y1Changed, this, forget);
+	connect(&item, &graphicsUtils::AbstractItem::x2Changed, this, forget);
+	connect(&item, &graphicsUtils::AbstractItem::y2Changed, this, forget);
+	connect(&item, &graphicsUtils::AbstractItem::penChanged, this, forget);
+	connect(&item, &graphicsUtils::AbstractItem::brushChanged, this, forget);
+	// Reshaping by mouse (curve control points, for example) may change geometry without dedicated signals.
+	connect(&item, &graphicsUtils::AbstractItem::mouseInteractionStopped, this, forget);
+}
+
+void WorldModel::serializeTrackedItem(const graphicsUtils::AbstractItem &item, QDomElement &parent) const
+{
+	QDomElement serialized = mSerializedItems.value(item.id());
+	if (serialized.isNull()) {
+		QDomElement temporalParent = mXmlFactory->createElement("temporalParent");
+		serialized = item.serialize(temporalParent);
+		mSerializedItems[item.id()] = serialized;
+	}
+
+	parent.appendChild(parent.ownerDocument().importNode(serialized, true));
+}
+
 QDomElement WorldModel::serializeBlobs(QDomElement &parent) const
 {
 	QDomElement result = parent.ownerDocument().createElement("blobs");
@@ -461,9 +570,16 @@ QDomElement WorldModel::serializeBlobs(QDomElement &parent) const
 
 	QList<QString> imageIds = mImageItems.keys();
 	for (const QString &imageItem : imageIds) {
-		QDomElement image = parent.ownerDocument().createElement("image");
-		mImageItems[imageItem]->image()->serialize(image);
-		images.appendChild(image);
+		const QSharedPointer<Image> image = mImageItems[imageItem]->image();
+		QDomElement serialized = mSerializedImages.value(image->imageId());
+		if (serialized.isNull()) {
+			serialized = mXmlFactory->createElement("image");
+			image->serialize(serialized);
+			mSerializedImages[image->imageId()] = serialized;
+		}
+
+		// Image bytes are kept in a shared string, so copying the element does not copy them.
+		images.appendChild(parent.ownerDocument().importNode(serialized, true));
 	}
 
 	if (!images.childNodes().isEmpty()) {
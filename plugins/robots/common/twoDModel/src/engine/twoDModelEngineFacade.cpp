@@ -140,16 +140,31 @@ void TwoDModelEngineFacade::init(const kitBase::EventsForKitPluginInterface &eve
 				   &kitBase::InterpreterControlInterface::userStopRobot);
 	};
 
+	// Postponed changes belong to the project that is being saved or closed.
+	connect(&projectManager, &qReal::ProjectManagementInterface::beforeOpen
+			, mView, &view::TwoDModelWidget::flushChangesToRepo);
+	connect(&projectManager, &qReal::ProjectManagementInterface::beforeSave
+			, mView, &view::TwoDModelWidget::flushChangesToRepo);
+	connect(&projectManager, &qReal::ProjectManagementInterface::beforeClose
+			, mView, &view::TwoDModelWidget::flushChangesToRepo);
 	connect(&projectManager, &qReal::ProjectManagementInterface::afterOpen, this, reloadWorld);
 	connect(&projectManager, &qReal::ProjectManagementInterface::closed, this, reloadWorld);
 	connect(&systemEvents, &qReal::SystemEvents::activeTabChanged, this, onActiveTabChanged);
 
-	connect(mModel.data(), &model::Model::modelChanged, this, [&logicalModel](const QDomDocument &xml) {
-		logicalModel.mutableLogicalRepoApi().setMetaInformation("worldModel", xml.toString(4));
+	// Clicks and selections request saving too, unchanged world is not written to keep the project unmodified.
+	const auto saveToRepo = [&logicalModel](const QString &key, const QDomDocument &xml) {
+		const QString text = xml.toString(4);
+		if (logicalModel.logicalRepoApi().metaInformation(key).toString() != text) {
+			logicalModel.mutableLogicalRepoApi().setMetaInformation(key, text);
+		}
+	};
+
+	connect(mModel.data(), &model::Model::modelChanged, this, [saveToRepo](const QDomDocument &xml) {
+		saveToRepo("worldModel", xml);
 	});
 
-	connect(mModel.data(), &model::Model::blobsChanged, this, [&logicalModel](const QDomDocument &xml) {
-		logicalModel.mutableLogicalRepoApi().setMetaInformation("blobs", xml.toString(4));
+	connect(mModel.data(), &model::Model::blobsChanged, this, [saveToRepo](const QDomDocument &xml) {
+		saveToRepo("blobs", xml);
 	});
 
 	connect(&eventsForKitPlugin,
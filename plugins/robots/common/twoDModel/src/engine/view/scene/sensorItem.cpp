@@ -90,6 +90,11 @@ QRectF SensorItem::boundingRect() const
 	return mBoundingRect;
 }
 
+const PortInfo &SensorItem::port() const
+{
+	return mPort;
+}
+
 void SensorItem::mousePressEvent(QGraphicsSceneMouseEvent * event)
 {
 	AbstractItem::mousePressEvent(event);
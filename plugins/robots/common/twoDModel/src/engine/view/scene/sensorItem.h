@@ -46,6 +46,9 @@ public:
 
 	QRectF boundingRect() const override;
 
+	/// Returns a port the sensor is plugged into.
+	const kitBase::robotModel::PortInfo &port() const;
+
 	void changeDragState(qreal x, qreal y) override;
 	void resizeItem(QGraphicsSceneMouseEvent *event) override;
 
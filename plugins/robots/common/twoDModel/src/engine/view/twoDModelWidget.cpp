@@ -70,6 +70,9 @@ using namespace robotParts;
 const int speedFactors[] = { 2, 3, 4, 5, 6, 8, 10, 15, 20 };
 const int defaultSpeedFactorIndex = 3;
 
+/// Changes made within this interval are written to the repository at once.
+const int saveDelay = 300;
+
 TwoDModelWidget::TwoDModelWidget(Model &model, QWidget *parent)
 	: QWidget(parent)
 	, mUi(new Ui::TwoDModelWidget)
@@ -81,6 +84,10 @@ TwoDModelWidget::TwoDModelWidget(Model &model, QWidget *parent)
 {
 	setWindowIcon(QIcon(":/icons/2d-model.svg"));
 
+	mSaveTimer.setSingleShot(true);
+	mSaveTimer.setInterval(saveDelay);
+	connect(&mSaveTimer, &QTimer::timeout, this, &TwoDModelWidget::flushChangesToRepo);
+
 	initWidget();
 	initPalette();
 
@@ -95,7 +102,11 @@ TwoDModelWidget::TwoDModelWidget(Model &model, QWidget *parent)
 	connect(&*mScene, &TwoDModelScene::selectionChanged, this, &TwoDModelWidget::onSelectionChange);
 	connect(&*mScene, &TwoDModelScene::mousePressed, this, &TwoDModelWidget::refreshCursor);
 	connect(&*mScene, &TwoDModelScene::mouseReleased, this, &TwoDModelWidget::refreshCursor);
-	connect(&*mScene, &TwoDModelScene::mouseReleased, this, [this](){ saveWorldModelToRepo(); });
+	connect(&*mScene, &TwoDModelScene::mousePressed, this, [this]() { mSceneInteraction = true; });
+	connect(&*mScene, &TwoDModelScene::mouseReleased, this, [this]() {
+		mSceneInteraction = false;
+		saveWorldModelToRepo();
+	});
 	connect(&*mScene, &TwoDModelScene::robotPressed, mUi->palette, &Palette::unselect);
 	connect(&*mScene, &TwoDModelScene::robotListChanged, this, &TwoDModelWidget::onRobotListChange);
 
@@ -167,6 +178,7 @@ TwoDModelWidget::TwoDModelWidget(Model &model, QWidget *parent)
 
 TwoDModelWidget::~TwoDModelWidget()
 {
+	flushChangesToRepo();
 	mSelectedRobotItem = nullptr;
 	mScene.reset();
 	delete mUi;
@@ -661,12 +673,32 @@ SensorItem *TwoDModelWidget::sensorItem(const kitBase::robotModel::PortInfo &por
 
 void TwoDModelWidget::saveWorldModelToRepo()
 {
-	emit mModel.modelChanged(generateWorldModelXml());
+	mWorldModelSavePending = true;
+	if (!mSceneInteraction) {
+		mSaveTimer.start();
+	}
 }
 
 void TwoDModelWidget::saveBlobsToRepo()
 {
-	emit mModel.blobsChanged(generateBlobsXml());
+	mBlobsSavePending = true;
+	if (!mSceneInteraction) {
+		mSaveTimer.start();
+	}
+}
+
+void TwoDModelWidget::flushChangesToRepo()
+{
+	mSaveTimer.stop();
+	if (mBlobsSavePending) {
+		mBlobsSavePending = false;
+		emit mModel.blobsChanged(generateBlobsXml());
+	}
+
+	if (mWorldModelSavePending) {
+		mWorldModelSavePending = false;
+		emit mModel.modelChanged(generateWorldModelXml());
+	}
 }
 
 QDomDocument TwoDModelWidget::generateWorldModelXml() const
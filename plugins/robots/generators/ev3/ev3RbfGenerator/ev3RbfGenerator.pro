@@ -58,4 +58,5 @@ SOURCES += \
 RESOURCES += \
 	$$PWD/ev3RbfGenerator.qrc \
 	$$PWD/templates.qrc \
-	$$PWD/thirdparty.qrc \
+
+include($$PWD/lmsAssembler/lmsAssembler.pri)
@@ -15,15 +15,15 @@
 #include "ev3RbfGeneratorPlugin.h"
 
 #include <QtWidgets/QApplication>
-#include <QtCore/QDirIterator>
-#include <QtCore/QProcess>
 
+#include <qrutils/inFile.h>
 #include <qrutils/widgets/qRealMessageBox.h>
 #include <qrkernel/logging.h>
 #include <ev3Kit/communication/ev3RobotCommunicationThread.h>
 #include <ev3GeneratorBase/robotModel/ev3GeneratorRobotModel.h>
 #include <qrkernel/settingsManager.h>
 #include "ev3RbfMasterGenerator.h"
+#include "lmsAssembler/lmsAssembler.h"
 
 using namespace ev3::rbf;
 using namespace qReal;
@@ -121,22 +121,11 @@ QString Ev3RbfGeneratorPlugin::generatorName() const
 
 QString Ev3RbfGeneratorPlugin::uploadProgram()
 {
-	if (!javaInstalled()) {
-		mMainWindowInterface->errorReporter()->addError(tr("<a href=\"https://java.com/ru/download/\">Java</a> is "\
-				"not installed. Please download and install it."));
-		return QString();
-	}
-
 	QFileInfo const fileInfo = generateCodeForProcessing();
 	if (!fileInfo.exists()) {
 		return QString();
 	}
 
-	if (!copySystemFiles(fileInfo.absolutePath())) {
-		mMainWindowInterface->errorReporter()->addError(tr("Can't write source code files to disk!"));
-		return QString();
-	}
-
 	if (!compile(fileInfo)) {
 		QLOG_ERROR() << "EV3 bytecode compillation process failed!";
 		mMainWindowInterface->errorReporter()->addError(tr("Compilation error occured."));
@@ -189,30 +178,6 @@ void Ev3RbfGeneratorPlugin::stopRobot()
 	}
 }
 
-bool Ev3RbfGeneratorPlugin::javaInstalled()
-{
-	QProcess java;
-	java.setEnvironment(QProcess::systemEnvironment());
-
-	java.start("java");
-	java.waitForFinished();
-	return !java.readAllStandardError().isEmpty();
-}
-
-bool Ev3RbfGeneratorPlugin::copySystemFiles(const QString &destination)
-{
-	QDirIterator iterator(":/ev3/rbf/thirdparty");
-	while (iterator.hasNext()) {
-		const QFileInfo fileInfo(iterator.next());
-		const QString destFile = destination + "/" + fileInfo.fileName();
-		if (!QFile::exists(destFile) && !QFile::copy(fileInfo.absoluteFilePath(), destFile)) {
-			return false;
-		}
-	}
-
-	return true;
-}
-
 bool Ev3RbfGeneratorPlugin::compile(const QFileInfo &lmsFile)
 {
 	QFile rbfFile(lmsFile.absolutePath() + "/" + lmsFile.baseName() + ".rbf");
@@ -220,30 +185,31 @@ bool Ev3RbfGeneratorPlugin::compile(const QFileInfo &lmsFile)
 		rbfFile.remove();
 	}
 
-	QProcess java;
-	QEventLoop loop;
-	java.setEnvironment(QProcess::systemEnvironment());
-	java.setWorkingDirectory(lmsFile.absolutePath());
-	java.setProgram("java");
-	java.setArguments({"-jar", "assembler.jar", lmsFile.baseName()});
-
-	connect(&java, &QProcess::readyRead, &loop, [&java]() { QLOG_INFO() << java.readAll(); });
-	connect(&java, &QProcess::errorOccurred, &loop, [&java, &loop](QProcess::ProcessError e) {
-		QLOG_ERROR() << "Failed to start process (status" << e << "):"
-					 << java.program() << java.arguments();
-		loop.quit();
-	});
-	connect(&java, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished)
-		, &loop, [&loop, &java](int e, QProcess::ExitStatus s) {
-		if (e || s != QProcess::ExitStatus::NormalExit) {
-			QLOG_ERROR() << "Failed to execute process (errCode:" << e << ", exitStatus:" << s << "):"
-						 << java.program() << java.arguments();
-		}
-		loop.quit();
-	});
+	QString errorString;
+	const QString source = utils::InFile::readAll(lmsFile.absoluteFilePath(), &errorString);
+	if (!errorString.isEmpty()) {
+		mMainWindowInterface->errorReporter()->addError(tr("Could not read %1: %2")
+				.arg(lmsFile.absoluteFilePath(), errorString));
+		return false;
+	}
+
+	LmsAssembler assembler;
+	const QByteArray rbf = assembler.assemble(source);
+	for (const QString &error : assembler.errors()) {
+		mMainWindowInterface->errorReporter()->addError(error);
+	}
+
+	if (rbf.isEmpty()) {
+		return false;
+	}
+
+	if (!rbfFile.open(QIODevice::WriteOnly) || rbfFile.write(rbf) != rbf.size()) {
+		QLOG_ERROR() << "Failed to write" << rbfFile.fileName() << ":" << rbfFile.errorString();
+		mMainWindowInterface->errorReporter()->addError(tr("Could not write %1: %2")
+				.arg(rbfFile.fileName(), rbfFile.errorString()));
+		return false;
+	}
 
-	java.start();
-	loop.exec();
 	return true;
 }
 
@@ -54,11 +54,10 @@ private:
 	/// Generates, uploads and starts script on the EV3 robot.
 	void runProgram();
 
-	/// Function that checks installed JRE or not
-	bool javaInstalled();
-
-	bool copySystemFiles(const QString &destination);
+	/// Assembles given LMS file into RBF file with the same base name in the same folder.
+	/// Assembler errors are shown to the user via error reporter.
 	bool compile(const QFileInfo &lmsFile);
+
 	/// @returns path to uploaded file on EV3 brick if it was uploaded successfully or empty string otherwise.
 	QString upload(const QFileInfo &lmsFile);
 
@@ -0,0 +1,1008 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "lmsAssembler.h"
+
+#include <cmath>
+#include <cstring>
+
+#include <QtCore/QFile>
+#include <QtCore/QLocale>
+#include <QtCore/QObject>
+#include <QtCore/QRegularExpression>
+
+using namespace ev3::rbf;
+
+namespace {
+
+const QString bytecodesHeader = ":/ev3/rbf/thirdparty/bytecodes.h";
+const QString bytecodesSource = ":/ev3/rbf/thirdparty/bytecodes.c";
+
+/// Program header: "LEGO", image size, bytecode version, objects count and globals size.
+const int programHeaderSize = 16;
+
+/// Object header: offset of code, owner, trigger count and locals size.
+const int objectHeaderSize = 12;
+
+/// Protects from endless recursion in definitions like "define a a".
+const int maxDefinitionDepth = 32;
+
+/// Java's (long) cast, used by the reference implementation for all bit operations.
+qint64 toLong(double value)
+{
+	if (std::isnan(value)) {
+		return 0;
+	}
+
+	return static_cast<qint64>(qBound(-9.0e18, value, 9.0e18));
+}
+
+/// Long.parseLong(): optional sign and digits of given base.
+bool parseLong(const QString &text, int base, double &result)
+{
+	static const QString digits = "0123456789abcdefghijklmnopqrstuvwxyz";
+	const int start = text.startsWith('+') || text.startsWith('-') ? 1 : 0;
+	if (start == text.length()) {
+		return false;
+	}
+
+	for (int i = start; i < text.length(); ++i) {
+		const int digit = digits.indexOf(text[i].toLower());
+		if (digit < 0 || digit >= base) {
+			return false;
+		}
+	}
+
+	bool ok = false;
+	const qint64 value = text.toLongLong(&ok, base);
+	result = value;
+	return ok;
+}
+
+/// JLogo's number recognition: a restricted set of characters and then Double.valueOf().
+bool parseDouble(const QString &text, double &result)
+{
+	static const QString firstCharacters = "eE.+-0123456789";
+	static const QString otherCharacters = "eE.0123456789";
+	static const QRegularExpression javaDouble("^[+-]?(\\d+\\.?\\d*|\\.\\d+)([eE]\\d+)?$");
+
+	if (text.isEmpty() || !firstCharacters.contains(text[0]) || (text.length() == 1 && !text[0].isDigit())) {
+		return false;
+	}
+
+	for (int i = 1; i < text.length(); ++i) {
+		if (!otherCharacters.contains(text[i])) {
+			return false;
+		}
+	}
+
+	if (!javaDouble.match(text).hasMatch()) {
+		return false;
+	}
+
+	bool ok = false;
+	result = text.toDouble(&ok);
+	return ok;
+}
+
+double align(double offset, double alignment)
+{
+	return alignment * toLong((offset + alignment - 1) / alignment);
+}
+
+void appendInt16(QByteArray &bytes, qint64 value)
+{
+	bytes.append(static_cast<char>(value & 0xff));
+	bytes.append(static_cast<char>((value >> 8) & 0xff));
+}
+
+void appendInt32(QByteArray &bytes, qint64 value)
+{
+	appendInt16(bytes, value & 0xffff);
+	appendInt16(bytes, (value >> 16) & 0xffff);
+}
+
+QString readResource(const QString &path)
+{
+	QFile file(path);
+	if (!file.open(QIODevice::ReadOnly)) {
+		return QString();
+	}
+
+	return QString::fromUtf8(file.readAll());
+}
+
+}
+
+LmsAssembler::Value LmsAssembler::Value::fromNumber(double number)
+{
+	Value result;
+	result.kind = Kind::number;
+	result.number = number;
+	return result;
+}
+
+LmsAssembler::Value LmsAssembler::Value::fromWord(const QString &word)
+{
+	Value result;
+	result.kind = Kind::word;
+	result.text = word;
+	return result;
+}
+
+bool LmsAssembler::Value::isNone() const
+{
+	return kind == Kind::none;
+}
+
+bool LmsAssembler::Value::isNumber() const
+{
+	return kind == Kind::number;
+}
+
+QString LmsAssembler::Value::toString() const
+{
+	switch (kind) {
+	case Kind::number:
+		return number == std::floor(number) && !std::isinf(number)
+				? QString::number(toLong(number))
+				: QString::number(number, 'g', QLocale::FloatingPointShortest);
+	case Kind::string:
+	case Kind::word:
+		return text;
+	default:
+		return QString();
+	}
+}
+
+LmsAssembler::LmsAssembler()
+{
+	// Parsing firmware tables on construction keeps the first assemble() call as fast as the others.
+	firmware();
+}
+
+QByteArray LmsAssembler::assemble(const QString &source)
+{
+	const Firmware &tables = firmware();
+	mSymbols = tables.symbols;
+	mObjects.clear();
+	mThisObject.clear();
+	mLocals.clear();
+	mNextGlobal = 0;
+	mNextLocal = 0;
+	mCode.clear();
+	mErrors.clear();
+
+	if (tables.symbols.isEmpty()) {
+		error(QObject::tr("EV3 bytecode tables are not available"));
+		return QByteArray();
+	}
+
+	QList<QList<Value>> code;
+	for (const QString &line : lines(preprocess(source))) {
+		const QList<Value> tokens = parse(line);
+		if (!tokens.isEmpty()) {
+			code << tokens;
+		}
+	}
+
+	pass0(code);
+	pass1(code);
+	const QByteArray result = pass2();
+	return mErrors.isEmpty() ? result : QByteArray();
+}
+
+QStringList LmsAssembler::errors() const
+{
+	return mErrors;
+}
+
+const LmsAssembler::Firmware &LmsAssembler::firmware()
+{
+	static const Firmware result = []() {
+		Firmware firmware;
+		const QString header = preprocess(readResource(bytecodesHeader));
+		readEnums(header, firmware.symbols);
+		readEnums(preprocess(readResource(bytecodesSource)), firmware.symbols);
+		readDefines(header, firmware);
+		return firmware;
+	}();
+
+	return result;
+}
+
+void LmsAssembler::readEnums(const QString &preprocessed, QHash<QString, Symbol> &symbols)
+{
+	// Like the reference implementation, takes "name = value" lines between a line mentioning enum
+	// and a line with closing brace. Names starting with "op" are opcodes.
+	const QStringList source = lines(preprocessed);
+	int index = 0;
+	while (true) {
+		while (index < source.size() && !source[index++].contains("enum", Qt::CaseInsensitive)) {
+		}
+
+		if (index >= source.size()) {
+			return;
+		}
+
+		while (index < source.size()) {
+			const QString &line = source[index++];
+			if (line.contains('}')) {
+				break;
+			}
+
+			const QList<Value> tokens = parse(line);
+			if (tokens.size() != 3 || tokens[1].toString() != "=") {
+				continue;
+			}
+
+			const QString name = tokens[0].toString();
+			if (name.startsWith("op")) {
+				symbols[name.mid(2)].op = tokens[2];
+			} else {
+				Symbol &symbol = symbols[name];
+				symbol.type = "enum";
+				symbol.value = tokens[2];
+			}
+		}
+	}
+}
+
+void LmsAssembler::readDefines(const QString &preprocessed, Firmware &firmware)
+{
+	for (QString line : lines(preprocessed)) {
+		const QList<Value> tokens = parse(line.replace('"', '\''));
+		if (tokens.size() < 3 || tokens[0].toString() != "#define") {
+			continue;
+		}
+
+		const QString name = tokens[1].toString();
+		if (name == "BYTECODE_VERSION") {
+			double version = 0;
+			toNumber(tokens.last(), version);
+			firmware.version = toLong(version * 100);
+		} else if (name.startsWith("vm")) {
+			Symbol &symbol = firmware.symbols[name.mid(2)];
+			symbol.type = "define";
+			symbol.value = tokens[2];
+		}
+	}
+}
+
+QString LmsAssembler::preprocess(const QString &source)
+{
+	QString text = source;
+	text.replace("\r\n", "\n").replace('\r', '\n');
+
+	const auto peek = [&text](int position) {
+		return position < text.length() ? text[position] : QChar();
+	};
+
+	QString result;
+	result.reserve(text.length());
+	int position = 0;
+	while (position < text.length()) {
+		const QChar c = text[position++];
+		if (c == '(' || c == ')' || c == ',') {
+			result += ' ';
+		} else if (c == '/' && peek(position) == '/') {
+			// Line comment, line break is kept.
+			while (position < text.length()) {
+				if (text[position++] == '\n') {
+					result += '\n';
+					break;
+				}
+			}
+		} else if (c == '/' && peek(position) == '*') {
+			// Block comment. Like in the reference implementation, two characters after the slash are skipped
+			// before looking for the end of comment, so "/**/" does not close itself.
+			position += 2;
+			while (position < text.length()) {
+				if (text[position++] == '*' && peek(position) == '/') {
+					++position;
+					break;
+				}
+			}
+		} else if (c == '\'') {
+			// Spaces and tabs in strings are escaped to survive whitespace cleanup.
+			result += c;
+			while (true) {
+				if (position >= text.length()) {
+					result += '\'';
+					break;
+				}
+
+				const QChar next = text[position++];
+				if (next == '\'') {
+					result += next;
+					break;
+				} else if (next == ' ') {
+					result += "\\s";
+				} else if (next == '\\' && peek(position) == '\'') {
+					++position;
+					result += "\\q";
+				} else if (next == '\t') {
+					result += "\\t";
+				} else {
+					result += next;
+				}
+			}
+		} else {
+			result += c;
+		}
+	}
+
+	static const QRegularExpression emptyLines("\\n[\\s\\n]*\\n");
+	static const QRegularExpression leadingLineBreaks("^\\n*");
+	static const QRegularExpression trailingSpaces("[\\n\\t\\s]*$");
+	static const QRegularExpression spaces("[ \\t]+");
+	static const QRegularExpression continuedAssignment("\\s*=\\s*\\n\\s*");
+
+	result.replace(emptyLines, "\n");
+	result.replace(leadingLineBreaks, QString());
+	result.replace(trailingSpaces, QString());
+	result.replace(spaces, " ");
+	result.replace("\\s", " ");
+	result.replace(continuedAssignment, " ");
+	return result;
+}
+
+QStringList LmsAssembler::lines(const QString &preprocessed)
+{
+	return preprocessed.isEmpty() ? QStringList() : preprocessed.split('\n');
+}
+
+QList<LmsAssembler::Value> LmsAssembler::parse(const QString &line)
+{
+	static const QString delimiters = "()[] \t\n";
+	static const QString spaces = " ;\t\n";
+
+	int position = 0;
+	const auto skipSpaces = [&line, &position]() {
+		while (position < line.length() && spaces.contains(line[position])) {
+			if (line[position] == ';') {
+				while (position < line.length() && line[position] != '\n') {
+					++position;
+				}
+			} else {
+				++position;
+			}
+		}
+	};
+
+	QList<Value> result;
+	skipSpaces();
+	while (position < line.length()) {
+		QString token;
+		if (delimiters.contains(line[position])) {
+			token = line[position++];
+		} else {
+			while (position < line.length() && !delimiters.contains(line[position])) {
+				if (line[position] != '\'') {
+					token += line[position++];
+					continue;
+				}
+
+				// Quote starts a string up to the next single quote, doubled quote stands for the quote itself.
+				token += '\'';
+				++position;
+				while (position < line.length()) {
+					if (line[position] == '\'') {
+						++position;
+						if (position >= line.length() || line[position] != '\'') {
+							break;
+						}
+					}
+
+					token += line[position++];
+				}
+
+				break;
+			}
+		}
+
+		skipSpaces();
+		result << readToken(token);
+	}
+
+	return result;
+}
+
+LmsAssembler::Value LmsAssembler::readToken(const QString &token)
+{
+	double number = 0;
+	if ((token.length() > 2 && token.startsWith("0x") && parseLong(token.mid(2), 16, number))
+			|| (token.length() > 1 && token.startsWith('$') && parseLong(token.mid(1), 16, number))
+			|| (token.length() > 1 && token.startsWith('0') && parseLong(token.mid(1), 8, number))
+			|| parseDouble(token, number))
+	{
+		return Value::fromNumber(number);
+	}
+
+	if (token.startsWith('\'')) {
+		Value result;
+		result.kind = Value::Kind::string;
+		result.text = token.mid(1);
+		return result;
+	}
+
+	return Value::fromWord(token);
+}
+
+bool LmsAssembler::toNumber(const Value &value, double &result)
+{
+	if (value.isNumber()) {
+		result = value.number;
+		return true;
+	}
+
+	return (value.kind == Value::Kind::word || value.kind == Value::Kind::string) && parseDouble(value.text, result);
+}
+
+bool LmsAssembler::isOperator(const QString &token)
+{
+	return token == "+" || token == "-" || token == "*" || token == "/";
+}
+
+bool LmsAssembler::isParam(const QString &token)
+{
+	static const QRegularExpression params("^((IN|OUT|IO)_(8|16|32|F|S))*$");
+	return params.match(token).hasMatch();
+}
+
+QList<LmsAssembler::Value> LmsAssembler::constant(double value)
+{
+	const qint64 bits = toLong(value);
+	if (value > -32 && value < 32) {
+		return { Value::fromNumber(bits & 0x3f) };
+	}
+
+	if (value > -128 && value < 128) {
+		return { Value::fromNumber(0x81), Value::fromNumber(bits & 0xff) };
+	}
+
+	if (value > -32768 && value < 32768) {
+		return { Value::fromNumber(0x82), Value::fromNumber(bits & 0xff), Value::fromNumber((bits >> 8) & 0xff) };
+	}
+
+	return { Value::fromNumber(0x83), Value::fromNumber(bits & 0xff), Value::fromNumber((bits >> 8) & 0xff)
+			, Value::fromNumber((bits >> 16) & 0xff), Value::fromNumber((bits >> 24) & 0xff) };
+}
+
+QList<LmsAssembler::Value> LmsAssembler::handle(double offset)
+{
+	const qint64 bits = toLong(offset);
+	if (offset > -128 && offset < 128) {
+		return { Value::fromNumber(0x91), Value::fromNumber(bits & 0xff) };
+	}
+
+	// High byte is not masked in the reference implementation, it is truncated when written.
+	return { Value::fromNumber(0x92), Value::fromNumber(bits & 0xff), Value::fromNumber(bits >> 8) };
+}
+
+QList<LmsAssembler::Value> LmsAssembler::address(double offset)
+{
+	const qint64 bits = toLong(offset);
+	if (offset > -128 && offset < 128) {
+		return { Value::fromNumber(0x89), Value::fromNumber(bits & 0xff) };
+	}
+
+	if (offset > -32768 && offset < 32768) {
+		return { Value::fromNumber(0x8a), Value::fromNumber(bits & 0xff), Value::fromNumber((bits >> 8) & 0xff) };
+	}
+
+	return { Value::fromNumber(0x8b), Value::fromNumber(bits & 0xff), Value::fromNumber((bits >> 8) & 0xff)
+			, Value::fromNumber((bits >> 16) & 0xff), Value::fromNumber((bits >> 24) & 0xff) };
+}
+
+QList<LmsAssembler::Value> LmsAssembler::addBits(int bits, QList<Value> operand)
+{
+	operand.first().number += bits;
+	return operand;
+}
+
+const LmsAssembler::Symbol &LmsAssembler::symbol(const QString &name) const
+{
+	static const Symbol unknown;
+	const auto it = mSymbols.constFind(name);
+	return it == mSymbols.constEnd() ? unknown : it.value();
+}
+
+LmsAssembler::Symbol &LmsAssembler::mutableSymbol(const QString &name)
+{
+	return mSymbols[name];
+}
+
+QString LmsAssembler::localName(const QString &name) const
+{
+	return mThisObject + "-" + name;
+}
+
+void LmsAssembler::pass0(const QList<QList<Value>> &code)
+{
+	// Declares objects, definitions and labels, counts parameters of subcalls.
+	mThisObject.clear();
+	for (const QList<Value> &line : code) {
+		const QString token = line.first().toString();
+		if (token == "vmthread" || token == "subcall") {
+			const QString name = line.value(1).toString();
+			if (name.isEmpty()) {
+				error(QObject::tr("Name of %1 is missing").arg(token));
+				continue;
+			}
+
+			mObjects << name;
+			Symbol &object = mutableSymbol(name);
+			object.value = Value::fromNumber(mObjects.size());
+			object.type = token;
+			object.params = Value::fromNumber(0);
+			mThisObject = name;
+		} else if (token == "define") {
+			Symbol &definition = mutableSymbol(line.value(1).toString());
+			definition.value = expression(line.mid(2));
+			definition.type = "define";
+		} else if (token.endsWith(':')) {
+			const QString name = token.left(token.length() - 1);
+			Symbol &label = mutableSymbol(localName(name));
+			label.value = Value::fromWord("undefined");
+			label.type = "label";
+			mutableSymbol(name).type = "label";
+		} else if (isParam(token)) {
+			if (mThisObject.isEmpty()) {
+				error(QObject::tr("Parameter %1 is declared outside of subcall").arg(line.value(1).toString()));
+				continue;
+			}
+
+			Symbol &object = mutableSymbol(mThisObject);
+			object.params = Value::fromNumber(object.params.number + 1);
+		}
+	}
+}
+
+void LmsAssembler::pass1(const QList<QList<Value>> &code)
+{
+	// Allocates variables and translates instructions, labels are left as symbols.
+	mThisObject.clear();
+	for (const QList<Value> &line : code) {
+		if (mThisObject.isEmpty()) {
+			pass1Outside(line);
+		} else {
+			pass1Inside(line);
+		}
+	}
+}
+
+void LmsAssembler::pass1Outside(const QList<Value> &line)
+{
+	const QString token = line.first().toString();
+	if (token == "vmthread" || token == "subcall") {
+		mThisObject = line.value(1).toString();
+		add({ Value::fromWord("&" + mThisObject) });
+		if (token == "subcall") {
+			add({ symbol(mThisObject).params });
+		}
+	} else if (token == "global") {
+		setupGlobal(line.value(1), expression(line.mid(2)));
+	} else {
+		// Everything else, like definitions or thread forward declarations, takes no place in the image.
+		setupData(line, true);
+	}
+}
+
+void LmsAssembler::pass1Inside(const QList<Value> &line)
+{
+	const QString token = line.first().toString();
+	if (token.endsWith(':')) {
+		add({ Value::fromWord(localName(token)) });
+	} else if (token == "local") {
+		setupLocal(line.value(1), expression(line.mid(2)));
+	} else if (setupData(line, false)) {
+		return;
+	} else if (isParam(token)) {
+		setupParam(line);
+	} else if (token == "}") {
+		pass1ObjectEnd();
+	} else if (token != "{") {
+		pass1Instruction(line);
+	}
+}
+
+void LmsAssembler::pass1Instruction(QList<Value> line)
+{
+	const Value name = line.first();
+	const Value op = name.isNumber() ? Value() : symbol(name.toString()).op;
+	if (op.isNone()) {
+		error(QObject::tr("Unknown instruction %1").arg(name.toString()));
+		return;
+	}
+
+	if (name.toString() == "CALL" && line.size() > 1) {
+		// Number of parameters of the callee goes right after its index.
+		const Symbol &callee = symbol(line[1].toString());
+		if (callee.type == "subcall") {
+			line.insert(2, callee.params);
+		}
+	}
+
+	QList<Value> instruction = { op };
+	for (int i = 1; i < line.size(); ++i) {
+		instruction << argument(line[i]);
+	}
+
+	add(instruction);
+}
+
+void LmsAssembler::pass1ObjectEnd()
+{
+	mutableSymbol(mThisObject).locals = Value::fromNumber(mNextLocal);
+	for (const QString &local : mLocals) {
+		mutableSymbol(local).local = Value();
+	}
+
+	mLocals.clear();
+	mNextLocal = 0;
+
+	if (symbol(mThisObject).type == "subcall") {
+		add({ symbol("RETURN").op });
+	}
+
+	add({ symbol("OBJECT_END").op });
+	mThisObject.clear();
+}
+
+QByteArray LmsAssembler::pass2()
+{
+	// Every label reference is encoded as LC2 offset relative to the end of the reference itself,
+	// so label positions are known before anything is emitted.
+	const double headerSize = programHeaderSize + objectHeaderSize * mObjects.size();
+	double pc = headerSize;
+	for (const Value &item : mCode) {
+		double value = 0;
+		if (toNumber(item, value)) {
+			++pc;
+			continue;
+		}
+
+		const QString text = item.toString();
+		if (text.endsWith(':')) {
+			mutableSymbol(text.left(text.length() - 1)).value = Value::fromNumber(pc);
+		} else if (text.startsWith('&')) {
+			mutableSymbol(text.mid(1)).offset = Value::fromNumber(pc);
+		} else {
+			pc += 3;
+		}
+	}
+
+	QByteArray code;
+	for (const Value &item : mCode) {
+		double value = 0;
+		if (toNumber(item, value)) {
+			code.append(static_cast<char>(toLong(value) & 0xff));
+			continue;
+		}
+
+		const QString text = item.toString();
+		const Symbol &label = symbol(text);
+		if (label.type != "label") {
+			continue;
+		}
+
+		double target = 0;
+		if (!toNumber(label.value, target)) {
+			error(QObject::tr("Label %1 is not defined").arg(text));
+			continue;
+		}
+
+		const qint64 offset = toLong(target - (headerSize + code.size()) - 3);
+		code.append(static_cast<char>(0x82));
+		appendInt16(code, offset);
+	}
+
+	QByteArray result("LEGO");
+	appendInt32(result, toLong(pc));
+	appendInt16(result, firmware().version);
+	appendInt16(result, mObjects.size());
+	appendInt32(result, toLong(mNextGlobal));
+
+	for (const QString &object : mObjects) {
+		const Symbol &properties = symbol(object);
+		double offset = 0;
+		double locals = 0;
+		if (!toNumber(properties.offset, offset) || !toNumber(properties.locals, locals)) {
+			error(QObject::tr("Object %1 is not closed").arg(object));
+			continue;
+		}
+
+		appendInt32(result, toLong(offset));
+		appendInt16(result, 0);
+		appendInt16(result, properties.type == "subcall" ? 1 : 0);
+		appendInt32(result, toLong(locals));
+	}
+
+	return result + code;
+}
+
+bool LmsAssembler::setupData(const QList<Value> &line, bool isGlobal)
+{
+	static const QHash<QString, int> scalarSizes = {
+		{ "DATA8", 1 }
+		, { "DATA16", 2 }
+		, { "HANDLE", 2 }
+		, { "DATA32", 4 }
+		, { "DATAF", 4 }
+	};
+
+	static const QHash<QString, int> elementSizes = {
+		{ "DATAS", 1 }
+		, { "ARRAY8", 1 }
+		, { "ARRAY16", 2 }
+		, { "ARRAY32", 4 }
+		, { "ARRAYF", 4 }
+	};
+
+	const QString token = line.first().toString();
+	Value size;
+	if (scalarSizes.contains(token)) {
+		size = Value::fromNumber(scalarSizes[token]);
+	} else if (elementSizes.contains(token)) {
+		const Value count = expression(line.mid(2));
+		size = Value::fromNumber(elementSizes[token] * number(count, line.value(1).toString()));
+	} else {
+		return false;
+	}
+
+	if (isGlobal) {
+		setupGlobal(line.value(1), size);
+	} else {
+		setupLocal(line.value(1), size);
+	}
+
+	return true;
+}
+
+void LmsAssembler::setupParam(const QList<Value> &line)
+{
+	// Parameter type code and size, zero size means string which size is given explicitly.
+	static const QHash<QString, QPair<int, int>> params = {
+		{ "IN_8", { 0x80, 1 } }
+		, { "IN_16", { 0x81, 2 } }
+		, { "IN_32", { 0x82, 4 } }
+		, { "IN_F", { 0x83, 4 } }
+		, { "IN_S", { 0x84, 0 } }
+		, { "OUT_8", { 0x40, 1 } }
+		, { "OUT_16", { 0x41, 2 } }
+		, { "OUT_32", { 0x42, 4 } }
+		, { "OUT_F", { 0x43, 4 } }
+		, { "OUT_S", { 0x44, 0 } }
+		, { "IO_8", { 0xc0, 1 } }
+		, { "IO_16", { 0xc1, 2 } }
+		, { "IO_32", { 0xc2, 4 } }
+		, { "IO_F", { 0xc3, 4 } }
+		, { "IO_S", { 0xc4, 0 } }
+	};
+
+	const auto param = params.constFind(line.first().toString());
+	if (param == params.constEnd()) {
+		return;
+	}
+
+	const bool isString = param.value().second == 0;
+	const Value size = isString ? paramSize(line.value(2)) : Value::fromNumber(param.value().second);
+	setupLocal(line.value(1), size);
+	add({ Value::fromNumber(param.value().first) });
+	if (isString) {
+		add({ size });
+	}
+}
+
+void LmsAssembler::setupGlobal(const Value &name, const Value &size)
+{
+	const double length = number(size, name.toString());
+	if (length == 2 || length == 4) {
+		mNextGlobal = align(mNextGlobal, length);
+	}
+
+	Symbol &global = mutableSymbol(name.toString());
+	global.value = Value::fromNumber(mNextGlobal);
+	global.type = "global";
+	mNextGlobal += length;
+}
+
+void LmsAssembler::setupLocal(const Value &name, const Value &size)
+{
+	const double length = number(size, name.toString());
+	if (length == 2 || length == 4) {
+		mNextLocal = align(mNextLocal, length);
+	}
+
+	mutableSymbol(name.toString()).local = Value::fromNumber(mNextLocal);
+	mNextLocal += length;
+	mLocals << name.toString();
+}
+
+QList<LmsAssembler::Value> LmsAssembler::argument(const Value &argument, int depth)
+{
+	if (argument.kind == Value::Kind::string) {
+		return string(argument.text);
+	}
+
+	double value = 0;
+	if (toNumber(argument, value)) {
+		return constant(value);
+	}
+
+	const QString text = argument.toString();
+	if (argument.kind == Value::Kind::invalid || text.isEmpty()) {
+		error(QObject::tr("Invalid operand"));
+		return {};
+	}
+
+	if (text.endsWith('F') && toNumber(Value::fromWord(text.left(text.length() - 1)), value)) {
+		const float single = static_cast<float>(value);
+		qint32 bits = 0;
+		std::memcpy(&bits, &single, sizeof(bits));
+		return constant(bits);
+	}
+
+	if (text.startsWith('@') || text.startsWith('&')) {
+		return handleOrAddress(text.mid(1), text.startsWith('@'));
+	}
+
+	const Symbol &properties = symbol(text);
+	if (!properties.local.isNone()) {
+		return addBits(0x40, constant(properties.local.number));
+	}
+
+	if (properties.type == "enum" || properties.type == "subcall") {
+		return constant(number(properties.value, text));
+	} else if (properties.type == "global") {
+		return addBits(0x60, constant(properties.value.number));
+	} else if (properties.type == "label") {
+		return { Value::fromWord(localName(text)) };
+	} else if (properties.type == "vmthread") {
+		return { properties.value };
+	} else if (properties.type == "define" && depth < maxDefinitionDepth) {
+		return this->argument(properties.value, depth + 1);
+	}
+
+	error(QObject::tr("Undefined symbol %1").arg(text));
+	return {};
+}
+
+QList<LmsAssembler::Value> LmsAssembler::handleOrAddress(const QString &name, bool isHandle)
+{
+	const Symbol &properties = symbol(name);
+	if (!properties.local.isNone()) {
+		return addBits(0x40, isHandle ? handle(properties.local.number) : address(properties.local.number));
+	}
+
+	if (properties.type == "global") {
+		return addBits(0x60, isHandle ? handle(properties.value.number) : address(properties.value.number));
+	}
+
+	error(QObject::tr("Undefined symbol %1").arg(name));
+	return {};
+}
+
+QList<LmsAssembler::Value> LmsAssembler::string(const QString &string) const
+{
+	// Two-character strings starting with underscore denote character codes.
+	if (string.length() == 2 && string[0] == '_') {
+		return constant(string[1].unicode());
+	}
+
+	QString text = string;
+	text.replace("\\r", "\r").replace("\\n", "\n").replace("\\q", "'").replace("\\t", "\t");
+
+	QList<Value> result = { Value::fromNumber(0x80) };
+	for (const QChar c : text) {
+		result << Value::fromNumber(c.unicode());
+	}
+
+	result << Value::fromNumber(0);
+	return result;
+}
+
+LmsAssembler::Value LmsAssembler::expression(const QList<Value> &tokens) const
+{
+	QList<Value> values;
+	bool hasOperators = false;
+	for (const Value &token : tokens) {
+		double value = 0;
+		if (isOperator(token.toString())) {
+			hasOperators = true;
+			values << token;
+		} else if (token.kind == Value::Kind::string || toNumber(token, value)) {
+			values << token;
+		} else {
+			values << symbol(token.toString()).value;
+		}
+	}
+
+	if (values.size() == 1) {
+		return values.first();
+	}
+
+	Value invalid;
+	invalid.kind = Value::Kind::invalid;
+	if (!hasOperators || values.size() % 2 == 0) {
+		return invalid;
+	}
+
+	// Infix arithmetics, multiplication and division take precedence over addition and subtraction.
+	double sum = 0;
+	double term = 0;
+	if (!toNumber(values.first(), term)) {
+		return invalid;
+	}
+
+	for (int i = 1; i < values.size(); i += 2) {
+		const QString op = values[i].toString();
+		double operand = 0;
+		if (!isOperator(op) || !toNumber(values[i + 1], operand)) {
+			return invalid;
+		}
+
+		if (op == "*") {
+			term *= operand;
+		} else if (op == "/") {
+			term /= operand;
+		} else {
+			sum += term;
+			term = op == "-" ? -operand : operand;
+		}
+	}
+
+	return Value::fromNumber(sum + term);
+}
+
+LmsAssembler::Value LmsAssembler::paramSize(const Value &value)
+{
+	double size = 0;
+	if (toNumber(value, size)) {
+		return Value::fromNumber(size);
+	}
+
+	const Symbol &properties = symbol(value.toString());
+	if (properties.type == "enum" || properties.type == "define") {
+		return Value::fromNumber(number(properties.value, value.toString()));
+	}
+
+	error(QObject::tr("Undefined symbol %1").arg(value.toString()));
+	return Value::fromNumber(0);
+}
+
+double LmsAssembler::number(const Value &value, const QString &what)
+{
+	double result = 0;
+	if (!toNumber(value, result)) {
+		error(QObject::tr("Invalid size or value of %1").arg(what));
+	}
+
+	return result;
+}
+
+void LmsAssembler::add(const QList<Value> &items)
+{
+	for (const Value &item : items) {
+		if (!item.isNone()) {
+			mCode << item;
+		}
+	}
+}
+
+void LmsAssembler::error(const QString &message)
+{
+	mErrors << (mThisObject.isEmpty() ? message : QObject::tr("%1 in %2").arg(message, mThisObject));
+}
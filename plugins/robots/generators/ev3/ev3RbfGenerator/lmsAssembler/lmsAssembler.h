@@ -0,0 +1,156 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QStringList>
+
+namespace ev3 {
+namespace rbf {
+
+/// Translates EV3 LMS assembly code into RBF bytecode image in memory.
+/// This is a port of the reference LMS assembler (assembler.logo running on JLogo) that was used by the generator
+/// via Java: it preprocesses the source the same way, allocates globals and locals with the same alignment rules,
+/// counts subcall parameters, resolves labels with the same relative offset encoding and produces byte-for-byte
+/// identical images. Opcodes, enumerations and "vm" constants are read from bytecodes.h and bytecodes.c firmware
+/// headers stored in plugin resources; the tables are parsed once per process and shared by all assemblers.
+/// Unlike the reference implementation, unknown instructions, undefined symbols and labels are reported as errors
+/// instead of silently producing broken bytecode.
+class LmsAssembler
+{
+public:
+	LmsAssembler();
+
+	/// Assembles given LMS source code.
+	/// @returns RBF image or empty array if assembling failed, in that case errors() describe the reason.
+	QByteArray assemble(const QString &source);
+
+	/// Returns human-readable descriptions of problems found during last assemble() call.
+	QStringList errors() const;
+
+private:
+	/// Logo word, number or quoted string, whatever appears in the source or in the symbol properties.
+	struct Value
+	{
+		enum class Kind
+		{
+			none
+			, number
+			, string
+			, word
+			/// Expression that could not be evaluated, it is an error to use it.
+			, invalid
+		};
+
+		Kind kind = Kind::none;
+		double number = 0;
+		QString text;
+
+		static Value fromNumber(double number);
+		static Value fromWord(const QString &word);
+
+		bool isNone() const;
+		bool isNumber() const;
+
+		/// Returns textual representation of the value, the one that is used in comparisons.
+		QString toString() const;
+	};
+
+	/// Properties of a symbol. Unlike in the reference implementation, properties of the symbols mentioned
+	/// in a program are never written back into the shared table of firmware symbols.
+	struct Symbol
+	{
+		QString type;
+		Value value;
+		Value op;
+		Value local;
+		Value params;
+		Value locals;
+		Value offset;
+	};
+
+	/// Tables of symbols from firmware headers.
+	struct Firmware
+	{
+		QHash<QString, Symbol> symbols;
+		int version = 0;
+	};
+
+	static const Firmware &firmware();
+	static void readEnums(const QString &preprocessed, QHash<QString, Symbol> &symbols);
+	static void readDefines(const QString &preprocessed, Firmware &firmware);
+
+	static QString preprocess(const QString &source);
+	static QStringList lines(const QString &preprocessed);
+	static QList<Value> parse(const QString &line);
+	static Value readToken(const QString &token);
+
+	/// Converts value to number the way Logo does, numeric words and strings are numbers too.
+	static bool toNumber(const Value &value, double &result);
+	static bool isOperator(const QString &token);
+	static bool isParam(const QString &token);
+
+	/// Encodes a constant in the shortest of LC0, LC1, LC2 and LC4 forms.
+	static QList<Value> constant(double value);
+
+	/// Encodes a handle to a variable with given offset.
+	static QList<Value> handle(double offset);
+
+	/// Encodes an address of a variable with given offset.
+	static QList<Value> address(double offset);
+
+	/// Adds given bits to the first byte of encoded operand, marks it as local or global variable.
+	static QList<Value> addBits(int bits, QList<Value> operand);
+
+	const Symbol &symbol(const QString &name) const;
+	Symbol &mutableSymbol(const QString &name);
+	QString localName(const QString &name) const;
+
+	void pass0(const QList<QList<Value>> &code);
+	void pass1(const QList<QList<Value>> &code);
+	void pass1Outside(const QList<Value> &line);
+	void pass1Inside(const QList<Value> &line);
+	void pass1Instruction(QList<Value> line);
+	void pass1ObjectEnd();
+	QByteArray pass2();
+
+	bool setupData(const QList<Value> &line, bool isGlobal);
+	void setupParam(const QList<Value> &line);
+	void setupGlobal(const Value &name, const Value &size);
+	void setupLocal(const Value &name, const Value &size);
+
+	QList<Value> argument(const Value &argument, int depth = 0);
+	QList<Value> handleOrAddress(const QString &name, bool isHandle);
+	QList<Value> string(const QString &string) const;
+	Value expression(const QList<Value> &tokens) const;
+	Value paramSize(const Value &value);
+	double number(const Value &value, const QString &what);
+
+	void add(const QList<Value> &items);
+	void error(const QString &message);
+
+	QHash<QString, Symbol> mSymbols;
+	QStringList mObjects;
+	QString mThisObject;
+	QStringList mLocals;
+	double mNextGlobal = 0;
+	double mNextLocal = 0;
+	QList<Value> mCode;
+	QStringList mErrors;
+};
+
+}
+}
@@ -64,6 +64,7 @@ HEADERS += \
 	$$PWD/include/generatorBase/lua/precedenceConverter.h \
 	$$PWD/include/generatorBase/lua/reservedFunctionsConverter.h \
 	$$PWD/include/generatorBase/gotoControlFlowGenerator.h \
+	$$PWD/include/generatorBase/toolchainRunner.h \
 	$$PWD/src/converters/dynamicPropertiesConverter.h \
 	$$PWD/src/structuralControlFlowGenerator.h \
 	$$PWD/src/structurizator.h \
@@ -111,6 +112,7 @@ SOURCES += \
 	$$PWD/src/semanticTree/joinNode.cpp \
 	$$PWD/src/semanticTree/rootNode.cpp \
 	$$PWD/src/gotoControlFlowGenerator.cpp \
+	$$PWD/src/toolchainRunner.cpp \
 	$$PWD/src/converters/dynamicPropertiesConverter.cpp \
 	$$PWD/src/structuralControlFlowGenerator.cpp \
 	$$PWD/src/structurizator.cpp \
@@ -0,0 +1,151 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QObject>
+#include <QtCore/QProcess>
+#include <QtCore/QStringList>
+#include <QtCore/QTimer>
+
+#include "robotsGeneratorDeclSpec.h"
+
+namespace qReal {
+class ErrorReporterInterface;
+}
+
+namespace generatorBase {
+
+/// Description of one invocation of an external tool (compiler, uploader and so on).
+struct ROBOTS_GENERATOR_EXPORT ToolchainStep
+{
+	/// Message shown in the error reporter when the step starts, nothing is shown if empty.
+	QString description;
+
+	QString program;
+	QStringList arguments;
+	QString workingDirectory;
+
+	/// Time in milliseconds after which the tool is killed and the pipeline fails, non-positive means no limit.
+	int timeout = 30000;
+
+	/// Failure of an optional step is reported as a warning and does not stop the pipeline.
+	bool optional = false;
+
+	/// Detached tool is started and forgotten, the step succeeds as soon as the tool is launched. Used for
+	/// interactive tools which may stay opened for a long time.
+	bool detached = false;
+
+	/// Files which together with the command line determine the result of the step, usually generated sources.
+	/// If the step has both inputs and outputs, its outputs are cached and a repeated run with unchanged inputs
+	/// takes them from the cache instead of launching the tool.
+	QStringList inputs;
+
+	/// Files produced by the step. They are removed before the tool is launched, so stale files of previous runs
+	/// can not be taken for a result, and the step fails if the tool did not produce them.
+	QStringList outputs;
+};
+
+/// Runs a pipeline of external tools one after another without blocking the GUI thread. Tools output is
+/// forwarded line by line into the error reporter, each step is killed if it exceeds its timeout, the whole
+/// pipeline may be cancelled at any moment. Results of steps with inputs and outputs are cached on disk.
+class ROBOTS_GENERATOR_EXPORT ToolchainRunner : public QObject
+{
+	Q_OBJECT
+
+public:
+	/// @param errorReporter Receives tools output and failure messages, may be nullptr.
+	explicit ToolchainRunner(qReal::ErrorReporterInterface *errorReporter, QObject *parent = nullptr);
+	~ToolchainRunner() override;
+
+	/// Returns a directory where outputs of steps are cached, by default it is located in user cache directory.
+	QString cacheDirectory() const;
+
+	/// Sets a directory where outputs of steps are cached. Empty path disables caching.
+	void setCacheDirectory(const QString &path);
+
+	/// Sets maximal number of cached step results, least recently used ones are removed when it is exceeded.
+	void setCacheLimit(int entries);
+
+	/// Starts executing \a steps one by one, finished() is emitted when all of them succeed or one fails.
+	/// A pipeline that is running at the moment is stopped silently: finished() is emitted only for the new one,
+	/// so a caller may prepare its state for the new pipeline before calling run().
+	void run(const QList<ToolchainStep> &steps);
+
+	/// Stops the running pipeline, current tool is killed. finished() is emitted with false if something was
+	/// actually running.
+	void cancel();
+
+	/// Returns true if a pipeline is being executed at the moment.
+	bool isRunning() const;
+
+	/// Returns a key identifying outputs of \a step in the cache, it is a hash of the command line, contents
+	/// of step inputs and sizes and modification times of tools mentioned in the command line, so an updated
+	/// compiler does not reuse results of the old one. Returns empty string if the step can not be cached or
+	/// some of inputs can not be read.
+	static QString cacheKey(const ToolchainStep &step);
+
+signals:
+	/// Emitted when the step with index \a step in the current pipeline starts.
+	void stepStarted(int step);
+
+	/// Emitted when the pipeline is over. \a success is true if all its mandatory steps succeeded.
+	void finished(bool success);
+
+private:
+	/// Kills the current tool and forgets the pipeline without emitting finished(). Returns false if nothing
+	/// was running.
+	bool stop();
+
+	void startNextStep();
+	void finishStep(bool success, const QString &errorMessage = QString());
+	void finish(bool success);
+
+	void onProcessFinished(int exitCode, QProcess::ExitStatus exitStatus);
+	void onProcessError(QProcess::ProcessError error);
+	void onTimeout();
+
+	/// Forwards complete lines accumulated in \a buffer into the error reporter, \a flush forwards the rest too.
+	void forwardOutput(QByteArray &buffer, bool flush);
+
+	bool restoreFromCache(const ToolchainStep &step, const QString &key);
+	void storeToCache(const ToolchainStep &step, const QString &key);
+
+	/// Removes least recently used cache entries beyond the limit.
+	void trimCache();
+
+	void reportInformation(const QString &message);
+	void reportWarning(const QString &message);
+	void reportError(const QString &message);
+
+	qReal::ErrorReporterInterface *mErrorReporter;  // Doesn't have ownership.
+	QString mCacheDirectory;
+	int mCacheLimit = 64;
+
+	QList<ToolchainStep> mSteps;
+	int mCurrentStep = -1;
+
+	/// Cache key of the current step, empty if its result is not cached.
+	QString mCurrentKey;
+
+	/// Process of the current step, recreated for each step so signals of a killed tool do not interfere with
+	/// the next one.
+	QProcess *mProcess = nullptr;  // Has ownership via Qt parent-child system.
+	QTimer mTimeoutTimer;
+
+	QByteArray mStandardOutput;
+	QByteArray mStandardError;
+};
+
+}
@@ -0,0 +1,415 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "generatorBase/toolchainRunner.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QStandardPaths>
+
+#include <qrkernel/logging.h>
+#include <qrgui/plugins/toolPluginInterface/usedInterfaces/errorReporterInterface.h>
+
+using namespace generatorBase;
+
+/// Name of an empty file in a cache entry, its modification time is the time the entry was used last.
+static const QString lastUseStamp = "lastUse";
+
+ToolchainRunner::ToolchainRunner(qReal::ErrorReporterInterface *errorReporter, QObject *parent)
+	: QObject(parent)
+	, mErrorReporter(errorReporter)
+	, mCacheDirectory(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/toolchain")
+{
+	mTimeoutTimer.setSingleShot(true);
+	connect(&mTimeoutTimer, &QTimer::timeout, this, &ToolchainRunner::onTimeout);
+}
+
+ToolchainRunner::~ToolchainRunner()
+{
+	if (mProcess) {
+		// Nobody is interested in results anymore, the tool will be killed by QProcess destructor.
+		mProcess->disconnect(this);
+	}
+}
+
+QString ToolchainRunner::cacheDirectory() const
+{
+	return mCacheDirectory;
+}
+
+void ToolchainRunner::setCacheDirectory(const QString &path)
+{
+	mCacheDirectory = path;
+}
+
+void ToolchainRunner::setCacheLimit(int entries)
+{
+	mCacheLimit = entries;
+}
+
+void ToolchainRunner::run(const QList<ToolchainStep> &steps)
+{
+	stop();
+	mSteps = steps;
+	mCurrentStep = -1;
+	startNextStep();
+}
+
+void ToolchainRunner::cancel()
+{
+	if (stop()) {
+		finish(false);
+	}
+}
+
+bool ToolchainRunner::stop()
+{
+	if (!isRunning()) {
+		return false;
+	}
+
+	mTimeoutTimer.stop();
+	if (mProcess) {
+		mProcess->disconnect(this);
+		mProcess->kill();
+		mProcess->deleteLater();
+		mProcess = nullptr;
+	}
+
+	reportInformation(tr("%1 was cancelled").arg(QFileInfo(mSteps[mCurrentStep].program).fileName()));
+	mSteps.clear();
+	mCurrentStep = -1;
+	mCurrentKey.clear();
+	return true;
+}
+
+bool ToolchainRunner::isRunning() const
+{
+	return mCurrentStep >= 0 && mCurrentStep < mSteps.size();
+}
+
+QString ToolchainRunner::cacheKey(const ToolchainStep &step)
+{
+	if (step.detached || step.inputs.isEmpty() || step.outputs.isEmpty()) {
+		return QString();
+	}
+
+	QCryptographicHash hash(QCryptographicHash::Sha1);
+	const auto addString = [&hash](const QString &string) {
+		hash.addData(string.toUtf8());
+		hash.addData("\0", 1);
+	};
+
+	const auto addTool = [&hash, &step](const QString &path) {
+		const QFileInfo tool(QDir(step.workingDirectory).filePath(path));
+		if (tool.isFile() && !step.inputs.contains(path)) {
+			hash.addData(QByteArray::number(tool.size()));
+			hash.addData(QByteArray::number(tool.lastModified().toMSecsSinceEpoch()));
+		}
+	};
+
+	addString(step.program);
+	addTool(step.program);
+	addString(step.workingDirectory);
+	for (const QString &argument : step.arguments) {
+		addString(argument);
+		addTool(argument);
+	}
+
+	for (const QString &output : step.outputs) {
+		addString(output);
+	}
+
+	for (const QString &input : step.inputs) {
+		QFile file(input);
+		if (!file.open(QIODevice::ReadOnly)) {
+			return QString();
+		}
+
+		addString(input);
+		hash.addData(&file);
+	}
+
+	return QString::fromLatin1(hash.result().toHex());
+}
+
+void ToolchainRunner::startNextStep()
+{
+	++mCurrentStep;
+	if (mCurrentStep >= mSteps.size()) {
+		finish(true);
+		return;
+	}
+
+	const ToolchainStep &step = mSteps[mCurrentStep];
+	emit stepStarted(mCurrentStep);
+	if (!step.description.isEmpty()) {
+		reportInformation(step.description);
+	}
+
+	mCurrentKey = mCacheDirectory.isEmpty() ? QString() : cacheKey(step);
+	if (!mCurrentKey.isEmpty() && restoreFromCache(step, mCurrentKey)) {
+		reportInformation(tr("Sources were not changed, using results of previous %1 run")
+				.arg(QFileInfo(step.program).fileName()));
+		startNextStep();
+		return;
+	}
+
+	if (step.detached) {
+		if (QProcess::startDetached(step.program, step.arguments, step.workingDirectory)) {
+			finishStep(true);
+		} else {
+			finishStep(false, tr("Unable to launch %1").arg(step.program));
+		}
+
+		return;
+	}
+
+	for (const QString &output : step.outputs) {
+		QFile::remove(output);
+	}
+
+	mStandardOutput.clear();
+	mStandardError.clear();
+	mProcess = new QProcess(this);
+	mProcess->setWorkingDirectory(step.workingDirectory);
+	connect(mProcess, &QProcess::readyReadStandardOutput, this, [this]() {
+		mStandardOutput += mProcess->readAllStandardOutput();
+		forwardOutput(mStandardOutput, false);
+	});
+	connect(mProcess, &QProcess::readyReadStandardError, this, [this]() {
+		mStandardError += mProcess->readAllStandardError();
+		forwardOutput(mStandardError, false);
+	});
+	connect(mProcess, static_cast<void(QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished)
+			, this, &ToolchainRunner::onProcessFinished);
+	connect(mProcess, static_cast<void(QProcess::*)(QProcess::ProcessError)>(&QProcess::error)
+			, this, &ToolchainRunner::onProcessError);
+
+	QLOG_INFO() << "Starting" << step.program << step.arguments;
+	if (step.timeout > 0) {
+		mTimeoutTimer.start(step.timeout);
+	}
+
+	mProcess->start(step.program, step.arguments);
+}
+
+void ToolchainRunner::finishStep(bool success, const QString &errorMessage)
+{
+	mTimeoutTimer.stop();
+	if (mProcess) {
+		mProcess->disconnect(this);
+		mProcess->deleteLater();
+		mProcess = nullptr;
+	}
+
+	if (success) {
+		startNextStep();
+		return;
+	}
+
+	QLOG_ERROR() << errorMessage;
+	if (mSteps[mCurrentStep].optional) {
+		reportWarning(errorMessage);
+		startNextStep();
+	} else {
+		reportError(errorMessage);
+		finish(false);
+	}
+}
+
+void ToolchainRunner::finish(bool success)
+{
+	mSteps.clear();
+	mCurrentStep = -1;
+	mCurrentKey.clear();
+	emit finished(success);
+}
+
+void ToolchainRunner::onProcessFinished(int exitCode, QProcess::ExitStatus exitStatus)
+{
+	mStandardOutput += mProcess->readAllStandardOutput();
+	forwardOutput(mStandardOutput, true);
+	mStandardError += mProcess->readAllStandardError();
+	forwardOutput(mStandardError, true);
+
+	const ToolchainStep &step = mSteps[mCurrentStep];
+	const QString toolName = QFileInfo(step.program).fileName();
+	if (exitStatus == QProcess::CrashExit) {
+		finishStep(false, tr("%1 crashed").arg(toolName));
+		return;
+	}
+
+	if (exitCode != 0) {
+		finishStep(false, tr("%1 finished with exit code %2").arg(toolName).arg(exitCode));
+		return;
+	}
+
+	for (const QString &output : step.outputs) {
+		if (!QFileInfo(output).exists()) {
+			finishStep(false, tr("%1 did not produce %2").arg(toolName, QFileInfo(output).fileName()));
+			return;
+		}
+	}
+
+	if (!mCurrentKey.isEmpty()) {
+		storeToCache(step, mCurrentKey);
+	}
+
+	finishStep(true);
+}
+
+void ToolchainRunner::onProcessError(QProcess::ProcessError error)
+{
+	// Other errors are followed by finished() signal or are handled by timeout.
+	if (error == QProcess::FailedToStart) {
+		finishStep(false, tr("Unable to launch %1").arg(mSteps[mCurrentStep].program));
+	}
+}
+
+void ToolchainRunner::onTimeout()
+{
+	if (!mProcess) {
+		return;
+	}
+
+	mProcess->disconnect(this);
+	mProcess->kill();
+	const ToolchainStep &step = mSteps[mCurrentStep];
+	finishStep(false, tr("%1 did not finish in %2 seconds and was stopped")
+			.arg(QFileInfo(step.program).fileName()).arg(step.timeout / 1000.0));
+}
+
+void ToolchainRunner::forwardOutput(QByteArray &buffer, bool flush)
+{
+	int start = 0;
+	while (start < buffer.size()) {
+		int end = buffer.indexOf('\n', start);
+		if (end < 0) {
+			if (!flush) {
+				break;
+			}
+
+			end = buffer.size();
+		}
+
+		const QString line = QString::fromLocal8Bit(buffer.constData() + start, end - start).trimmed();
+		if (!line.isEmpty()) {
+			reportInformation(line);
+		}
+
+		start = end + 1;
+	}
+
+	buffer.remove(0, start);
+}
+
+bool ToolchainRunner::restoreFromCache(const ToolchainStep &step, const QString &key)
+{
+	const QDir entry(mCacheDirectory + "/" + key);
+	for (int i = 0; i < step.outputs.size(); ++i) {
+		if (!entry.exists(QString::number(i))) {
+			return false;
+		}
+	}
+
+	for (int i = 0; i < step.outputs.size(); ++i) {
+		QFile::remove(step.outputs[i]);
+		if (!QFile::copy(entry.filePath(QString::number(i)), step.outputs[i])) {
+			QLOG_ERROR() << "Could not restore" << step.outputs[i] << "from toolchain cache";
+			return false;
+		}
+	}
+
+	QFile stamp(entry.filePath(lastUseStamp));
+	if (stamp.open(QIODevice::ReadWrite)) {
+		stamp.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+	}
+
+	return true;
+}
+
+void ToolchainRunner::storeToCache(const ToolchainStep &step, const QString &key)
+{
+	// Outputs are copied into a temporary directory first, so an interrupted copy never looks like a valid entry.
+	const QString entryPath = mCacheDirectory + "/" + key;
+	QDir temporary(entryPath + ".tmp");
+	temporary.removeRecursively();
+	if (!QDir().mkpath(temporary.path())) {
+		QLOG_ERROR() << "Could not create toolchain cache directory" << temporary.path();
+		return;
+	}
+
+	for (int i = 0; i < step.outputs.size(); ++i) {
+		if (!QFile::copy(step.outputs[i], temporary.filePath(QString::number(i)))) {
+			QLOG_ERROR() << "Could not store" << step.outputs[i] << "in toolchain cache";
+			temporary.removeRecursively();
+			return;
+		}
+	}
+
+	QFile(temporary.filePath(lastUseStamp)).open(QIODevice::WriteOnly);
+
+	QDir(entryPath).removeRecursively();
+	if (!QDir().rename(temporary.path(), entryPath)) {
+		temporary.removeRecursively();
+		return;
+	}
+
+	trimCache();
+}
+
+void ToolchainRunner::trimCache()
+{
+	const QDir cache(mCacheDirectory);
+	QList<QPair<QDateTime, QString>> entries;
+	for (const QString &entry : cache.entryList(QDir::Dirs | QDir::NoDotAndDotDot)) {
+		if (!entry.endsWith(".tmp")) {
+			entries << qMakePair(QFileInfo(cache.filePath(entry + "/" + lastUseStamp)).lastModified(), entry);
+		}
+	}
+
+	if (entries.size() <= mCacheLimit) {
+		return;
+	}
+
+	std::sort(entries.begin(), entries.end());
+	for (int i = 0; i < entries.size() - mCacheLimit; ++i) {
+		QDir(cache.filePath(entries[i].second)).removeRecursively();
+	}
+}
+
+void ToolchainRunner::reportInformation(const QString &message)
+{
+	if (mErrorReporter) {
+		mErrorReporter->addInformation(message);
+	}
+}
+
+void ToolchainRunner::reportWarning(const QString &message)
+{
+	if (mErrorReporter) {
+		mErrorReporter->addWarning(message);
+	}
+}
+
+void ToolchainRunner::reportError(const QString &message)
+{
+	if (mErrorReporter) {
+		mErrorReporter->addError(message);
+	}
+}
@@ -38,6 +38,7 @@ NxtFlashTool::NxtFlashTool(qReal::ErrorReporterInterface &errorReporter
 		, utils::robotCommunication::RobotCommunicationThreadInterface &communicator)
 	: mErrorReporter(errorReporter)
 	, mCommunicator(communicator)
+	, mToolchainRunner(&errorReporter)
 	, mIsFlashing(false)
 	, mIsUploading(false)
 	, mCompileState(done)
@@ -53,6 +54,12 @@ NxtFlashTool::NxtFlashTool(qReal::ErrorReporterInterface &errorReporter
 	connect(&mCompileProcess, static_cast<void (QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished)
 			, this, &NxtFlashTool::nxtCompilationFinished);
 
+	connect(&mToolchainRunner, &generatorBase::ToolchainRunner::finished, this, [this](bool success) {
+		if (!success || !startFlashing(mFirmware)) {
+			mIsFlashing = false;
+		}
+	});
+
 	connect(&mCommunicator, &utils::robotCommunication::RobotCommunicationThreadInterface::errorOccured
 			, this, &NxtFlashTool::error);
 	connect(&mCommunicator, &utils::robotCommunication::RobotCommunicationThreadInterface::messageArrived
@@ -81,12 +88,29 @@ bool NxtFlashTool::flashRobot()
 		return false;
 	}
 
+	mIsFlashing = true;
 #ifdef Q_OS_LINUX
-	QProcess configureProcess;
-	configureProcess.start("sh", { path("configureForFlash.sh") });
-	configureProcess.waitForFinished(-1);
+	generatorBase::ToolchainStep configure;
+	configure.program = "sh";
+	configure.arguments = { path("configureForFlash.sh") };
+	configure.timeout = 60000;
+	// Flashing may still succeed if USB permissions were configured earlier.
+	configure.optional = true;
+	mFirmware = firmwareBinaryName;
+	mToolchainRunner.run({ configure });
+	return true;
+#else
+	if (!startFlashing(firmwareBinaryName)) {
+		mIsFlashing = false;
+		return false;
+	}
+
+	return true;
 #endif
+}
 
+bool NxtFlashTool::startFlashing(const QFileInfo &firmwareBinaryName)
+{
 	auto const usbCommunicator = dynamic_cast<nxt::communication::UsbRobotCommunicationThread *>(&mCommunicator);
 	if (!usbCommunicator) {
 		QLOG_ERROR() << "Attempted to flash robot in bluetooth mode";
@@ -99,7 +123,6 @@ bool NxtFlashTool::flashRobot()
 		return false;
 	}
 
-	mIsFlashing = true;
 	information(tr("Firmware flash started. Please don't disconnect robot during the process"));
 
 	// This lambda will be invoked in separete thread via QtConcurrent, progress will be reported.
@@ -18,6 +18,7 @@
 #include <QtCore/QFileInfo>
 
 #include <qrgui/plugins/toolPluginInterface/usedInterfaces/errorReporterInterface.h>
+#include <generatorBase/toolchainRunner.h>
 #include <utils/robotCommunication/robotCommunicationThreadInterface.h>
 
 template<typename T>
@@ -44,7 +45,9 @@ public slots:
 	/// Searches for the firmware image in nxt-tools/nexttool directory and flashes it into NXT brick.
 	/// NXT brick must be reseted before this method is called. If multiple images found in nxt-tools/nexttool
 	/// then latest (greatest lexicographically) will be flashed. Flashing is performed through the raw libusb or
-	/// qextserialport connection, fantom driver and NeXTTool are not required.
+	/// qextserialport connection, fantom driver and NeXTTool are not required. On Linux USB permissions are
+	/// configured first with configureForFlash.sh script which is run asynchronously.
+	/// @returns true if flashing was started.
 	bool flashRobot();
 
 	/// Compiles and uploads program with the given source \a fileInfo into NXT brick. Makefile should be placed
@@ -87,6 +90,9 @@ private:
 	//--------------------- Flashing section ----------------------//
 
 	QFileInfo findLatestFirmware() const;
+
+	/// Connects to the brick in firmware mode and starts flashing \a firmware in a separate thread.
+	bool startFlashing(const QFileInfo &firmware);
 	bool flashFirmwareStream(QDataStream &firmware, QFutureInterface<void> &progressTracker);
 	bool flashOneBlock(int orderNumber, const QByteArray &block);
 	bool startNewFirmware();
@@ -129,6 +135,10 @@ private:
 	utils::robotCommunication::RobotCommunicationThreadInterface &mCommunicator;
 	QProcess mCompileProcess;
 
+	/// Runs configuration script before flashing without blocking GUI.
+	generatorBase::ToolchainRunner mToolchainRunner;
+	QFileInfo mFirmware;
+
 	bool mIsFlashing;
 	bool mIsUploading;
 
@@ -22,6 +22,10 @@ namespace qReal {
 class ErrorReporterInterface;
 }
 
+namespace generatorBase {
+class ToolchainRunner;
+}
+
 namespace utils {
 namespace robotCommunication {
 
@@ -64,11 +68,9 @@ protected:
 
 private slots:
 
-	/// Generates and uploads script to a robot. Program then can be launched manually or remotely
-	/// by runCommand. Program is stored on robot as a file in /home/root/trik/scripts and named
-	/// as <qReal save name>.fs.
-	/// @returns True, if successful.
-	bool uploadProgram();
+	/// Generates, compiles and uploads program to a robot. Program then can be launched manually or remotely
+	/// by runCommand. Compilation is performed asynchronously, then WinSCP is launched to upload the binary.
+	void uploadProgram();
 
 	/// Runs currently opened program on a robot. Uploads it first.
 	void runProgram();
@@ -99,6 +101,9 @@ private:
 
 	/// Protocol that is used to stop robot.
 	QScopedPointer<utils::robotCommunication::StopRobotProtocol> mStopRobotProtocol;
+
+	/// Runs compiler and WinSCP without blocking GUI.
+	QScopedPointer<generatorBase::ToolchainRunner> mToolchainRunner;
 };
 
 }
@@ -16,9 +16,9 @@
 
 #include <QtWidgets/QApplication>
 #include <QtCore/QDir>
-#include <QtCore/QProcess>
 
 #include <qrkernel/settingsManager.h>
+#include <generatorBase/toolchainRunner.h>
 #include <utils/robotCommunication/tcpRobotCommunicator.h>
 #include <utils/robotCommunication/stopRobotProtocol.h>
 #include <utils/robotCommunication/networkCommunicationErrorReporter.h>
@@ -75,6 +75,7 @@ void TrikFSharpGeneratorPluginBase::init(const kitBase::KitPluginConfigurator &c
 	mCommunicator.reset(new TcpRobotCommunicator("TrikTcpServer"));
 	NetworkCommunicationErrorReporter::connectErrorReporter(*mCommunicator, *errorReporter);
 	mStopRobotProtocol.reset(new StopRobotProtocol(*mCommunicator));
+	mToolchainRunner.reset(new generatorBase::ToolchainRunner(errorReporter));
 
 	connect(mStopRobotProtocol.data(), &StopRobotProtocol::timeout, this, [errorReporter]() {
 		errorReporter->addError(tr("Stop robot operation timed out"));
@@ -144,63 +145,45 @@ QString TrikFSharpGeneratorPluginBase::generatorName() const
 	return "trikFSharp";
 }
 
-bool TrikFSharpGeneratorPluginBase::uploadProgram()
+void TrikFSharpGeneratorPluginBase::uploadProgram()
 {
-	QProcess compileProcess;
 	const QFileInfo fileInfo = generateCodeForProcessing();
 
-	const QString pathToTheTrikCore = " -r \"..\\..\\Trik.Core.dll\"";
-
 	if (qReal::SettingsManager::value("FSharpPath").toString().isEmpty()) {
 		mMainWindowInterface->errorReporter()->addError(
 			tr("Please provide path to the FSharp Compiler in Settings dialog.")
 		);
 
-		return false;
-	}
-
-	const QString compileCommand = QString("\"%1\" \"%2\" %3")
-			.arg(qReal::SettingsManager::value("FSharpPath").toString())
-			.arg(fileInfo.absoluteFilePath())
-			.arg(pathToTheTrikCore);
-
-	compileProcess.setWorkingDirectory(fileInfo.absoluteDir().path());
-	compileProcess.start(compileCommand);
-	compileProcess.waitForStarted();
-	if (compileProcess.state() != QProcess::Running) {
-		mMainWindowInterface->errorReporter()->addError(tr("Unable to launch F# compiler"));
-		return false;
+		return;
 	}
 
-	compileProcess.waitForFinished();
-
 	if (qReal::SettingsManager::value("WinScpPath").toString().isEmpty()) {
 		mMainWindowInterface->errorReporter()->addError(
 			tr("Please provide path to the WinSCP in Settings dialog.")
 		);
 
-		return false;
-	}
-
-	const QFileInfo binaryFile(fileInfo.canonicalPath() + "/" + fileInfo.completeBaseName() + ".exe");
-
-	const QString moveCommand = QString(
-			"\"%1\" /command  \"open scp://root@%2\" \"put %3 /home/root/trik/FSharp/Environment/\"")
-			.arg(qReal::SettingsManager::value("WinScpPath").toString())
-			.arg(qReal::SettingsManager::value("TrikTcpServer").toString())
-			.arg(binaryFile.canonicalFilePath().replace("/", "\\"));
-
-	QProcess deployProcess;
-	if (!deployProcess.startDetached(moveCommand)) {
-		mMainWindowInterface->errorReporter()->addError(tr("Unable to launch WinSCP"));
-		return false;
+		return;
 	}
 
-	mMainWindowInterface->errorReporter()->addInformation(
-		tr("After downloading the program, enter 'exit' or close the window")
-	);
-
-	return true;
+	const QString binaryPath = fileInfo.canonicalPath() + "/" + fileInfo.completeBaseName() + ".exe";
+
+	generatorBase::ToolchainStep compile;
+	compile.program = qReal::SettingsManager::value("FSharpPath").toString();
+	compile.arguments = {fileInfo.absoluteFilePath(), "-r", "..\\..\\Trik.Core.dll"};
+	compile.workingDirectory = fileInfo.absoluteDir().path();
+	compile.timeout = 60000;
+	compile.inputs = {fileInfo.absoluteFilePath()};
+	compile.outputs = {binaryPath};
+
+	generatorBase::ToolchainStep move;
+	move.description = tr("After downloading the program, enter 'exit' or close the window");
+	move.program = qReal::SettingsManager::value("WinScpPath").toString();
+	move.arguments = {"/command"
+			, "open scp://root@" + qReal::SettingsManager::value("TrikTcpServer").toString()
+			, QString("put %1 /home/root/trik/FSharp/Environment/").arg(QString(binaryPath).replace("/", "\\"))};
+	move.detached = true;
+
+	mToolchainRunner->run({compile, move});
 }
 
 void TrikFSharpGeneratorPluginBase::runProgram()
@@ -216,6 +199,7 @@ void TrikFSharpGeneratorPluginBase::runProgram()
 
 void TrikFSharpGeneratorPluginBase::stopRobot()
 {
+	mToolchainRunner->cancel();
 	mStopRobotProtocol->run(
 			"script.system(\"killall mono\"); "
 			"script.system(\"killall aplay\"); \n"
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <generatorBase/toolchainRunner.h>
 #include <trikGeneratorBase/trikGeneratorPluginBase.h>
 #include <trikGeneratorBase/robotModel/generatorModelExtensionInterface.h>
 #include <utils/uploaderTool.h>
@@ -56,8 +57,8 @@ protected:
 
 private slots:
 	/// Generates, compiles and uploads compiled program to a robot. It can then be run by Mono.
-	/// @returns binary file name if successful or empty string if not.
-	QString uploadProgram();
+	/// Compilation and uploading are performed asynchronously, results are shown in the error reporter.
+	void uploadProgram();
 
 	/// Runs currently opened program on a robot. Compiles and uploads it first.
 	void runProgram();
@@ -66,6 +67,13 @@ private slots:
 	void stopRobot();
 
 private:
+	/// Generates code and starts a pipeline that compiles and uploads it, remembers binary name in mUploadedBinary.
+	/// @returns false if the pipeline could not be started.
+	bool startUpload();
+
+	/// Called when compilation and uploading are over, runs uploaded program if it was requested.
+	void onUploadFinished(bool success);
+
 	/// Action that launches code generator.
 	/// Doesn't have ownership; may be disposed by GUI.
 	QAction *mGenerateCodeAction = nullptr;
@@ -97,6 +105,15 @@ private:
 
 	/// Protocol that is used to stop robot.
 	QScopedPointer<utils::robotCommunication::StopRobotProtocol> mStopRobotProtocol;
+
+	/// Runs compiler and uploading tools without blocking GUI.
+	QScopedPointer<generatorBase::ToolchainRunner> mToolchainRunner;
+
+	/// Name of the binary that is being uploaded or was uploaded last.
+	QString mUploadedBinary;
+
+	/// True if the program shall be run on a robot as soon as it is uploaded.
+	bool mRunAfterUpload = false;
 };
 
 }
@@ -14,8 +14,8 @@
 
 #include "trikPascalABCGeneratorLibrary/trikPascalABCGeneratorPluginBase.h"
 
-#include <QtCore/QProcess>
 #include <QtCore/QDir>
+#include <QtCore/QFile>
 
 #include <qrkernel/platformInfo.h>
 #include <qrkernel/settingsManager.h>
@@ -153,6 +153,10 @@ void TrikPascalABCGeneratorPluginBase::init(const kitBase::KitPluginConfigurator
 
 	mStopRobotProtocol.reset(new StopRobotProtocol(*mCommunicator));
 
+	mToolchainRunner.reset(new generatorBase::ToolchainRunner(&errorReporter));
+	connect(mToolchainRunner.data(), &generatorBase::ToolchainRunner::finished
+			, this, &TrikPascalABCGeneratorPluginBase::onUploadFinished);
+
 	connect(mStopRobotProtocol.data(), &StopRobotProtocol::timeout, this, [&errorReporter]() {
 		errorReporter.addError(tr("Stop robot operation timed out"));
 	});
@@ -184,9 +188,14 @@ QString TrikPascalABCGeneratorPluginBase::generatorName() const
 	return "trikPascalABC";
 }
 
-QString TrikPascalABCGeneratorPluginBase::uploadProgram()
+void TrikPascalABCGeneratorPluginBase::uploadProgram()
+{
+	mRunAfterUpload = false;
+	startUpload();
+}
+
+bool TrikPascalABCGeneratorPluginBase::startUpload()
 {
-	QProcess compileProcess;
 	const QFileInfo fileInfo = generateCodeForProcessing();
 
 	const QString pascalCompiler = qReal::SettingsManager::value("PascalABCPath").toString();
@@ -196,143 +205,110 @@ QString TrikPascalABCGeneratorPluginBase::uploadProgram()
 			tr("Please provide path to the PascalABC.NET Compiler in Settings dialog.")
 		);
 
-		return "";
+		return false;
 	}
 
-	mMainWindowInterface->errorReporter()->addInformation(
-		tr("Compiling...")
-	);
-
-	compileProcess.setWorkingDirectory(fileInfo.absoluteDir().path());
-
-#ifdef Q_OS_WIN
-	compileProcess.start("cmd", {"/C", "start", "PascalABC Compiler", pascalCompiler, fileInfo.absoluteFilePath()});
-#else
-	compileProcess.start("mono", {pascalCompiler, fileInfo.absoluteFilePath()});
-#endif
-
-	compileProcess.waitForStarted();
-	if (compileProcess.state() != QProcess::Running) {
-		mMainWindowInterface->errorReporter()->addError(tr("Unable to launch PascalABC.NET compiler"));
-		return "";
-	}
-
-	compileProcess.waitForFinished();
-
-	/// @todo: will not work since PascalABC uses console device instead of stdout or stderr for error output, so
-	///        it will always return exit code 0 (even when using console command that actually captures exit code,
-	///        start cmd /c "pabcnetc.exe <file name>.pas || call echo %errorLevel% > exitcode.txt"
-	///        Need to patch PascalABC.NET compiler to fix that. Or maybe it already can do it, but more investigation
-	///        is needed.
-	if (compileProcess.exitCode() != 0) {
-		mMainWindowInterface->errorReporter()->addError(tr("PascalABC compiler finished with error."));
-		QStringList errors = QString(compileProcess.readAllStandardError()).split("\n", QString::SkipEmptyParts);
-		errors << QString(compileProcess.readAllStandardOutput()).split("\n", QString::SkipEmptyParts);
-		for (const auto &error : errors) {
-			mMainWindowInterface->errorReporter()->addInformation(error);
-		}
-
-		return "";
-	}
-
-	/// @todo: dirty hack. "start" launches process detached so we don't even know when compiler finishes.
-	QEventLoop eventLoop;
-	QTimer::singleShot(2000, &eventLoop, &QEventLoop::quit);
-	eventLoop.exec();
-	mMainWindowInterface->errorReporter()->addInformation(
-		tr("Compile completed"));
-
 #ifdef Q_OS_WIN
 	if (qReal::SettingsManager::value("WinScpPath").toString().isEmpty()) {
 		mMainWindowInterface->errorReporter()->addError(
 			tr("Please provide path to the WinSCP in Settings dialog.")
 		);
 
-		return "";
+		return false;
 	}
 #endif
 
-	const QFileInfo binaryFile(fileInfo.canonicalPath() + "/" + fileInfo.completeBaseName() + ".exe");
+	const QString robotIp = qReal::SettingsManager::value("TrikTcpServer").toString();
+	const QString binaryPath = fileInfo.canonicalPath() + "/" + fileInfo.completeBaseName() + ".exe";
+	mUploadedBinary = QFileInfo(binaryPath).fileName();
+
+	generatorBase::ToolchainStep compile;
+	compile.description = tr("Compiling...");
+#ifdef Q_OS_WIN
+	// Compiler is launched directly and not via "start", otherwise it gets its own console and its output
+	// never reaches the toolchain runner.
+	compile.program = pascalCompiler;
+	compile.arguments = {fileInfo.absoluteFilePath()};
+#else
+	compile.program = "mono";
+	compile.arguments = {pascalCompiler, fileInfo.absoluteFilePath()};
+#endif
+	compile.workingDirectory = fileInfo.absoluteDir().path();
+	compile.timeout = 60000;
+	compile.inputs = {fileInfo.absoluteFilePath()};
+	/// @todo: PascalABC uses console device instead of stdout or stderr for error output, so it always returns
+	///        exit code 0. Compilation errors are detected by absence of the binary which is removed before
+	///        compilation, but error messages themselves are lost. Need to patch PascalABC.NET compiler to fix that.
+	compile.outputs = {binaryPath};
+
 	QFile shScript(fileInfo.canonicalPath() + "/" + fileInfo.completeBaseName() + ".sh");
 	shScript.open(QIODevice::WriteOnly);
-	const QString script = "mono /home/root/trik/" + binaryFile.fileName();
+	const QString script = "mono /home/root/trik/" + mUploadedBinary;
 	shScript.write(script.toStdString().data());
 	shScript.close();
-	const QFileInfo scriptFile = QFileInfo(shScript);
-	const QString scriptPath = scriptFile.canonicalFilePath();
+	shScript.setPermissions(shScript.permissions() | QFile::ExeOwner | QFile::ExeGroup | QFile::ExeOther);
 
+	generatorBase::ToolchainStep moveBinary;
 #ifdef Q_OS_WIN
-	const QString moveBinary = QString(
-			"\"%1\" /command  \"open scp://root@%2\" \"put %3 /home/root/trik/\"")
-			.arg(qReal::SettingsManager::value("WinScpPath").toString())
-			.arg(qReal::SettingsManager::value("TrikTcpServer").toString())
-			.arg(binaryFile.canonicalFilePath().replace("/", "\\"));
+	moveBinary.description = tr("Uploading... After downloading the program, enter 'exit' or close the window");
+	moveBinary.program = qReal::SettingsManager::value("WinScpPath").toString();
+	moveBinary.arguments = {"/command"
+			, "open scp://root@" + robotIp
+			, QString("put %1 /home/root/trik/").arg(QString(binaryPath).replace("/", "\\"))};
+	moveBinary.timeout = 0;
+
+	const QList<generatorBase::ToolchainStep> steps = {compile, moveBinary};
 #else
-	//todo chmod and moveScript for windows
-	const QString chmod = QString("chmod +x %1").arg(scriptPath);
-	const QString moveScript = QString("scp %2 root@%1:/home/root/trik/scripts")
-			.arg(qReal::SettingsManager::value("TrikTcpServer").toString())
-			.arg(scriptPath);
-	QProcess chmodProcess;
-	chmodProcess.start(chmod);
-	chmodProcess.waitForFinished();
-	QProcess moveScriptProcess;
-	moveScriptProcess.start(moveScript);
-	moveScriptProcess.waitForFinished(3000);
-	const QString moveBinary = QString(
-				"scp %2 root@%1:/home/root/trik")
-				.arg(qReal::SettingsManager::value("TrikTcpServer").toString())
-				.arg(binaryFile.canonicalFilePath());
+	//todo moveScript for windows
+	generatorBase::ToolchainStep moveScript;
+	moveScript.program = "scp";
+	moveScript.arguments = {QFileInfo(shScript).canonicalFilePath(), QString("root@%1:/home/root/trik/scripts").arg(robotIp)};
+	moveScript.timeout = 3000;
+	moveScript.optional = true;
+
+	moveBinary.description = tr("Uploading... Please wait for about 20 seconds.");
+	moveBinary.program = "scp";
+	moveBinary.arguments = {binaryPath, QString("root@%1:/home/root/trik").arg(robotIp)};
+
+	const QList<generatorBase::ToolchainStep> steps = {compile, moveScript, moveBinary};
 #endif
 
-	mMainWindowInterface->errorReporter()->addInformation(
-		tr("Uploading... Please wait for about 20 seconds.")
-	);
-
-	QProcess deployProcess;
-
-	//check on windows
-	deployProcess.start(moveBinary);
+	mToolchainRunner->run(steps);
+	return true;
+}
 
-	if (deployProcess.state() == QProcess::NotRunning) {
-		mMainWindowInterface->errorReporter()->addError(
-					tr("Cant't start download process"));
-		return "";
+void TrikPascalABCGeneratorPluginBase::onUploadFinished(bool success)
+{
+	const bool runAfterUpload = mRunAfterUpload;
+	mRunAfterUpload = false;
+	if (!success) {
+		// Failed step was already reported by the toolchain runner.
+		return;
 	}
 
-	mMainWindowInterface->errorReporter()->addInformation(
-		tr("After downloading the program, enter 'exit' or close the window")
-	);
-
-	if (deployProcess.exitCode() != 0 or !deployProcess.waitForFinished(10000))
-	{
-		mMainWindowInterface->errorReporter()->addError(
-					tr("Failed to download program. Check connection"));
-		return "";
+	mMainWindowInterface->errorReporter()->addInformation(tr("Download completed"));
+	if (!runAfterUpload) {
+		return;
 	}
 
-	mMainWindowInterface->errorReporter()->addInformation(
-				tr("Download completed"));
+	mMainWindowInterface->errorReporter()->addWarning(
+		tr("Running... Attention, program execution will start after about ten seconds")
+	);
 
-	return binaryFile.fileName();
+	mCommunicator->runDirectCommand("script.system(\"mono /home/root/trik/" + mUploadedBinary + "\"); ");
 }
 
 void TrikPascalABCGeneratorPluginBase::runProgram()
 {
-	const QString binary = uploadProgram();
-	if (binary.isEmpty()) {
-		return;
+	mRunAfterUpload = true;
+	if (!startUpload()) {
+		mRunAfterUpload = false;
 	}
-
-	mMainWindowInterface->errorReporter()->addWarning(
-		tr("Running... Attention, program execution will start after about ten seconds")
-	);
-
-	mCommunicator->runDirectCommand("script.system(\"mono /home/root/trik/" + binary + "\"); ");
 }
 
 void TrikPascalABCGeneratorPluginBase::stopRobot()
 {
+	mToolchainRunner->cancel();
 	mStopRobotProtocol->run(
 			"script.system(\"killall mono\"); "
 			"script.system(\"killall aplay\"); \n"
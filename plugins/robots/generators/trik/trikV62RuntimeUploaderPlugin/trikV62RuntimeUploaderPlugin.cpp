@@ -49,11 +49,11 @@ const QString preCopyCommand = "ssh -v -oConnectTimeout=%SSH_TIMEOUT%s -oStrictH
 		"-oUserKnownHostsFile=/dev/null root@%IP% \""
 		"mkdir -p /home/root/trik; "
 		"chmod a-x trik/trik*; "
-		"killall -q trikGui"
+		"killall -q trikGui || true"
 		"\"";
 
-const QString copyCommand = "scp -r -v -oConnectTimeout=%SSH_TIMEOUT%s -oStrictHostKeyChecking=no "
-		"-oUserKnownHostsFile=/dev/null %PATH%/* root@%IP%:/home/root/trik";
+// Only files that differ from ones on a robot are transferred.
+const QString copyCommand = UploaderTool::deployCommand("/home/root/trik");
 
 const QString postCopyCommand = "ssh -v -oConnectTimeout=%SSH_TIMEOUT%s -oStrictHostKeyChecking=no "
 		"-oUserKnownHostsFile=/dev/null root@%IP% \""
@@ -41,6 +41,7 @@ HEADERS += \
 	$$PWD/robotModel/real/parts/motor.h \
 	$$PWD/robotModel/real/parts/button.h \
 	$$PWD/robotModel/real/parts/led.h \
+	$$PWD/robotModel/real/parts/ev3BatchedSensor.h \
 	$$PWD/robotModel/real/parts/ev3InputDevice.h \
 	$$PWD/robotModel/real/parts/encoderSensor.h \
 	$$PWD/robotModel/real/parts/touchSensor.h \
@@ -73,6 +74,7 @@ SOURCES += \
 	$$PWD/robotModel/real/parts/motor.cpp \
 	$$PWD/robotModel/real/parts/button.cpp \
 	$$PWD/robotModel/real/parts/led.cpp \
+	$$PWD/robotModel/real/parts/ev3BatchedSensor.cpp \
 	$$PWD/robotModel/real/parts/ev3InputDevice.cpp \
 	$$PWD/robotModel/real/parts/encoderSensor.cpp \
 	$$PWD/robotModel/real/parts/touchSensor.cpp \
@@ -34,22 +34,29 @@ Button::Button(const DeviceInfo &info, const PortInfo &port
 
 void Button::read()
 {
-	QByteArray command = Ev3DirectCommand::formCommand(13, 4, 1, 0
-			, enums::commandType::CommandTypeEnum::DIRECT_COMMAND_REPLY);
-	int index = 7;
-	Ev3DirectCommand::addOpcode(enums::opcode::OpcodeEnum::UI_BUTTON_PRESSED, command, index);
-	Ev3DirectCommand::addByteParameter(parsePort(port().name()), command, index);
-	Ev3DirectCommand::addGlobalIndex(0, command, index);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, buttonResponseSize, outputBuf);
-	if (outputBuf.length() == buttonResponseSize && outputBuf.data()[5] == buttonPressed) {
+	Ev3BatchedSensor::read(mRobotCommunicator, {this});
+}
+
+bool Button::enqueueRead(Ev3DirectCommandBatch &batch) const
+{
+	const char button = parsePort(port().name());
+	return batch.add(6, 1, [button](QByteArray &command, int &index, quint8 globalOffset) {
+		Ev3DirectCommand::addOpcode(enums::opcode::OpcodeEnum::UI_BUTTON_PRESSED, command, index);
+		Ev3DirectCommand::addByteParameter(button, command, index);
+		Ev3DirectCommand::addGlobalIndex(static_cast<qint8>(globalOffset), command, index);
+	}) >= 0;
+}
+
+void Button::processReading(const QByteArray &response)
+{
+	if (response.length() == buttonResponseSize && response.data()[5] == buttonPressed) {
 		emit newData(1);
 	} else {
 		emit newData(0);
 	}
 }
 
-char Button::parsePort(const QString &portName)
+char Button::parsePort(const QString &portName) const
 {
 	if (portName == "UpButtonPort") {
 		return enums::brickButton::BrickButtonEnum::UP;
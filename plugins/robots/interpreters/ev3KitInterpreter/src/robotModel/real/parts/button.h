@@ -17,12 +17,14 @@
 #include <kitBase/robotModel/robotParts/button.h>
 #include <utils/robotCommunication/robotCommunicator.h>
 
+#include "ev3BatchedSensor.h"
+
 namespace ev3 {
 namespace robotModel {
 namespace real {
 namespace parts {
 
-class Button : public kitBase::robotModel::robotParts::Button
+class Button : public kitBase::robotModel::robotParts::Button, public Ev3BatchedSensor
 {
 	Q_OBJECT
 
@@ -32,9 +34,11 @@ public:
 			, utils::robotCommunication::RobotCommunicator &robotCommunicator);
 
 	void read() override;
+	bool enqueueRead(communication::Ev3DirectCommandBatch &batch) const override;
+	void processReading(const QByteArray &response) override;
 
 private:
-	char parsePort(const QString &portName);
+	char parsePort(const QString &portName) const;
 
 	utils::robotCommunication::RobotCommunicator &mRobotCommunicator;
 };
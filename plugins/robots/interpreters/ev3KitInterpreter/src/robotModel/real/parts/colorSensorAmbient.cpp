@@ -16,8 +16,6 @@
 
 #include <ev3Kit/communication/ev3DirectCommand.h>
 
-const unsigned colorSensorResponseSize = 9;
-
 using namespace ev3::robotModel::real::parts;
 using namespace ev3::communication;
 using namespace kitBase::robotModel;
@@ -33,8 +31,15 @@ ColorSensorAmbient::ColorSensorAmbient(const kitBase::robotModel::DeviceInfo &in
 
 void ColorSensorAmbient::read()
 {
-	const QByteArray command = mImplementation.readyPercentCommand(mImplementation.lowLevelPort(), 1);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, colorSensorResponseSize, outputBuf);
-	emit newData(static_cast<int>(outputBuf.data()[5]));
+	Ev3BatchedSensor::read(mRobotCommunicator, {this});
+}
+
+bool ColorSensorAmbient::enqueueRead(communication::Ev3DirectCommandBatch &batch) const
+{
+	return mImplementation.enqueueReady(batch, enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_PCT, 1);
+}
+
+void ColorSensorAmbient::processReading(const QByteArray &response)
+{
+	emit newData(static_cast<int>(response.data()[5]));
 }
@@ -31,8 +31,15 @@ ColorSensorBlue::ColorSensorBlue(const kitBase::robotModel::DeviceInfo &info
 
 void ColorSensorBlue::read()
 {
-	const QByteArray command = mImplementation.readyPercentCommand(mImplementation.lowLevelPort(), 4);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, colorSensorResponseSize, outputBuf);
-	emit newData(static_cast<int>(outputBuf[5]));
+	Ev3BatchedSensor::read(mRobotCommunicator, {this});
+}
+
+bool ColorSensorBlue::enqueueRead(communication::Ev3DirectCommandBatch &batch) const
+{
+	return mImplementation.enqueueReady(batch, enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_PCT, 4);
+}
+
+void ColorSensorBlue::processReading(const QByteArray &response)
+{
+	emit newData(static_cast<int>(response[5]));
 }
@@ -31,8 +31,15 @@ ColorSensorFull::ColorSensorFull(const kitBase::robotModel::DeviceInfo &info
 
 void ColorSensorFull::read()
 {
-	const QByteArray command = mImplementation.readyRawCommand(mImplementation.lowLevelPort(), 2);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, colorSensorResponseSize, outputBuf);
-	emit newData(static_cast<int>(outputBuf.data()[5]));
+	Ev3BatchedSensor::read(mRobotCommunicator, {this});
+}
+
+bool ColorSensorFull::enqueueRead(communication::Ev3DirectCommandBatch &batch) const
+{
+	return mImplementation.enqueueReady(batch, enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_RAW, 2);
+}
+
+void ColorSensorFull::processReading(const QByteArray &response)
+{
+	emit newData(static_cast<int>(response.data()[5]));
 }
@@ -31,8 +31,15 @@ ColorSensorGreen::ColorSensorGreen(const kitBase::robotModel::DeviceInfo &info
 
 void ColorSensorGreen::read()
 {
-	const QByteArray command = mImplementation.readyPercentCommand(mImplementation.lowLevelPort(), 3);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, colorSensorResponseSize, outputBuf);
-	emit newData(static_cast<int>(outputBuf.data()[5]));
+	Ev3BatchedSensor::read(mRobotCommunicator, {this});
+}
+
+bool ColorSensorGreen::enqueueRead(communication::Ev3DirectCommandBatch &batch) const
+{
+	return mImplementation.enqueueReady(batch, enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_PCT, 3);
+}
+
+void ColorSensorGreen::processReading(const QByteArray &response)
+{
+	emit newData(static_cast<int>(response.data()[5]));
 }
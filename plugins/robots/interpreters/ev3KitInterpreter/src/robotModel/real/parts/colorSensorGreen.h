@@ -17,6 +17,7 @@
 #include <kitBase/robotModel/robotParts/colorSensorGreen.h>
 #include <utils/robotCommunication/robotCommunicator.h>
 
+#include "ev3BatchedSensor.h"
 #include "ev3InputDevice.h"
 
 namespace ev3 {
@@ -24,7 +25,7 @@ namespace robotModel {
 namespace real {
 namespace parts {
 
-class ColorSensorGreen : public kitBase::robotModel::robotParts::ColorSensorGreen
+class ColorSensorGreen : public kitBase::robotModel::robotParts::ColorSensorGreen, public Ev3BatchedSensor
 {
 	Q_OBJECT
 
@@ -34,6 +35,8 @@ public:
 			, utils::robotCommunication::RobotCommunicator &robotCommunicator);
 
 	void read() override;
+	bool enqueueRead(communication::Ev3DirectCommandBatch &batch) const override;
+	void processReading(const QByteArray &response) override;
 
 private:
 	Ev3InputDevice mImplementation;
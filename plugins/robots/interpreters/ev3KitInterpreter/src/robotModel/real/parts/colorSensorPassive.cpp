@@ -31,8 +31,15 @@ ColorSensorPassive::ColorSensorPassive(const kitBase::robotModel::DeviceInfo &in
 
 void ColorSensorPassive::read()
 {
-	const QByteArray command = mImplementation.readyPercentCommand(mImplementation.lowLevelPort(), 1);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, colorSensorResponseSize, outputBuf);
-	emit newData(static_cast<int>(outputBuf.data()[5]));
+	Ev3BatchedSensor::read(mRobotCommunicator, {this});
+}
+
+bool ColorSensorPassive::enqueueRead(communication::Ev3DirectCommandBatch &batch) const
+{
+	return mImplementation.enqueueReady(batch, enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_PCT, 1);
+}
+
+void ColorSensorPassive::processReading(const QByteArray &response)
+{
+	emit newData(static_cast<int>(response.data()[5]));
 }
@@ -31,8 +31,15 @@ ColorSensorRed::ColorSensorRed(const kitBase::robotModel::DeviceInfo &info
 
 void ColorSensorRed::read()
 {
-	const QByteArray command = mImplementation.readyPercentCommand(mImplementation.lowLevelPort(), 0);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, colorSensorResponseSize, outputBuf);
-	emit newData(static_cast<int>(outputBuf.data()[5]));
+	Ev3BatchedSensor::read(mRobotCommunicator, {this});
+}
+
+bool ColorSensorRed::enqueueRead(communication::Ev3DirectCommandBatch &batch) const
+{
+	return mImplementation.enqueueReady(batch, enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_PCT, 0);
+}
+
+void ColorSensorRed::processReading(const QByteArray &response)
+{
+	emit newData(static_cast<int>(response.data()[5]));
 }
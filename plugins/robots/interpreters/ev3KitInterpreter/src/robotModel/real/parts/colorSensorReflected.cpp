@@ -31,8 +31,15 @@ ColorSensorReflected::ColorSensorReflected(const kitBase::robotModel::DeviceInfo
 
 void ColorSensorReflected::read()
 {
-	const QByteArray command = mImplementation.readyPercentCommand(mImplementation.lowLevelPort(), 0);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, colorSensorResponseSize, outputBuf);
-	emit newData(static_cast<int>(outputBuf.data()[5]));
+	Ev3BatchedSensor::read(mRobotCommunicator, {this});
+}
+
+bool ColorSensorReflected::enqueueRead(communication::Ev3DirectCommandBatch &batch) const
+{
+	return mImplementation.enqueueReady(batch, enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_PCT, 0);
+}
+
+void ColorSensorReflected::processReading(const QByteArray &response)
+{
+	emit newData(static_cast<int>(response.data()[5]));
 }
@@ -17,6 +17,7 @@
 #include <kitBase/robotModel/robotParts/colorSensorReflected.h>
 #include <utils/robotCommunication/robotCommunicator.h>
 
+#include "ev3BatchedSensor.h"
 #include "ev3InputDevice.h"
 
 namespace ev3 {
@@ -24,7 +25,7 @@ namespace robotModel {
 namespace real {
 namespace parts {
 
-class ColorSensorReflected : public kitBase::robotModel::robotParts::ColorSensorReflected
+class ColorSensorReflected : public kitBase::robotModel::robotParts::ColorSensorReflected, public Ev3BatchedSensor
 {
 	Q_OBJECT
 public:
@@ -33,6 +34,8 @@ public:
 			, utils::robotCommunication::RobotCommunicator &robotCommunicator);
 
 	void read() override;
+	bool enqueueRead(communication::Ev3DirectCommandBatch &batch) const override;
+	void processReading(const QByteArray &response) override;
 
 private:
 	Ev3InputDevice mImplementation;
@@ -16,8 +16,6 @@
 
 #include <ev3Kit/communication/ev3DirectCommand.h>
 
-const unsigned encoderSensorResponseSize = 9;
-
 using namespace ev3::robotModel::real::parts;
 using namespace kitBase::robotModel;
 
@@ -31,15 +29,22 @@ EncoderSensor::EncoderSensor(const DeviceInfo &info, const PortInfo &port
 
 void EncoderSensor::read()
 {
-	QByteArray command = mImplementation.readyRawCommand(mImplementation.lowLevelPort(), 0);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, encoderSensorResponseSize, outputBuf);
-	int secondByte = static_cast<quint8>(outputBuf[6]) << 8;
-	if (static_cast<int>(outputBuf[7]) < 0) {
-		secondByte = static_cast<int>(outputBuf[6]) << 8;
+	Ev3BatchedSensor::read(mRobotCommunicator, {this});
+}
+
+bool EncoderSensor::enqueueRead(communication::Ev3DirectCommandBatch &batch) const
+{
+	return mImplementation.enqueueReady(batch, enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_RAW, 0);
+}
+
+void EncoderSensor::processReading(const QByteArray &response)
+{
+	int secondByte = static_cast<quint8>(response[6]) << 8;
+	if (static_cast<int>(response[7]) < 0) {
+		secondByte = static_cast<int>(response[6]) << 8;
 	}
 
-	emit newData(static_cast<quint8>(outputBuf[5]) | secondByte);
+	emit newData(static_cast<quint8>(response[5]) | secondByte);
 }
 
 void EncoderSensor::nullify()
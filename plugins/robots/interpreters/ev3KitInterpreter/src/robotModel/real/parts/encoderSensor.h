@@ -17,6 +17,7 @@
 #include <kitBase/robotModel/robotParts/encoderSensor.h>
 #include <utils/robotCommunication/robotCommunicator.h>
 
+#include "ev3BatchedSensor.h"
 #include "ev3InputDevice.h"
 
 namespace ev3 {
@@ -24,7 +25,7 @@ namespace robotModel {
 namespace real {
 namespace parts {
 
-class EncoderSensor : public kitBase::robotModel::robotParts::EncoderSensor
+class EncoderSensor : public kitBase::robotModel::robotParts::EncoderSensor, public Ev3BatchedSensor
 {
 	Q_OBJECT
 
@@ -34,6 +35,8 @@ public:
 			, utils::robotCommunication::RobotCommunicator &robotCommunicator);
 
 	void read() override;
+	bool enqueueRead(communication::Ev3DirectCommandBatch &batch) const override;
+	void processReading(const QByteArray &response) override;
 	void nullify() override;
 
 private:
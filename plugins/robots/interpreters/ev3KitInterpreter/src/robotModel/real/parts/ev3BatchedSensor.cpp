@@ -0,0 +1,51 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "ev3BatchedSensor.h"
+
+using namespace ev3::robotModel::real::parts;
+using namespace ev3::communication;
+
+Ev3BatchedSensor::~Ev3BatchedSensor()
+{
+}
+
+void Ev3BatchedSensor::read(utils::robotCommunication::RobotCommunicator &robotCommunicator
+		, const QList<Ev3BatchedSensor *> &sensors)
+{
+	int sent = 0;
+	while (sent < sensors.size()) {
+		Ev3DirectCommandBatch batch;
+		QList<Ev3BatchedSensor *> batched;
+		while (sent < sensors.size() && sensors[sent]->enqueueRead(batch)) {
+			batched << sensors[sent++];
+		}
+
+		if (batched.isEmpty()) {
+			// Request that does not fit even into an empty batch is a bug in the sensor, skip it.
+			++sent;
+			continue;
+		}
+
+		// Message counter is assigned by the communication thread.
+		QByteArray reply;
+		robotCommunicator.send(batch.command(0), batch.responseSize(), reply);
+		for (int i = 0; i < batched.size(); ++i) {
+			const QByteArray response = batch.response(i, reply);
+			if (!response.isEmpty()) {
+				batched[i]->processReading(response);
+			}
+		}
+	}
+}
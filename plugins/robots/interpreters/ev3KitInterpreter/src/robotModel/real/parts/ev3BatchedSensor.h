@@ -0,0 +1,50 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QList>
+
+#include <ev3Kit/communication/ev3DirectCommandBatch.h>
+#include <utils/robotCommunication/robotCommunicator.h>
+
+namespace ev3 {
+namespace robotModel {
+namespace real {
+namespace parts {
+
+/// Sensor whose reading request can be merged with requests of other sensors into one direct command,
+/// so polling all sensors takes one round trip to the brick instead of one per sensor.
+class Ev3BatchedSensor
+{
+public:
+	virtual ~Ev3BatchedSensor();
+
+	/// Adds request for sensor reading to the batch.
+	/// @returns false if the request does not fit into the batch.
+	virtual bool enqueueRead(communication::Ev3DirectCommandBatch &batch) const = 0;
+
+	/// Handles response to the request added by enqueueRead(). The response has the same layout as a response
+	/// to the request sent alone: 5 bytes of reply header followed by global variables of the request.
+	virtual void processReading(const QByteArray &response) = 0;
+
+	/// Reads given sensors using as few direct commands as possible.
+	static void read(utils::robotCommunication::RobotCommunicator &robotCommunicator
+			, const QList<Ev3BatchedSensor *> &sensors);
+};
+
+}
+}
+}
+}
@@ -29,57 +29,22 @@ Ev3InputDevice::Ev3InputDevice(utils::robotCommunication::RobotCommunicator &rob
 {
 }
 
-void Ev3InputDevice::send(const QByteArray &command, const unsigned responseSize, QByteArray reading)
-{
-	mRobotCommunicator.send(command, responseSize, reading);
-}
-
 char Ev3InputDevice::lowLevelPort() const
 {
 	return mLowLevelPort;
 }
 
-QByteArray Ev3InputDevice::readySiCommand(int port, int sensorMode)
-{
-	QByteArray command = Ev3DirectCommand::formCommand(21, 2, 4, 0
-			, enums::commandType::CommandTypeEnum::DIRECT_COMMAND_REPLY);
-	int index = 7;
-	Ev3DirectCommand::addOpcode(enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_SI, command, index);
-	Ev3DirectCommand::addByteParameter(enums::daisyChainLayer::DaisyChainLayerEnum::EV3, command, index);
-	Ev3DirectCommand::addByteParameter(port, command, index);
-	Ev3DirectCommand::addByteParameter(0x00, command, index);        //type (0 = Don’t change type)
-	Ev3DirectCommand::addByteParameter(sensorMode, command, index);  // mode – Device mode [0-7]
-	Ev3DirectCommand::addByteParameter(0x01, command, index);        // # values
-	Ev3DirectCommand::addGlobalIndex(0x00, command, index);          // index for return data
-	return command;
-}
-
-QByteArray Ev3InputDevice::readyRawCommand(int port, int sensorMode)
-{
-	QByteArray command = Ev3DirectCommand::formCommand(21, 2, 4, 0
-			, enums::commandType::CommandTypeEnum::DIRECT_COMMAND_REPLY);
-	int index = 7;
-	Ev3DirectCommand::addOpcode(enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_RAW, command, index);
-	Ev3DirectCommand::addByteParameter(enums::daisyChainLayer::DaisyChainLayerEnum::EV3, command, index);
-	Ev3DirectCommand::addByteParameter(port, command, index);
-	Ev3DirectCommand::addByteParameter(0x00, command, index);        // type (0 = Don’t change type)
-	Ev3DirectCommand::addByteParameter(sensorMode, command, index);  // mode – Device mode [0-7]
-	Ev3DirectCommand::addByteParameter(0x01, command, index);        // # values
-	Ev3DirectCommand::addGlobalIndex(0x00, command, index);          // index for return data
-	return command;
-}
-
-QByteArray Ev3InputDevice::readyPercentCommand(int port, int sensorMode)
+bool Ev3InputDevice::enqueueReady(Ev3DirectCommandBatch &batch, enums::opcode::OpcodeEnum opcode
+		, int sensorMode) const
 {
-	QByteArray command = Ev3DirectCommand::formCommand(21, 2, 4, 0
-			, enums::commandType::CommandTypeEnum::DIRECT_COMMAND_REPLY);
-	int index = 7;
-	Ev3DirectCommand::addOpcode(enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_PCT, command, index);
-	Ev3DirectCommand::addByteParameter(enums::daisyChainLayer::DaisyChainLayerEnum::EV3, command, index);
-	Ev3DirectCommand::addByteParameter(port, command, index);
-	Ev3DirectCommand::addByteParameter(0x00, command, index);        // type (0 = Don’t change type)
-	Ev3DirectCommand::addByteParameter(sensorMode, command, index);  // mode – Device mode [0-7]
-	Ev3DirectCommand::addByteParameter(0x01, command, index);        // # values
-	Ev3DirectCommand::addGlobalIndex(0x00, command, index);          // index for return data
-	return command;
+	const char port = mLowLevelPort;
+	return batch.add(14, 4, [opcode, port, sensorMode](QByteArray &command, int &index, quint8 globalOffset) {
+		Ev3DirectCommand::addOpcode(opcode, command, index);
+		Ev3DirectCommand::addByteParameter(enums::daisyChainLayer::DaisyChainLayerEnum::EV3, command, index);
+		Ev3DirectCommand::addByteParameter(port, command, index);
+		Ev3DirectCommand::addByteParameter(0x00, command, index);        // type (0 = Don’t change type)
+		Ev3DirectCommand::addByteParameter(sensorMode, command, index);  // mode – Device mode [0-7]
+		Ev3DirectCommand::addByteParameter(0x01, command, index);        // # values
+		Ev3DirectCommand::addGlobalIndex(static_cast<qint8>(globalOffset), command, index);
+	}) >= 0;
 }
@@ -18,6 +18,8 @@
 
 #include <kitBase/robotModel/robotParts/abstractSensor.h>
 #include <utils/robotCommunication/robotCommunicator.h>
+#include <ev3Kit/communication/commandConstants.h>
+#include <ev3Kit/communication/ev3DirectCommandBatch.h>
 
 namespace ev3 {
 namespace robotModel {
@@ -32,14 +34,14 @@ public:
 	Ev3InputDevice(utils::robotCommunication::RobotCommunicator &robotCommunicator
 			, const kitBase::robotModel::PortInfo &port);
 
-	void send(const QByteArray &command, const unsigned responseSize, QByteArray reading);
-
 	/// Returns a value of port that can be used as corresponding byte in request packages.
 	char lowLevelPort() const;
 
-	QByteArray readySiCommand(int port, int sensorMode);
-	QByteArray readyRawCommand(int port, int sensorMode);
-	QByteArray readyPercentCommand(int port, int sensorMode);
+	/// Adds INPUT_DEVICE_READY_SI, INPUT_DEVICE_READY_RAW or INPUT_DEVICE_READY_PCT request for one value
+	/// of this port to the batch. The value is returned in 4 bytes of global variables.
+	/// @returns false if the request does not fit into the batch.
+	bool enqueueReady(communication::Ev3DirectCommandBatch &batch, enums::opcode::OpcodeEnum opcode
+			, int sensorMode) const;
 
 private:
 	//enums::inputPort::InputPortEnum parsePort();
@@ -14,8 +14,6 @@
 
 #include "gyroscope.h"
 
-const unsigned gyroscopeSensorResponseSize = 9;
-
 using namespace ev3::robotModel::real::parts;
 using namespace kitBase::robotModel;
 
@@ -36,8 +34,15 @@ void Gyroscope::calibrate()
 
 void Gyroscope::read()
 {
-	const QByteArray command = mImplementation.readyPercentCommand(mImplementation.lowLevelPort(), 0);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, gyroscopeSensorResponseSize, outputBuf);
-	setLastData({static_cast<int>(outputBuf.data()[5])});
+	Ev3BatchedSensor::read(mRobotCommunicator, {this});
+}
+
+bool Gyroscope::enqueueRead(communication::Ev3DirectCommandBatch &batch) const
+{
+	return mImplementation.enqueueReady(batch, enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_PCT, 0);
+}
+
+void Gyroscope::processReading(const QByteArray &response)
+{
+	setLastData({static_cast<int>(response.data()[5])});
 }
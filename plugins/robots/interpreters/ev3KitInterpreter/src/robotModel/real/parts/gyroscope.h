@@ -17,6 +17,7 @@
 #include <utils/robotCommunication/robotCommunicator.h>
 #include <kitBase/robotModel/robotParts/gyroscopeSensor.h>
 
+#include "ev3BatchedSensor.h"
 #include "ev3InputDevice.h"
 
 namespace ev3 {
@@ -24,7 +25,7 @@ namespace robotModel {
 namespace real {
 namespace parts {
 
-class Gyroscope : public kitBase::robotModel::robotParts::GyroscopeSensor
+class Gyroscope : public kitBase::robotModel::robotParts::GyroscopeSensor, public Ev3BatchedSensor
 {
 	Q_OBJECT
 
@@ -34,6 +35,8 @@ public:
 			, utils::robotCommunication::RobotCommunicator &robotCommunicator);
 
 	void read() override;
+	bool enqueueRead(communication::Ev3DirectCommandBatch &batch) const override;
+	void processReading(const QByteArray &response) override;
 
 	void calibrate() override;
 
@@ -14,8 +14,6 @@
 
 #include "lightSensor.h"
 
-const unsigned lightSensorResponseSize = 9;
-
 using namespace ev3::robotModel::real::parts;
 using namespace kitBase::robotModel;
 
@@ -30,8 +28,15 @@ LightSensor::LightSensor(const kitBase::robotModel::DeviceInfo &info
 
 void LightSensor::read()
 {
-	QByteArray command = mImplementation.readyPercentCommand(mImplementation.lowLevelPort(), 0);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, lightSensorResponseSize, outputBuf);
-	emit newData(static_cast<int>(outputBuf.data()[5]));
+	Ev3BatchedSensor::read(mRobotCommunicator, {this});
+}
+
+bool LightSensor::enqueueRead(communication::Ev3DirectCommandBatch &batch) const
+{
+	return mImplementation.enqueueReady(batch, enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_PCT, 0);
+}
+
+void LightSensor::processReading(const QByteArray &response)
+{
+	emit newData(static_cast<int>(response.data()[5]));
 }
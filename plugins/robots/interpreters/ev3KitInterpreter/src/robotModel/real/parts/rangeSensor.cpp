@@ -16,8 +16,6 @@
 
 #include <qrkernel/logging.h>
 
-const unsigned rangeSensorResponseSize = 10;
-
 using namespace ev3::robotModel::real::parts;
 using namespace kitBase::robotModel;
 
@@ -32,18 +30,24 @@ RangeSensor::RangeSensor(const kitBase::robotModel::DeviceInfo &info
 
 void RangeSensor::read()
 {
-	QByteArray command = mImplementation.readySiCommand(mImplementation.lowLevelPort(), 0);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, rangeSensorResponseSize, outputBuf);
+	Ev3BatchedSensor::read(mRobotCommunicator, {this});
+}
+
+bool RangeSensor::enqueueRead(communication::Ev3DirectCommandBatch &batch) const
+{
+	return mImplementation.enqueueReady(batch, enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_SI, 0);
+}
 
+void RangeSensor::processReading(const QByteArray &response)
+{
 	union {
 		float f;
 		uchar b[4];
 	} floatFromBytesCast {};
-	floatFromBytesCast.b[3] = outputBuf.data()[8];
-	floatFromBytesCast.b[2] = outputBuf.data()[7];
-	floatFromBytesCast.b[1] = outputBuf.data()[6];
-	floatFromBytesCast.b[0] = outputBuf.data()[5];
+	floatFromBytesCast.b[3] = response.data()[8];
+	floatFromBytesCast.b[2] = response.data()[7];
+	floatFromBytesCast.b[1] = response.data()[6];
+	floatFromBytesCast.b[0] = response.data()[5];
 
 	const int data = qIsNaN(floatFromBytesCast.f) ? 0 : static_cast<int>(floatFromBytesCast.f);
 	emit newData(data);
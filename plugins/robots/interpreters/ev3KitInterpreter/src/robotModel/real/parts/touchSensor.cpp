@@ -14,7 +14,6 @@
 
 #include "touchSensor.h"
 
-const unsigned touchSensorResponseSize = 9;
 const unsigned pressed = 63;
 
 using namespace ev3::robotModel::real::parts;
@@ -31,10 +30,17 @@ TouchSensor::TouchSensor(const kitBase::robotModel::DeviceInfo &info
 
 void TouchSensor::read()
 {
-	const QByteArray command = mImplementation.readySiCommand(mImplementation.lowLevelPort(), 0);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, touchSensorResponseSize, outputBuf);
-	if (outputBuf.data()[8] == pressed) {
+	Ev3BatchedSensor::read(mRobotCommunicator, {this});
+}
+
+bool TouchSensor::enqueueRead(communication::Ev3DirectCommandBatch &batch) const
+{
+	return mImplementation.enqueueReady(batch, enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_SI, 0);
+}
+
+void TouchSensor::processReading(const QByteArray &response)
+{
+	if (response.data()[8] == pressed) {
 		emit newData(1);
 	} else {
 		emit newData(0);
@@ -16,6 +16,7 @@
 
 #include <qrkernel/settingsManager.h>
 
+#include "parts/ev3BatchedSensor.h"
 #include "parts/display.h"
 #include "parts/speaker.h"
 #include "parts/button.h"
@@ -65,6 +66,25 @@ void RealRobotModel::disconnectFromRobot()
 	mRobotCommunicator->disconnect();
 }
 
+void RealRobotModel::updateSensorsValues() const
+{
+	QList<parts::Ev3BatchedSensor *> batched;
+	for (robotParts::Device * const device : configuration().devices()) {
+		robotParts::AbstractSensor * const sensor = dynamic_cast<robotParts::AbstractSensor *>(device);
+		if (!sensor || sensor->port().reservedVariable().isEmpty() || !sensor->ready() || sensor->isLocked()) {
+			continue;
+		}
+
+		if (parts::Ev3BatchedSensor * const batchedSensor = dynamic_cast<parts::Ev3BatchedSensor *>(sensor)) {
+			batched << batchedSensor;
+		} else {
+			sensor->read();
+		}
+	}
+
+	parts::Ev3BatchedSensor::read(*mRobotCommunicator, batched);
+}
+
 robotParts::Device *RealRobotModel::createDevice(const PortInfo &port, const DeviceInfo &deviceInfo)
 {
 	if (deviceInfo.isA(speakerInfo())) {
@@ -34,6 +34,9 @@ public:
 	void connectToRobot() override;
 	void disconnectFromRobot() override;
 
+	/// Polls all sensors that support batching with one direct command per batch instead of one per sensor.
+	void updateSensorsValues() const override;
+
 signals:
 	/// Emitted when communicator throws an error to be displayed with error reporter.
 	void errorOccured(const QString &text);
@@ -22,6 +22,8 @@
 namespace interpreterCore {
 
 /// Provides a number of converters that transform some incompatible features in old save versions.
+/// All converters are repository-level ones, so they are applied to raw save contents before models are built
+/// and their consecutive element steps are fused into one pass over the save.
 class SaveConvertionManager
 {
 public:
@@ -29,11 +31,11 @@ public:
 	static QList<qReal::ProjectConverter> converters();
 
 private:
-	typedef std::function<bool(const qReal::Id &, qReal::LogicalModelAssistInterface &)> LogicalFilter;
-	typedef std::function<bool(const qReal::Id &, qReal::GraphicalModelAssistInterface &)> GraphicalFilter;
-	typedef std::function<qReal::Id(const qReal::Id &, qReal::GraphicalModelAssistInterface &)> GraphicalReplacer;
-	typedef std::function<void(const qReal::Id &, const qReal::Id &
-			, qReal::GraphicalModelAssistInterface &)> GraphicalConstructor;
+	/// Element-level conversion step. Takes id of a block and the repository snapshot, returns the id block has
+	/// after the step (null id if block was deleted), sets the last parameter to true if something was changed.
+	typedef qReal::ProjectConverter::ElementRewriter Filter;
+	typedef std::function<qReal::Id(const qReal::Id &, qReal::RepoSnapshot &)> GraphicalReplacer;
+	typedef std::function<void(const qReal::Id &, const qReal::Id &, qReal::RepoSnapshot &)> GraphicalConstructor;
 
 	/// Returns a converter that restricts all saves made by editors till 3.0.0 alpha1.
 	static qReal::ProjectConverter before300Alpha1Converter();
@@ -72,35 +74,41 @@ private:
 	static bool isRobotsDiagram(const qReal::Id &element);
 	static bool isDiagramType(const qReal::Id &element);
 	static bool isEdgeType(const qReal::Id &element);
-	static qReal::IdList elementsOfRobotsDiagrams(const qReal::LogicalModelAssistInterface &logicalApi);
 	static QString editor();
-	static void reconnectEdges(const qReal::Id &newBlock, const qReal::Id &block
-							   , qReal::details::ModelsAssistInterface &Api);
+	static void reconnectEdges(const qReal::Id &newBlock, const qReal::Id &block, qrRepo::RepoApi &repo);
+
+	/// Removes logical block with all its graphical instances from repository.
+	static void removeBlock(const qReal::Id &logicalBlock, qReal::RepoSnapshot &snapshot);
 
 	/// Helper method, creates "typical" that applies a list of filters to a block if block satisfies given condition.
 	/// @param oldVersion - version from which converter can convert.
 	/// @param newVersion - version to which converter converts save.
-	/// @param filters - a list of elementary conversion steps. Each filter is a function that takes Id of a block
-	///        and logical model API and shall return true if it has changed something or false if it did nothing.
-	///        Every filter will be called for every logical block in a save.
+	/// @param logicalFilters - a list of elementary conversion steps. Every filter will be called for every
+	///        logical block of robots diagrams in a save.
+	/// @param graphicalFilters - a list of elementary conversion steps that will be called for the graphical
+	///        instance of every logical block.
 	/// @param condition - logical predicate that shall be true for a block to be processed.
 	static qReal::ProjectConverter constructConverter(const QString &oldVersion, const QString &newVersion
-			, const QList<LogicalFilter> &logicalFilters
-			, const QList<GraphicalFilter> &graphicalFilters = {}
+			, const QList<Filter> &logicalFilters
+			, const QList<Filter> &graphicalFilters = {}
 			, const std::function<bool(const qReal::Id &)> &condition
 					= [] (const qReal::Id &block) { return !block.isNull(); }
 			);
 
+	/// Helper method, creates converter that transforms only meta-information of a save.
+	static qReal::ProjectConverter constructProjectConverter(const QString &oldVersion, const QString &newVersion
+			, const qReal::ProjectConverter::ProjectRewriter &rewriter);
+
 	/// Helper method, constructs property replace filter. Takes map in form { {<from>, <to>}, ... } and applies
 	/// replacements coded in this map to every property of a block.
-	static LogicalFilter replace(const QMap<QString, QString> &replacementRules);
+	static Filter replace(const QMap<QString, QString> &replacementRules);
 
 	/// Helper method, constructs deleting filter. If block in old save was removed from metamodel of a new version,
 	/// it is safer to delete it completely.
-	static LogicalFilter deleteBlocks(const QStringList &blocks);
+	static Filter deleteBlocks(const QStringList &blocks);
 
 	/// Helper method, constructs quoting filter. Puts '"' around value of given property of all blocks with given type.
-	static LogicalFilter quote(const QString &blockType, const QString &property);
+	static Filter quote(const QString &blockType, const QString &property);
 
 	/// Helper method, constructs filter for graphical model recreation. For each graphical block in model
 	/// \a constructor will be called with the id of that block. If constructor returns non-null type id
@@ -110,8 +118,8 @@ private:
 	/// If null id is returned the block stays without modification. Otherwise returned type id will be used
 	/// to replace current block with the returned one.
 	/// @param constructor A fucntion that will initialize new element right after its creation.
-	/// The id of the new block, old block and graphical model will be passed there in this exact order.
-	static GraphicalFilter graphicalRecreate(const GraphicalReplacer &replacer
+	/// The id of the new block, old block and repository snapshot will be passed there in this exact order.
+	static Filter graphicalRecreate(const GraphicalReplacer &replacer
 			, const GraphicalConstructor &constructor);
 };
 
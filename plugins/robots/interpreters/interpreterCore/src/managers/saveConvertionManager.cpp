@@ -22,26 +22,38 @@ QString SaveConvertionManager::editor()
 	return "RobotsMetamodel";
 }
 
-void SaveConvertionManager::reconnectEdges(const Id &newBlock, const Id &block
-										   , details::ModelsAssistInterface &api)
+void SaveConvertionManager::reconnectEdges(const Id &newBlock, const Id &block, qrRepo::RepoApi &repo)
 {
 	const bool isEdge = isEdgeType(block);
 	if (isEdge) {
 		// If out element is edge then connecting it to same elements as the old one was connected
-		api.setFrom(newBlock, api.from(block));
-		api.setTo(newBlock, api.to(block));
+		repo.setFrom(newBlock, repo.from(block));
+		repo.setTo(newBlock, repo.to(block));
 	} else {
 		// Replacing old node in all incomming and outgoing edges of the old node with the new one.
-		for (const Id &edge : api.mutableRepoApi().outgoingLinks(block)) {
-			api.mutableRepoApi().setProperty(edge, "from", newBlock.toVariant());
+		for (const Id &edge : repo.outgoingLinks(block)) {
+			repo.setProperty(edge, "from", newBlock.toVariant());
 		}
 
-		for (const Id &edge : api.mutableRepoApi().incomingLinks(block)) {
-			api.mutableRepoApi().setProperty(edge, "to", newBlock.toVariant());
+		for (const Id &edge : repo.incomingLinks(block)) {
+			repo.setProperty(edge, "to", newBlock.toVariant());
 		}
 	}
 }
 
+void SaveConvertionManager::removeBlock(const Id &logicalBlock, RepoSnapshot &snapshot)
+{
+	qrRepo::RepoApi &repo = snapshot.repo();
+	for (const Id &graphicalBlock : snapshot.graphicalIds(logicalBlock)) {
+		repo.removeChild(repo.parent(graphicalBlock), graphicalBlock);
+		repo.removeElement(graphicalBlock);
+	}
+
+	snapshot.unregisterLogicalId(logicalBlock);
+	repo.removeChild(repo.parent(logicalBlock), logicalBlock);
+	repo.removeElement(logicalBlock);
+}
+
 QList<ProjectConverter> SaveConvertionManager::converters()
 {
 	return { before300Alpha1Converter()
@@ -60,10 +72,8 @@ QList<ProjectConverter> SaveConvertionManager::converters()
 ProjectConverter SaveConvertionManager::before300Alpha1Converter()
 {
 	return ProjectConverter(editor(), Version(), Version::fromString("3.0.0-a1")
-			, [=](GraphicalModelAssistInterface &, LogicalModelAssistInterface &)
-	{
-		return ProjectConverter::VersionTooOld;
-	});
+			, [=](RepoSnapshot &) { return ProjectConverter::VersionTooOld; }
+			, ProjectConverter::ElementRewriter());
 }
 
 ProjectConverter SaveConvertionManager::from300Alpha4to300Alpha5Converter()
@@ -141,12 +151,12 @@ qReal::ProjectConverter SaveConvertionManager::from300to301Converter()
 						, {"upButton", "buttonUp"}
 						, {"powerButton", "buttonEsc"}
 				  })
-				, [=] (const Id &block, LogicalModelAssistInterface &logicalApi) {
+				, [=] (const Id &block, RepoSnapshot &snapshot, bool &modified) {
 						if (block.element().startsWith("Trik")) {
-							return replace({{"buttonEscape", "buttonEsc"}})(block, logicalApi);
+							return replace({{"buttonEscape", "buttonEsc"}})(block, snapshot, modified);
 						}
 
-						return false;
+						return block;
 					}
 				, deleteBlocks({"Ev3WaitForUp"
 						, "Ev3WaitForEnter"
@@ -195,29 +205,31 @@ ProjectConverter SaveConvertionManager::from302to310Converter()
 	return constructConverter("3.0.2", "3.1.0"
 			, {
 				replace(replacementRules)
-				, [=](const Id &block, LogicalModelAssistInterface &logicalApi) {
+				, [=](const Id &block, RepoSnapshot &snapshot, bool &modified) {
 					if (block.element() == "RobotsDiagramNode") {
-						QString worldModel = logicalApi.logicalRepoApi().stringProperty(block, "worldModel");
+						QString worldModel = snapshot.repo().stringProperty(block, "worldModel");
 						for (const QString &toReplace : replacementRules.keys()) {
 							if (worldModel.contains(toReplace)) {
 								worldModel.replace(toReplace, replacementRules[toReplace]);
 							}
 						}
 
-						logicalApi.mutableLogicalRepoApi().setMetaInformation("worldModel", worldModel);
-						return true;
+						if (snapshot.repo().metaInformation("worldModel").toString() != worldModel) {
+							snapshot.repo().setMetaInformation("worldModel", worldModel);
+							modified = true;
+						}
 					}
 
-					return false;
+					return block;
 				}
 			}
 			, {
 				// This one repairs labels positions. At some moment a number of labels on scene
 				// reduced a lot, so old saves used wrong partial models. The easiest fix "by hand"
 				// is to cut and paste element. This converter does the same thing.
-				graphicalRecreate([](const Id &block, GraphicalModelAssistInterface &) { return block.type(); }
-						, [](const Id &newBlock, const Id &oldBlock, GraphicalModelAssistInterface &model) {
-							model.copyProperties(newBlock, oldBlock);
+				graphicalRecreate([](const Id &block, RepoSnapshot &) { return block.type(); }
+						, [](const Id &newBlock, const Id &oldBlock, RepoSnapshot &snapshot) {
+							snapshot.repo().copyProperties(newBlock, oldBlock);
 				})
 			}
 	);
@@ -239,25 +251,23 @@ ProjectConverter SaveConvertionManager::from312to313Converter()
 
 ProjectConverter SaveConvertionManager::from320to330Converter()
 {
-	return ProjectConverter(editor(), Version::fromString("3.2.0"), Version::fromString("3.3.0")
-			, [=](GraphicalModelAssistInterface &, LogicalModelAssistInterface &logicalApi)
+	return constructProjectConverter("3.2.0", "3.3.0", [=](RepoSnapshot &snapshot)
 	{
-		QString worldModel = logicalApi.logicalRepoApi().metaInformation("worldModel").toString();
+		QString worldModel = snapshot.repo().metaInformation("worldModel").toString();
 		if (!worldModel.contains("trikV62KitRobot")) {
 			return ProjectConverter::NoModificationsMade;
 		}
 		worldModel.replace("trikV62KitRobot", "trikKitRobot");
-		logicalApi.mutableLogicalRepoApi().setMetaInformation("worldModel", worldModel);
+		snapshot.repo().setMetaInformation("worldModel", worldModel);
 		return ProjectConverter::Success;
 	});
 }
 
 ProjectConverter SaveConvertionManager::from330to20204Converter()
 {
-	return ProjectConverter(editor(), Version::fromString("3.3.0"), Version::fromString("2020.4")
-			, [=](GraphicalModelAssistInterface &, LogicalModelAssistInterface &logicalApi)
+	return constructProjectConverter("3.3.0", "2020.4", [=](RepoSnapshot &snapshot)
 	{
-		QString worldModel = logicalApi.logicalRepoApi().metaInformation("worldModel").toString();
+		QString worldModel = snapshot.repo().metaInformation("worldModel").toString();
 		if (!worldModel.contains("trik::robotModel::parts::TrikLineSensor")
 				&& !worldModel.contains("value=\"trik::robotModel::twoD::parts::TwoDInfraredSensor")) {
 			return ProjectConverter::NoModificationsMade;
@@ -271,68 +281,43 @@ ProjectConverter SaveConvertionManager::from330to20204Converter()
 
 		worldModel.replace("TrikLineSensor", "TrikVideoCamera");
 
-		logicalApi.mutableLogicalRepoApi().setMetaInformation("worldModel", worldModel);
+		snapshot.repo().setMetaInformation("worldModel", worldModel);
 		return ProjectConverter::Success;
 	});
 }
 
 ProjectConverter SaveConvertionManager::from20204to20205Converter()
 {
-	return ProjectConverter(editor(), Version::fromString("2020.4"), Version::fromString("2020.4.1")
-			, [=](GraphicalModelAssistInterface &graphicalApi, LogicalModelAssistInterface &logicalApi)
-	{
-		if (!logicalApi.logicalRepoApi()
-				.metaInformation("lastKitId").toString().contains("trik", Qt::CaseInsensitive)) {
-			return ProjectConverter::NoModificationsMade;
-		}
-
-		bool modificationsMade = false;
-
-		for (const Id &block : elementsOfRobotsDiagrams(logicalApi)) {
-			const Id logicalBlock = graphicalApi.isGraphicalId(block)
-					? graphicalApi.logicalId(block)
-					: block;
-
-			Id graphicalBlock;
-			if (graphicalApi.isGraphicalId(block)) {
-				graphicalBlock = block;
-			} else {
-				const IdList graphicalIds = graphicalApi.graphicalIdsByLogicalId(logicalBlock);
-				if (graphicalIds.isEmpty()) {
-					continue;
-				}
+	return constructConverter("2020.4", "2020.4.1"
+			, {
+				[=](const Id &logicalBlock, RepoSnapshot &snapshot, bool &modified) {
+					qrRepo::RepoApi &repo = snapshot.repo();
+					if (logicalBlock.element() != "PrintText"
+							|| !repo.metaInformation("lastKitId").toString().contains("trik", Qt::CaseInsensitive)) {
+						return logicalBlock;
+					}
 
-				graphicalBlock = graphicalIds.first();
-			}
+					const Id newLogicalBlock = Id::createElementId(logicalBlock.editor(), logicalBlock.diagram()
+							, "TrikPrintText");
+					repo.addChild(repo.parent(logicalBlock), newLogicalBlock);
+					repo.copyProperties(newLogicalBlock, logicalBlock);
+					repo.setProperty(newLogicalBlock, "FontSize", 20);
+
+					for (const Id &graphicalBlock : snapshot.graphicalIds(logicalBlock)) {
+						const Id newGraphicalBlock = newLogicalBlock.sameTypeId();
+						repo.addChild(repo.parent(graphicalBlock), newGraphicalBlock, newLogicalBlock);
+						repo.copyProperties(newGraphicalBlock, graphicalBlock);
+						reconnectEdges(newGraphicalBlock, graphicalBlock, repo);
+						snapshot.registerGraphicalId(newLogicalBlock, newGraphicalBlock);
+					}
 
-			if (graphicalBlock.element() == "PrintText") {
-				const auto newType = Id(graphicalBlock.editor(), graphicalBlock.diagram(), "TrikPrintText");
-				const auto newGraphicalBlock = graphicalApi.createElement(graphicalApi.parent(graphicalBlock)
-						, newType.sameTypeId()
-						, false
-						, graphicalApi.name(graphicalBlock)
-						, graphicalApi.position(graphicalBlock)
-						, logicalApi.createElement(logicalApi.parent(logicalBlock), newType));
-				graphicalApi.copyProperties(newGraphicalBlock, graphicalBlock);
-				const auto newLogicalBlock = graphicalApi.logicalId(newGraphicalBlock);
-
-				auto iterator = logicalApi.logicalRepoApi().propertiesIterator(logicalBlock);
-				while (iterator.hasNext()) {
-					iterator.next();
-					logicalApi.mutableLogicalRepoApi().setProperty(newLogicalBlock, iterator.key(), iterator.value());
+					reconnectEdges(newLogicalBlock, logicalBlock, repo);
+					removeBlock(logicalBlock, snapshot);
+					modified = true;
+					return newLogicalBlock;
 				}
-
-				logicalApi.setPropertyByRoleName(newLogicalBlock, 20, "FontSize");
-				reconnectEdges(newGraphicalBlock, graphicalBlock, graphicalApi);
-				reconnectEdges(newLogicalBlock, logicalBlock, logicalApi);
-				graphicalApi.removeElement(graphicalBlock);
-				logicalApi.removeElement(logicalBlock);
-				modificationsMade = true;
 			}
-		}
-
-		return modificationsMade ? ProjectConverter::Success : ProjectConverter::NoModificationsMade;
-	});
+			);
 }
 
 bool SaveConvertionManager::isRobotsDiagram(const Id &element)
@@ -352,80 +337,61 @@ bool SaveConvertionManager::isEdgeType(const Id &element)
 	return element.element() == "ControlFlow";
 }
 
-IdList SaveConvertionManager::elementsOfRobotsDiagrams(const LogicalModelAssistInterface &logicalApi)
-{
-	IdList nodes;
-	IdList edges;
-	for (const Id &blockId : logicalApi.children(Id::rootId())) {
-		if (isRobotsDiagram(blockId)) {
-			if (isEdgeType(blockId)) {
-				edges += blockId;
-			} else {
-				nodes += blockId;
-			}
-		}
-	}
-
-	// When we traverse elements it is important to traverse first nodes and then edges.
-	return nodes + edges;
-}
-
 qReal::ProjectConverter SaveConvertionManager::constructConverter(const QString &oldVersion
 		, const QString &newVersion
-		, const QList<LogicalFilter> &logicalFilters
-			, const QList<GraphicalFilter> &graphicalFilters
+		, const QList<Filter> &logicalFilters
+		, const QList<Filter> &graphicalFilters
 		, const std::function<bool(const qReal::Id &)> &condition
 		)
 {
 	return ProjectConverter(editor(), Version::fromString(oldVersion), Version::fromString(newVersion)
-			, [=](GraphicalModelAssistInterface &graphicalApi, LogicalModelAssistInterface &logicalApi)
+			, ProjectConverter::ProjectRewriter()
+			, [=](const Id &block, RepoSnapshot &snapshot, bool &modified)
 	{
-		bool modificationsMade = false;
-
-		for (const Id &block : elementsOfRobotsDiagrams(logicalApi)) {
-			const Id logicalBlock = graphicalApi.isGraphicalId(block)
-					? graphicalApi.logicalId(block)
-					: block;
-
-			if (!condition(logicalBlock)) {
-				continue;
-			}
-
-			for (const auto &filter : logicalFilters) {
-				modificationsMade |= filter(logicalBlock, logicalApi);
-			}
+		if (!isRobotsDiagram(block) || !condition(block)) {
+			return block;
+		}
 
-			if (graphicalFilters.isEmpty()) {
-				// A small optimization not to count graphical id.
-				continue;
+		Id logicalBlock = block;
+		for (const auto &filter : logicalFilters) {
+			logicalBlock = filter(logicalBlock, snapshot, modified);
+			if (logicalBlock.isNull()) {
+				return logicalBlock;
 			}
+		}
 
-			Id graphicalBlock;
-			if (graphicalApi.isGraphicalId(block)) {
-				graphicalBlock = block;
-			} else {
-				const IdList graphicalIds = graphicalApi.graphicalIdsByLogicalId(logicalBlock);
-				if (graphicalIds.isEmpty()) {
-					continue;
-				}
+		if (graphicalFilters.isEmpty()) {
+			// A small optimization not to count graphical id.
+			return logicalBlock;
+		}
 
-				graphicalBlock = graphicalIds.first();
+		Id graphicalBlock = snapshot.firstGraphicalId(logicalBlock);
+		for (const auto &filter : graphicalFilters) {
+			if (graphicalBlock.isNull()) {
+				break;
 			}
 
-			for (const auto &filter : graphicalFilters) {
-				modificationsMade |= filter(graphicalBlock, graphicalApi);
-			}
+			graphicalBlock = filter(graphicalBlock, snapshot, modified);
 		}
 
-		return modificationsMade ? ProjectConverter::Success : ProjectConverter::NoModificationsMade;
+		return logicalBlock;
 	});
 }
 
-SaveConvertionManager::LogicalFilter SaveConvertionManager::replace(const QMap<QString, QString> &replacementRules)
+qReal::ProjectConverter SaveConvertionManager::constructProjectConverter(const QString &oldVersion
+		, const QString &newVersion
+		, const ProjectConverter::ProjectRewriter &rewriter)
+{
+	return ProjectConverter(editor(), Version::fromString(oldVersion), Version::fromString(newVersion)
+			, rewriter, ProjectConverter::ElementRewriter());
+}
+
+SaveConvertionManager::Filter SaveConvertionManager::replace(const QMap<QString, QString> &replacementRules)
 {
-	return [=] (const Id &block, LogicalModelAssistInterface &logicalApi) {
-		bool modificationsMade = false;
-		auto iterator = logicalApi.logicalRepoApi().propertiesIterator(block);
+	return [=] (const Id &block, RepoSnapshot &snapshot, bool &modified) {
+		qrRepo::RepoApi &repo = snapshot.repo();
+		QMap<QString, QString> replacedProperties;
+		auto iterator = repo.propertiesIterator(block);
 		while (iterator.hasNext()) {
 			iterator.next();
 			const auto name = iterator.key();
@@ -434,79 +400,85 @@ SaveConvertionManager::LogicalFilter SaveConvertionManager::replace(const QMap<Q
 			for (const auto &toReplace : replacementRules.keys()) {
 				if (value.contains(toReplace)) {
 					replacementOccured = true;
-					modificationsMade = true;
-
 					value.replace(toReplace, replacementRules[toReplace]);
 				}
 			}
 
 			if (replacementOccured) {
-				logicalApi.setPropertyByRoleName(block, value, name);
+				replacedProperties[name] = value;
 			}
 		}
 
-		 return modificationsMade;
+		for (auto it = replacedProperties.cbegin(); it != replacedProperties.cend(); ++it) {
+			repo.setProperty(block, it.key(), it.value());
+			modified = true;
+		}
+
+		return block;
 	};
 }
 
-SaveConvertionManager::LogicalFilter SaveConvertionManager::deleteBlocks(const QStringList &blocks)
+SaveConvertionManager::Filter SaveConvertionManager::deleteBlocks(const QStringList &blocks)
 {
-	return [=] (const Id &block, LogicalModelAssistInterface &logicalApi) {
+	return [=] (const Id &block, RepoSnapshot &snapshot, bool &modified) {
 		if (blocks.contains(block.element())) {
-			logicalApi.removeElement(block);
-			return true;
+			removeBlock(block, snapshot);
+			modified = true;
+			return Id();
 		}
 
-		return false;
+		return block;
 	};
 }
 
-SaveConvertionManager::LogicalFilter SaveConvertionManager::quote(const QString &blockType, const QString &property)
+SaveConvertionManager::Filter SaveConvertionManager::quote(const QString &blockType, const QString &property)
 {
-	return [blockType, property] (const qReal::Id &block, qReal::LogicalModelAssistInterface &logicalApi) {
+	return [blockType, property] (const qReal::Id &block, RepoSnapshot &snapshot, bool &modified) {
 		if (block.element() == blockType) {
-			const QString oldValue = logicalApi.logicalRepoApi().property(block, property).toString();
+			const QString oldValue = snapshot.repo().property(block, property).toString();
 			if (!oldValue.startsWith("\"")) {
-				logicalApi.mutableLogicalRepoApi().setProperty(block, property, "\"" + oldValue + "\"");
-				return true;
+				snapshot.repo().setProperty(block, property, "\"" + oldValue + "\"");
+				modified = true;
 			}
 		}
 
-		return false;
+		return block;
 	};
 }
 
-SaveConvertionManager::GraphicalFilter SaveConvertionManager::graphicalRecreate(
+SaveConvertionManager::Filter SaveConvertionManager::graphicalRecreate(
 		const SaveConvertionManager::GraphicalReplacer &replacer
 		, const SaveConvertionManager::GraphicalConstructor &constructor)
 {
-	return [replacer, constructor](const Id &block, GraphicalModelAssistInterface &graphicalApi) {
+	return [replacer, constructor](const Id &block, RepoSnapshot &snapshot, bool &modified) {
 		// Just iterating throught the elements on some diagram, ignoring the diagram itself.
 		if (isDiagramType(block)) {
-			return false;
+			return block;
 		}
 
 		// For each element trying to find out what to replace it with.
-		const Id newType = replacer(block, graphicalApi);
+		const Id newType = replacer(block, snapshot);
 		if (newType.isNull()) {
 			// Not every element be replaced, concrete implementation must decide it.
-			return false;
+			return block;
 		}
 
 		// Then creating new element of some type...
+		qrRepo::RepoApi &repo = snapshot.repo();
+		const Id parent = repo.parent(block);
+		const Id logicalBlock = repo.logicalId(block);
 		const Id newBlock = Id::createElementId(newType.editor(), newType.diagram(), newType.element());
-		graphicalApi.createElement(graphicalApi.parent(block)
-				, newBlock
-				, false
-				, graphicalApi.name(block)
-				, graphicalApi.position(block)
-				, graphicalApi.logicalId(block));
+		repo.addChild(parent, newBlock, logicalBlock);
 		// And initializing it...
-		constructor(newBlock, block, graphicalApi);
+		constructor(newBlock, block, snapshot);
 
-		reconnectEdges(newBlock, block, graphicalApi);
+		reconnectEdges(newBlock, block, repo);
 		// And finally disposing of outdated entity.
-		graphicalApi.removeElement(block);
-		return true;
+		repo.removeChild(parent, block);
+		repo.removeElement(block);
+		snapshot.unregisterGraphicalId(logicalBlock, block);
+		snapshot.registerGraphicalId(logicalBlock, newBlock);
+		modified = true;
+		return newBlock;
 	};
 }
@@ -46,6 +46,9 @@ public:
 	bool isRunning() const;
 	void setRunning(bool running);
 	void setCurrentDir(const QString &dir, const QString &languageExtension);
+
+	/// Sets images returned by the simulated camera when they are taken from the project.
+	void setCameraImitationFrames(const QList<QSharedPointer<const utils::Blob>> &frames);
 	QStringList supportedRobotModelNames() const;
 	QStringList knownMethodNames() const;
 
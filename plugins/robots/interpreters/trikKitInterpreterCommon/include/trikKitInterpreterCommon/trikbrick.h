@@ -15,6 +15,7 @@
 #pragma once
 
 #include <QtCore/QHash>
+#include <QtCore/QMutex>
 #include <QtCore/QScopedPointer>
 #include <QtCore/QSharedPointer>
 #include <QtCore/QDir>
@@ -36,6 +37,7 @@
 
 namespace utils {
 class AbstractTimer;
+class Blob;
 }
 
 namespace trikControl {
@@ -65,6 +67,10 @@ public:
 
 	void reinitImitationCamera();
 
+	/// Sets encoded images returned by the simulated camera one by one when images are taken from the project.
+	/// May be called while a program is running.
+	void setCameraImitationFrames(const QList<QSharedPointer<const utils::Blob>> &frames);
+
 	QDir getCurrentDir() const;
 
 public slots:
@@ -113,6 +119,9 @@ signals:
 private:
 	void printToShell(const QString &msg);
 
+	/// Returns the next project camera frame converted to the format of TRIK camera photo.
+	QVector<uint8_t> nextCameraImitationFrame();
+
 	QSharedPointer<robotModel::twoD::TrikTwoDRobotModel> mTwoDRobotModel;
 
 	TrikDisplayEmu mDisplay;
@@ -132,6 +141,11 @@ private:
 
 	QScopedPointer<trikControl::CameraImplementationInterface> mImitationCamera;
 
+	/// Guards project camera frames, they are read from script threads.
+	QMutex mCameraFramesMutex;
+	QList<QSharedPointer<const utils::Blob>> mCameraFrames;
+	int mNextCameraFrame = 0;
+
 	QDir mCurrentDir;
 	bool mIsExcerciseMode = false;
 	QStringList mInputs;
@@ -25,6 +25,7 @@
 #include <qrkernel/settingsManager.h>
 #include <qrkernel/settingsListener.h>
 #include <qrkernel/platformInfo.h>
+#include <qrutils/blobStore.h>
 
 #include <qrgui/textEditor/qscintillaTextEdit.h>
 #include <qrgui/textEditor/languageInfo.h>
@@ -154,41 +155,27 @@ void TrikKitInterpreterPluginBase::startCodeInterpretation(const QString &code
 void TrikKitInterpreterPluginBase::handleImitationCameraWork()
 {
 	auto prepareImagesFromProject = [this](const QString&) {
-		if (mCurrentlySelectedModelName.contains("trik", Qt::CaseInsensitive)
-				&& qReal::SettingsManager::value("TrikSimulatedCameraImagesFromProject").toBool()
+		// Frames stay encoded in memory, identical pictures of different projects are stored once.
+		// Nothing is written to disk, so frames are prepared regardless of currently selected robot model.
+		QList<QSharedPointer<const utils::Blob>> frames;
+		if (qReal::SettingsManager::value("TrikSimulatedCameraImagesFromProject").toBool()
 				&& mProjectManager->somethingOpened()) {
 			QVariant rawData = mLogicalModel->logicalRepoApi().metaInformation("cameraImitationImages");
 
 			if (not rawData.isNull()) {
-				const QString path = qReal::PlatformInfo::invariantSettingsPath("trikCameraImitationImagesDir");
-				QDir dir(path);
-				const QString curPath = QDir::currentPath();
-				if (dir.exists()) {
-					dir.cd(path);
-					dir.removeRecursively();
-				}
-
-				dir.mkpath(path);
-				dir.cd(path);
-
+				const auto blobStore = utils::BlobStore::instance();
 				QDomDocument images;
 				images.setContent(rawData.toString());
 				for (QDomElement element = images.firstChildElement("images").firstChildElement("image")
 						; !element.isNull()
 						; element = element.nextSiblingElement("image"))
 				{
-					const QString fileName = element.attribute("name");
-					QByteArray content = QByteArray::fromBase64(element.text().toLatin1());
-					QFile file(dir.filePath(fileName));
-					if (file.open(QIODevice::WriteOnly)) {
-						file.write(content);
-						file.close();
-					}
+					frames << blobStore->put(QByteArray::fromBase64(element.text().toLatin1()));
 				}
-
-				dir.cd(curPath);
 			}
 		}
+
+		mTextualInterpreter->setCameraImitationFrames(frames);
 	};
 
 
@@ -196,7 +183,8 @@ void TrikKitInterpreterPluginBase::handleImitationCameraWork()
 	qReal::SettingsListener::listen("TrikSimulatedCameraImagesFromProject", prepareImagesFromProject, this);
 	qReal::SettingsListener::listen("TrikSimulatedCameraImagesPath", prepareImagesFromProject, this);
 
-	connect(mAdditionalPreferences, &TrikAdditionalPreferences::packImagesToProjectClicked, this, [this]() {
+	connect(mAdditionalPreferences, &TrikAdditionalPreferences::packImagesToProjectClicked, this
+			, [this, prepareImagesFromProject]() {
 		// in case if user works with images and want to pack them into qrs
 		// we are saving images to metadata using logicalRepoApi
 		if (mCurrentlySelectedModelName.contains("trik", Qt::CaseInsensitive)
@@ -227,6 +215,7 @@ void TrikKitInterpreterPluginBase::handleImitationCameraWork()
 				mLogicalModel->mutableLogicalRepoApi().setMetaInformation("cameraImitationImages"
 						, imagesDomDoc.toString());
 				mProjectManager->setUnsavedIndicator(true);
+				prepareImagesFromProject(QString());
 			}
 		}
 	});
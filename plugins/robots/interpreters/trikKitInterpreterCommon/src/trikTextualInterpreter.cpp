@@ -202,6 +202,11 @@ void trik::TrikTextualInterpreter::setCurrentDir(const QString &dir, const QStri
 	mScriptRunner.setWorkingDirectory(trikKernel::FileUtils::normalizePath(dir));
 }
 
+void trik::TrikTextualInterpreter::setCameraImitationFrames(const QList<QSharedPointer<const utils::Blob>> &frames)
+{
+	mBrick.setCameraImitationFrames(frames);
+}
+
 QStringList trik::TrikTextualInterpreter::supportedRobotModelNames() const
 {
 	return {"TwoDRobotModelForTrikV62RealRobotModel", "TwoDRobotModelForTrikV6RealRobotModel"};
@@ -17,6 +17,8 @@
 
 #include <QtCore/QThread>
 
+#include <cstring>
+
 #include <trikKitInterpreterCommon/trikbrick.h>
 
 #include <utils/abstractTimer.h>
@@ -28,9 +30,10 @@
 #include <kitBase/robotModel/robotParts/random.h>
 #include <twoDModel/robotModel/parts/marker.h>
 #include <twoDModel/engine/model/timeline.h>
-#include <qrkernel/settingsManager.h>
+#include <qrkernel/settingsKey.h>
 #include <qrkernel/settingsListener.h>
 #include <qrkernel/platformInfo.h>
+#include <qrutils/blobStore.h>
 #include <src/qtCameraImplementation.h>
 #include <src/imitationCameraImplementation.h>
 #include <QApplication>
@@ -41,6 +44,17 @@
 
 using namespace trik;
 
+namespace {
+// Camera settings are read from script threads.
+const qReal::SettingsKey<bool> webCameraRealKey("TrikWebCameraReal");
+const qReal::SettingsKey<QString> webCameraRealNameKey("TrikWebCameraRealName");
+const qReal::SettingsKey<bool> imagesFromProjectKey("TrikSimulatedCameraImagesFromProject");
+const qReal::SettingsKey<QString> imagesPathKey("TrikSimulatedCameraImagesPath");
+
+// Photos of TRIK camera are RGB888 pixels of this size.
+const QSize photoSize(320, 240);
+}
+
 TrikBrick::TrikBrick(const QSharedPointer<robotModel::twoD::TrikTwoDRobotModel> &model)
 	: mTwoDRobotModel(model)
 	, mDisplay(model)
@@ -140,13 +154,52 @@ void TrikBrick::setCurrentInputs(const QString &f)
 
 void TrikBrick::reinitImitationCamera()
 {
-	if (not qReal::SettingsManager::value("TrikSimulatedCameraImagesFromProject").toBool()) {
-		const QString path = qReal::SettingsManager::value("TrikSimulatedCameraImagesPath").toString();
+	if (not imagesFromProjectKey.value()) {
+		const QString path = imagesPathKey.value();
 		mImitationCamera.reset(new trikControl::ImitationCameraImplementation({"*.jpg","*.png"}, path));
 	} else {
-		const QString path = qReal::PlatformInfo::invariantSettingsPath("trikCameraImitationImagesDir");
-		mImitationCamera.reset(new trikControl::ImitationCameraImplementation({"*.jpg","*.png"}, path));
+		// Project images are served from memory, see setCameraImitationFrames().
+		mImitationCamera.reset();
+		QMutexLocker lock(&mCameraFramesMutex);
+		mNextCameraFrame = 0;
+	}
+}
+
+void TrikBrick::setCameraImitationFrames(const QList<QSharedPointer<const utils::Blob>> &frames)
+{
+	QMutexLocker lock(&mCameraFramesMutex);
+	mCameraFrames = frames;
+	mNextCameraFrame = 0;
+}
+
+QVector<uint8_t> TrikBrick::nextCameraImitationFrame()
+{
+	QSharedPointer<const utils::Blob> frame;
+	{
+		QMutexLocker lock(&mCameraFramesMutex);
+		if (mCameraFrames.isEmpty()) {
+			return {};
+		}
+
+		frame = mCameraFrames[mNextCameraFrame % mCameraFrames.size()];
+		mNextCameraFrame = (mNextCameraFrame + 1) % mCameraFrames.size();
+	}
+
+	const QImage image = frame->image(photoSize)
+			.scaled(photoSize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation)
+			.convertToFormat(QImage::Format_RGB888);
+	if (image.isNull()) {
+		return {};
 	}
+
+	const int lineSize = photoSize.width() * 3;
+	QVector<uint8_t> photo(lineSize * photoSize.height());
+	for (int y = 0; y < photoSize.height(); ++y) {
+		// Lines of QImage are padded to 4 bytes, photo is not.
+		memcpy(photo.data() + y * lineSize, image.constScanLine(y), static_cast<size_t>(lineSize));
+	}
+
+	return photo;
 }
 
 void TrikBrick::say(const QString &msg) {
@@ -355,10 +408,10 @@ trikControl::LedInterface *TrikBrick::led() {
 
 QVector<uint8_t> TrikBrick::getStillImage()
 {
-	const bool webCamera = qReal::SettingsManager::value("TrikWebCameraReal").toBool();
+	const bool webCamera = webCameraRealKey.value();
 
 	if (webCamera) {
-		const QString webCameraName = qReal::SettingsManager::value("TrikWebCameraRealName").toString();
+		const QString webCameraName = webCameraRealNameKey.value();
 		trikControl::QtCameraImplementation camera(webCameraName);
 		camera.setTempDir(qReal::PlatformInfo::invariantSettingsPath("pathToTempFolder"));
 
@@ -371,7 +424,7 @@ QVector<uint8_t> TrikBrick::getStillImage()
 
 		return photo;
 	} else {
-		QVector<uint8_t> photo = mImitationCamera->getPhoto();
+		QVector<uint8_t> photo = mImitationCamera ? mImitationCamera->getPhoto() : nextCameraImitationFrame();
 		if (photo.isEmpty()) {
 			error(tr("Cannot get a photo from folders/project (possibly because of wrong path/empty project)"));
 		}
@@ -163,7 +163,7 @@ const T &utils::CircularQueue<T>::nthFromTail(int n) const
 {
 	Q_ASSERT(size() >= n + 1);
 	Q_ASSERT(n < mBody.size());
-	return mBody[previous(mTail, n)];
+	return mBody[previous(mTail, n + 1)];
 }
 
 template<typename T>
@@ -0,0 +1,56 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QStringList>
+
+#include "utils/utilsDeclSpec.h"
+
+namespace utils {
+namespace deployment {
+
+class DeploymentTransport;
+
+/// Brings a target directory up to date with a local one transferring only changed files. Compares content hashes
+/// of local files with manifest reported by the target and sends files that are missing or differ as one
+/// compressed stream. Files that exist only on the target are left intact.
+class ROBOTS_UTILS_EXPORT Deployer
+{
+public:
+	/// @param transport - connection to the target, must outlive the deployer.
+	explicit Deployer(DeploymentTransport &transport);
+
+	/// Deploys contents of given directory. Blocks until done, so shall be called from a worker thread in GUI.
+	/// @returns false on error, see errorString().
+	bool deploy(const QString &directory);
+
+	/// Returns relative paths of files sent during the last deployment.
+	QStringList transferredFiles() const;
+
+	/// Returns size of compressed stream sent during the last deployment, 0 if nothing was changed.
+	qint64 transferredBytes() const;
+
+	/// Returns description of the last error.
+	QString errorString() const;
+
+private:
+	DeploymentTransport &mTransport;
+	QStringList mTransferredFiles;
+	qint64 mTransferredBytes = 0;
+	QString mErrorString;
+};
+
+}
+}
@@ -0,0 +1,42 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QStringList>
+
+#include "utils/utilsDeclSpec.h"
+
+namespace utils {
+namespace deployment {
+
+/// Packs files into a gzip-compressed tar stream and unpacks it back. The format is understood by "tar -xzf -"
+/// on a robot, so the whole set of changed files is sent as one stream through a single connection.
+/// Only regular files are stored, with their permissions; directories are created when unpacking.
+class ROBOTS_UTILS_EXPORT DeploymentArchive
+{
+public:
+	/// Packs given files from \a directory, paths are relative to it.
+	/// @returns compressed stream or empty array on error, description of the error is put into \a errorString.
+	static QByteArray pack(const QString &directory, const QStringList &files, QString &errorString);
+
+	/// Unpacks a stream produced by pack() into \a directory, overwriting existing files.
+	/// Entries with absolute paths or paths going outside of the directory are rejected.
+	/// @returns false on error, description of the error is put into \a errorString.
+	static bool unpack(const QByteArray &archive, const QString &directory, QString &errorString);
+};
+
+}
+}
@@ -0,0 +1,60 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QHash>
+#include <QtCore/QStringList>
+
+#include "utils/utilsDeclSpec.h"
+
+namespace utils {
+namespace deployment {
+
+/// Content hashes of files in a directory, used to find out which files differ between a local directory and
+/// its copy on a robot. Paths are relative to the directory and separated by '/', hashes are lowercase hex MD5
+/// digests, the same as printed by md5sum utility, so a manifest of a robot directory can be taken without any
+/// special software there.
+class ROBOTS_UTILS_EXPORT DeploymentManifest
+{
+public:
+	/// Computes hashes of all files in given directory and its subdirectories. Missing directory gives
+	/// an empty manifest. Files that can not be read get empty hash.
+	static DeploymentManifest scan(const QString &directory);
+
+	/// Parses output of "find . -type f -exec md5sum {} \;", lines that can not be parsed are skipped.
+	static DeploymentManifest fromMd5sumOutput(const QString &output);
+
+	/// Adds or replaces a hash of a file with given relative path.
+	void insert(const QString &path, const QByteArray &hash);
+
+	/// Returns a hash of a file or empty array if there is no such file in the manifest.
+	QByteArray hash(const QString &path) const;
+
+	/// Returns relative paths of all files in the manifest, sorted.
+	QStringList files() const;
+
+	/// Returns sorted relative paths of files from this manifest that are missing or different in \a target.
+	/// Files with empty hash are always considered changed.
+	QStringList changedFiles(const DeploymentManifest &target) const;
+
+	/// Returns a number of files in the manifest.
+	int size() const;
+
+private:
+	QHash<QString, QByteArray> mHashes;
+};
+
+}
+}
@@ -0,0 +1,47 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QString>
+
+#include "utils/utilsDeclSpec.h"
+
+namespace utils {
+namespace deployment {
+
+class DeploymentManifest;
+
+/// Connection to a place where files are deployed, for example a directory on a robot. Implementations are used
+/// from a worker thread and may block.
+class ROBOTS_UTILS_EXPORT DeploymentTransport
+{
+public:
+	virtual ~DeploymentTransport() = default;
+
+	/// Obtains hashes of files currently present in the target directory. Missing directory is not an error,
+	/// it just has empty manifest.
+	/// @returns false on error, see errorString().
+	virtual bool fetchManifest(DeploymentManifest &manifest) = 0;
+
+	/// Sends a gzip-compressed tar stream (see DeploymentArchive) to be unpacked into the target directory.
+	/// @returns false on error, see errorString().
+	virtual bool upload(const QByteArray &archive) = 0;
+
+	/// Returns description of the last error.
+	virtual QString errorString() const = 0;
+};
+
+}
+}
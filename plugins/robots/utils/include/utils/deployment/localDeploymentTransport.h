@@ -0,0 +1,47 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include "utils/deployment/deploymentTransport.h"
+
+namespace utils {
+namespace deployment {
+
+/// Deploys files into a local directory. Used in tests and may be used for deploying to a mounted robot filesystem.
+class ROBOTS_UTILS_EXPORT LocalDeploymentTransport : public DeploymentTransport
+{
+public:
+	/// @param directory - target directory, will be created if missing.
+	explicit LocalDeploymentTransport(const QString &directory);
+
+	bool fetchManifest(DeploymentManifest &manifest) override;
+	bool upload(const QByteArray &archive) override;
+	QString errorString() const override;
+
+	/// Returns total size of archives received by this transport.
+	qint64 receivedBytes() const;
+
+	/// Returns a number of archives received by this transport.
+	int uploadsCount() const;
+
+private:
+	const QString mDirectory;
+	QString mErrorString;
+	qint64 mReceivedBytes = 0;
+	int mUploadsCount = 0;
+};
+
+}
+}
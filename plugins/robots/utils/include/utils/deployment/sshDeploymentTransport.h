@@ -0,0 +1,48 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include "utils/deployment/deploymentTransport.h"
+
+namespace utils {
+namespace deployment {
+
+/// Deploys files to a robot with ssh, which is expected to be installed on this computer. Manifest of the target
+/// directory is taken with md5sum and files are unpacked with tar on the robot side, both are present on TRIK.
+class ROBOTS_UTILS_EXPORT SshDeploymentTransport : public DeploymentTransport
+{
+public:
+	/// Constructor.
+	/// @param host - ip address or host name of a robot, connection is made as root.
+	/// @param directory - absolute path of the target directory on a robot.
+	/// @param connectTimeout - ssh connection timeout in seconds.
+	SshDeploymentTransport(const QString &host, const QString &directory, int connectTimeout);
+
+	bool fetchManifest(DeploymentManifest &manifest) override;
+	bool upload(const QByteArray &archive) override;
+	QString errorString() const override;
+
+private:
+	/// Runs a command on a robot feeding it with \a input, returns false and sets error if it failed.
+	bool run(const QString &command, const QByteArray &input, QByteArray &output);
+
+	const QString mHost;
+	const QString mDirectory;
+	const int mConnectTimeout;
+	QString mErrorString;
+};
+
+}
+}
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <QtCore/QFutureWatcher>
 #include <QtCore/QProcess>
 #include <functional>
 
@@ -57,6 +58,11 @@ public:
 	/// Transfers ownership of QAction objects.
 	qReal::ActionInfo action() const;
 
+	/// Returns a command that transfers files from the uploaded directory to \a remoteDirectory on a robot,
+	/// sending only files that are missing or differ there (see utils::deployment::Deployer). Commands around it
+	/// are executed before and after the transfer. Works with ssh, so shall not be used with WinSCP commands.
+	static QString deployCommand(const QString &remoteDirectory);
+
 private slots:
 	void upload();
 	void onUploadStarted();
@@ -64,8 +70,17 @@ private slots:
 	void onUploadFinished(int exitCode);
 	void onUploadStdOut();
 	void onUploadStdErr();
+	void onDeploymentFinished();
 
 private:
+	/// Starts the next group of shell commands or the next deployment, reports success if nothing is left.
+	void runNextCommands();
+
+	/// Starts transferring changed files to the given directory on a robot in a worker thread.
+	void deploy(const QString &remoteDirectory);
+
+	void reportFailure();
+
 	bool checkUnixToolsExist();
 	bool checkUnixToolExist(const QString &name, const QStringList &args);
 
@@ -76,6 +91,12 @@ private:
 	std::function<QString()> mRobotIpGetter;
 	QProcess mProcess;
 	QString mPath;
+
+	/// Commands of the current upload that are not started yet, with all placeholders substituted.
+	QStringList mRemainingCommands;
+
+	/// Watches deployment running in a worker thread, its result is an error message or empty string.
+	QFutureWatcher<QString> mDeploymentWatcher;
 };
 
 }
@@ -0,0 +1,77 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "utils/deployment/deployer.h"
+
+#include <qrkernel/logging.h>
+
+#include "utils/deployment/deploymentArchive.h"
+#include "utils/deployment/deploymentManifest.h"
+#include "utils/deployment/deploymentTransport.h"
+
+using namespace utils::deployment;
+
+Deployer::Deployer(DeploymentTransport &transport)
+	: mTransport(transport)
+{
+}
+
+bool Deployer::deploy(const QString &directory)
+{
+	mTransferredFiles.clear();
+	mTransferredBytes = 0;
+	mErrorString.clear();
+
+	DeploymentManifest target;
+	if (!mTransport.fetchManifest(target)) {
+		mErrorString = mTransport.errorString();
+		return false;
+	}
+
+	const DeploymentManifest local = DeploymentManifest::scan(directory);
+	const QStringList changed = local.changedFiles(target);
+	QLOG_INFO() << "Deploying" << directory << ":" << changed.size() << "of" << local.size() << "files changed";
+	if (changed.isEmpty()) {
+		return true;
+	}
+
+	const QByteArray archive = DeploymentArchive::pack(directory, changed, mErrorString);
+	if (archive.isEmpty()) {
+		return false;
+	}
+
+	if (!mTransport.upload(archive)) {
+		mErrorString = mTransport.errorString();
+		return false;
+	}
+
+	mTransferredFiles = changed;
+	mTransferredBytes = archive.size();
+	return true;
+}
+
+QStringList Deployer::transferredFiles() const
+{
+	return mTransferredFiles;
+}
+
+qint64 Deployer::transferredBytes() const
+{
+	return mTransferredBytes;
+}
+
+QString Deployer::errorString() const
+{
+	return mErrorString;
+}
@@ -0,0 +1,259 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "utils/deployment/deploymentArchive.h"
+
+#include <cstring>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QObject>
+
+#include <zlib.h>
+
+using namespace utils::deployment;
+
+/// Tar archive consists of 512-byte blocks, header of each entry takes one block.
+static const int blockSize = 512;
+
+/// Offsets and sizes of used fields of POSIX ustar header.
+static const int nameOffset = 0;
+static const int nameSize = 100;
+static const int modeOffset = 100;
+static const int uidOffset = 108;
+static const int gidOffset = 116;
+static const int sizeOffset = 124;
+static const int mtimeOffset = 136;
+static const int checksumOffset = 148;
+static const int typeOffset = 156;
+static const int magicOffset = 257;
+static const int prefixOffset = 345;
+static const int prefixSize = 155;
+
+/// Window bits value that makes zlib produce and accept gzip wrapper instead of zlib one.
+static const int gzipWindowBits = 15 + 16;
+
+static void writeOctal(char *field, int size, qint64 value)
+{
+	const QByteArray digits = QByteArray::number(value, 8).rightJustified(size - 1, '0');
+	std::memcpy(field, digits.constData(), static_cast<size_t>(size - 1));
+	field[size - 1] = '\0';
+}
+
+static qint64 readOctal(const char *field, int size)
+{
+	qint64 result = 0;
+	for (int i = 0; i < size && field[i] >= '0' && field[i] <= '7'; ++i) {
+		result = result * 8 + (field[i] - '0');
+	}
+
+	return result;
+}
+
+static int headerChecksum(const char *header)
+{
+	int result = 0;
+	for (int i = 0; i < blockSize; ++i) {
+		// Checksum field itself is counted as filled with spaces.
+		const bool inChecksum = i >= checksumOffset && i < checksumOffset + 8;
+		result += inChecksum ? ' ' : static_cast<unsigned char>(header[i]);
+	}
+
+	return result;
+}
+
+/// Fills tar header of a regular file. Long paths are split into prefix and name at a slash.
+static bool writeHeader(char *header, const QByteArray &path, const QFileInfo &info)
+{
+	std::memset(header, 0, blockSize);
+	QByteArray name = path;
+	QByteArray prefix;
+	if (name.size() > nameSize) {
+		const int slash = path.lastIndexOf('/', prefixSize);
+		if (slash <= 0 || path.size() - slash - 1 > nameSize) {
+			return false;
+		}
+
+		prefix = path.left(slash);
+		name = path.mid(slash + 1);
+	}
+
+	std::memcpy(header + nameOffset, name.constData(), static_cast<size_t>(name.size()));
+	std::memcpy(header + prefixOffset, prefix.constData(), static_cast<size_t>(prefix.size()));
+
+	const QFile::Permissions permissions = info.permissions();
+	const int mode = (permissions & QFile::ExeOwner) || (permissions & QFile::ExeUser) ? 0755 : 0644;
+	writeOctal(header + modeOffset, 8, mode);
+	writeOctal(header + uidOffset, 8, 0);
+	writeOctal(header + gidOffset, 8, 0);
+	writeOctal(header + sizeOffset, 12, info.size());
+	writeOctal(header + mtimeOffset, 12, info.lastModified().toMSecsSinceEpoch() / 1000);
+	header[typeOffset] = '0';
+	std::memcpy(header + magicOffset, "ustar\0" "00", 8);
+	writeOctal(header + checksumOffset, 7, headerChecksum(header));
+	header[checksumOffset + 7] = ' ';
+	return true;
+}
+
+static QByteArray gzip(const QByteArray &data, QString &errorString)
+{
+	z_stream stream;
+	std::memset(&stream, 0, sizeof(stream));
+	if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, gzipWindowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+		errorString = QObject::tr("Can not initialize compression");
+		return QByteArray();
+	}
+
+	QByteArray result(static_cast<int>(deflateBound(&stream, static_cast<uLong>(data.size()))), Qt::Uninitialized);
+	stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data.constData()));
+	stream.avail_in = static_cast<uInt>(data.size());
+	stream.next_out = reinterpret_cast<Bytef *>(result.data());
+	stream.avail_out = static_cast<uInt>(result.size());
+	const int status = deflate(&stream, Z_FINISH);
+	result.resize(static_cast<int>(stream.total_out));
+	deflateEnd(&stream);
+	if (status != Z_STREAM_END) {
+		errorString = QObject::tr("Compression failed");
+		return QByteArray();
+	}
+
+	return result;
+}
+
+static QByteArray gunzip(const QByteArray &data, QString &errorString)
+{
+	z_stream stream;
+	std::memset(&stream, 0, sizeof(stream));
+	if (inflateInit2(&stream, gzipWindowBits) != Z_OK) {
+		errorString = QObject::tr("Can not initialize decompression");
+		return QByteArray();
+	}
+
+	QByteArray result;
+	char buffer[64 * 1024];
+	stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data.constData()));
+	stream.avail_in = static_cast<uInt>(data.size());
+	int status = Z_OK;
+	while (status == Z_OK) {
+		stream.next_out = reinterpret_cast<Bytef *>(buffer);
+		stream.avail_out = sizeof(buffer);
+		status = inflate(&stream, Z_NO_FLUSH);
+		result.append(buffer, static_cast<int>(sizeof(buffer) - stream.avail_out));
+	}
+
+	inflateEnd(&stream);
+	if (status != Z_STREAM_END) {
+		errorString = QObject::tr("Archive is corrupted");
+		return QByteArray();
+	}
+
+	return result;
+}
+
+QByteArray DeploymentArchive::pack(const QString &directory, const QStringList &files, QString &errorString)
+{
+	const QDir root(directory);
+	QByteArray tar;
+	for (const QString &file : files) {
+		QFile input(root.filePath(file));
+		if (!input.open(QIODevice::ReadOnly)) {
+			errorString = QObject::tr("Can not read %1: %2").arg(input.fileName(), input.errorString());
+			return QByteArray();
+		}
+
+		const QByteArray contents = input.readAll();
+		const int headerPosition = tar.size();
+		tar.resize(headerPosition + blockSize);
+		if (!writeHeader(tar.data() + headerPosition, file.toUtf8(), QFileInfo(input))) {
+			errorString = QObject::tr("Path is too long to be stored in archive: %1").arg(file);
+			return QByteArray();
+		}
+
+		tar.append(contents);
+		const int padding = (blockSize - contents.size() % blockSize) % blockSize;
+		tar.append(QByteArray(padding, '\0'));
+	}
+
+	// End of archive is marked by two empty blocks.
+	tar.append(QByteArray(2 * blockSize, '\0'));
+	return gzip(tar, errorString);
+}
+
+bool DeploymentArchive::unpack(const QByteArray &archive, const QString &directory, QString &errorString)
+{
+	const QByteArray tar = gunzip(archive, errorString);
+	if (tar.isEmpty()) {
+		return false;
+	}
+
+	const QDir root(directory);
+	int position = 0;
+	while (position + blockSize <= tar.size()) {
+		const char * const header = tar.constData() + position;
+		if (header[0] == '\0') {
+			return true;
+		}
+
+		if (readOctal(header + checksumOffset, 8) != headerChecksum(header)) {
+			errorString = QObject::tr("Archive is corrupted");
+			return false;
+		}
+
+		const QByteArray name(header + nameOffset, static_cast<int>(qstrnlen(header + nameOffset, nameSize)));
+		const QByteArray prefix(header + prefixOffset, static_cast<int>(qstrnlen(header + prefixOffset, prefixSize)));
+		const QString path = QString::fromUtf8(prefix.isEmpty() ? name : prefix + "/" + name);
+		const qint64 size = readOctal(header + sizeOffset, 12);
+		const int dataPosition = position + blockSize;
+		if (size > tar.size() - dataPosition) {
+			errorString = QObject::tr("Archive is truncated");
+			return false;
+		}
+
+		const QString cleanPath = QDir::cleanPath(path);
+		if (QDir::isAbsolutePath(cleanPath) || cleanPath == ".." || cleanPath.startsWith("../")) {
+			errorString = QObject::tr("Archive entry is outside of target directory: %1").arg(path);
+			return false;
+		}
+
+		const char type = header[typeOffset];
+		if (type == '5') {
+			root.mkpath(cleanPath);
+		} else if (type == '0' || type == '\0') {
+			const QString target = root.filePath(cleanPath);
+			QDir().mkpath(QFileInfo(target).absolutePath());
+			QFile output(target);
+			if (!output.open(QIODevice::WriteOnly | QIODevice::Truncate)
+					|| output.write(tar.constData() + dataPosition, size) != size)
+			{
+				errorString = QObject::tr("Can not write %1: %2").arg(target, output.errorString());
+				return false;
+			}
+
+			const int mode = static_cast<int>(readOctal(header + modeOffset, 8));
+			QFile::Permissions permissions = QFile::ReadOwner | QFile::WriteOwner | QFile::ReadUser | QFile::WriteUser
+					| QFile::ReadGroup | QFile::ReadOther;
+			if (mode & 0100) {
+				permissions |= QFile::ExeOwner | QFile::ExeUser | QFile::ExeGroup | QFile::ExeOther;
+			}
+
+			output.setPermissions(permissions);
+		}
+
+		position = dataPosition + static_cast<int>((size + blockSize - 1) / blockSize * blockSize);
+	}
+
+	return true;
+}
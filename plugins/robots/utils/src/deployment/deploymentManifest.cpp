@@ -0,0 +1,103 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "utils/deployment/deploymentManifest.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDir>
+#include <QtCore/QDirIterator>
+#include <QtCore/QFile>
+
+#include <qrkernel/logging.h>
+
+using namespace utils::deployment;
+
+DeploymentManifest DeploymentManifest::scan(const QString &directory)
+{
+	DeploymentManifest result;
+	const QDir root(directory);
+	QDirIterator iterator(directory, QDir::Files | QDir::Hidden | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+	while (iterator.hasNext()) {
+		const QString path = iterator.next();
+		QFile file(path);
+		if (!file.open(QIODevice::ReadOnly)) {
+			// Not fatal, the file is recorded with empty hash, so it is considered changed and its packing
+			// will report the problem.
+			QLOG_WARN() << "Can not read" << path << "to compute its hash:" << file.errorString();
+			result.insert(root.relativeFilePath(path), QByteArray());
+			continue;
+		}
+
+		QCryptographicHash hash(QCryptographicHash::Md5);
+		hash.addData(&file);
+		result.insert(root.relativeFilePath(path), hash.result().toHex());
+	}
+
+	return result;
+}
+
+DeploymentManifest DeploymentManifest::fromMd5sumOutput(const QString &output)
+{
+	DeploymentManifest result;
+	for (const QString &line : output.split('\n', QString::SkipEmptyParts)) {
+		// md5sum prints "<32 hex digits><space><space or '*'><file name>".
+		if (line.size() < 35 || line[32] != ' ') {
+			continue;
+		}
+
+		QString path = line.mid(34).trimmed();
+		if (path.startsWith("./")) {
+			path = path.mid(2);
+		}
+
+		result.insert(path, line.left(32).toLatin1().toLower());
+	}
+
+	return result;
+}
+
+void DeploymentManifest::insert(const QString &path, const QByteArray &hash)
+{
+	mHashes.insert(path, hash);
+}
+
+QByteArray DeploymentManifest::hash(const QString &path) const
+{
+	return mHashes.value(path);
+}
+
+QStringList DeploymentManifest::files() const
+{
+	QStringList result = mHashes.keys();
+	result.sort();
+	return result;
+}
+
+QStringList DeploymentManifest::changedFiles(const DeploymentManifest &target) const
+{
+	QStringList result;
+	for (auto file = mHashes.constBegin(); file != mHashes.constEnd(); ++file) {
+		if (file.value().isEmpty() || target.hash(file.key()) != file.value()) {
+			result << file.key();
+		}
+	}
+
+	result.sort();
+	return result;
+}
+
+int DeploymentManifest::size() const
+{
+	return mHashes.size();
+}
@@ -0,0 +1,53 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "utils/deployment/localDeploymentTransport.h"
+
+#include "utils/deployment/deploymentArchive.h"
+#include "utils/deployment/deploymentManifest.h"
+
+using namespace utils::deployment;
+
+LocalDeploymentTransport::LocalDeploymentTransport(const QString &directory)
+	: mDirectory(directory)
+{
+}
+
+bool LocalDeploymentTransport::fetchManifest(DeploymentManifest &manifest)
+{
+	manifest = DeploymentManifest::scan(mDirectory);
+	return true;
+}
+
+bool LocalDeploymentTransport::upload(const QByteArray &archive)
+{
+	mReceivedBytes += archive.size();
+	++mUploadsCount;
+	return DeploymentArchive::unpack(archive, mDirectory, mErrorString);
+}
+
+QString LocalDeploymentTransport::errorString() const
+{
+	return mErrorString;
+}
+
+qint64 LocalDeploymentTransport::receivedBytes() const
+{
+	return mReceivedBytes;
+}
+
+int LocalDeploymentTransport::uploadsCount() const
+{
+	return mUploadsCount;
+}
@@ -0,0 +1,95 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "utils/deployment/sshDeploymentTransport.h"
+
+#include <QtCore/QProcess>
+
+#include <qrkernel/logging.h>
+
+#include "utils/deployment/deploymentManifest.h"
+
+using namespace utils::deployment;
+
+/// Manifest command is expected to produce output quickly, but uploading may take minutes on slow Wi-Fi.
+static const int manifestTimeout = 60 * 1000;
+
+SshDeploymentTransport::SshDeploymentTransport(const QString &host, const QString &directory, int connectTimeout)
+	: mHost(host)
+	, mDirectory(directory)
+	, mConnectTimeout(connectTimeout)
+{
+}
+
+bool SshDeploymentTransport::fetchManifest(DeploymentManifest &manifest)
+{
+	// Busybox find may not support "-exec {} +", so md5sum is run per file.
+	const QString command = QString("mkdir -p '%1' && cd '%1' && find . -type f -exec md5sum {} \\;").arg(mDirectory);
+	QByteArray output;
+	if (!run(command, QByteArray(), output)) {
+		return false;
+	}
+
+	manifest = DeploymentManifest::fromMd5sumOutput(QString::fromUtf8(output));
+	return true;
+}
+
+bool SshDeploymentTransport::upload(const QByteArray &archive)
+{
+	QByteArray output;
+	return run(QString("mkdir -p '%1' && tar -xzf - -C '%1'").arg(mDirectory), archive, output);
+}
+
+QString SshDeploymentTransport::errorString() const
+{
+	return mErrorString;
+}
+
+bool SshDeploymentTransport::run(const QString &command, const QByteArray &input, QByteArray &output)
+{
+	const QStringList args = {
+		QString("-oConnectTimeout=%1s").arg(mConnectTimeout)
+		, "-oStrictHostKeyChecking=no"
+		, "-oUserKnownHostsFile=/dev/null"
+		, "root@" + mHost
+		, command
+	};
+
+	QLOG_INFO() << "Running ssh" << args << "with" << input.size() << "bytes of input";
+	QProcess ssh;
+	ssh.start("ssh", args);
+	if (!ssh.waitForStarted()) {
+		mErrorString = QObject::tr("Can not start ssh: %1").arg(ssh.errorString());
+		return false;
+	}
+
+	ssh.write(input);
+	ssh.closeWriteChannel();
+	if (!ssh.waitForFinished(input.isEmpty() ? manifestTimeout : -1)) {
+		ssh.kill();
+		ssh.waitForFinished();
+		mErrorString = QObject::tr("Robot does not respond");
+		return false;
+	}
+
+	output = ssh.readAllStandardOutput();
+	if (ssh.exitStatus() != QProcess::NormalExit || ssh.exitCode() != 0) {
+		const QByteArray errors = ssh.readAllStandardError();
+		QLOG_ERROR() << "ssh failed:" << errors;
+		mErrorString = QObject::tr("Command on robot failed: %1").arg(QString::fromUtf8(errors).trimmed());
+		return false;
+	}
+
+	return true;
+}
@@ -14,80 +14,88 @@
 
 #include "pointsQueueProcessor.h"
 
+#include <limits>
+
+#include <QtCore/QtMath>
+
 using namespace utils::sensorsGraph;
 
+/// Number of latest raw samples that are kept for export.
+const int maxSamples = 1 << 16;
+
+/// Distance in pixels between plot and top and bottom bounds of a view.
+const int verticalBounds = 10;
+
 PointsQueueProcessor::PointsQueueProcessor(const qreal viewPortHeight, const qreal leftLimit)
-	: mMinCurrent(0)
+	: mSamples(maxSamples)
+	, mMinCurrent(0)
 	, mMaxCurrent(1)
-	, mNextToDraw(QPointF(0, -80))
 {
 	setViewParams(viewPortHeight, leftLimit);
 }
 
-PointsQueueProcessor::~PointsQueueProcessor()
-{
-	mPointsQueue.clear();
-}
-
 void PointsQueueProcessor::addNewValue(const qreal newValue)
 {
-	const qreal oldMax = mMaxCurrent;
-	const qreal oldMin = mMinCurrent;
-	if (newValue > mMaxCurrent) {
-		mMaxCurrent = newValue;
-	}
+	mMaxCurrent = qMax(mMaxCurrent, newValue);
+	mMinCurrent = qMin(mMinCurrent, newValue);
 
-	if (newValue < mMinCurrent) {
-		mMinCurrent = newValue;
+	if (mSamples.size() == maxSamples) {
+		mSamples.dequeue();
 	}
 
-	if (oldMax != mMaxCurrent || oldMin != mMinCurrent) {
-		recalcPointsQueue(oldMin, oldMax, mGraphHeight);
+	mSamples.enqueue(newValue);
+	mLatestValue = newValue;
+	if (!mHasValue || mColumns.isEmpty()) {
+		mHasValue = true;
+		mColumns.enqueue({newValue, newValue, newValue, newValue});
+		return;
 	}
 
-	mNextToDraw.setY(absoluteValueToPoint(newValue));
-	filterLastValues();
-	mPointsQueue.append(QPointF(0, absoluteValueToPoint(newValue)));
+	Column &column = mColumns.tail();
+	column.min = qMin(column.min, newValue);
+	column.max = qMax(column.max, newValue);
+	column.last = newValue;
 }
 
-void PointsQueueProcessor::recalcPointsQueue(const qreal oldMin, const qreal oldMax, const qreal oldViewHeight)
+void PointsQueueProcessor::makeShiftLeft(const qreal step)
 {
-	qreal currentValue = 0;
-	for (int i = 0; i < mPointsQueue.size(); i++) {
-		currentValue = pointToAbsoluteValue(mPointsQueue[i].y(), oldMin, oldMax, oldViewHeight);
-		mPointsQueue[i].setY(absoluteValueToPoint(currentValue));
+	if (step != mStep) {
+		mStep = step;
+		resizeColumns();
 	}
-}
 
-void PointsQueueProcessor::filterLastValues()
-{
-	if (mPointsQueue.size() < 2) {
+	if (!mHasValue) {
 		return;
 	}
 
-	const qreal filterPixelDiff = 2;
-	if (qAbs(mPointsQueue.at(mPointsQueue.size() - 2).y() - mPointsQueue.last().y()) < filterPixelDiff) {
-		mPointsQueue.removeLast();
+	while (mColumns.size() >= visibleColumnsCount()) {
+		mColumns.dequeue();
 	}
+
+	mColumns.enqueue({mLatestValue, mLatestValue, mLatestValue, mLatestValue});
 }
 
-void PointsQueueProcessor::makeShiftLeft(const qreal step)
+int PointsQueueProcessor::visibleColumnsCount() const
 {
-	mPointsQueue.append(latestPosition());
-	for (int i = 0; i < mPointsQueue.size(); i++) {
-		mPointsQueue[i].setX(mPointsQueue[i].x() - step);
-		if (mPointsQueue[i].x() < mLeftLimit) {
-			mPointsQueue.removeAt(i--);
-		}
+	return qMax(1, qFloor(-mLeftLimit / mStep) + 1);
+}
+
+void PointsQueueProcessor::resizeColumns()
+{
+	const int count = visibleColumnsCount();
+	CircularQueue<Column> columns(count);
+	for (int i = qMax(0, mColumns.size() - count); i < mColumns.size(); ++i) {
+		columns.enqueue(mColumns.nthFromHead(i));
 	}
+
+	mColumns = columns;
 }
 
 qreal PointsQueueProcessor::absoluteValueToPoint(const qreal value) const
 {
-	const int verticalBounds = 10;
 	const int invertCoordSys = -1;
 	if (qFuzzyCompare(mMaxCurrent, mMinCurrent)) {
-		return mNextToDraw.y();
+		return (mGraphHeight / 2 + verticalBounds) * invertCoordSys;
 	}
 
 	return ((value - mMinCurrent) / (mMaxCurrent - mMinCurrent) * mGraphHeight + verticalBounds) * invertCoordSys;
@@ -95,92 +103,95 @@ qreal PointsQueueProcessor::absoluteValueToPoint(const qreal value) const
 
 qreal PointsQueueProcessor::pointToAbsoluteValue(const qreal yValue) const
 {
-	return pointToAbsoluteValue(yValue, mMinCurrent, mMaxCurrent, mGraphHeight);
-}
-
-qreal PointsQueueProcessor::pointToAbsoluteValue(const qreal yValue, const qreal minValue
-		, const qreal maxValue, const qreal graphHeight) const
-{
-	return (((maxValue - minValue) * (-yValue - 10)) / graphHeight) + minValue;
+	return (((mMaxCurrent - mMinCurrent) * (-yValue - verticalBounds)) / mGraphHeight) + mMinCurrent;
 }
 
 void PointsQueueProcessor::clearData()
 {
 	mMinCurrent = 0;
 	mMaxCurrent = 1;
-	mPointsQueue.clear();
+	mHasValue = false;
+	mLatestValue = 0;
+	mSamples.clear();
+	mColumns.clear();
 }
 
 QPointF PointsQueueProcessor::latestPosition() const
 {
-	return mNextToDraw;
+	return QPointF(0, absoluteValueToPoint(mLatestValue));
 }
 
 qreal PointsQueueProcessor::latestValue() const
 {
-	return pointToAbsoluteValue(mNextToDraw.y(), mMinCurrent, mMaxCurrent, mGraphHeight);
+	return mLatestValue;
 }
 
-const QList<QPointF> &PointsQueueProcessor::pointsBase() const
+QPolygonF PointsQueueProcessor::visiblePolyline() const
 {
-	return mPointsQueue;
+	QPolygonF result;
+	result.reserve(4 * mColumns.size());
+	const auto append = [&result](const QPointF &point) {
+		if (result.isEmpty() || result.last() != point) {
+			result << point;
+		}
+	};
+
+	for (int i = 0; i < mColumns.size(); ++i) {
+		const Column &column = mColumns.nthFromHead(i);
+		const qreal x = -(mColumns.size() - 1 - i) * mStep;
+		append(QPointF(x, absoluteValueToPoint(column.first)));
+		append(QPointF(x, absoluteValueToPoint(column.min)));
+		append(QPointF(x, absoluteValueToPoint(column.max)));
+		append(QPointF(x, absoluteValueToPoint(column.last)));
+	}
+
+	return result;
 }
 
-void PointsQueueProcessor::checkPeaks()
+QVector<qreal> PointsQueueProcessor::samples() const
 {
-	const qreal oldMin = mMinCurrent;
-	const qreal oldMax = mMaxCurrent;
+	QVector<qreal> result;
+	result.reserve(mSamples.size());
+	for (int i = 0; i < mSamples.size(); ++i) {
+		result << mSamples.nthFromHead(i);
+	}
 
-	mMaxCurrent = std::numeric_limits<qreal>::min();
-	mMinCurrent = std::numeric_limits<qreal>::max();
+	return result;
+}
 
-	for (int i = 0; i < mPointsQueue.size(); i++) {
-		if (pointToAbsoluteValue(mPointsQueue[i].y(), oldMin, oldMax, mGraphHeight) > mMaxCurrent) {
-			mMaxCurrent = pointToAbsoluteValue(mPointsQueue[i].y(), oldMin, oldMax, mGraphHeight);
-		}
-		if (pointToAbsoluteValue(mPointsQueue[i].y(), oldMin, oldMax, mGraphHeight) < mMinCurrent) {
-			mMinCurrent = pointToAbsoluteValue(mPointsQueue[i].y(), oldMin, oldMax, mGraphHeight);
-		}
+void PointsQueueProcessor::checkPeaks()
+{
+	if (mColumns.isEmpty()) {
+		return;
 	}
 
-	recalcPointsQueue(oldMin, oldMax, mGraphHeight);
+	mMaxCurrent = std::numeric_limits<qreal>::lowest();
+	mMinCurrent = std::numeric_limits<qreal>::max();
+	for (int i = 0; i < mColumns.size(); ++i) {
+		mMaxCurrent = qMax(mMaxCurrent, mColumns.nthFromHead(i).max);
+		mMinCurrent = qMin(mMinCurrent, mColumns.nthFromHead(i).min);
+	}
 }
 
 QPointF PointsQueueProcessor::pointOfVerticalIntersection(const QPointF &position) const
 {
-	if (mPointsQueue.isEmpty())
+	if (mColumns.isEmpty()) {
 		return QPointF(0, 0);
-	const qreal accuracyCoefficient = 2; // accuracy = diameter * accCoefficient
-	const qreal diameter = (mPointsQueue.last().x() - mPointsQueue.first().x()) / mPointsQueue.size();
-
-	QPointF result;
-	int leftBound = 0;
-	int rightBound = mPointsQueue.size() - 1;
-	while (leftBound < rightBound) {
-		int middleIndex = (rightBound + leftBound) / 2;
-		result = mPointsQueue.at(middleIndex);
-		if (qAbs(result.x() - position.x()) < diameter * accuracyCoefficient) {
-			break;
-		}
-
-		if (position.x() < result.x()) {
-			rightBound = middleIndex - 1;
-		}
-
-		if (position.x() > result.x()) {
-			leftBound = middleIndex + 1;
-		}
 	}
 
-	return result;
+	// Columns are placed with constant step, so the column under the given point is found directly.
+	const int columnsFromTail = qBound(0, qRound(-position.x() / mStep), mColumns.size() - 1);
+	const Column &column = mColumns.nthFromHead(mColumns.size() - 1 - columnsFromTail);
+	return QPointF(-columnsFromTail * mStep, absoluteValueToPoint(column.last));
 }
 
 void PointsQueueProcessor::setViewParams(const qreal viewPortHeight, const qreal leftLimit)
 {
-	const qreal oldViewHeight = mGraphHeight;
 	mGraphHeight = viewPortHeight;
-	recalcPointsQueue(mMinCurrent, mMaxCurrent, oldViewHeight);
-	mLeftLimit = leftLimit;
+	if (leftLimit != mLeftLimit) {
+		mLeftLimit = leftLimit;
+		resizeColumns();
+	}
 }
 
 qreal PointsQueueProcessor::minLimit() const
@@ -14,31 +14,33 @@
 
 #pragma once
 
-#include <QtCore/QList>
 #include <QtCore/QPointF>
-#include <limits>
+#include <QtGui/QPolygonF>
+
+#include "utils/circularQueue.h"
 
 namespace utils {
 namespace sensorsGraph {
 
-/// @class PointsQueueProcessor provides all necessary transformations with points
-/// Features: scaling by search of peaks on plot
-/// Full recount of current plot with new min/max rate
-/// Convertion absolute value to plot-Y-value and back
-/// @remarks get out point list to draw plot with them
+/// @class PointsQueueProcessor stores sensor values and provides all necessary transformations with them.
+/// Raw samples are kept in a fixed-capacity ring buffer; for drawing they are decimated into columns, one column
+/// per frame, each keeping first, minimal, maximal and last values that got into it. Columns are stored in
+/// a ring buffer too, the newest one is at x = 0, so scrolling is just starting a new column.
+/// Values are stored as is, conversion into plot Y coordinates is done only when points are requested
+/// for drawing, so autoscaling does not touch stored data.
 class PointsQueueProcessor
 {
 public:
 	/// @param viewPortHeight takes amplitude for graphics without top and bottom bounds
 	/// @param leftLimit takes sceneRect.left() for deleting out_to_date points
 	PointsQueueProcessor(const qreal viewPortHeight, const qreal leftLimit);
-	~PointsQueueProcessor();
 
+	/// Adds new sample into the current column. Works O(1).
 	void addNewValue(const qreal newValue);
 	void clearData();
 
-	/// Shifts left points queue to animate plot
-	/// use this func on each iteration
+	/// Shifts plot left to animate it: closes current column and starts new one with the latest value.
+	/// Use this func on each iteration. Works O(1).
 	/// @param step one shift in pixels
 	void makeShiftLeft(const qreal step);
 
@@ -56,8 +58,12 @@ public:
 	QPointF latestPosition() const;
 	qreal latestValue() const;
 
-	/// get points data to draw a plot
-	const QList<QPointF> &pointsBase() const;
+	/// Returns visible part of the plot in scene coordinates. Each column gives at most four points,
+	/// so the size of result depends only on the width of a view, not on sampling rate.
+	QPolygonF visiblePolyline() const;
+
+	/// Returns stored raw samples, oldest first.
+	QVector<qreal> samples() const;
 
 	qreal minLimit() const;
 	qreal maxLimit() const;
@@ -66,18 +72,29 @@ public:
 
 	qreal pointToAbsoluteValue(const qreal yValue) const;
 
-protected:
-	void recalcPointsQueue(const qreal oldMin, const qreal oldMax, const qreal oldViewHeight);
-	/// Removes last values if they have no difference
-	void filterLastValues();
-
-	qreal pointToAbsoluteValue(const qreal yValue, const qreal minValue
-			, const qreal maxValue, const qreal graphHeight) const;
-
-	QList<QPointF> mPointsQueue;
+private:
+	/// Values that got into one column of the plot.
+	struct Column
+	{
+		qreal first;
+		qreal min;
+		qreal max;
+		qreal last;
+	};
+
+	/// Returns number of columns that fit between left limit and zero.
+	int visibleColumnsCount() const;
+
+	/// Reallocates columns ring buffer for new visible width, keeping the newest columns.
+	void resizeColumns();
+
+	CircularQueue<qreal> mSamples;
+	CircularQueue<Column> mColumns;
+	bool mHasValue {};
+	qreal mLatestValue {};
 	qreal mMinCurrent;
 	qreal mMaxCurrent;
-	QPointF mNextToDraw;
+	qreal mStep { 1 };
 	qreal mGraphHeight {};
 	qreal mLeftLimit {};
 };
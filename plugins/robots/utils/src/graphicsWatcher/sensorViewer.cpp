@@ -90,13 +90,7 @@ void SensorViewer::stopJob()
 void SensorViewer::clear()
 {
 	mPointsDataProcessor->clearData();
-
-	for (auto *item : mScene->items()) {
-		if (auto *curLine = qgraphicsitem_cast<QGraphicsLineItem *>(item)) {
-			mScene->removeItem(curLine);
-			delete curLine;
-		}
-	}
+	viewport()->update();
 
 	QMatrix defaultMatrix;
 	setMatrix(defaultMatrix);
@@ -118,9 +112,9 @@ void SensorViewer::exportHistory()
 	bool fileOpened = false;
 	OutFile out(fileName, &fileOpened);
 	out() << "time" << ";" << "value" << "\n";
-	for (int i = 0; i < mPointsDataProcessor->pointsBase().size(); ++i) {
-		const qreal plotValue = mPointsDataProcessor->pointsBase()[i].y();
-		out() << i << ";" << mPointsDataProcessor->pointToAbsoluteValue(plotValue) << "\n";
+	const QVector<qreal> samples = mPointsDataProcessor->samples();
+	for (int i = 0; i < samples.size(); ++i) {
+		out() << i << ";" << samples[i] << "\n";
 	}
 
 	if (!fileOpened) {
@@ -137,24 +131,9 @@ void SensorViewer::drawNextFrame()
 {
 	mMainPoint.setPos(mPointsDataProcessor->latestPosition());
 
-	// shifting lines left
+	// shifting plot left, it will be drawn in drawForeground()
 	mPointsDataProcessor->makeShiftLeft(stepSize);
-
-	for (QGraphicsItem *item : mScene->items()) {
-		QGraphicsLineItem *curLine = qgraphicsitem_cast<QGraphicsLineItem *>(item);
-		if (curLine == nullptr) {
-			continue;
-		}
-
-		delete curLine;
-	}
-
-	const QPen regularPen = QPen(mPenBrush, 2, Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin);
-	for (int i = 0; i < mPointsDataProcessor->pointsBase().size() - 1; i++) {
-		QLineF quantOfGraph(mPointsDataProcessor->pointsBase()[i]
-				, mPointsDataProcessor->pointsBase()[i + 1]);
-		mScene->addLine(quantOfGraph, regularPen);
-	}
+	viewport()->update();
 }
 
 void SensorViewer::visualTimerEvent()
@@ -203,6 +182,13 @@ void SensorViewer::drawBackground(QPainter *painter, const QRectF &rect)
 	Q_UNUSED(rect);
 }
 
+void SensorViewer::drawForeground(QPainter *painter, const QRectF &rect)
+{
+	Q_UNUSED(rect)
+	painter->setPen(QPen(mPenBrush, 2, Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
+	painter->drawPolyline(mPointsDataProcessor->visiblePolyline());
+}
+
 void SensorViewer::mouseMoveEvent(QMouseEvent *event)
 {
 	const QPointF pivot = mPointsDataProcessor->pointOfVerticalIntersection(mapToScene(event->pos().x()
@@ -60,6 +60,8 @@ public slots:
 protected:
 	void drawNextFrame();
 	void drawBackground(QPainter *painter, const QRectF &rect);
+	/// Draws the plot over scene items
+	void drawForeground(QPainter *painter, const QRectF &rect);
 	/// Renders hint with value under cursor
 	void mouseMoveEvent(QMouseEvent *event);
 	void leaveEvent(QEvent *);
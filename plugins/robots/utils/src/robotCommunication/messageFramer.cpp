@@ -0,0 +1,186 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "messageFramer.h"
+
+#include <cstring>
+
+#include <QtCore/QtEndian>
+
+#include <qrkernel/logging.h>
+
+using namespace utils::robotCommunication;
+
+/// Initial size of receive buffer, enough for a few telemetry replies.
+static const int initialCapacity = 4096;
+
+/// Length of a text message never needs more digits than that.
+static const int maxLengthDigits = 10;
+
+/// Size of a length prefix of binary message.
+static const int binaryHeaderSize = 4;
+
+/// Messages longer than that are considered a sign of a broken stream.
+static const int maxMessageSize = 64 * 1024 * 1024;
+
+MessageFramer::MessageFramer(Framing framing)
+	: mFraming(framing)
+{
+}
+
+Framing MessageFramer::framing() const
+{
+	return mFraming;
+}
+
+void MessageFramer::frame(const QByteArray &message, QByteArray &output) const
+{
+	if (mFraming == Framing::text) {
+		output.append(QByteArray::number(message.size()));
+		output.append(':');
+	} else {
+		uchar header[binaryHeaderSize];
+		qToBigEndian<quint32>(static_cast<quint32>(message.size()), header);
+		output.append(reinterpret_cast<const char *>(header), binaryHeaderSize);
+	}
+
+	output.append(message);
+}
+
+char *MessageFramer::reserve(int size)
+{
+	if (mBuffer.size() - mWriteOffset < size && mReadOffset > 0) {
+		// Reusing space of consumed messages before growing.
+		const int pending = pendingBytes();
+		std::memmove(mBuffer.data(), mBuffer.constData() + mReadOffset, static_cast<size_t>(pending));
+		mReadOffset = 0;
+		mWriteOffset = pending;
+	}
+
+	if (mBuffer.size() - mWriteOffset < size) {
+		mBuffer.resize(qMax(qMax(initialCapacity, 2 * mBuffer.size()), mWriteOffset + size));
+	}
+
+	return mBuffer.data() + mWriteOffset;
+}
+
+void MessageFramer::commit(int size)
+{
+	mWriteOffset += size;
+}
+
+void MessageFramer::append(const char *data, int size)
+{
+	std::memcpy(reserve(size), data, static_cast<size_t>(size));
+	commit(size);
+}
+
+bool MessageFramer::next(const char *&message, int &size)
+{
+	const bool result = mFraming == Framing::text ? nextText(message, size) : nextBinary(message, size);
+	if (!result && mReadOffset == mWriteOffset) {
+		// Everything is consumed, next data can be written from the beginning for free.
+		mReadOffset = 0;
+		mWriteOffset = 0;
+	}
+
+	return result;
+}
+
+bool MessageFramer::nextText(const char *&message, int &size)
+{
+	while (mReadOffset < mWriteOffset) {
+		const char * const start = mBuffer.constData() + mReadOffset;
+		const int pending = pendingBytes();
+		const char * const delimiter = static_cast<const char *>(std::memchr(start, ':', static_cast<size_t>(pending)));
+		if (!delimiter) {
+			if (pending > maxLengthDigits) {
+				QLOG_ERROR() << "Malformed message, can not find message length in"
+						<< QByteArray(start, maxLengthDigits);
+				mReadOffset = mWriteOffset;
+			}
+
+			// We did not receive full message length yet.
+			return false;
+		}
+
+		const int headerSize = static_cast<int>(delimiter - start) + 1;
+		bool ok = headerSize > 1 && headerSize <= maxLengthDigits + 1;
+		qint64 length = 0;
+		for (const char *digit = start; ok && digit < delimiter; ++digit) {
+			ok = *digit >= '0' && *digit <= '9';
+			length = length * 10 + (*digit - '0');
+		}
+
+		if (!ok || length > maxMessageSize) {
+			QLOG_ERROR() << "Malformed message, can not determine message length from this:"
+					<< QByteArray(start, headerSize - 1);
+			mReadOffset += headerSize;
+			continue;
+		}
+
+		if (pending - headerSize < length) {
+			// We don't have all message yet.
+			return false;
+		}
+
+		message = start + headerSize;
+		size = static_cast<int>(length);
+		mReadOffset += headerSize + size;
+		return true;
+	}
+
+	return false;
+}
+
+bool MessageFramer::nextBinary(const char *&message, int &size)
+{
+	if (pendingBytes() < binaryHeaderSize) {
+		return false;
+	}
+
+	const char * const start = mBuffer.constData() + mReadOffset;
+	const quint32 length = qFromBigEndian<quint32>(reinterpret_cast<const uchar *>(start));
+	if (length > static_cast<quint32>(maxMessageSize)) {
+		// There is no way to find the next message boundary, so dropping everything received.
+		QLOG_ERROR() << "Malformed message, declared length is" << length;
+		mReadOffset = mWriteOffset;
+		return false;
+	}
+
+	if (pendingBytes() - binaryHeaderSize < static_cast<int>(length)) {
+		return false;
+	}
+
+	message = start + binaryHeaderSize;
+	size = static_cast<int>(length);
+	mReadOffset += binaryHeaderSize + size;
+	return true;
+}
+
+int MessageFramer::pendingBytes() const
+{
+	return mWriteOffset - mReadOffset;
+}
+
+int MessageFramer::capacity() const
+{
+	return mBuffer.size();
+}
+
+void MessageFramer::clear()
+{
+	mReadOffset = 0;
+	mWriteOffset = 0;
+}
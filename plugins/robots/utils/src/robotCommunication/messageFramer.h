@@ -0,0 +1,89 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QByteArray>
+
+namespace utils {
+namespace robotCommunication {
+
+/// The way messages are delimited in a TCP stream.
+enum class Framing
+{
+	/// Message is in form "<data length in bytes>:<data>", understood by TRIK Runtime.
+	text
+
+	/// Message is prefixed with its length as 4-byte big-endian unsigned integer.
+	, binary
+};
+
+/// Splits a stream of bytes into messages and frames outgoing messages. Incoming bytes are written directly into
+/// a growable buffer which is consumed by moving a read cursor, so extracting a message does not copy the buffer.
+/// Unread data is moved to the beginning of the buffer only when there is no room for new data at its end.
+class MessageFramer
+{
+public:
+	explicit MessageFramer(Framing framing = Framing::text);
+
+	/// Returns framing used by this framer.
+	Framing framing() const;
+
+	/// Appends framed message to the end of the given buffer.
+	void frame(const QByteArray &message, QByteArray &output) const;
+
+	/// Returns a pointer to at least @p size bytes of free space at the end of the buffer. Received data shall be
+	/// written there and then accounted by commit(). Invalidates messages returned by next().
+	char *reserve(int size);
+
+	/// Accounts @p size bytes written after the last reserve() call as received data.
+	void commit(int size);
+
+	/// Appends received data to the buffer, a convenience shortcut for reserve() and commit().
+	void append(const char *data, int size);
+
+	/// Extracts next complete message from the buffer.
+	/// @param message - is set to the beginning of the message, it points into the buffer and stays valid until
+	///        the next call to reserve(), append() or clear().
+	/// @param size - is set to the size of the message.
+	/// @returns false if there is no complete message yet.
+	bool next(const char *&message, int &size);
+
+	/// Returns the number of received bytes that are not consumed yet.
+	int pendingBytes() const;
+
+	/// Returns the size of memory allocated for received data.
+	int capacity() const;
+
+	/// Drops all received data.
+	void clear();
+
+private:
+	bool nextText(const char *&message, int &size);
+	bool nextBinary(const char *&message, int &size);
+
+	const Framing mFraming;
+
+	/// Received data, only bytes in [mReadOffset, mWriteOffset) are meaningful.
+	QByteArray mBuffer;
+
+	/// Position of the first byte of the first message not consumed yet.
+	int mReadOffset = 0;
+
+	/// Position right after the last received byte.
+	int mWriteOffset = 0;
+};
+
+}
+}
@@ -14,31 +14,45 @@
 
 #include "tcpConnectionHandler.h"
 
-#include <QtNetwork/QHostAddress>
+#include <QtCore/QStringList>
+#include <QtNetwork/QNetworkProxy>
 
 #include <qrkernel/logging.h>
 
-#include <QNetworkProxy>
-
 const int keepaliveTime = 3000;
+const int connectionTimeout = 3000;
 
 using namespace utils::robotCommunication;
 
-TcpConnectionHandler::TcpConnectionHandler(int port)
+TcpConnectionHandler::TcpConnectionHandler(int port, Framing framing)
 	: mKeepAliveTimer(new QTimer(this))
+	, mConnectionTimer(new QTimer(this))
+	, mFramer(framing)
 	, mPort(port)
 {
 	QObject::connect(&mSocket, &QTcpSocket::readyRead, this
 		, &TcpConnectionHandler::onIncomingData, Qt::DirectConnection);
 
+	QObject::connect(&mSocket, &QTcpSocket::connected, this
+		, &TcpConnectionHandler::onConnected, Qt::DirectConnection);
+
+	QObject::connect(&mSocket, QOverload<QAbstractSocket::SocketError>::of(&QTcpSocket::error), this
+		, &TcpConnectionHandler::onSocketError, Qt::DirectConnection);
+
 	QObject::connect(&mSocket, &QTcpSocket::disconnected
 					 , mKeepAliveTimer, &QTimer::stop, Qt::DirectConnection);
 
 	QObject::connect(mKeepAliveTimer, &QTimer::timeout, this
 		, &TcpConnectionHandler::keepalive, Qt::DirectConnection);
 
+	QObject::connect(mConnectionTimer, &QTimer::timeout, this
+		, &TcpConnectionHandler::onConnectionTimeout, Qt::DirectConnection);
+
 	mKeepAliveTimer->setInterval(keepaliveTime);
 	mKeepAliveTimer->setSingleShot(false);
+
+	mConnectionTimer->setInterval(connectionTimeout);
+	mConnectionTimer->setSingleShot(true);
 }
 
 TcpConnectionHandler::~TcpConnectionHandler()
@@ -46,80 +60,146 @@ TcpConnectionHandler::~TcpConnectionHandler()
 	mSocket.disconnect(); //otherwise DirectConnection from another thread can happen afer dtor
 }
 
-bool TcpConnectionHandler::connect(const QHostAddress &serverAddress)
+void TcpConnectionHandler::connect(const QHostAddress &serverAddress)
 {
-	if (isConnected() || mSocket.state() == QTcpSocket::ConnectingState) {
-		return true;
+	if (isOpen()) {
+		return;
+	}
+
+	if (mSocket.state() != QAbstractSocket::UnconnectedState) {
+		// Previous connection is still being closed gracefully, it is not needed anymore.
+		mSocket.abort();
 	}
+
+	mServerAddress = serverAddress;
+	mConnecting = true;
+	mProxyTried = false;
+	mFramer.clear();
+
 	// Sometimes local proxy configuration is an issue
 	// Try to avoid system proxy, because usually we are in local hetwork
 	// But fallback to proxy if connnection failed
 	mSocket.setProxy(QNetworkProxy::NoProxy);
 	mSocket.connectToHost(serverAddress, static_cast<quint16>(mPort));
-	auto result = mSocket.waitForConnected(3000);
-	if (!result) {
-		// QNetworkProxyFactory::systemProxyForQuery can run few seconds on Windows
-		// We can make a reconnect attempt wihout quering proxies
-		// However it will take (probably) additional 3000 ms for each case
-		// when just an ip-address was wrong (or robot is turned off)
-		// In case systemProxyForQuery takes more than 3000 ms,
-		// this code can be updated to make a blind re-connection attempt
-		// and just logging proxies after an attempt in case of a failure
-		const QNetworkProxyQuery proxyQuery(serverAddress.toString(), mPort);
-		const auto &tcpProxies = QNetworkProxyFactory::systemProxyForQuery(proxyQuery);
-		if (!tcpProxies.isEmpty()
-				&& (tcpProxies.size() != 1  || tcpProxies.first().type() != QNetworkProxy::NoProxy)) {
-			QLOG_INFO() << "Proxies:" << tcpProxies;
-			QLOG_INFO() << "Attempting to reconnect with an application default proxy";
-			mSocket.setProxy(QNetworkProxy::DefaultProxy);
-			mSocket.connectToHost(serverAddress, static_cast<quint16>(mPort));
-			result = mSocket.waitForConnected(3000);
-		}
-	}
-
-	if (!result) {
-		QLOG_ERROR() << mSocket.errorString();
-	} else {
-		mKeepAliveTimer->start();
-	}
-
-	mBuffer.clear();
-	mExpectedBytes = 0;
+	mConnectionTimer->start();
+}
 
-	return result;
+bool TcpConnectionHandler::isConnected() const
+{
+	return !mConnecting && mSocket.state() == QTcpSocket::ConnectedState;
 }
 
-bool TcpConnectionHandler::isConnected()
+bool TcpConnectionHandler::isOpen() const
 {
-	return mSocket.state() == QTcpSocket::ConnectedState;
+	return mConnecting || isConnected();
 }
 
 void TcpConnectionHandler::disconnect()
 {
-	if (isConnected()) {
+	mConnectionTimer->stop();
+	mPendingOutput.clear();
+	if (mConnecting) {
+		mConnecting = false;
+		mSocket.abort();
+	} else if (isConnected()) {
+		// Pending data is still delivered, socket is closed when it is written.
 		mSocket.disconnectFromHost();
-		if (mSocket.state() != QAbstractSocket::UnconnectedState) {
-			mSocket.waitForDisconnected(3000);
-		}
 	}
 }
 
 void TcpConnectionHandler::send(const QString &data)
 {
+	QByteArray framed;
+	mFramer.frame(data.toUtf8(), framed);
+	write(framed);
+}
+
+void TcpConnectionHandler::write(const QByteArray &data)
+{
+	if (mConnecting) {
+		mPendingOutput.append(data);
+		return;
+	}
+
 	if (!isConnected()) {
 		QLOG_ERROR() << "Attempting to send through unconnected socket";
 		return;
 	}
 
-	QByteArray dataByteArray = data.toUtf8();
-	dataByteArray = QByteArray::number(dataByteArray.size()) + ':' + dataByteArray;
-	mSocket.write(dataByteArray);
-	if (!mSocket.waitForBytesWritten(3000)) {
-		QLOG_ERROR() << "Unable to send data" << data << "to" << mSocket.peerAddress();
-	} else {
-		/// Resetting keepalive timer since we already sent something to the other side.
-		mKeepAliveTimer->start();
+	// Errors are reported asynchronously through error() signal of a socket.
+	mSocket.write(data);
+
+	/// Resetting keepalive timer since we already sent something to the other side.
+	mKeepAliveTimer->start();
+}
+
+void TcpConnectionHandler::onConnected()
+{
+	mConnectionTimer->stop();
+	mConnecting = false;
+
+	// Telemetry requests are small and latency-sensitive, Nagle's algorithm would delay them.
+	mSocket.setSocketOption(QAbstractSocket::LowDelayOption, 1);
+	mKeepAliveTimer->start();
+
+	if (!mPendingOutput.isEmpty()) {
+		mSocket.write(mPendingOutput);
+		mPendingOutput.clear();
+	}
+
+	emit connected();
+}
+
+void TcpConnectionHandler::onSocketError(QAbstractSocket::SocketError error)
+{
+	if (mConnecting) {
+		onConnectionAttemptFailed(mSocket.errorString());
+	} else if (error != QAbstractSocket::RemoteHostClosedError) {
+		QLOG_ERROR() << "Connection to" << mServerAddress << "failed:" << mSocket.errorString();
+	}
+}
+
+void TcpConnectionHandler::onConnectionTimeout()
+{
+	if (mConnecting) {
+		mSocket.abort();
+		onConnectionAttemptFailed(tr("Connection timed out"));
+	}
+}
+
+void TcpConnectionHandler::onConnectionAttemptFailed(const QString &error)
+{
+	mConnectionTimer->stop();
+	if (!mProxyTried) {
+		mProxyTried = true;
+		// QNetworkProxyFactory::systemProxyForQuery can run few seconds on Windows
+		// It is queried only when direct connection failed, which is usually
+		// when just an ip-address was wrong (or robot is turned off)
+		const QNetworkProxyQuery proxyQuery(mServerAddress.toString(), mPort);
+		const auto &tcpProxies = QNetworkProxyFactory::systemProxyForQuery(proxyQuery);
+		if (!tcpProxies.isEmpty()
+				&& (tcpProxies.size() != 1  || tcpProxies.first().type() != QNetworkProxy::NoProxy)) {
+			QLOG_INFO() << "Proxies:" << tcpProxies;
+			QLOG_INFO() << "Attempting to reconnect with an application default proxy";
+			// Socket must not be reused from its own error handler.
+			QMetaObject::invokeMethod(this, [this]() {
+				if (!mConnecting) {
+					return;
+				}
+
+				mSocket.abort();
+				mSocket.setProxy(QNetworkProxy::DefaultProxy);
+				mSocket.connectToHost(mServerAddress, static_cast<quint16>(mPort));
+				mConnectionTimer->start();
+			}, Qt::QueuedConnection);
+			return;
+		}
 	}
+
+	QLOG_ERROR() << error;
+	mConnecting = false;
+	mPendingOutput.clear();
+	emit connectionFailed(error);
 }
 
 void TcpConnectionHandler::onIncomingData()
@@ -128,38 +208,23 @@ void TcpConnectionHandler::onIncomingData()
 		return;
 	}
 
-	const QByteArray &data = mSocket.readAll();
-	mBuffer.append(data);
-
-	while (!mBuffer.isEmpty()) {
-		if (mExpectedBytes == 0) {
-			// Determining the length of a message.
-			const int delimiterIndex = mBuffer.indexOf(':');
-			if (delimiterIndex == -1) {
-				// We did not receive full message length yet.
-				return;
-			} else {
-				const QByteArray length = mBuffer.left(delimiterIndex);
-				mBuffer = mBuffer.mid(delimiterIndex + 1);
-				bool ok = false;
-				mExpectedBytes = length.toInt(&ok);
-				if (!ok) {
-					QLOG_ERROR() << "Malformed message, can not determine message length from this:" << length;
-					mExpectedBytes = 0;
-				}
-			}
-		} else {
-			if (mBuffer.size() >= mExpectedBytes) {
-				const QByteArray message = mBuffer.left(mExpectedBytes);
-				mBuffer = mBuffer.mid(mExpectedBytes);
-				emit messageReceived(message);
-
-				mExpectedBytes = 0;
-			} else {
-				// We don't have all message yet.
-				return;
-			}
+	// Reading straight into the receive buffer, messages are decoded from where they lie.
+	qint64 available = mSocket.bytesAvailable();
+	while (available > 0) {
+		const int chunk = static_cast<int>(qMin<qint64>(available, 1024 * 1024));
+		const qint64 read = mSocket.read(mFramer.reserve(chunk), chunk);
+		if (read <= 0) {
+			break;
 		}
+
+		mFramer.commit(static_cast<int>(read));
+		available = mSocket.bytesAvailable();
+	}
+
+	const char *message = nullptr;
+	int size = 0;
+	while (mFramer.next(message, size)) {
+		emit messageReceived(QString::fromUtf8(message, size));
 	}
 }
 
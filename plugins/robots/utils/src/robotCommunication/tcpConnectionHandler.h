@@ -14,42 +14,91 @@
 
 #pragma once
 
-#include <QtNetwork/QTcpSocket>
 #include <QtCore/QTimer>
+#include <QtNetwork/QHostAddress>
+#include <QtNetwork/QTcpSocket>
+
+#include "messageFramer.h"
 
 namespace utils {
 namespace robotCommunication {
 
+/// Event-driven connection to a robot. Never blocks: connection result is reported by signals, outgoing data is
+/// queued until connection is established, incoming data is split into messages in place.
 class TcpConnectionHandler : public QObject
 {
 	Q_OBJECT
 
 public:
-	explicit TcpConnectionHandler(int port);
+	/// Constructor.
+	/// @param port - port on a robot to connect to.
+	/// @param framing - the way messages are delimited, the other side must use the same.
+	explicit TcpConnectionHandler(int port, Framing framing = Framing::text);
 	~TcpConnectionHandler() override;
 
-	bool connect(const QHostAddress &serverAddress);
+	/// Starts connecting to the given address, emits connected() or connectionFailed() when done.
+	/// Does nothing if connection is already established or being established.
+	void connect(const QHostAddress &serverAddress);
+
+	/// Returns true if connection is established.
+	bool isConnected() const;
 
-	bool isConnected();
+	/// Returns true if connection is established or being established, so that sent data will be delivered.
+	bool isOpen() const;
 
+	/// Closes connection or aborts connection attempt, drops data that was not sent yet.
 	void disconnect();
 
+	/// Sends a message or queues it until connection is established.
 	void send(const QString &data);
 
 signals:
+	/// Emitted when a complete message was received.
 	void messageReceived(const QString &message);
 
+	/// Emitted when connection was established.
+	void connected();
+
+	/// Emitted when connection attempt failed.
+	/// @param error - description of a problem.
+	void connectionFailed(const QString &error);
+
 private slots:
+	void onConnected();
+	void onSocketError(QAbstractSocket::SocketError error);
+	void onConnectionTimeout();
 	void onIncomingData();
 	void keepalive();
 
 private:
+	/// Writes already framed data or queues it if connection is being established.
+	void write(const QByteArray &data);
+
+	/// Retries connection with application default proxy or reports failure.
+	/// @param error - description of a problem to be reported if there will be no retry.
+	void onConnectionAttemptFailed(const QString &error);
+
 	/// Timer used to send "keepalive" packets for other side to be able to detect connection failure.
 	QTimer *mKeepAliveTimer {};
+
+	/// Limits time of a connection attempt.
+	QTimer *mConnectionTimer {};
+
 	QTcpSocket mSocket;
-	QByteArray mBuffer;
-	int mExpectedBytes = 0;
+	MessageFramer mFramer;
 	const int mPort;
+
+	/// Address of the last connection attempt.
+	QHostAddress mServerAddress;
+
+	/// True while connection attempt is in progress.
+	bool mConnecting = false;
+
+	/// True if connection attempt is already made through application default proxy.
+	bool mProxyTried = false;
+
+	/// Data sent while connection was being established.
+	QByteArray mPendingOutput;
 };
 
 }
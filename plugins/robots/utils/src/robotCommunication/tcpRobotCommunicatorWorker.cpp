@@ -49,6 +49,13 @@ void TcpRobotCommunicatorWorker::init()
 			, this, &TcpRobotCommunicatorWorker::processControlMessage, Qt::DirectConnection);
 	QObject::connect(mTelemetryConnection.data(), &TcpConnectionHandler::messageReceived
 			, this, &TcpRobotCommunicatorWorker::processTelemetryMessage, Qt::DirectConnection);
+
+	for (TcpConnectionHandler * const connection : {mControlConnection.data(), mTelemetryConnection.data()}) {
+		QObject::connect(connection, &TcpConnectionHandler::connected
+				, this, &TcpRobotCommunicatorWorker::onConnectionEstablished, Qt::DirectConnection);
+		QObject::connect(connection, &TcpConnectionHandler::connectionFailed
+				, this, &TcpRobotCommunicatorWorker::onConnectionFailed, Qt::DirectConnection);
+	}
 }
 
 void TcpRobotCommunicatorWorker::deinit()
@@ -61,7 +68,7 @@ void TcpRobotCommunicatorWorker::deinit()
 void TcpRobotCommunicatorWorker::uploadProgram(const QString &programName, const QString &programContents)
 {
 	connect();
-	if (!mControlConnection->isConnected()) {
+	if (!mControlConnection->isOpen()) {
 		// Error is already reported by connect().
 		return;
 	}
@@ -73,7 +80,7 @@ void TcpRobotCommunicatorWorker::uploadProgram(const QString &programName, const
 void TcpRobotCommunicatorWorker::runProgram(const QString &programName)
 {
 	connect();
-	if (!mControlConnection->isConnected()) {
+	if (!mControlConnection->isOpen()) {
 		// Error is already reported by connect().
 		return;
 	}
@@ -85,7 +92,7 @@ void TcpRobotCommunicatorWorker::runProgram(const QString &programName)
 void TcpRobotCommunicatorWorker::runDirectCommand(const QString &directCommand, bool asScript)
 {
 	connect();
-	if (!mControlConnection->isConnected()) {
+	if (!mControlConnection->isOpen()) {
 		return;
 	}
 
@@ -97,7 +104,7 @@ void TcpRobotCommunicatorWorker::runDirectCommand(const QString &directCommand,
 void TcpRobotCommunicatorWorker::stopRobot()
 {
 	connect();
-	if (!mControlConnection->isConnected()) {
+	if (!mControlConnection->isOpen()) {
 		return;
 	}
 
@@ -108,7 +115,7 @@ void TcpRobotCommunicatorWorker::stopRobot()
 void TcpRobotCommunicatorWorker::requestCasingVersion()
 {
 	connect();
-	if (!mControlConnection->isConnected()) {
+	if (!mControlConnection->isOpen()) {
 		return;
 	}
 
@@ -117,7 +124,7 @@ void TcpRobotCommunicatorWorker::requestCasingVersion()
 
 void TcpRobotCommunicatorWorker::requestData(const QString &sensor)
 {
-	if (!mTelemetryConnection->isConnected()) {
+	if (!mTelemetryConnection->isOpen()) {
 		return;
 	}
 
@@ -126,7 +133,7 @@ void TcpRobotCommunicatorWorker::requestData(const QString &sensor)
 
 void TcpRobotCommunicatorWorker::requestData()
 {
-	if (!mTelemetryConnection->isConnected()) {
+	if (!mTelemetryConnection->isOpen()) {
 		return;
 	}
 
@@ -233,7 +240,7 @@ void TcpRobotCommunicatorWorker::connect()
 		return;
 	}
 
-	if (mControlConnection->isConnected() && mTelemetryConnection->isConnected()) {
+	if (mControlConnection->isOpen() && mTelemetryConnection->isOpen()) {
 		if (mCurrentIp == server) {
 			return;
 		}
@@ -242,15 +249,26 @@ void TcpRobotCommunicatorWorker::connect()
 	}
 
 	mCurrentIp = server;
-	const bool result = mControlConnection->connect(hostAddress) && mTelemetryConnection->connect(hostAddress);
-	if (result) {
+	mControlConnection->connect(hostAddress);
+	mTelemetryConnection->connect(hostAddress);
+}
+
+void TcpRobotCommunicatorWorker::onConnectionEstablished()
+{
+	if (mControlConnection->isConnected() && mTelemetryConnection->isConnected()) {
 		versionRequest();
 		emit connected();
-	} else {
-		emit connectionError(tr("Connection failed. IP: %1").arg(server));
 	}
 }
 
+void TcpRobotCommunicatorWorker::onConnectionFailed()
+{
+	// Both connections are useless without each other, and the failure shall be reported only once.
+	mControlConnection->disconnect();
+	mTelemetryConnection->disconnect();
+	emit connectionError(tr("Connection failed. IP: %1").arg(mCurrentIp));
+}
+
 void TcpRobotCommunicatorWorker::disconnectConnection()
 {
 	mControlConnection->disconnect();
@@ -137,6 +137,12 @@ private slots:
 	/// TRIK Runtime version request timed out. Most likely caused by network problems.
 	void onVersionTimeOut();
 
+	/// One of connections is established, emits connected() when both of them are.
+	void onConnectionEstablished();
+
+	/// One of connections failed to connect, closes the other one and reports an error.
+	void onConnectionFailed();
+
 private:
 	/// Handles value from telemetry message from robot. Emits signals with sensor data.
 	void handleValue(const QString &data);
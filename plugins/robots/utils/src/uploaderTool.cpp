@@ -15,6 +15,7 @@
 #include "utils/uploaderTool.h"
 
 #include <QtCore/QProcess>
+#include <QtConcurrent/QtConcurrentRun>
 #include <QtWidgets/QApplication>
 
 #include <qrkernel/logging.h>
@@ -23,8 +24,14 @@
 #include <qrkernel/settingsListener.h>
 #include <qrgui/plugins/toolPluginInterface/usedInterfaces/errorReporterInterface.h>
 
+#include "utils/deployment/deployer.h"
+#include "utils/deployment/sshDeploymentTransport.h"
+
 using namespace trik;
 
+/// Prefix of a command that transfers changed files instead of running a shell command.
+static const QString deployPrefix = "%DEPLOY% ";
+
 UploaderTool::UploaderTool(
 		const QString &actionName
 		, const QString &icon
@@ -52,6 +59,7 @@ UploaderTool::UploaderTool(
 			, this, &UploaderTool::onUploadFinished);
 	connect(&mProcess, &QProcess::readyReadStandardOutput, this, &UploaderTool::onUploadStdOut);
 	connect(&mProcess, &QProcess::readyReadStandardError, this, &UploaderTool::onUploadStdErr);
+	connect(&mDeploymentWatcher, &QFutureWatcher<QString>::finished, this, &UploaderTool::onDeploymentFinished);
 }
 
 UploaderTool::~UploaderTool()
@@ -60,6 +68,7 @@ UploaderTool::~UploaderTool()
 	disconnect(&mProcess);
 	disconnect(this);
 	mProcess.terminate();
+	mDeploymentWatcher.waitForFinished();
 }
 
 void UploaderTool::init(qReal::gui::MainWindowInterpretersInterface &mainWindowInterface, const QString &path)
@@ -74,9 +83,14 @@ qReal::ActionInfo UploaderTool::action() const
 	return qReal::ActionInfo(mAction, "", "tools");
 }
 
+QString UploaderTool::deployCommand(const QString &remoteDirectory)
+{
+	return deployPrefix + remoteDirectory;
+}
+
 void UploaderTool::upload()
 {
-	if (mProcess.state() != QProcess::NotRunning) {
+	if (mProcess.state() != QProcess::NotRunning || mDeploymentWatcher.isRunning() || !mRemainingCommands.isEmpty()) {
 		QLOG_WARN() << "Attempted to upload during uploading!";
 		if (mMainWindowInterface) {
 			mMainWindowInterface->errorReporter()->addInformation("Uploading is already running.");
@@ -91,33 +105,97 @@ void UploaderTool::upload()
 	QStringList args = {"/command", openConnection};
 	args << mCommands;
 	args << "exit";
+
+	if (mMainWindowInterface) {
+		mMainWindowInterface->errorReporter()->addWarning(mStartedMessage);
+	}
+
+	QLOG_INFO() << "Uploading is about to start. Path:" << uploaderPath << "Args: " << args;
+	mProcess.start(uploaderPath, args);
 #else
 	if (!checkUnixToolsExist()) {
 		return;
 	}
 
-	const QString uploaderPath = "bash";
-	QStringList actions;
 	for (QString command /* Not by const reference cause it will be modified next line */ : mCommands) {
-		actions << command
+		mRemainingCommands << command
 				.replace("%IP%", mRobotIpGetter())
 				.replace("%PATH%", mPath)
 				.replace("%SSH_TIMEOUT%", qReal::SettingsManager::value("sshTimeout").toString());
 	}
 
-	const QStringList args = { "-x", "-c", actions.join("; ") };
+	if (mMainWindowInterface) {
+		mMainWindowInterface->errorReporter()->addWarning(mStartedMessage);
+	}
+
+	runNextCommands();
 #endif
+}
 
+void UploaderTool::runNextCommands()
+{
+	if (mRemainingCommands.isEmpty()) {
+		QLOG_INFO() << "Uploading process successfully finished.";
+		if (mMainWindowInterface) {
+			mMainWindowInterface->errorReporter()->addInformation(tr("Uploaded successfully!"));
+		}
+
+		return;
+	}
+
+	if (mRemainingCommands.first().startsWith(deployPrefix)) {
+		deploy(mRemainingCommands.takeFirst().mid(deployPrefix.size()));
+		return;
+	}
+
+	QStringList actions;
+	while (!mRemainingCommands.isEmpty() && !mRemainingCommands.first().startsWith(deployPrefix)) {
+		actions << mRemainingCommands.takeFirst();
+	}
+
+	const QString uploaderPath = "bash";
+	const QStringList args = { "-x", "-c", actions.join("; ") };
 	QLOG_INFO() << "Uploading is about to start. Path:" << uploaderPath << "Args: " << args;
 	mProcess.start(uploaderPath, args);
 }
 
-void UploaderTool::onUploadStarted()
+void UploaderTool::deploy(const QString &remoteDirectory)
 {
-	QLOG_INFO() << "Uploading process started successfully...";
+	const QString path = mPath;
+	const QString host = mRobotIpGetter();
+	const int timeout = qReal::SettingsManager::value("sshTimeout").toInt();
+	mDeploymentWatcher.setFuture(QtConcurrent::run([path, host, remoteDirectory, timeout]() {
+		utils::deployment::SshDeploymentTransport transport(host, remoteDirectory, timeout);
+		utils::deployment::Deployer deployer(transport);
+		if (!deployer.deploy(path)) {
+			return deployer.errorString();
+		}
+
+		QLOG_INFO() << "Deployed" << deployer.transferredFiles().size() << "files," << deployer.transferredBytes()
+				<< "bytes to" << host << ":" << remoteDirectory;
+		return QString();
+	}));
+}
+
+void UploaderTool::onDeploymentFinished()
+{
+	const QString error = mDeploymentWatcher.result();
+	if (error.isEmpty()) {
+		runNextCommands();
+		return;
+	}
+
+	QLOG_ERROR() << "Deployment failed:" << error;
 	if (mMainWindowInterface) {
-		mMainWindowInterface->errorReporter()->addWarning(mStartedMessage);
+		mMainWindowInterface->errorReporter()->addError(error);
 	}
+
+	reportFailure();
+}
+
+void UploaderTool::onUploadStarted()
+{
+	QLOG_INFO() << "Uploading process started successfully...";
 }
 
 void UploaderTool::onUploadError(QProcess::ProcessError reason)
@@ -142,10 +220,17 @@ void UploaderTool::onUploadFinished(int exitCode)
 	}
 
 	if (exitCode == 0) {
-		QLOG_INFO() << "Uploading process successfully finished.";
-		mMainWindowInterface->errorReporter()->addInformation(tr("Uploaded successfully!"));
+		runNextCommands();
 	} else {
 		QLOG_ERROR() << "Uploading process failed with exit code" << exitCode;
+		reportFailure();
+	}
+}
+
+void UploaderTool::reportFailure()
+{
+	mRemainingCommands.clear();
+	if (mMainWindowInterface) {
 		mMainWindowInterface->errorReporter()->addError(tr("Uploading failed, check connection and try again."));
 	}
 }
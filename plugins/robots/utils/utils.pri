@@ -12,7 +12,10 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
-QT += widgets network
+QT += widgets network concurrent
+
+CONFIG *= link_pkgconfig
+PKGCONFIG *= zlib
 
 links(qrkernel qrutils qextserialport qrtext)
 includes(qrtext)
@@ -30,6 +33,12 @@ HEADERS += \
 	$$PWD/include/utils/sensorsGraph.h \
 	$$PWD/include/utils/utilsDeclSpec.h \
 	$$PWD/include/utils/requiredVersion.h \
+	$$PWD/include/utils/deployment/deployer.h \
+	$$PWD/include/utils/deployment/deploymentArchive.h \
+	$$PWD/include/utils/deployment/deploymentManifest.h \
+	$$PWD/include/utils/deployment/deploymentTransport.h \
+	$$PWD/include/utils/deployment/localDeploymentTransport.h \
+	$$PWD/include/utils/deployment/sshDeploymentTransport.h \
 	$$PWD/include/utils/canvas/canvas.h \
 	$$PWD/include/utils/canvas/canvasObject.h \
 	$$PWD/include/utils/canvas/pointObject.h \
@@ -52,6 +61,7 @@ HEADERS += \
 HEADERS += \
 	$$PWD/src/robotCommunication/protocol.h \
 	$$PWD/src/robotCommunication/guardSignalGenerator.h \
+	$$PWD/src/robotCommunication/messageFramer.h \
 	$$PWD/src/robotCommunication/tcpConnectionHandler.h \
 	$$PWD/src/robotCommunication/tcpRobotCommunicatorWorker.h \
 	$$PWD/src/graphicsWatcher/keyPoint.h \
@@ -64,6 +74,11 @@ SOURCES += \
 	$$PWD/src/realTimer.cpp \
 	$$PWD/src/objectsSet.cpp \
 	$$PWD/src/uploaderTool.cpp \
+	$$PWD/src/deployment/deployer.cpp \
+	$$PWD/src/deployment/deploymentArchive.cpp \
+	$$PWD/src/deployment/deploymentManifest.cpp \
+	$$PWD/src/deployment/localDeploymentTransport.cpp \
+	$$PWD/src/deployment/sshDeploymentTransport.cpp \
 	$$PWD/src/canvas/arcObject.cpp \
 	$$PWD/src/canvas/canvas.cpp \
 	$$PWD/src/canvas/canvasObject.cpp \
@@ -73,6 +88,7 @@ SOURCES += \
 	$$PWD/src/canvas/rectangleObject.cpp \
 	$$PWD/src/canvas/textObject.cpp \
 	$$PWD/src/widgets/comPortPicker.cpp \
+	$$PWD/src/robotCommunication/messageFramer.cpp \
 	$$PWD/src/robotCommunication/networkCommunicationErrorReporter.cpp \
 	$$PWD/src/robotCommunication/protocol.cpp \
 	$$PWD/src/robotCommunication/robotCommunicator.cpp \
@@ -149,6 +149,11 @@ bool RefactoringFinder::compareElementTypesAndProperties(Id const &first,
 	return BaseGraphTransformationUnit::compareElementTypesAndProperties(first, second);
 }
 
+bool RefactoringFinder::isTypeWildcard(Id const &elementInRule) const
+{
+	return elementInRule.element() == "Element" || elementInRule.element() == "Link";
+}
+
 QMapIterator<QString, QVariant> RefactoringFinder::propertiesIterator(Id const &id) const
 {
 	return mRefactoringRepoApi->propertiesIterator(id);
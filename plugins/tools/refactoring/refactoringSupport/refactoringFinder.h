@@ -53,6 +53,7 @@ private:
 
 	bool compareElements(Id const &first, Id const &second) const;
 	bool compareElementTypesAndProperties(Id const &first, Id const &second) const;
+	bool isTypeWildcard(Id const &elementInRule) const;
 
 	Id toInRule(Id const &id) const;
 	Id fromInRule(Id const &id) const;
@@ -24,13 +24,6 @@ PythonGenerator::PythonGenerator(LogicalModelAssistInterface &logicalModelApi
 {
 }
 
-QString PythonGenerator::generateScript(bool const isApplicationCondition)
-{
-	QString const script = "#!/usr/bin/python\n# -*- coding: utf-8 -*-\n\n" 
-			+ TextCodeGenerator::generateScript(isApplicationCondition);
-	return script;
-}
-
 QString PythonGenerator::property(Id const &element, QString const &propertyName) const
 {
 	QString res = TextCodeGenerator::property(element, propertyName);
@@ -45,36 +38,6 @@ QString PythonGenerator::property(Id const &element, QString const &propertyName
 	return res;
 }
 
-QString PythonGenerator::createProperInitAndOutput(QString const &code, bool const isApplicationCondition) const
-{
-	QString init = "";
-	QString output = "print ''";
-
-	if (mPropertiesUsage.keys().isEmpty()) {
-		output += " + 'empty reaction'";
-	} else {
-		for (QString const &elemName : mPropertiesUsage.keys()) {
-			for (QString const &propertyName : *mPropertiesUsage.value(elemName)) {
-				QString const variable = elemName + delimeter + propertyName;
-				QString const curPropertyValue = property(mMatch.value(idByName(elemName)), propertyName);
-	
-				bool isStringProp = isStringProperty(mMatch.value(idByName(elemName)), propertyName);
-				QString const propertyValue = isStringProp ? "'" + escape(curPropertyValue) + "'" : curPropertyValue;
-				QString const representationOfProperty = "'\\'' + str(" + variable + ") + '\\''";
-	
-				init += variable + "=" + propertyValue + "; ";
-				output += " + '" + variable + "=' + " + representationOfProperty + " + ';'";
-			}
-		}
-	}
-
-	if (!isApplicationCondition) {
-		return init + "\n\n" + code + "\n\n" + output;
-	} else {
-		return init + "\n\nprint " + code;
-	}
-}
-
 QString PythonGenerator::createBehaviourFunction(QString const &elementName, QString const &propertyName) const
 {
 	QString result = properElementProperty(elementName, propertyName);
@@ -32,15 +32,9 @@ public:
 			, GraphicalModelAssistInterface &graphicalModelApi
 			, gui::MainWindowInterpretersInterface &interpretersInterface);
 
-	/// Generate and return reaction script or application condition script on python
-	QString generateScript(bool const isApplicationCondition);
-
 protected:
 	QString property(Id const &element, QString const &propertyName) const;
 
-	/// Add to code correct initialization of new variables and create proper output for model update
-	QString createProperInitAndOutput(QString const &code, bool const isApplicationCondition) const;
-
 	/// Create function definition from element property
 	QString createBehaviourFunction(QString const &elementName, QString const &propertyName) const;
 
@@ -0,0 +1,158 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "pythonScriptHost.h"
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+using namespace qReal;
+
+/// Reads the driver script from the first line of input, so it is passed without temporary files and quoting.
+static QString const bootstrap =
+		"import json,sys; exec(json.loads(getattr(sys.stdin,'buffer',sys.stdin).readline().decode('utf-8'))[0])";
+
+/// Replies to session reset requests are ignored.
+static int const resetRequest = 0;
+
+PythonScriptHost::PythonScriptHost(QObject *parent)
+	: ScriptHost(parent)
+	, mPythonPath("python")
+{
+	connect(&mProcess, &QProcess::readyReadStandardOutput, this, &PythonScriptHost::readReplies);
+	connect(&mProcess, static_cast<void (QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished)
+			, this, &PythonScriptHost::onProcessFinished);
+}
+
+PythonScriptHost::~PythonScriptHost()
+{
+	stopSession();
+}
+
+void PythonScriptHost::setPythonPath(QString const &path)
+{
+	mPythonPath = path.isEmpty() ? "python" : path;
+}
+
+void PythonScriptHost::startSession()
+{
+	if (mProcess.state() == QProcess::Running && mProcess.program() != mPythonPath) {
+		stopSession();
+	}
+
+	// Not running process will be started with clean state on the first request.
+	if (mProcess.state() == QProcess::Running) {
+		send(resetRequest, "reset", QDir().currentPath(), QVariantMap());
+	}
+}
+
+void PythonScriptHost::stopSession()
+{
+	// Process finish is expected here, so it is not reported as an error of pending request.
+	mPendingRequest = -1;
+	if (mProcess.state() != QProcess::NotRunning) {
+		mProcess.kill();
+		mProcess.waitForFinished();
+	}
+}
+
+bool PythonScriptHost::ensureStarted()
+{
+	if (mProcess.state() == QProcess::Running) {
+		return true;
+	}
+
+	QFile driver(":/textualPart/scriptHostDriver.py");
+	if (!driver.open(QIODevice::ReadOnly)) {
+		return false;
+	}
+
+	mProcess.start(mPythonPath, { "-u", "-c", bootstrap });
+	if (!mProcess.waitForStarted()) {
+		return false;
+	}
+
+	QJsonArray const driverLine{ QString::fromUtf8(driver.readAll()) };
+	mProcess.write(QJsonDocument(driverLine).toJson(QJsonDocument::Compact) + '\n');
+	send(resetRequest, "reset", QDir().currentPath(), QVariantMap());
+	return true;
+}
+
+void PythonScriptHost::post(int request, CodeType type, QString const &code, QVariantMap const &values)
+{
+	if (!ensureStarted()) {
+		Result result;
+		result.error = tr("Python interpreter can not be started, check python path in settings");
+		emit finished(request, result);
+		return;
+	}
+
+	QString const types[] = { "initialization", "applicationCondition", "reaction" };
+	mPendingRequest = request;
+	send(request, types[type], code, values);
+}
+
+void PythonScriptHost::interrupt()
+{
+	// Python code can not be interrupted from outside, so the session is lost.
+	stopSession();
+}
+
+void PythonScriptHost::send(int request, QString const &type, QString const &code, QVariantMap const &values)
+{
+	QJsonObject message;
+	message["id"] = request;
+	message["type"] = type;
+	message["code"] = code;
+	message["values"] = QJsonObject::fromVariantMap(values);
+	mProcess.write(QJsonDocument(message).toJson(QJsonDocument::Compact) + '\n');
+}
+
+void PythonScriptHost::readReplies()
+{
+	while (mProcess.canReadLine()) {
+		QJsonObject const reply = QJsonDocument::fromJson(mProcess.readLine()).object();
+		int const request = reply["id"].toInt(resetRequest);
+		if (request == resetRequest) {
+			continue;
+		}
+
+		Result result;
+		result.ok = reply["ok"].toBool();
+		result.condition = reply["condition"].toBool();
+		result.values = reply["values"].toObject().toVariantMap();
+		result.output = reply["output"].toString();
+		result.error = reply["error"].toString();
+		if (request == mPendingRequest) {
+			mPendingRequest = -1;
+		}
+
+		emit finished(request, result);
+	}
+}
+
+void PythonScriptHost::onProcessFinished()
+{
+	if (mPendingRequest != -1) {
+		Result result;
+		result.error = tr("Python interpreter has exited unexpectedly: %1")
+				.arg(QString::fromLocal8Bit(mProcess.readAllStandardError()));
+		int const request = mPendingRequest;
+		mPendingRequest = -1;
+		emit finished(request, result);
+	}
+}
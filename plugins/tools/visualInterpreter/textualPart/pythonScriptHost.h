@@ -0,0 +1,61 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QProcess>
+
+#include "scriptHost.h"
+
+namespace qReal {
+
+/// Runs textual parts of rules written on Python in a separate interpreter process that lives during the whole
+/// session. Requests and replies are exchanged as JSON lines with the driver script started in that process,
+/// the driver caches compiled code and keeps global variables between requests.
+class PythonScriptHost : public ScriptHost
+{
+	Q_OBJECT
+
+public:
+	explicit PythonScriptHost(QObject *parent = nullptr);
+	~PythonScriptHost() override;
+
+	/// Sets path to python interpreter executable, takes effect when the process is started next time.
+	void setPythonPath(QString const &path);
+
+	void startSession() override;
+	void stopSession() override;
+
+protected:
+	void post(int request, CodeType type, QString const &code, QVariantMap const &values) override;
+	void interrupt() override;
+
+private slots:
+	void readReplies();
+	void onProcessFinished();
+
+private:
+	/// Starts interpreter process with the driver if it is not running yet, returns false on failure.
+	bool ensureStarted();
+
+	void send(int request, QString const &type, QString const &code, QVariantMap const &values);
+
+	QProcess mProcess;
+	QString mPythonPath;
+
+	/// Request being executed by the interpreter, -1 if there is no one.
+	int mPendingRequest = -1;
+};
+
+}
@@ -23,30 +23,6 @@ QtScriptGenerator::QtScriptGenerator(LogicalModelAssistInterface &logicalModelAp
 {
 }
 
-QString QtScriptGenerator::createProperInitAndOutput(QString const &code, bool const isApplicationCondition) const
-{
-	QString init = "";
-	QString output = "''";
-	for (QString const &elemName : mPropertiesUsage.keys()) {
-		for (QString const &propertyName : *mPropertiesUsage.value(elemName)) {
-			QString const variable = elemName + delimeter + propertyName;
-			QString const curPropertyValue = property(mMatch.value(idByName(elemName)), propertyName);
-
-			bool isStringProp = isStringProperty(mMatch.value(idByName(elemName)), propertyName);
-			QString const propertyValue = isStringProp ? "'" + escape(curPropertyValue) + "'" : curPropertyValue;
-			QString const representationOfProperty = "'\\'' + String(" + variable + ") + '\\''";
-
-			init += variable + "=" + propertyValue + "; ";
-			output += " + '" + variable + "=' + " + representationOfProperty + " + ';'";
-		}
-	}
-	if (!isApplicationCondition) {
-		return init + "\n\n" + code + "\n\n" + output;
-	} else {
-		return init + "\n\n" + code;
-	}
-}
-
 QString QtScriptGenerator::createBehaviourFunction(QString const &elementName, QString const &propertyName) const
 {
 	QString result = properElementProperty(elementName, propertyName);
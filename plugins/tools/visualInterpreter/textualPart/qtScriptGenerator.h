@@ -33,9 +33,6 @@ public:
 			, gui::MainWindowInterpretersInterface &interpretersInterface);
 
 protected:
-	/// Add to code correct initialization of new variables and create proper output for model update
-	QString createProperInitAndOutput(QString const &code, bool const isApplicationCondition) const;
-
 	/// Create function definition from element property
 	QString createBehaviourFunction(QString const &elementName, QString const &propertyName) const;
 
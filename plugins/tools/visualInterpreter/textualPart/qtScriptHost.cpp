@@ -0,0 +1,114 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "qtScriptHost.h"
+
+using namespace qReal;
+
+/// Period of checking for interruption requests while the script is evaluated.
+static int const processEventsInterval = 20;
+
+QtScriptHost::QtScriptHost(QObject *parent)
+	: ScriptHost(parent)
+{
+	mWorker.moveToThread(&mThread);
+	mThread.start();
+}
+
+QtScriptHost::~QtScriptHost()
+{
+	// Engine is destroyed after its thread is finished, so it can not be in the middle of evaluation.
+	interrupt();
+	mThread.quit();
+	mThread.wait();
+}
+
+void QtScriptHost::startSession()
+{
+	QMetaObject::invokeMethod(&mWorker, [this]() {
+		mPrograms.clear();
+		mEngine.reset(new QScriptEngine());
+		mEngine->setProcessEventsInterval(processEventsInterval);
+	});
+}
+
+void QtScriptHost::stopSession()
+{
+	QMetaObject::invokeMethod(&mWorker, [this]() {
+		mPrograms.clear();
+		mEngine.reset();
+	});
+}
+
+void QtScriptHost::post(int request, CodeType type, QString const &code, QVariantMap const &values)
+{
+	QMetaObject::invokeMethod(&mWorker, [=]() { execute(request, type, code, values); });
+}
+
+void QtScriptHost::interrupt()
+{
+	// Delivered while the engine processes events during evaluation.
+	QMetaObject::invokeMethod(&mWorker, [this]() {
+		if (mEngine && mEngine->isEvaluating()) {
+			mInterrupted = true;
+			mEngine->abortEvaluation();
+		}
+	});
+}
+
+void QtScriptHost::execute(int request, CodeType type, QString const &code, QVariantMap const &values)
+{
+	if (!mEngine) {
+		mEngine.reset(new QScriptEngine());
+		mEngine->setProcessEventsInterval(processEventsInterval);
+	}
+
+	auto program = mPrograms.find(code);
+	if (program == mPrograms.end()) {
+		program = mPrograms.insert(code, QScriptProgram(code));
+	}
+
+	mInterrupted = false;
+	Result result;
+	if (type == initialization) {
+		mEngine->evaluate(*program);
+	} else {
+		QScriptContext * const context = mEngine->pushContext();
+		QScriptValue scope = context->activationObject();
+		for (auto value = values.cbegin(); value != values.cend(); ++value) {
+			scope.setProperty(value.key(), mEngine->toScriptValue(value.value()));
+		}
+
+		QScriptValue const conditionValue = mEngine->evaluate(*program);
+		if (!mEngine->hasUncaughtException() && !mInterrupted) {
+			result.condition = conditionValue.toBool();
+			for (auto value = values.cbegin(); value != values.cend(); ++value) {
+				result.values.insert(value.key(), scope.property(value.key()).toVariant());
+			}
+		}
+
+		mEngine->popContext();
+	}
+
+	if (mInterrupted) {
+		result.error = tr("Evaluation was aborted");
+	} else if (mEngine->hasUncaughtException()) {
+		result.error = mEngine->uncaughtException().toString();
+		mEngine->clearExceptions();
+	} else {
+		result.ok = true;
+	}
+
+	emit finished(request, result);
+}
@@ -0,0 +1,60 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QHash>
+#include <QtCore/QScopedPointer>
+#include <QtCore/QThread>
+#include <QtScript/QScriptEngine>
+#include <QtScript/QScriptProgram>
+
+#include "scriptHost.h"
+
+namespace qReal {
+
+/// Runs textual parts of rules written on QtScript in the engine living in a separate thread. Initialization code
+/// is evaluated in the global context, conditions and reactions are evaluated in a fresh context whose activation
+/// object holds property values, so assignments to them are read back after evaluation.
+class QtScriptHost : public ScriptHost
+{
+	Q_OBJECT
+
+public:
+	explicit QtScriptHost(QObject *parent = nullptr);
+	~QtScriptHost() override;
+
+	void startSession() override;
+	void stopSession() override;
+
+protected:
+	void post(int request, CodeType type, QString const &code, QVariantMap const &values) override;
+	void interrupt() override;
+
+private:
+	/// Evaluates code in the engine thread.
+	void execute(int request, CodeType type, QString const &code, QVariantMap const &values);
+
+	QThread mThread;
+
+	/// Receiver of calls that shall be executed in the engine thread.
+	QObject mWorker;
+
+	/// Fields below are accessed only from the engine thread.
+	QScopedPointer<QScriptEngine> mEngine;
+	QHash<QString, QScriptProgram> mPrograms;
+	bool mInterrupted = false;
+};
+
+}
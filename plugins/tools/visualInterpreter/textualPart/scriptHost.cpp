@@ -0,0 +1,85 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "scriptHost.h"
+
+#include <QtCore/QEventLoop>
+#include <QtCore/QTimer>
+
+using namespace qReal;
+
+/// Time given to interrupted code to report that it is finished.
+static int const interruptionTimeout = 1000;
+
+ScriptHost::ScriptHost(QObject *parent)
+	: QObject(parent)
+{
+	qRegisterMetaType<ScriptHost::Result>();
+}
+
+ScriptHost::Result ScriptHost::run(CodeType type, QString const &code, QVariantMap const &values, int timeout)
+{
+	Result result;
+	if (mLoop) {
+		// Events are processed while waiting for a reply, so someone may try to run code before it comes.
+		// Engines execute one request at a time, so the new one is rejected instead of being mixed with it.
+		result.error = tr("Previous rule code is still running");
+		return result;
+	}
+
+	int const request = ++mLastRequest;
+	bool done = false;
+
+	QEventLoop loop;
+	QTimer timer;
+	timer.setSingleShot(true);
+	connect(&timer, &QTimer::timeout, &loop, &QEventLoop::quit);
+	connect(this, &ScriptHost::finished, &loop, [&](int finishedRequest, Result const &finishedResult) {
+		if (finishedRequest == request) {
+			result = finishedResult;
+			done = true;
+			loop.quit();
+		}
+	});
+
+	mAborted = false;
+	mLoop = &loop;
+	post(request, type, code, values);
+	if (!done) {
+		timer.start(timeout);
+		loop.exec();
+	}
+
+	if (!done) {
+		// Waiting for the engine to actually stop, so the next request does not overlap with this one.
+		interrupt();
+		timer.start(interruptionTimeout);
+		loop.exec();
+		result = Result();
+		result.error = mAborted
+				? tr("Execution of rule code was stopped")
+				: tr("Rule code was not finished in %1 ms and was aborted").arg(timeout);
+	}
+
+	mLoop = nullptr;
+	return result;
+}
+
+void ScriptHost::abort()
+{
+	if (mLoop) {
+		mAborted = true;
+		mLoop->quit();
+	}
+}
@@ -0,0 +1,93 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QObject>
+#include <QtCore/QVariantMap>
+
+class QEventLoop;
+
+namespace qReal {
+
+/// Runs textual parts of rules written on some script language. Host keeps one engine for the whole interpretation
+/// session, so variables defined by initialization code survive between steps and the code of each rule is compiled
+/// only once. Values of element properties are passed to the engine as data and not as generated source text.
+/// Code is executed asynchronously, so the editor stays responsive while a rule runs, and is aborted on timeout.
+class ScriptHost : public QObject
+{
+	Q_OBJECT
+
+public:
+	enum CodeType {
+		initialization,
+		applicationCondition,
+		reaction
+	};
+
+	/// Outcome of one code execution.
+	struct Result
+	{
+		/// True if code was executed without errors and in time.
+		bool ok = false;
+
+		/// Value of application condition, meaningful only for applicationCondition code.
+		bool condition = false;
+
+		/// Values of variables after execution, has the same keys as values given to run().
+		QVariantMap values;
+
+		/// Text printed by code.
+		QString output;
+
+		/// Error description if ok is false.
+		QString error;
+	};
+
+	explicit ScriptHost(QObject *parent = nullptr);
+
+	/// Starts new session, state left by the previous one is dropped. Engine itself may be started lazily.
+	virtual void startSession() = 0;
+
+	/// Ends current session and frees engine resources.
+	virtual void stopSession() = 0;
+
+	/// Runs \a code with variables initialized by \a values and returns when it is finished or after \a timeout
+	/// milliseconds. Events are processed while waiting. Returns an error if called while previous code is still
+	/// running.
+	Result run(CodeType type, QString const &code, QVariantMap const &values, int timeout);
+
+	/// Aborts code that is being run now, run() returns an error.
+	void abort();
+
+signals:
+	/// Emitted by implementations when the execution of the request is finished. May be emitted from other thread.
+	void finished(int request, qReal::ScriptHost::Result const &result);
+
+protected:
+	/// Starts asynchronous execution of \a code, finished() shall be emitted with \a request when it is done.
+	virtual void post(int request, CodeType type, QString const &code, QVariantMap const &values) = 0;
+
+	/// Interrupts currently executed code, state of the session may be lost after that.
+	virtual void interrupt() = 0;
+
+private:
+	int mLastRequest = 0;
+	QEventLoop *mLoop = nullptr;
+	bool mAborted = false;
+};
+
+}
+
+Q_DECLARE_METATYPE(qReal::ScriptHost::Result)
@@ -0,0 +1,96 @@
+# Copyright 2026 CyberTech Labs Ltd.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Executes textual parts of visual interpreter rules sent by PythonScriptHost. Each request and each reply is
+# a JSON object on a separate line. Works both with Python 2 and Python 3.
+
+import json
+import sys
+import traceback
+
+_input = getattr(sys.stdin, 'buffer', sys.stdin)
+_channel = sys.stdout
+_session = {}
+_compiled = {}
+
+
+class _Output(object):
+    def __init__(self):
+        self.parts = []
+
+    def write(self, text):
+        self.parts.append(text)
+
+    def flush(self):
+        pass
+
+
+def _compile(code, mode):
+    key = (mode, code)
+    if key not in _compiled:
+        _compiled[key] = compile(code, '<rule>', mode)
+    return _compiled[key]
+
+
+def _reset(scriptDir):
+    _session.clear()
+    _compiled.clear()
+    _session['__name__'] = '__main__'
+    _session['__script_dir__'] = scriptDir
+
+
+def _condition(code):
+    try:
+        expression = _compile(code, 'eval')
+    except SyntaxError:
+        # Behaviour functions are defined before the condition itself.
+        definitions, _, condition = code.strip().rpartition('\n')
+        exec(_compile(definitions, 'exec'), _session)
+        expression = _compile(condition, 'eval')
+    return eval(expression, _session)
+
+
+def _execute(request, reply):
+    kind = request['type']
+    values = request.get('values', {})
+    if kind == 'reset':
+        _reset(request['code'])
+        return
+
+    _session.update(values)
+    if kind == 'applicationCondition':
+        reply['condition'] = bool(_condition(request['code']))
+    else:
+        exec(_compile(request['code'], 'exec'), _session)
+    reply['values'] = dict((name, _session.get(name)) for name in values)
+
+
+while True:
+    line = _input.readline()
+    if not line:
+        break
+
+    request = json.loads(line.decode('utf-8'))
+    reply = {'id': request['id'], 'ok': True}
+    output = _Output()
+    sys.stdout = output
+    try:
+        _execute(request, reply)
+    except Exception:
+        reply['ok'] = False
+        reply['error'] = traceback.format_exc()
+    sys.stdout = _channel
+    reply['output'] = ''.join(output.parts)
+    _channel.write(json.dumps(reply, default=str) + '\n')
+    _channel.flush()
@@ -39,7 +39,7 @@ void TextCodeGenerator::setMatch(QHash<Id, Id> const &match)
 	mMatch = match;
 }
 
-QString TextCodeGenerator::generateScript(bool const isApplicationCondition)
+QString TextCodeGenerator::generateCode(bool const isApplicationCondition, QVariantMap &values)
 {
 	QString code = property(mRule, isApplicationCondition ? "applicationCondition" : "procedure");
 	collectPropertiesUsageAndMethodsInvocation(code);
@@ -49,12 +49,20 @@ QString TextCodeGenerator::generateScript(bool const isApplicationCondition)
 
 	collectPropertiesUsageAndMethodsInvocation(code);
 
-	QString const script = createProperInitAndOutput(replacePropertiesUsage(code), isApplicationCondition);
+	code = replacePropertiesUsage(code);
+
+	values.clear();
+	for (QString const &elemName : mPropertiesUsage.keys()) {
+		for (QString const &propertyName : *mPropertiesUsage.value(elemName)) {
+			values.insert(elemName + delimeter + propertyName
+					, variableValue(mMatch.value(idByName(elemName)), propertyName));
+		}
+	}
 
 	mPropertiesUsage.clear();
 	mMethodsInvocation.clear();
 
-	return script;
+	return code;
 }
 
 bool TextCodeGenerator::hasElementName(QString const &name) const
@@ -100,17 +108,22 @@ QVariant TextCodeGenerator::propertyVariant(Id const &element, QString const &pr
 	return mLogicalModelApi.logicalRepoApi().property(mGraphicalModelApi.logicalId(element), propertyName);
 }
 
-bool TextCodeGenerator::isStringProperty(Id const &element, QString const &propertyName) const
+QVariant TextCodeGenerator::variableValue(Id const &element, QString const &propertyName) const
 {
-	QVariant result = propertyVariant(element, propertyName);
+	QString const value = propertyVariant(element, propertyName).toString();
 
 	bool isInt = false;
-	result.toInt(&isInt);
+	int const intValue = value.toInt(&isInt);
+	if (isInt) {
+		return intValue;
+	}
 
-	QString const boolResult = result.toString().toLower();
-	bool isBool = boolResult == "true" || boolResult == "false";
+	QString const boolValue = value.toLower();
+	if (boolValue == "true" || boolValue == "false") {
+		return boolValue == "true";
+	}
 
-	return !isInt && !isBool;
+	return value;
 }
 
 void TextCodeGenerator::collectPropertiesUsageAndMethodsInvocation(QString const &code)
@@ -209,20 +222,3 @@ bool TextCodeGenerator::isCorrectIdentifierSymbol(QChar const c) const
 {
 	return ('0' <= c && c <= '9') || ('A' <= c && c <= 'Z') || ('a'<= c && c <= 'z') || c == '_';
 }
-
-QString TextCodeGenerator::escape(QString const &string) const
-{
-	QString result = string;
-
-	QList<QString> escapedSymbols;
-	escapedSymbols << "\\" << "'" << "\"" ;
-	for (QString e : escapedSymbols) {
-		result.replace(e, "\\" + e);
-	}
-
-	result.replace("\n", "\\n");
-	result.replace("\t", "\\t");
-	result.replace("\r", "\\r");
-
-	return result;
-}
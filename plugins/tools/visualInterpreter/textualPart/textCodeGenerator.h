@@ -40,8 +40,9 @@ public:
 	/// Matched rule match
 	void setMatch(QHash<Id, Id> const &match);
 
-	/// Generate and return reaction script or application condition script
-	virtual QString generateScript(bool const isApplicationCondition);
+	/// Generates reaction or application condition code where properties of matched elements are replaced with
+	/// variables, initial values of these variables are stored into \a values
+	QString generateCode(bool const isApplicationCondition, QVariantMap &values);
 
 	/// Returns element id by it's name (from single rule)
 	Id idByName(QString const &name) const;
@@ -54,8 +55,8 @@ protected:
 	virtual QString property(Id const &element, QString const &propertyName) const;
 	QVariant propertyVariant(Id const &element, QString const &propertyName) const;
 
-	/// Checks if property has string type
-	bool isStringProperty(Id const &element, QString const &propertyName) const;
+	/// Returns property value converted to int or bool if it looks like one, and to string otherwise
+	QVariant variableValue(Id const &element, QString const &propertyName) const;
 
 	/// Collects all pairs of elemName.propertyName (property usage) and elemName.propertyName() (method invocation)
 	/// in specified code piece
@@ -71,9 +72,6 @@ protected:
 	/// Substitute all occurrences of elemName@propertyName with content of this property
 	QString substituteElementProperties(QString const &code) const;
 
-	/// Add to code correct initialization of new variables and create proper output for model update
-	virtual QString createProperInitAndOutput(QString const &code, bool const isApplicationCondition) const = 0;
-
 	/// Create function definition from element property
 	virtual QString createBehaviourFunction(QString const &elementName, QString const &propertyName) const = 0;
 
@@ -83,9 +81,6 @@ protected:
 	QString parseIdentifier(QString const &stream, int pos, bool leftToRight) const;
 	bool isCorrectIdentifierSymbol(QChar const c) const;
 
-	/// Escapes string (',",\,\t,\r,\n)
-	QString escape(QString const &string) const;
-
 	gui::MainWindowInterpretersInterface &mInterpretersInterface;
 	LogicalModelAssistInterface &mLogicalModelApi;
 	GraphicalModelAssistInterface &mGraphicalModelApi;
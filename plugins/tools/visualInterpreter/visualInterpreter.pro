@@ -32,24 +32,24 @@ HEADERS = \
 	visualInterpreterPreferencesPage.h \
 	visualInterpreterUnit.h \
 	textualPart/ruleParser.h \
-	textualPart/pythonInterpreter.h \
 	textualPart/pythonGenerator.h \
+	textualPart/pythonScriptHost.h \
 	textualPart/textCodeGenerator.h \
-	textualPart/textCodeInterpreter.h \
+	textualPart/scriptHost.h \
 	textualPart/qtScriptGenerator.h \
-	textualPart/qtScriptInterpreter.h
+	textualPart/qtScriptHost.h
 
 SOURCES = \
 	visualInterpreterPlugin.cpp \
 	visualInterpreterPreferencesPage.cpp \
 	visualInterpreterUnit.cpp \
 	textualPart/ruleParser.cpp \
-	textualPart/pythonInterpreter.cpp \
 	textualPart/pythonGenerator.cpp \
+	textualPart/pythonScriptHost.cpp \
 	textualPart/textCodeGenerator.cpp \
-	textualPart/textCodeInterpreter.cpp \
+	textualPart/scriptHost.cpp \
 	textualPart/qtScriptGenerator.cpp \
-	textualPart/qtScriptInterpreter.cpp
+	textualPart/qtScriptHost.cpp
 
 FORMS += \
 	visualInterpreterPreferencePage.ui \
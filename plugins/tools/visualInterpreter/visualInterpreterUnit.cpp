@@ -18,6 +18,9 @@
 
 using namespace qReal;
 
+/// Rule code running longer than that is aborted unless other timeout is set in settings.
+static int const defaultScriptTimeout = 10000;
+
 VisualInterpreterUnit::VisualInterpreterUnit(
 		qReal::LogicalModelAssistInterface &logicalModelApi
 		, qReal::GraphicalModelAssistInterface &graphicalModelApi
@@ -29,34 +32,21 @@ VisualInterpreterUnit::VisualInterpreterUnit(
 		, mRules()
 		, mRuleParser(new RuleParser(logicalModelApi, graphicalModelApi, interpretersInterface.errorReporter()))
 		, mPythonGenerator(new PythonGenerator(logicalModelApi, graphicalModelApi, interpretersInterface))
-		, mPythonInterpreter(new PythonInterpreter(this))
+		, mPythonHost(new PythonScriptHost(this))
 		, mQtScriptGenerator(new QtScriptGenerator(logicalModelApi, graphicalModelApi, interpretersInterface))
-		, mQtScriptInterpreter(new QtScriptInterpreter(this))
+		, mQtScriptHost(new QtScriptHost(this))
 {
 	mDefaultProperties.insert("semanticsStatus");
 	mDefaultProperties.insert("id");
-	connect(mPythonInterpreter
-			, SIGNAL(readyReadStdOutput(QHash<QPair<QString, QString>, QString>, TextCodeInterpreter::CodeLanguage))
-			, this
-			, SLOT(processTextCodeInterpreterStdOutput(QHash<QPair<QString, QString>, QString>
-					, TextCodeInterpreter::CodeLanguage)));
-	connect(mPythonInterpreter, SIGNAL(readyReadErrOutput(QString))
-			, this, SLOT(processTextCodeInterpreterErrOutput(QString)));
-	connect(mQtScriptInterpreter
-			, SIGNAL(readyReadStdOutput(QHash<QPair<QString, QString>, QString>, TextCodeInterpreter::CodeLanguage))
-			, this
-			, SLOT(processTextCodeInterpreterStdOutput(QHash<QPair<QString, QString>, QString>
-					, TextCodeInterpreter::CodeLanguage)));
-	connect(mQtScriptInterpreter, SIGNAL(readyReadErrOutput(QString))
-			, this, SLOT(processTextCodeInterpreterErrOutput(QString)));
+
+	// Each step changes only a few elements, so matches of rules are kept between steps.
+	setIncrementalMatching(true);
 }
 
 VisualInterpreterUnit::~VisualInterpreterUnit()
 {
 	delete mPythonGenerator;
-	delete mPythonInterpreter;
 	delete mQtScriptGenerator;
-	delete mQtScriptInterpreter;
 }
 
 IdList VisualInterpreterUnit::allRules() const
@@ -156,10 +146,70 @@ void VisualInterpreterUnit::initBeforeInterpretation()
 	mCurrentNodesWithControlMark.clear();
 	mInterpretersInterface.dehighlight();
 	mMatches.clear();
+	// The model and the rules could be edited since the last run.
+	resetMatchCache();
+	watchModelsOfActiveDiagram();
 	mRuleParser->clear();
 	mRuleParser->setErrorReporter(mInterpretersInterface.errorReporter());
 	resetRuleSyntaxCheck();
 	mNeedToStopInterpretation = false;
+	// Variables of initialization code live until the end of interpretation.
+	mPythonHost->setPythonPath(SettingsManager::value("pythonPath").toString());
+	mPythonHost->startSession();
+	mQtScriptHost->startSession();
+}
+
+void VisualInterpreterUnit::watchModelsOfActiveDiagram()
+{
+	Id const activeDiagram = mInterpretersInterface.activeDiagram();
+	if (activeDiagram.isNull()) {
+		return;
+	}
+
+	// The root index of a model is invalid and does not know its model, so the diagram itself is used to get it.
+	watchModel(mGraphicalModelApi.indexById(activeDiagram).model());
+	watchModel(mLogicalModelApi.indexById(mGraphicalModelApi.logicalId(activeDiagram)).model());
+}
+
+void VisualInterpreterUnit::watchModel(QAbstractItemModel const *model)
+{
+	if (!model || mWatchedModels.contains(model)) {
+		return;
+	}
+
+	mWatchedModels.insert(model);
+	connect(model, &QObject::destroyed, this, [this, model]() { mWatchedModels.remove(model); });
+
+	connect(model, &QAbstractItemModel::rowsInserted, this
+			, [this, model](QModelIndex const &parent, int first, int last) {
+				reportRowsChanged(*model, parent, first, last);
+			});
+
+	// Removed elements are reported before removal while their graphical and logical ids can still be mapped.
+	connect(model, &QAbstractItemModel::rowsAboutToBeRemoved, this
+			, [this, model](QModelIndex const &parent, int first, int last) {
+				reportRowsChanged(*model, parent, first, last);
+			});
+
+	connect(model, &QAbstractItemModel::dataChanged, this
+			, [this, model](QModelIndex const &topLeft, QModelIndex const &bottomRight) {
+				reportRowsChanged(*model, topLeft.parent(), topLeft.row(), bottomRight.row());
+			});
+
+	connect(model, &QAbstractItemModel::rowsMoved, this, &VisualInterpreterUnit::resetMatchCache);
+	connect(model, &QAbstractItemModel::layoutChanged, this, &VisualInterpreterUnit::resetMatchCache);
+	connect(model, &QAbstractItemModel::modelReset, this, &VisualInterpreterUnit::resetMatchCache);
+}
+
+void VisualInterpreterUnit::reportRowsChanged(QAbstractItemModel const &model, QModelIndex const &parent
+		, int first, int last)
+{
+	for (int row = first; row <= last; ++row) {
+		QModelIndex const index = model.index(row, 0, parent);
+		// Each API knows only items of its own model.
+		Id const graphicalId = mGraphicalModelApi.idByIndex(index);
+		elementChanged(graphicalId.isNull() ? mLogicalModelApi.idByIndex(index) : graphicalId);
+	}
 }
 
 void VisualInterpreterUnit::loadSemantics()
@@ -263,7 +313,7 @@ void VisualInterpreterUnit::interpret()
 
 	while (findMatch()) {
 		if (mNeedToStopInterpretation) {
-			mPythonInterpreter->terminateProcess();
+			stopScriptHosts();
 			report(tr("Interpretation stopped manually"), false);
 			return;
 		}
@@ -285,14 +335,15 @@ void VisualInterpreterUnit::interpret()
 	if (!hasRuleSyntaxError()) {
 		report(tr("No rule cannot be applied"), false);
 		mInterpretersInterface.dehighlight();
-		mPythonInterpreter->deleteTempFile();
 	}
-	mPythonInterpreter->terminateProcess();
+	stopScriptHosts();
 }
 
 void VisualInterpreterUnit::stopInterpretation()
 {
 	mNeedToStopInterpretation = true;
+	mPythonHost->abort();
+	mQtScriptHost->abort();
 }
 
 void VisualInterpreterUnit::highlightMatch()
@@ -355,8 +406,10 @@ bool VisualInterpreterUnit::checkApplicationConditionQtScript(QHash<Id, Id> cons
 	mQtScriptGenerator->setRule(mRules.value(ruleName));
 	mQtScriptGenerator->setMatch(match);
 
-	return mQtScriptInterpreter->interpret(mQtScriptGenerator->generateScript(true)
-			, TextCodeInterpreter::applicationCondition);
+	QVariantMap values;
+	QString const code = mQtScriptGenerator->generateCode(true, values);
+	ScriptHost::Result const result = runScript(*mQtScriptHost, ScriptHost::applicationCondition, code, values);
+	return result.ok && result.condition;
 }
 
 bool VisualInterpreterUnit::checkApplicationConditionCStyle(QHash<Id, Id> const &match, QString const &appCond) const
@@ -366,15 +419,13 @@ bool VisualInterpreterUnit::checkApplicationConditionCStyle(QHash<Id, Id> const
 
 bool VisualInterpreterUnit::checkApplicationConditionPython(QHash<Id, Id> const &match, QString const &ruleName) const
 {
-	QString const pythonPath = SettingsManager::value("pythonPath").toString();
-
-	mPythonInterpreter->setPythonPath(pythonPath);
-
 	mPythonGenerator->setRule(mRules.value(ruleName));
 	mPythonGenerator->setMatch(match);
 
-	return mPythonInterpreter->interpret(mPythonGenerator->generateScript(true)
-			, PythonInterpreter::applicationCondition);
+	QVariantMap values;
+	QString const code = mPythonGenerator->generateCode(true, values);
+	ScriptHost::Result const result = runScript(*mPythonHost, ScriptHost::applicationCondition, code, values);
+	return result.ok && result.condition;
 }
 
 Id VisualInterpreterUnit::startElement() const
@@ -408,7 +459,7 @@ void VisualInterpreterUnit::report(const QString &message, bool isError) const
 {
 	BaseGraphTransformationUnit::report(message, isError);
 	if (isError) {
-		mPythonInterpreter->terminateProcess();
+		stopScriptHosts();
 	}
 }
 
@@ -530,9 +581,11 @@ void VisualInterpreterUnit::replaceElements()
 
 			for (Id const &link : outgoingLinks(fromInModel)) {
 				mGraphicalModelApi.setFrom(link, toInModel);
+				elementChanged(link);
 			}
 			for (Id const &link : incomingLinks(fromInModel)) {
 				mGraphicalModelApi.setTo(link, toInModel);
+				elementChanged(link);
 			}
 
 			mInterpretersInterface.deleteElementFromDiagram(
@@ -570,9 +623,9 @@ void VisualInterpreterUnit::interpretInitializationCode()
 	if (mInitializationCode.first == "Block Scheme (C-like)") {
 		mRuleParser->parseStringCode(mInitializationCode.second);
 	} else if (mInitializationCode.first == "Python") {
-		mPythonInterpreter->interpret(mInitializationCode.second, TextCodeInterpreter::initialization);
+		runScript(*mPythonHost, ScriptHost::initialization, mInitializationCode.second, QVariantMap());
 	} else {
-		mQtScriptInterpreter->interpret(mInitializationCode.second, TextCodeInterpreter::initialization);
+		runScript(*mQtScriptHost, ScriptHost::initialization, mInitializationCode.second, QVariantMap());
 	}
 }
 
@@ -592,14 +645,17 @@ bool VisualInterpreterUnit::interpretReaction()
 
 bool VisualInterpreterUnit::interpretPythonReaction()
 {
-	QString const pythonPath = SettingsManager::value("pythonPath").toString();
-
-	mPythonInterpreter->setPythonPath(pythonPath);
-
 	mPythonGenerator->setRule(mRules.value(mMatchedRuleName));
 	mPythonGenerator->setMatch(mMatches.first());
 
-	return mPythonInterpreter->interpret(mPythonGenerator->generateScript(false), PythonInterpreter::reaction);
+	QVariantMap values;
+	QString const code = mPythonGenerator->generateCode(false, values);
+	ScriptHost::Result const result = runScript(*mPythonHost, ScriptHost::reaction, code, values);
+	if (result.ok) {
+		applyScriptValues(*mPythonGenerator, values, result.values);
+	}
+
+	return result.ok;
 }
 
 bool VisualInterpreterUnit::interpretQtScriptReaction()
@@ -607,7 +663,54 @@ bool VisualInterpreterUnit::interpretQtScriptReaction()
 	mQtScriptGenerator->setRule(mRules.value(mMatchedRuleName));
 	mQtScriptGenerator->setMatch(mMatches.first());
 
-	return mQtScriptInterpreter->interpret(mQtScriptGenerator->generateScript(false), TextCodeInterpreter::reaction);
+	QVariantMap values;
+	QString const code = mQtScriptGenerator->generateCode(false, values);
+	ScriptHost::Result const result = runScript(*mQtScriptHost, ScriptHost::reaction, code, values);
+	if (result.ok) {
+		applyScriptValues(*mQtScriptGenerator, values, result.values);
+	}
+
+	return result.ok;
+}
+
+ScriptHost::Result VisualInterpreterUnit::runScript(ScriptHost &host, ScriptHost::CodeType type
+		, QString const &code, QVariantMap const &values) const
+{
+	int const timeout = SettingsManager::value("scriptTimeout", defaultScriptTimeout).toInt();
+	ScriptHost::Result const result = host.run(type, code, values, timeout);
+	if (!result.output.isEmpty()) {
+		mInterpretersInterface.errorReporter()->addInformation(result.output.trimmed());
+	}
+
+	if (!result.ok) {
+		mInterpretersInterface.errorReporter()->addCritical(result.error);
+	}
+
+	return result;
+}
+
+void VisualInterpreterUnit::applyScriptValues(TextCodeGenerator const &generator, QVariantMap const &oldValues
+		, QVariantMap const &newValues)
+{
+	for (auto value = newValues.cbegin(); value != newValues.cend(); ++value) {
+		QString const newValue = value.value().toString();
+		if (newValue == oldValues.value(value.key()).toString()) {
+			continue;
+		}
+
+		int const delimeterIndex = value.key().indexOf(TextCodeGenerator::delimeter);
+		QString const elemName = value.key().left(delimeterIndex);
+		QString const propName = value.key().mid(delimeterIndex + TextCodeGenerator::delimeter.length());
+		Id const element = mMatches.first().value(generator.idByName(elemName));
+		setProperty(element, propName, newValue);
+		elementChanged(element);
+	}
+}
+
+void VisualInterpreterUnit::stopScriptHosts() const
+{
+	mPythonHost->stopSession();
+	mQtScriptHost->stopSession();
 }
 
 void VisualInterpreterUnit::copyProperties(Id const &elemInModel, Id const &elemInRule)
@@ -627,6 +730,12 @@ void VisualInterpreterUnit::copyProperties(Id const &elemInModel, Id const &elem
 
 bool VisualInterpreterUnit::makeStep()
 {
+	// Reactions, deletions, replacements and control flow touch only matched elements. They are reported
+	// before anything is deleted, while their logical and graphical ids can still be mapped to each other.
+	for (Id const &element : mMatches.first()) {
+		elementChanged(element);
+	}
+
 	bool needToUpdate = createElements();
 	needToUpdate |= createElementsToReplace();
 
@@ -649,6 +758,10 @@ bool VisualInterpreterUnit::makeStep()
 
 	moveControlFlow();
 
+	for (Id const &element : mCreatedElementsPairs.values() + mReplacedElementsPairs.values()) {
+		elementChanged(element);
+	}
+
 	mMatches.clear();
 	return result;
 }
@@ -680,6 +793,11 @@ bool VisualInterpreterUnit::compareElementTypesAndProperties(Id const &first, Id
 	return BaseGraphTransformationUnit::compareElementTypesAndProperties(first, second);
 }
 
+bool VisualInterpreterUnit::isTypeWildcard(Id const &elementInRule) const
+{
+	return elementInRule.element() == "Wildcard";
+}
+
 Id VisualInterpreterUnit::nodeIdWithControlMark(Id const &controlMarkId) const
 {
 	IdList const outLinks = outgoingLinks(controlMarkId);
@@ -715,33 +833,3 @@ utils::ExpressionsParser* VisualInterpreterUnit::ruleParser()
 {
 	return mRuleParser;
 }
-
-void VisualInterpreterUnit::processTextCodeInterpreterStdOutput(QHash<QPair<QString, QString>, QString> const &output
-		, TextCodeInterpreter::CodeLanguage const language)
-{
-	QPair<QString, QString> pair;
-	for (pair : output.keys()) {
-		QString const elemName = pair.first;
-		QString const propName = pair.second;
-		QString value = output.value(pair);
-		if (value == "True" || value == "False") {
-			value = value.toLower();
-		}
-
-		Id elemId;
-		if (language == TextCodeInterpreter::python) {
-			elemId = mPythonGenerator->idByName(elemName);
-		} else {
-			elemId = mQtScriptGenerator->idByName(elemName);
-		}
-		setProperty(mMatches.first().value(elemId), propName, QString::fromUtf8(value.toLatin1()));
-	}
-
-	mPythonInterpreter->continueStep();
-}
-
-void VisualInterpreterUnit::processTextCodeInterpreterErrOutput(QString const &output)
-{
-	mInterpretersInterface.errorReporter()->addCritical(output);
-	mPythonInterpreter->continueStep();
-}
@@ -14,14 +14,17 @@
 
 #pragma once
 
+#include <QtCore/QAbstractItemModel>
+#include <QtCore/QSet>
+
 #include <qrgui/mainWindow/errorReporter.h>
 #include <qrgui/plugins/toolPluginInterface/usedInterfaces/mainWindowInterpretersInterface.h>
 #include <qrutils/graphUtils/baseGraphTransformationUnit.h>
 #include "textualPart/ruleParser.h"
 #include "textualPart/pythonGenerator.h"
-#include "textualPart/pythonInterpreter.h"
+#include "textualPart/pythonScriptHost.h"
 #include "textualPart/qtScriptGenerator.h"
-#include "textualPart/qtScriptInterpreter.h"
+#include "textualPart/qtScriptHost.h"
 
 namespace qReal {
 
@@ -54,11 +57,6 @@ public:
 	/// Get rule parser for watch list
 	utils::ExpressionsParser* ruleParser();
 
-private slots:
-	void processTextCodeInterpreterStdOutput(QHash<QPair<QString, QString>, QString> const &output
-			, TextCodeInterpreter::CodeLanguage const language);
-	void processTextCodeInterpreterErrOutput(QString const &output);
-
 protected:
 	/// For debug uses only
 	void highlightMatch();
@@ -75,6 +73,16 @@ protected:
 	/// Fields initialization before interpretation
 	void initBeforeInterpretation();
 
+	/// Subscribes to changes of logical and graphical models containing active diagram, so edits made by user
+	/// during pauses between steps are reported to incremental matching.
+	void watchModelsOfActiveDiagram();
+
+	/// Reports insertions, removals and modifications of elements of given model as elementChanged().
+	void watchModel(QAbstractItemModel const *model);
+
+	/// Reports elements in rows from first to last under given parent as changed.
+	void reportRowsChanged(QAbstractItemModel const &model, QModelIndex const &parent, int first, int last);
+
 	/// Checks current diagram for being semantics model
 	bool isSemanticsEditor() const;
 	
@@ -126,6 +134,17 @@ protected:
 	/// Interpret rule reaction written on QtScript
 	bool interpretQtScriptReaction();
 
+	/// Runs textual code in the given script host and reports its output and errors
+	ScriptHost::Result runScript(ScriptHost &host, ScriptHost::CodeType type, QString const &code
+			, QVariantMap const &values) const;
+
+	/// Writes changed values of variables after reaction to properties of matched elements
+	void applyScriptValues(TextCodeGenerator const &generator, QVariantMap const &oldValues
+			, QVariantMap const &newValues);
+
+	/// Ends sessions of script hosts
+	void stopScriptHosts() const;
+
 	/// Arranges connections between newly created elements
 	void arrangeConnections();
 
@@ -153,6 +172,7 @@ protected:
 	/// Functions for test elements for equality
 	bool compareElements(Id const &first, Id const &second) const;
 	bool compareElementTypesAndProperties(Id const &first, Id const &second) const;
+	bool isTypeWildcard(Id const &elementInRule) const;
 
 	/// Logical repo api methods for more quick access
 	IdList linksInRule(Id const &id) const;
@@ -199,10 +219,13 @@ protected:
 	RuleParser *mRuleParser;
 
 	PythonGenerator *mPythonGenerator;
-	PythonInterpreter *mPythonInterpreter;
+	PythonScriptHost *mPythonHost;  // Has ownership
 
 	QtScriptGenerator *mQtScriptGenerator;
-	QtScriptInterpreter *mQtScriptInterpreter;
+	QtScriptHost *mQtScriptHost;  // Has ownership
+
+	/// Models whose changes are already reported to incremental matching.
+	QSet<QAbstractItemModel const *> mWatchedModels;
 };
 
 }
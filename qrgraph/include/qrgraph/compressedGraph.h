@@ -0,0 +1,108 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QHash>
+#include <QtCore/QVector>
+
+#include "qrgraph/multigraph.h"
+
+namespace qrgraph {
+
+/// Frozen snapshot of multigraph edges of one type in compressed sparse row form. Vertices get dense indices
+/// in order of Multigraph::vertices(), successors and predecessors of each vertex are stored in contiguous
+/// arrays, so traversals do not touch hashes of nodes and do not allocate per step. Hanging edges are not included.
+/// The view does not follow modifications of the multigraph, use isActual() to check whether it should be rebuilt.
+class CompressedGraph
+{
+public:
+	/// Contiguous range of vertex indices, adjacent to some vertex.
+	class Range
+	{
+	public:
+		Range(const int *begin, const int *end)
+			: mBegin(begin)
+			, mEnd(end)
+		{
+		}
+
+		const int *begin() const { return mBegin; }
+		const int *end() const { return mEnd; }
+		int size() const { return static_cast<int>(mEnd - mBegin); }
+		bool isEmpty() const { return mBegin == mEnd; }
+
+	private:
+		const int *mBegin;
+		const int *mEnd;
+	};
+
+	/// Builds a view of edges of \a edgeType in \a graph, takes O(V + E) time.
+	CompressedGraph(const Multigraph &graph, uint edgeType);
+
+	/// Returns a multigraph this view was built from.
+	const Multigraph &graph() const;
+
+	/// Returns the type of edges contained in this view.
+	uint edgeType() const;
+
+	/// Returns true if the multigraph was not modified since this view was built.
+	bool isActual() const;
+
+	/// Returns a number of vertices, they have indices from 0 to verticesCount() - 1.
+	int verticesCount() const;
+
+	/// Returns a number of edges in this view, loops and parallel edges are counted separately.
+	int edgesCount() const;
+
+	/// Returns dense index of \a node or -1 if it was not in the multigraph when the view was built.
+	int index(const Node &node) const;
+
+	/// Returns a vertex with the given dense index.
+	const Node &node(int index) const;
+
+	/// Returns indices of ends of edges going out of the vertex with index \a vertex. Parallel edges produce
+	/// repeating indices.
+	Range successors(int vertex) const;
+
+	/// Returns indices of begins of edges going into the vertex with index \a vertex. Parallel edges produce
+	/// repeating indices.
+	Range predecessors(int vertex) const;
+
+	/// Returns edge that corresponds to the position \a position in successors array, position is in
+	/// [successorsOffset(vertex), successorsOffset(vertex + 1)).
+	const Edge &outgoingEdge(int position) const;
+
+	/// Returns position of the first successor of \a vertex in the whole successors array.
+	int successorsOffset(int vertex) const;
+
+private:
+	const Multigraph &mGraph;
+	const uint mEdgeType;
+	const int mRevision;
+
+	QVector<const Node *> mNodes;
+	QHash<const Node *, int> mIndices;
+
+	/// Successors of vertex i are mSuccessors[mOutOffsets[i] .. mOutOffsets[i + 1]).
+	QVector<int> mOutOffsets;
+	QVector<int> mSuccessors;
+	QVector<const Edge *> mOutgoingEdges;
+
+	/// Predecessors of vertex i are mPredecessors[mInOffsets[i] .. mInOffsets[i + 1]).
+	QVector<int> mInOffsets;
+	QVector<int> mPredecessors;
+};
+
+}
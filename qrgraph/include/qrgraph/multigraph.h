@@ -50,6 +50,10 @@ public:
 	/// Removes a number of edges of a given type in multigraph.
 	int edgesCount(uint type) const;
 
+	/// Returns a counter that changes each time vertices or edges are added, removed, connected or disconnected.
+	/// Used to find out if views built over this multigraph are still actual.
+	int revision() const;
+
 	/// Removes all nodes and edges from multigraph, frees their memory.
 	void clear();
 
@@ -93,8 +97,14 @@ public:
 	void removeEdge(Edge &edge);
 
 private:
+	/// Called by this class and by edges when structure of multigraph changes.
+	void touch();
+
 	QList<Node *> mNodes;
 	QMultiHash<uint, Edge *> mEdges;
+	int mRevision = 0;
+
+	friend class qrgraph::Edge;
 };
 
 }
@@ -17,6 +17,7 @@
 #include <functional>
 
 #include "qrgraph/multigraph.h"
+#include "qrgraph/compressedGraph.h"
 
 namespace qrgraph {
 
@@ -86,6 +87,30 @@ public:
 	/// It is guaranteed that each node will be met in resulting set not more that once.
 	/// @note \a node will be always included into resulting set. The implementation uses deep-first-search traversal.
 	static QList<const Node *> reachableSet(const Node &node, uint edgeType);
+
+	/// Traverses \a graph starting from vertex with index \a start by deep-first-search method calling \a processor
+	/// for each visited vertex index, in preorder. Traversal terminates as soon as \a processor returns true.
+	/// @returns True if \a processor returned true for some vertex or false otherwise.
+	/// @note Unlike dfs() on multigraph this implementation is not recursive and uses a single bit per vertex.
+	static bool dfs(const CompressedGraph &graph, int start, const std::function<bool(int vertex)> &processor);
+
+	/// Returns true if vertex with index \a to is reachable from vertex with index \a from in \a graph.
+	/// Vertex is always reachable from itself.
+	static bool isReachable(const CompressedGraph &graph, int from, int to);
+
+	/// Returns indices of vertices reachable from \a start in \a graph in deep-first-search preorder,
+	/// \a start is always the first one.
+	static QVector<int> reachableSet(const CompressedGraph &graph, int start);
+
+	/// Returns indices of all vertices of \a graph ordered so that each edge goes from earlier vertex to later one.
+	/// If there is no such order because \a graph has a cycle (loops included) then empty vector is returned.
+	static QVector<int> topologicalOrder(const CompressedGraph &graph);
+
+	/// Computes immediate dominators of vertices reachable from \a root using the iterative algorithm by
+	/// Cooper, Harvey and Kennedy.
+	/// @returns Vector where i-th element is the index of immediate dominator of vertex i, \a root dominates
+	/// itself and vertices unreachable from \a root have -1.
+	static QVector<int> immediateDominators(const CompressedGraph &graph, int root);
 };
 
 }
@@ -0,0 +1,122 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "qrgraph/compressedGraph.h"
+
+using namespace qrgraph;
+
+CompressedGraph::CompressedGraph(const Multigraph &graph, uint edgeType)
+	: mGraph(graph)
+	, mEdgeType(edgeType)
+	, mRevision(graph.revision())
+{
+	const QList<Node *> &vertices = graph.vertices();
+	const int verticesCount = vertices.count();
+	mNodes.reserve(verticesCount);
+	mIndices.reserve(verticesCount);
+	for (const Node *node : vertices) {
+		mIndices.insert(node, mNodes.count());
+		mNodes << node;
+	}
+
+	// Outgoing edges are appended vertex by vertex, so their offsets are known immediately. Incoming ones are
+	// only counted here and then placed with counting sort over the successors array.
+	mOutOffsets.reserve(verticesCount + 1);
+	mInOffsets.fill(0, verticesCount + 1);
+	mSuccessors.reserve(graph.edgesCount(edgeType));
+	mOutgoingEdges.reserve(graph.edgesCount(edgeType));
+	for (const Node *node : vertices) {
+		mOutOffsets << mSuccessors.count();
+		const QList<Edge *> edges = node->outgoingEdges(edgeType);
+		for (const Edge *edge : edges) {
+			const int end = edge->end() ? mIndices.value(edge->end(), -1) : -1;
+			if (end >= 0) {
+				mSuccessors << end;
+				mOutgoingEdges << edge;
+				++mInOffsets[end + 1];
+			}
+		}
+	}
+
+	mOutOffsets << mSuccessors.count();
+
+	for (int i = 0; i < verticesCount; ++i) {
+		mInOffsets[i + 1] += mInOffsets[i];
+	}
+
+	QVector<int> positions = mInOffsets;
+	mPredecessors.resize(mSuccessors.count());
+	for (int begin = 0; begin < verticesCount; ++begin) {
+		for (int i = mOutOffsets[begin]; i < mOutOffsets[begin + 1]; ++i) {
+			mPredecessors[positions[mSuccessors[i]]++] = begin;
+		}
+	}
+}
+
+const Multigraph &CompressedGraph::graph() const
+{
+	return mGraph;
+}
+
+uint CompressedGraph::edgeType() const
+{
+	return mEdgeType;
+}
+
+bool CompressedGraph::isActual() const
+{
+	return mGraph.revision() == mRevision;
+}
+
+int CompressedGraph::verticesCount() const
+{
+	return mNodes.count();
+}
+
+int CompressedGraph::edgesCount() const
+{
+	return mSuccessors.count();
+}
+
+int CompressedGraph::index(const Node &node) const
+{
+	return mIndices.value(&node, -1);
+}
+
+const Node &CompressedGraph::node(int index) const
+{
+	return *mNodes[index];
+}
+
+CompressedGraph::Range CompressedGraph::successors(int vertex) const
+{
+	const int *data = mSuccessors.constData();
+	return Range(data + mOutOffsets[vertex], data + mOutOffsets[vertex + 1]);
+}
+
+CompressedGraph::Range CompressedGraph::predecessors(int vertex) const
+{
+	const int *data = mPredecessors.constData();
+	return Range(data + mInOffsets[vertex], data + mInOffsets[vertex + 1]);
+}
+
+const Edge &CompressedGraph::outgoingEdge(int position) const
+{
+	return *mOutgoingEdges[position];
+}
+
+int CompressedGraph::successorsOffset(int vertex) const
+{
+	return mOutOffsets[vertex];
+}
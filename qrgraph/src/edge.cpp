@@ -57,12 +57,14 @@ void Edge::connectBegin(Node &node)
 	disconnectBegin();
 	node.connectBeginOf(*this);
 	mBegin = &node;
+	mParent.touch();
 }
 
 void Edge::connectEnd(Node &node)
 {
 	node.connectEndOf(*this);
 	mEnd = &node;
+	mParent.touch();
 }
 
 void Edge::connect(Node &begin, Node &end)
@@ -76,6 +78,7 @@ void Edge::disconnectBegin()
 	if (mBegin) {
 		mBegin->disconnectBeginOf(*this);
 		mBegin = nullptr;
+		mParent.touch();
 	}
 }
 
@@ -84,6 +87,7 @@ void Edge::disconnectEnd()
 	if (mEnd) {
 		mEnd->disconnectEndOf(*this);
 		mEnd = nullptr;
+		mParent.touch();
 	}
 }
 
@@ -60,6 +60,16 @@ int Multigraph::edgesCount(uint type) const
 	return mEdges.count(type);
 }
 
+int Multigraph::revision() const
+{
+	return mRevision;
+}
+
+void Multigraph::touch()
+{
+	++mRevision;
+}
+
 void Multigraph::clear()
 {
 	// qDeleteAll cannot be used here because Node and Edge types have protected desctuctor.
@@ -73,12 +83,14 @@ void Multigraph::clear()
 
 	mNodes.clear();
 	mEdges.clear();
+	touch();
 }
 
 Node &Multigraph::produceNode()
 {
 	Node * const node = new Node(*this);
 	mNodes << node;
+	touch();
 	return *node;
 }
 
@@ -89,12 +101,14 @@ void Multigraph::addNode(Node *node)
 	}
 
 	mNodes << node;
+	touch();
 }
 
 Edge &Multigraph::produceEdge(uint type)
 {
 	Edge * const edge = new Edge(*this, type);
 	mEdges.insert(type, edge);
+	touch();
 	return *edge;
 }
 
@@ -119,6 +133,7 @@ void Multigraph::addEdge(Edge &edge)
 	}
 
 	mEdges.insert(edge.type(), &edge);
+	touch();
 }
 
 void Multigraph::removeNode(Node &node, bool deleteHangingEdges)
@@ -127,6 +142,7 @@ void Multigraph::removeNode(Node &node, bool deleteHangingEdges)
 	node.disconnectAll(deleteHangingEdges);
 	mNodes.removeAll(&node);
 	delete &node;
+	touch();
 }
 
 void Multigraph::removeEdge(Edge &edge)
@@ -134,4 +150,5 @@ void Multigraph::removeEdge(Edge &edge)
 	Q_ASSERT_X(mEdges.contains(edge.type(), &edge), Q_FUNC_INFO, "Attepmt to remove nonexisting edge");
 	mEdges.remove(edge.type(), &edge);
 	delete &edge;
+	touch();
 }
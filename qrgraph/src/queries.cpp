@@ -149,3 +149,158 @@ QList<const Node *> Queries::reachableSet(const Node &node, uint edgeType)
 	::dfs(node, [](const Node &) {return false;}, edgeType, &result);
 	return result.values();
 }
+
+/// Iterative deep-first-search over compressed graph, \a enter is called in preorder and may stop traversal
+/// by returning true, \a leave is called in postorder.
+static bool compressedDfs(const CompressedGraph &graph, int start, QVector<bool> &visited
+		, const std::function<bool(int vertex)> &enter, const std::function<void(int vertex)> &leave)
+{
+	struct Frame
+	{
+		int vertex;
+		const int *next;
+		const int *end;
+	};
+
+	QVector<Frame> stack;
+	auto visit = [&](int vertex) {
+		visited[vertex] = true;
+		if (enter && enter(vertex)) {
+			return true;
+		}
+
+		const CompressedGraph::Range successors = graph.successors(vertex);
+		stack.append({vertex, successors.begin(), successors.end()});
+		return false;
+	};
+
+	if (visited[start]) {
+		return false;
+	}
+
+	if (visit(start)) {
+		return true;
+	}
+
+	while (!stack.isEmpty()) {
+		Frame &top = stack.last();
+		if (top.next == top.end) {
+			if (leave) {
+				leave(top.vertex);
+			}
+
+			stack.removeLast();
+			continue;
+		}
+
+		const int next = *top.next++;
+		if (!visited[next] && visit(next)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool Queries::dfs(const CompressedGraph &graph, int start, const std::function<bool (int)> &processor)
+{
+	QVector<bool> visited(graph.verticesCount(), false);
+	return compressedDfs(graph, start, visited, processor, nullptr);
+}
+
+bool Queries::isReachable(const CompressedGraph &graph, int from, int to)
+{
+	return dfs(graph, from, [to](int vertex) {return vertex == to;});
+}
+
+QVector<int> Queries::reachableSet(const CompressedGraph &graph, int start)
+{
+	QVector<int> result;
+	dfs(graph, start, [&result](int vertex) {
+		result << vertex;
+		return false;
+	});
+
+	return result;
+}
+
+QVector<int> Queries::topologicalOrder(const CompressedGraph &graph)
+{
+	const int count = graph.verticesCount();
+	QVector<int> incomingCount(count);
+	QVector<int> result;
+	result.reserve(count);
+	for (int vertex = 0; vertex < count; ++vertex) {
+		incomingCount[vertex] = graph.predecessors(vertex).size();
+		if (incomingCount[vertex] == 0) {
+			result << vertex;
+		}
+	}
+
+	// The result itself serves as a queue of vertices without unprocessed incoming edges.
+	for (int i = 0; i < result.count(); ++i) {
+		for (const int successor : graph.successors(result[i])) {
+			if (--incomingCount[successor] == 0) {
+				result << successor;
+			}
+		}
+	}
+
+	if (result.count() != count) {
+		// Vertices on cycles never lose all their incoming edges.
+		result.clear();
+	}
+
+	return result;
+}
+
+QVector<int> Queries::immediateDominators(const CompressedGraph &graph, int root)
+{
+	const int count = graph.verticesCount();
+	QVector<bool> visited(count, false);
+	QVector<int> postorder;
+	QVector<int> postorderIndex(count, -1);
+	compressedDfs(graph, root, visited, nullptr, [&postorder, &postorderIndex](int vertex) {
+		postorderIndex[vertex] = postorder.count();
+		postorder << vertex;
+	});
+
+	QVector<int> result(count, -1);
+	result[root] = root;
+
+	auto intersect = [&result, &postorderIndex](int first, int second) {
+		while (first != second) {
+			while (postorderIndex[first] < postorderIndex[second]) {
+				first = result[first];
+			}
+
+			while (postorderIndex[second] < postorderIndex[first]) {
+				second = result[second];
+			}
+		}
+
+		return first;
+	};
+
+	bool changed = true;
+	while (changed) {
+		changed = false;
+		// Reverse postorder without the root, which is the last one in postorder.
+		for (int i = postorder.count() - 2; i >= 0; --i) {
+			const int vertex = postorder[i];
+			int dominator = -1;
+			for (const int predecessor : graph.predecessors(vertex)) {
+				if (result[predecessor] != -1) {
+					dominator = dominator == -1 ? predecessor : intersect(predecessor, dominator);
+				}
+			}
+
+			if (result[vertex] != dominator) {
+				result[vertex] = dominator;
+				changed = true;
+			}
+		}
+	}
+
+	return result;
+}
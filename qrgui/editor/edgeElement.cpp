@@ -140,6 +140,7 @@ void EdgeElement::setLine(const QPolygonF &line)
 	saveConfiguration();
 	update();
 	updateLongestPart();
+	notifyGeometryChanged();
 }
 
 qreal EdgeElement::fromPort() const
@@ -748,6 +749,8 @@ void EdgeElement::breakPointHandler(const QPointF &pos)
 		mLine.insert(mLine.size() - 1, pos);
 		mDragType = mLine.size() - 1;
 	}
+
+	notifyGeometryChanged();
 }
 
 EdgeElement::NodeSide EdgeElement::defineNodePortSide(bool isStart) const
@@ -884,6 +887,7 @@ void EdgeElement::updateData()
 	update();
 	updateLongestPart();
 	highlight(isHanging() ? Qt::red : mPenColor);
+	notifyGeometryChanged();
 }
 
 void EdgeElement::removeLink(const NodeElement *from)
@@ -914,6 +918,7 @@ QStringList EdgeElement::toPortTypes() const
 void EdgeElement::placeStartTo(const QPointF &place)
 {
 	mLine[0] = place;
+	notifyGeometryChanged();
 }
 
 void EdgeElement::placeEndTo(const QPointF &place)
@@ -927,6 +932,7 @@ void EdgeElement::placeEndTo(const QPointF &place)
 	mGraphicalAssistApi.setPosition(id(), this->pos());
 
 	updateLongestPart();
+	notifyGeometryChanged();
 }
 
 void EdgeElement::moveConnection(NodeElement *node, const qreal portId)
@@ -978,6 +984,7 @@ QVariant EdgeElement::itemChange(GraphicsItemChange change, const QVariant &valu
 	switch (change)
 	{
 		case ItemPositionHasChanged:
+			notifyGeometryChanged();
 			if (mIsLoop) {
 				return value;
 			}
@@ -996,6 +1003,13 @@ QVariant EdgeElement::itemChange(GraphicsItemChange change, const QVariant &valu
 
 			updateLongestPart();
 			return value;
+		case ItemVisibleHasChanged:
+		case ItemSceneHasChanged:
+			notifyGeometryChanged();
+			return QGraphicsItem::itemChange(change, value);
+		case ItemSceneChange:
+			notifyRemoved();
+			return QGraphicsItem::itemChange(change, value);
 		default:
 			return QGraphicsItem::itemChange(change, value);
 	}
@@ -1056,6 +1070,7 @@ void EdgeElement::alignToGrid()
 	prepareGeometryChange();
 	mHandler->alignToGrid();
 	updateLongestPart();
+	notifyGeometryChanged();
 }
 
 
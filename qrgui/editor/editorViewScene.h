@@ -187,6 +187,13 @@ signals:
 		, const EditorManagerInterface *editorManagerProxy
 		, bool useTypedPorts);
 
+	/// Emitted when an element was added to the scene, moved, reshaped, shown or hidden.
+	void elementGeometryChanged(const QGraphicsItem *element);
+
+	/// Emitted when an element leaves the scene or is destroyed. The element may be partially destroyed already,
+	/// so it must be used only as a key.
+	void elementRemoved(const QGraphicsItem *element);
+
 protected:
 	void dragEnterEvent(QGraphicsSceneDragDropEvent *event) override;
 	void dragMoveEvent(QGraphicsSceneDragDropEvent *event) override;
@@ -23,6 +23,7 @@
 #include <qrgui/models/commands/changePropertyCommand.h>
 
 #include "qrgui/editor/labels/label.h"
+#include "qrgui/editor/editorViewScene.h"
 
 using namespace qReal;
 using namespace qReal::gui::editor;
@@ -50,6 +51,12 @@ Element::Element(const ElementType &elementType, const Id &id, const models::Mod
 	SettingsListener::listen("hideNonHardLabels", this, &Element::setHideNonHardLabels);
 }
 
+Element::~Element()
+{
+	// Items are removed from the scene by QGraphicsItem destructor without calling itemChange().
+	notifyRemoved();
+}
+
 Id Element::id() const
 {
 	return mId;
@@ -182,6 +189,21 @@ void Element::setHideNonHardLabels(bool hide)
 	}
 }
 
+void Element::notifyGeometryChanged()
+{
+	if (EditorViewScene * const editorScene = dynamic_cast<EditorViewScene *>(scene())) {
+		emit editorScene->elementGeometryChanged(this);
+	}
+}
+
+void Element::notifyRemoved()
+{
+	// Scene that is being destroyed is not an EditorViewScene any more, nobody needs to know about its items.
+	if (EditorViewScene * const editorScene = dynamic_cast<EditorViewScene *>(scene())) {
+		emit editorScene->elementRemoved(this);
+	}
+}
+
 void Element::keyPressEvent(QKeyEvent *event)
 {
 	if (event->key() == Qt::Key_F2) {
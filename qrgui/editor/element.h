@@ -51,7 +51,7 @@ public:
 	/// @param type - reference to type descriptor of the element. Takes ownership.
 	Element(const ElementType &type, const Id &id, const models::Models &models);
 
-	virtual ~Element() override = default;
+	virtual ~Element() override;
 
 	void initEmbeddedControls();
 
@@ -88,6 +88,13 @@ public:
 protected:
 	void setHideNonHardLabels(bool visible);
 
+	/// Tells the scene that the element was added, moved, reshaped, shown or hidden, so views that show
+	/// simplified pictures of the diagram can update only affected areas.
+	void notifyGeometryChanged();
+
+	/// Tells the scene that the element leaves it.
+	void notifyRemoved();
+
 	void keyPressEvent(QKeyEvent *event) override;
 
 	bool mMoving;
@@ -280,6 +280,7 @@ void NodeElement::setGeometry(const QRectF &geom)
 	mTransform.reset();
 	mTransform.scale(mContents.width(), mContents.height());
 	adjustLinks();
+	notifyGeometryChanged();
 }
 
 void NodeElement::setPos(const QPointF &pos)
@@ -810,6 +811,7 @@ QVariant NodeElement::itemChange(GraphicsItemChange change, const QVariant &valu
 		}
 
 		adjustLinks();
+		notifyGeometryChanged();
 		return value;
 
 	case ItemChildAddedChange:
@@ -837,8 +839,17 @@ QVariant NodeElement::itemChange(GraphicsItemChange change, const QVariant &valu
 		return QGraphicsItem::itemChange(change, value);
 	}
 
+	case ItemVisibleHasChanged:
+		notifyGeometryChanged();
+		return QGraphicsItem::itemChange(change, value);
+
+	case ItemSceneChange:
+		notifyRemoved();
+		return QGraphicsItem::itemChange(change, value);
+
 	case ItemSceneHasChanged: {
 		connectSceneEvents();
+		notifyGeometryChanged();
 		return QGraphicsItem::itemChange(change, value);
 	}
 
@@ -44,6 +44,7 @@ HEADERS += \
 	$$PWD/tabWidget.h \
 	$$PWD/modelExplorer.h \
 	$$PWD/miniMap.h \
+	$$PWD/miniMapTileCache.h \
 	$$PWD/referenceList.h \
 	$$PWD/externBrowser.h \
 	$$PWD/projectManager/projectManagerWrapper.h \
@@ -69,6 +70,7 @@ SOURCES += \
 	$$PWD/splashScreen.cpp \
 	$$PWD/tabWidget.cpp \
 	$$PWD/miniMap.cpp \
+	$$PWD/miniMapTileCache.cpp \
 	$$PWD/modelExplorer.cpp \
 	$$PWD/referenceList.cpp \
 	$$PWD/projectManager/projectManagerWrapper.cpp \
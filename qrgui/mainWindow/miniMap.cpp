@@ -14,11 +14,28 @@
 
 #include "miniMap.h"
 
+#include <QtWidgets/QApplication>
+#include <QtWidgets/QScrollBar>
+
+#include "editor/edgeElement.h"
+#include "editor/nodeElement.h"
+
+using namespace qReal::gui::editor;
+
+/// Delay of applying scene changes to the minimap, in milliseconds.
+static const int updateInterval = 100;
+
+/// Delay of applying scene changes while mouse button is pressed, items are likely being dragged.
+static const int dragUpdateInterval = 300;
+
 MiniMap::MiniMap(QWidget *parent)
 		: QGraphicsView(parent)
 		, mEditorView(nullptr)
 		, mMode(None)
+		, mTiles(&MiniMap::outline)
 {
+	mUpdateTimer.setSingleShot(true);
+	connect(&mUpdateTimer, &QTimer::timeout, this, &MiniMap::applyChanges);
 }
 
 void MiniMap::init(qReal::MainWindow *window)
@@ -50,24 +67,72 @@ void MiniMap::setCurrentScene()
 	}
 
 	setScene(mEditorView->scene());
-	// can affect zoom - need to change it if we make another desision about it
-	connect(mEditorView->scene(), SIGNAL(sceneRectChanged(QRectF)), this, SLOT(showScene()));
+
+	// Main view scrolling does not change the scene, but moves the rectangle of visible area.
+	const auto update = static_cast<void (QWidget::*)()>(&QWidget::update);
+	connect(mEditorView->horizontalScrollBar(), &QScrollBar::valueChanged, viewport(), update, Qt::UniqueConnection);
+	connect(mEditorView->verticalScrollBar(), &QScrollBar::valueChanged, viewport(), update, Qt::UniqueConnection);
 }
 
 void MiniMap::setScene(QGraphicsScene *scene)
 {
-	QGraphicsView::setScene(scene);
+	if (mSource) {
+		disconnect(mSource, nullptr, this, nullptr);
+	}
+
+	mSource = scene;
+	mTiles.setSource(scene);
+	mUpdateTimer.stop();
+	if (scene) {
+		// can affect zoom - need to change it if we make another desision about it
+		connect(scene, &QGraphicsScene::sceneRectChanged, this, &MiniMap::showScene);
+	}
+
+	// Listening to QGraphicsScene::changed() instead would make the scene collect and report every updated area,
+	// disabling its own update optimizations, and would not tell which items have changed.
+	if (EditorViewScene * const editorScene = dynamic_cast<EditorViewScene *>(scene)) {
+		connect(editorScene, &EditorViewScene::elementGeometryChanged, this, &MiniMap::onElementGeometryChanged);
+		connect(editorScene, &EditorViewScene::elementRemoved, this, &MiniMap::onElementRemoved);
+	}
+
+	QGraphicsView::setScene(scene ? &mProxyScene : nullptr);
 	showScene();
 }
 
 void MiniMap::showScene()
 {
-	if (scene() != nullptr) {
-		setSceneRect(scene()->sceneRect());
+	if (mSource) {
+		setSceneRect(mSource->sceneRect());
 		fitInView(sceneRect(), Qt::KeepAspectRatio);
 	}
 }
 
+void MiniMap::onElementGeometryChanged(const QGraphicsItem *element)
+{
+	mTiles.itemChanged(element);
+	scheduleUpdate();
+}
+
+void MiniMap::onElementRemoved(const QGraphicsItem *element)
+{
+	mTiles.itemRemoved(element);
+	scheduleUpdate();
+}
+
+void MiniMap::scheduleUpdate()
+{
+	if (!mUpdateTimer.isActive()) {
+		mUpdateTimer.start(QApplication::mouseButtons() == Qt::NoButton ? updateInterval : dragUpdateInterval);
+	}
+}
+
+void MiniMap::applyChanges()
+{
+	for (const QRectF &rect : mTiles.synchronize()) {
+		viewport()->update(mapFromScene(rect).boundingRect().adjusted(-1, -1, 1, 1));
+	}
+}
+
 void MiniMap::ensureVisible(const QList<QRectF> &region)
 {
 	for (const auto &rect : region) {
@@ -81,6 +146,19 @@ void MiniMap::clear()
 	mEditorView = nullptr;
 }
 
+QPolygonF MiniMap::outline(const QGraphicsItem &item)
+{
+	if (const NodeElement * const node = dynamic_cast<const NodeElement *>(&item)) {
+		QPolygonF result = node->mapToScene(node->contentsRect());
+		result << result.first();
+		return result;
+	} else if (const EdgeElement * const edge = dynamic_cast<const EdgeElement *>(&item)) {
+		return edge->mapToScene(edge->line());
+	}
+
+	return QPolygonF();
+}
+
 QRectF MiniMap::getNewRect()
 {
 	QRect visibleRect = mEditorView->viewport()->rect();
@@ -128,6 +206,13 @@ void MiniMap::resizeEvent(QResizeEvent *event)
 	QGraphicsView::resizeEvent(event);
 }
 
+void MiniMap::drawBackground(QPainter *painter, const QRectF &rect)
+{
+	QGraphicsView::drawBackground(painter, rect);
+	mTiles.setScale(transform().m11());
+	mTiles.draw(painter, rect);
+}
+
 void MiniMap::drawForeground(QPainter *painter, const QRectF &rect)
 {
 	QGraphicsView::drawForeground(painter, rect);
@@ -15,17 +15,24 @@
 #pragma once
 
 #include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QTimer>
 #include <QtWidgets/QGraphicsView>
 
 #include "editor/editorView.h"
 #include "editor/editorViewScene.h"
 #include "mainWindow/mainWindow.h"
+#include "mainWindow/miniMapTileCache.h"
 
 /** @brief Minimap for the current viewed diagram
 *
 * Displays the scene of current diagram. The area of the scene, visible in the
 * EditorView, displayed on the minimap as a rectangle. Navigation on the scene is possible
 * by moving that rectangle with mouse.
+*
+* Diagram items are not painted by the minimap directly, it shows cached low-resolution tiles instead
+* (see MiniMapTileCache) and re-renders only tiles touched by elements the editor scene reports changed.
+* Reports are applied not more often than once in a while, especially when the user drags something.
 */
 
 class MiniMap : public QGraphicsView
@@ -54,18 +61,32 @@ protected:
 	void mouseReleaseEvent(QMouseEvent *event);
 	void resizeEvent(QResizeEvent *event);
 
+	void drawBackground(QPainter *painter, const QRectF &rect);
 	void drawForeground(QPainter *painter, const QRectF &rect);
 	/// painting out the areas which aren't to be painted on the minimap (not in the scene rect)
 	void drawNonExistentAreas(QPainter *painter, const QRectF &rect);
 	/// @return list of areas visible on the minimap but not included in the scene rectangle
 	QList<QRectF> getNonExistentAreas(const QRectF &rect);
 
+private slots:
+	void onElementGeometryChanged(const QGraphicsItem *element);
+	void onElementRemoved(const QGraphicsItem *element);
+
+	/// Requests applying changes of items after a delay, unless it is already requested.
+	void scheduleUpdate();
+
+	/// Drops cached tiles where items changed and repaints them.
+	void applyChanges();
+
 private:
 	void setCurrentScene();
 	void clear();
 	/// @return a rectangle of the scene which is viewed in the editor view
 	QRectF getNewRect();
 
+	/// Simplified picture of an element for tiles: nodes are closed boxes, edges are polylines.
+	static QPolygonF outline(const QGraphicsItem &item);
+
 	qReal::MainWindow *mWindow {};
 
 	qReal::gui::editor::EditorView *mEditorView;
@@ -73,4 +94,13 @@ private:
 	QRectF mEditorViewRect;
 
 	Mode mMode;
+
+	/// Diagram scene displayed on the minimap. The view itself is attached to the empty mProxyScene,
+	/// so it does not paint diagram items.
+	QPointer<QGraphicsScene> mSource;
+	QGraphicsScene mProxyScene;
+
+	MiniMapTileCache mTiles;
+
+	QTimer mUpdateTimer;
 };
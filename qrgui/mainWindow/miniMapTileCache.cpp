@@ -0,0 +1,219 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "miniMapTileCache.h"
+
+#include <QtCore/QtMath>
+#include <QtGui/QPainter>
+#include <QtWidgets/QGraphicsItem>
+#include <QtWidgets/QGraphicsScene>
+
+/// Size of a tile side in minimap pixels.
+static const int tileSize = 128;
+
+static quint64 tileKey(int column, int row)
+{
+	return (static_cast<quint64>(static_cast<quint32>(column)) << 32) | static_cast<quint32>(row);
+}
+
+/// Returns the area occupied by an outline, straight horizontal and vertical edges get non-empty one.
+static QRectF outlineArea(const QPolygonF &outline)
+{
+	return outline.boundingRect().adjusted(-1, -1, 1, 1);
+}
+
+MiniMapTileCache::MiniMapTileCache(const Outline &outline)
+	: mOutline(outline)
+{
+}
+
+void MiniMapTileCache::setSource(QGraphicsScene *scene)
+{
+	mSource = scene;
+	mOutlines.clear();
+	mChangedItems.clear();
+	mChangedAreas.clear();
+	clear();
+}
+
+void MiniMapTileCache::setScale(qreal scale)
+{
+	if (!qFuzzyCompare(scale, mScale) && scale > 0) {
+		mScale = scale;
+		clear();
+	}
+}
+
+void MiniMapTileCache::invalidate(const QRectF &sceneRect)
+{
+	if (mTiles.isEmpty()) {
+		return;
+	}
+
+	const QRect range = tiles(sceneRect);
+	for (int column = range.left(); column <= range.right(); ++column) {
+		for (int row = range.top(); row <= range.bottom(); ++row) {
+			mTiles.remove(tileKey(column, row));
+		}
+	}
+}
+
+void MiniMapTileCache::clear()
+{
+	mTiles.clear();
+}
+
+void MiniMapTileCache::draw(QPainter *painter, const QRectF &exposed)
+{
+	if (!mSource) {
+		return;
+	}
+
+	const QRect range = tiles(exposed.intersected(mSource->sceneRect()));
+	for (int column = range.left(); column <= range.right(); ++column) {
+		for (int row = range.top(); row <= range.bottom(); ++row) {
+			const quint64 key = tileKey(column, row);
+			auto tile = mTiles.find(key);
+			if (tile == mTiles.end()) {
+				tile = mTiles.insert(key, renderTile(column, row));
+			}
+
+			painter->drawPixmap(tileRect(column, row), tile.value(), QRectF(tile.value().rect()));
+		}
+	}
+}
+
+void MiniMapTileCache::itemChanged(const QGraphicsItem *item)
+{
+	if (item) {
+		mChangedItems.insert(item);
+	}
+}
+
+void MiniMapTileCache::itemRemoved(const QGraphicsItem *item)
+{
+	mChangedItems.remove(item);
+	invalidateOutline(mOutlines.take(item));
+}
+
+QList<QRectF> MiniMapTileCache::synchronize()
+{
+	if (mSource) {
+		for (const QGraphicsItem * const item : mChangedItems) {
+			if (item->scene() == mSource) {
+				refresh(*item);
+			}
+		}
+	}
+
+	mChangedItems.clear();
+	QList<QRectF> result;
+	result.swap(mChangedAreas);
+	return result;
+}
+
+void MiniMapTileCache::refresh(const QGraphicsItem &item)
+{
+	const QPolygonF previous = mOutlines.take(&item);
+	const QPolygonF current = item.isVisible() ? mOutline(item) : QPolygonF();
+	if (previous != current) {
+		invalidateOutline(previous);
+		invalidateOutline(current);
+	}
+
+	if (!current.isEmpty()) {
+		mOutlines.insert(&item, current);
+	}
+
+	for (const QGraphicsItem * const child : item.childItems()) {
+		refresh(*child);
+	}
+}
+
+bool MiniMapTileCache::isPending(const QGraphicsItem *item) const
+{
+	for (; item; item = item->parentItem()) {
+		if (mChangedItems.contains(item)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void MiniMapTileCache::invalidateOutline(const QPolygonF &outline)
+{
+	if (!outline.isEmpty()) {
+		mChangedAreas << outlineArea(outline);
+		invalidate(mChangedAreas.last());
+	}
+}
+
+QRect MiniMapTileCache::tiles(const QRectF &sceneRect) const
+{
+	if (sceneRect.isEmpty()) {
+		return QRect();
+	}
+
+	const qreal sceneTileSize = tileSize / mScale;
+	return QRect(QPoint(qFloor(sceneRect.left() / sceneTileSize), qFloor(sceneRect.top() / sceneTileSize))
+			, QPoint(qFloor(sceneRect.right() / sceneTileSize), qFloor(sceneRect.bottom() / sceneTileSize)));
+}
+
+QRectF MiniMapTileCache::tileRect(int column, int row) const
+{
+	const qreal sceneTileSize = tileSize / mScale;
+	return QRectF(column * sceneTileSize, row * sceneTileSize, sceneTileSize, sceneTileSize);
+}
+
+QPixmap MiniMapTileCache::renderTile(int column, int row)
+{
+	QPixmap result(tileSize, tileSize);
+	result.fill(Qt::transparent);
+
+	const QRectF area = tileRect(column, row);
+	QPainter painter(&result);
+	painter.setRenderHint(QPainter::Antialiasing, true);
+	painter.scale(mScale, mScale);
+	painter.translate(-area.topLeft());
+
+	QPen pen(Qt::darkGray);
+	pen.setCosmetic(true);
+	painter.setPen(pen);
+	painter.setBrush(QColor(230, 230, 230));
+
+	for (const QGraphicsItem * const item : mSource->items(area, Qt::IntersectsItemBoundingRect, Qt::AscendingOrder)) {
+		if (!item->isVisible()) {
+			continue;
+		}
+
+		const QPolygonF outline = mOutline(*item);
+		if (outline.isEmpty()) {
+			continue;
+		}
+
+		if (outline.isClosed()) {
+			painter.drawPolygon(outline);
+		} else {
+			painter.drawPolyline(outline);
+		}
+
+		// Changed items keep the outline drawn before the change, so that synchronize() drops tiles at both places.
+		if (!isPending(item)) {
+			mOutlines.insert(item, outline);
+		}
+	}
+
+	return result;
+}
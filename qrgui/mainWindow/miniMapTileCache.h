@@ -0,0 +1,103 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <functional>
+
+#include <QtCore/QHash>
+#include <QtCore/QSet>
+#include <QtGui/QPixmap>
+#include <QtGui/QPolygonF>
+
+class QGraphicsItem;
+class QGraphicsScene;
+class QPainter;
+
+/// Low-resolution picture of a diagram for the minimap, split into square tiles rendered on demand. Every item is
+/// drawn as a simplified primitive given by an outline function, for example nodes as their bounding boxes and
+/// edges as straight polylines, so a tile costs far less than painting real elements with their shapes, labels and
+/// ports. A tile is rendered again only when some item in it is reported changed (see itemChanged(), itemRemoved()
+/// and synchronize()) or when the minimap scale changes.
+class MiniMapTileCache
+{
+public:
+	/// Returns what is drawn on tiles for the item in scene coordinates, empty polygon if it is not drawn.
+	/// Closed polygons are filled, open ones are drawn as polylines.
+	typedef std::function<QPolygonF(const QGraphicsItem &)> Outline;
+
+	explicit MiniMapTileCache(const Outline &outline);
+
+	/// Sets a scene to render tiles from, drops all cached tiles.
+	void setSource(QGraphicsScene *scene);
+
+	/// Sets a number of minimap pixels per scene unit, drops all cached tiles if it differs from the current one.
+	void setScale(qreal scale);
+
+	/// Drops tiles intersecting given rectangle in scene coordinates, they will be rendered again when requested.
+	void invalidate(const QRectF &sceneRect);
+
+	/// Drops all cached tiles.
+	void clear();
+
+	/// Remembers that the item or its children were added, moved, reshaped, shown or hidden. Tiles are dropped
+	/// by the next synchronize() call, so an item may be reported many times while being dragged.
+	void itemChanged(const QGraphicsItem *item);
+
+	/// Drops tiles where the item was drawn. The item is not dereferenced, so it may be already partially destroyed.
+	void itemRemoved(const QGraphicsItem *item);
+
+	/// Compares outlines of items reported by itemChanged() and their children with the ones drawn on tiles and
+	/// drops tiles where they differ. Other items are not visited.
+	/// @returns areas of the scene where tiles were dropped since the previous call.
+	QList<QRectF> synchronize();
+
+	/// Draws tiles covering \a exposed area of the scene, rendering missing ones. The painter is expected to be
+	/// in scene coordinates with the scale set by setScale().
+	void draw(QPainter *painter, const QRectF &exposed);
+
+private:
+	/// Returns a range of tile columns and rows covering given rectangle in scene coordinates.
+	QRect tiles(const QRectF &sceneRect) const;
+
+	/// Returns an area of the scene covered by the tile with given column and row.
+	QRectF tileRect(int column, int row) const;
+
+	QPixmap renderTile(int column, int row);
+
+	/// Drops tiles where the outline of the item or of its children differs from the remembered one.
+	void refresh(const QGraphicsItem &item);
+
+	/// Returns true if the item or one of its parents was reported changed and not synchronized yet.
+	bool isPending(const QGraphicsItem *item) const;
+
+	/// Drops tiles covering the outline and remembers the area for synchronize() result.
+	void invalidateOutline(const QPolygonF &outline);
+
+	const Outline mOutline;
+	QGraphicsScene *mSource = nullptr;  // Does not have ownership.
+	qreal mScale = 1.0;
+
+	/// Rendered tiles, the key is a column in the high half and a row in the low half.
+	QHash<quint64, QPixmap> mTiles;
+
+	/// Outlines of items as they are drawn on tiles. Items are used only as keys.
+	QHash<const QGraphicsItem *, QPolygonF> mOutlines;
+
+	/// Items reported by itemChanged() since the last synchronize() call.
+	QSet<const QGraphicsItem *> mChangedItems;
+
+	/// Areas where tiles were dropped since the last synchronize() call.
+	QList<QRectF> mChangedAreas;
+};
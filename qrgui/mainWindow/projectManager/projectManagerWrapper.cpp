@@ -47,6 +47,8 @@ ProjectManagerWrapper::ProjectManagerWrapper(MainWindow *mainWindow, TextManager
 
 bool ProjectManagerWrapper::suggestToSaveChangesOrCancel()
 {
+	// Postponed changes must reach the repository before it is checked for unsaved changes.
+	emit beforeClose();
 	if (!mUnsavedIndicator && !mStackUnsaved) {
 		return true;
 	}
@@ -154,6 +156,11 @@ QString ProjectManagerWrapper::textFileFilters() const
 	return result.join(";;");
 }
 
+bool ProjectManagerWrapper::convertRepository()
+{
+	return mVersionsConverter.convertRepository();
+}
+
 bool ProjectManagerWrapper::checkVersions()
 {
 	return mVersionsConverter.validateCurrentProject();
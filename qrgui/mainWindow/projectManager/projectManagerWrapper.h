@@ -60,6 +60,7 @@ public:
 private:
 	QString textFileFilters() const;
 
+	bool convertRepository() override;
 	bool checkVersions() override;
 
 	void refreshTitleModifiedSuffix();
@@ -17,8 +17,10 @@
 #include <QtWidgets/QMessageBox>
 
 #include <qrgui/models/models.h>
+#include <qrgui/plugins/pluginManager/editorManagerInterface.h>
 #include <qrgui/plugins/pluginManager/toolPluginManager.h>
 #include <qrgui/plugins/toolPluginInterface/usedInterfaces/errorReporterInterface.h>
+#include <qrgui/systemFacade/components/repositoryConverter.h>
 
 #include "mainWindow/mainWindow.h"
 
@@ -29,6 +31,18 @@ VersionsConverterManager::VersionsConverterManager(MainWindow &mainWindow)
 {
 }
 
+bool VersionsConverterManager::convertRepository()
+{
+	RepositoryConverter converter(mMainWindow.models().mutableRepoApi(), mMainWindow.editorManager()
+			, mMainWindow.toolManager().projectConverters());
+	const ProjectConverter::ConvertionResult result = converter.convert();
+	for (const QPair<Version, Version> &versions : converter.convertedVersions()) {
+		notifyConverted(versions.first, versions.second);
+	}
+
+	return handleConvertionResult(result, converter.failedSaveVersion());
+}
+
 bool VersionsConverterManager::validateCurrentProject()
 {
 	QSet<QString> editorsToCheck;
@@ -72,51 +86,48 @@ bool VersionsConverterManager::convertProject(const Version &enviromentVersion
 		, const Version &saveVersion
 		, QList<ProjectConverter> const &converters)
 {
-	// Stage I: Sorting converters by versions
-	QList<ProjectConverter> sortedConverters = converters;
-	std::sort(sortedConverters.begin(), sortedConverters.end()
-		, [=](const ProjectConverter &converter1, const ProjectConverter &converter2)
-	{
-		return converter1.fromVersion() < converter2.fromVersion();
-	});
-
-	// Stage II: Checking that versions are not overlapped
-	for (int index = 0; index < sortedConverters.count() - 1; ++index) {
-		if (sortedConverters[index].toVersion() > sortedConverters[index + 1].fromVersion()) {
-			qWarning() << "Converter versions are overlapped!";
-			return false;
-		}
+	// Stage I: Selecting converters to apply, sorted by versions
+	bool ok = true;
+	const QList<ProjectConverter> toApply = RepositoryConverter::applicableConverters(enviromentVersion, saveVersion
+			, converters, ok);
+	if (!ok) {
+		return false;
 	}
 
 	bool converterApplied = false;
 
-	// Stage III: Sequentially applying converters
-	for (ProjectConverter &converter : sortedConverters) {
-		if (converter.fromVersion() >= saveVersion && converter.toVersion() <= enviromentVersion) {
-			const ProjectConverter::ConvertionResult result = converter.convert(
-					mMainWindow.models().graphicalModelAssistApi()
-					, mMainWindow.models().logicalModelAssistApi());
-			switch (result) {
-			case ProjectConverter::Success:
-				converterApplied = true;
-				break;
-			case ProjectConverter::NoModificationsMade:
-				break;
-			case ProjectConverter::SaveInvalid:
-				displayCannotConvertError();
-				return false;
-			case ProjectConverter::VersionTooOld:
-				displayTooOldSaveError(saveVersion);
-				return false;
+	// Stage II: Sequentially applying converters. Adjacent repository-level converters are executed
+	// as one program, after that models must be rebuilt from repository.
+	for (int index = 0; index < toApply.count(); ++index) {
+		ProjectConverter::ConvertionResult result = ProjectConverter::NoModificationsMade;
+		if (toApply[index].isRepoConverter()) {
+			QList<ProjectConverter> batch;
+			for (; index < toApply.count() && toApply[index].isRepoConverter(); ++index) {
+				batch << toApply[index];
+			}
+
+			--index;
+			RepoSnapshot snapshot(mMainWindow.models().mutableRepoApi());
+			result = RepositoryConverter::runRepoConverters(batch, snapshot, mMainWindow.editorManager());
+			if (result == ProjectConverter::Success) {
+				mMainWindow.models().reinit();
 			}
+		} else {
+			ProjectConverter converter = toApply[index];
+			result = converter.convert(mMainWindow.models().graphicalModelAssistApi()
+					, mMainWindow.models().logicalModelAssistApi());
 		}
+
+		if (!handleConvertionResult(result, saveVersion)) {
+			return false;
+		}
+
+		converterApplied |= result == ProjectConverter::Success;
 	}
 
-	// Stage IV: Notifying user
+	// Stage III: Notifying user
 	if (converterApplied) {
-		mMainWindow.errorReporter()->addInformation(
-				QObject::tr("Project was automaticly converted from version %1 to version %2."\
-				" Please check its contents.").arg(saveVersion.toString(), enviromentVersion.toString()));
+		notifyConverted(saveVersion, enviromentVersion);
 		mMainWindow.models().mutableLogicalRepoApi().setMetaInformation(
 				converters.first().editor() + "Version", enviromentVersion.toString());
 	}
@@ -124,6 +135,31 @@ bool VersionsConverterManager::convertProject(const Version &enviromentVersion
 	return true;
 }
 
+bool VersionsConverterManager::handleConvertionResult(ProjectConverter::ConvertionResult result
+		, const Version &saveVersion)
+{
+	switch (result) {
+	case ProjectConverter::Success:
+	case ProjectConverter::NoModificationsMade:
+		return true;
+	case ProjectConverter::SaveInvalid:
+		displayCannotConvertError();
+		return false;
+	case ProjectConverter::VersionTooOld:
+		displayTooOldSaveError(saveVersion);
+		return false;
+	}
+
+	return false;
+}
+
+void VersionsConverterManager::notifyConverted(const Version &saveVersion, const Version &enviromentVersion)
+{
+	mMainWindow.errorReporter()->addInformation(
+			QObject::tr("Project was automaticly converted from version %1 to version %2."\
+			" Please check its contents.").arg(saveVersion.toString(), enviromentVersion.toString()));
+}
+
 void VersionsConverterManager::displayCannotConvertError()
 {
 	const QString errorMessage = QObject::tr("The attempt to automaticly convert this project "\
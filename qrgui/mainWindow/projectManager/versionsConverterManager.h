@@ -29,6 +29,13 @@ class VersionsConverterManager
 public:
 	explicit VersionsConverterManager(MainWindow &mainWindow);
 
+	/// Performs convertion of raw repository contents before models are built. Only editors for which all
+	/// applicable converters are repository-level ones are converted here, element steps of all such converters
+	/// are composed and executed in a single pass over the save. Other editors are left for
+	/// validateCurrentProject().
+	/// @returns false if the save can not be opened.
+	bool convertRepository();
+
 	/// Performs validation and convertion of models due to editor versions that created them.
 	bool validateCurrentProject();
 
@@ -37,6 +44,11 @@ private:
 			, const Version &saveVersion
 			, QList<ProjectConverter> const &converters);
 
+	/// Reports convertion result to user. Returns false if the save can not be opened.
+	bool handleConvertionResult(ProjectConverter::ConvertionResult result, const Version &saveVersion);
+
+	void notifyConverted(const Version &saveVersion, const Version &enviromentVersion);
+
 	void displayTooOldEnviromentError(const Version &saveVersion);
 	void displayCannotConvertError();
 	void displayTooOldSaveError(const Version &saveVersion);
@@ -42,6 +42,7 @@ LogicalModel::~LogicalModel()
 
 void LogicalModel::init()
 {
+	registerPropertySchemas();
 	mModelItems.insert(Id::rootId(), mRootItem);
 	mApi.setName(Id::rootId(), Id::rootId().toString());
 	// Turn off view notification while loading.
@@ -125,6 +126,17 @@ void LogicalModel::addInsufficientProperties(const Id &id, const QString &name)
 	}
 }
 
+void LogicalModel::registerPropertySchemas()
+{
+	for (const Id &editor : mEditorManagerInterface.editors()) {
+		for (const Id &diagram : mEditorManagerInterface.diagrams(editor)) {
+			for (const Id &element : mEditorManagerInterface.elements(diagram)) {
+				mApi.setPropertySchema(element, mEditorManagerInterface.propertyNames(element));
+			}
+		}
+	}
+}
+
 void LogicalModel::connectToGraphicalModel(GraphicalModel * const graphicalModel)
 {
 	mGraphicalModelView.setModel(graphicalModel);
@@ -312,7 +324,7 @@ QVariant LogicalModel::data(const QModelIndex &index, int role) const
 
 QVariant LogicalModel::dynamicPropertyData(const Id &id, int role) const
 {
-	const int propertiesCount = mLogicalAssistApi->editorManagerInterface().propertyNames(id.type()).count();
+	const int propertiesCount = metamodelPropertiesCount(id);
 	const QString dynamicProperties = mApi.property(id, "dynamicProperties").toString();
 
 	if (!dynamicProperties.isEmpty()) {
@@ -358,8 +370,7 @@ bool LogicalModel::setData(const QModelIndex &index, const QVariant &value, int
 					break;
 				}
 
-				int propertiesCount = mLogicalAssistApi->editorManagerInterface().
-						propertyNames(item->id().type()).count();
+				const int propertiesCount = metamodelPropertiesCount(item->id());
 				const QString dynamicProperties = mApi.property(item->id(), "dynamicProperties").toString();
 
 				if (!dynamicProperties.isEmpty()) {
@@ -64,6 +64,9 @@ private:
 			, const Id &id);
 	void addInsufficientProperties(const Id &id, const QString &name = QString());
 
+	/// Declares properties of all metamodel elements to the repository, so it can store them compactly.
+	void registerPropertySchemas();
+
 	virtual modelsImplementation::AbstractModelItem *createModelItem(const Id &id
 			, modelsImplementation::AbstractModelItem *parentItem) const override;
 	void addTree(const Id &parent, const QMultiMap<Id, ElementInfo> &childrenOfParents, QSet<Id> &visited);
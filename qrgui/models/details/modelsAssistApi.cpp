@@ -68,8 +68,7 @@ QVariant ModelsAssistApi::property(const Id &elem, const int role) const
 
 int ModelsAssistApi::roleIndexByName(const Id &elem, const QString &roleName) const
 {
-	const QStringList properties = editorManagerInterface().propertyNames(elem.type());
-	return properties.indexOf(roleName) + roles::customPropertiesBeginRole;
+	return mModel.roleByPropertyName(elem, roleName);
 }
 
 QModelIndex ModelsAssistApi::indexById(const Id &id) const
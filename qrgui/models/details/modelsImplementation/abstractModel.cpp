@@ -100,19 +100,12 @@ QModelIndex AbstractModel::parent(const QModelIndex &index) const
 
 QModelIndex AbstractModel::index(const AbstractModelItem * const item) const
 {
-	QList<int> rowCoords;
-
-	for (const AbstractModelItem *curItem = item; curItem != mRootItem; curItem = curItem->parent()) {
-		rowCoords.append(curItem->row());
-	}
-
-	QModelIndex result;
-
-	for (int i = rowCoords.size() - 1; i >= 0; --i) {
-		result = index(rowCoords[i], 0, result);
+	if (item == mRootItem) {
+		return QModelIndex();
 	}
 
-	return result;
+	// Index is determined by the item and its row, items keep their rows, so there is no need to walk the tree.
+	return createIndex(item->row(), 0, const_cast<AbstractModelItem *>(item));
 }
 
 QString AbstractModel::findPropertyName(const Id &id, const int role) const
@@ -120,12 +113,48 @@ QString AbstractModel::findPropertyName(const Id &id, const int role) const
 	// In case of a property described in element itself (in metamodel),
 	// role is simply an index of a property in a list of properties.
 	// This convention must be obeyed everywhere, otherwise roles will shift.
-	QStringList properties = mEditorManagerInterface.propertyNames(id.type());
+	const QStringList &properties = roleTable(id).propertyNames;
 	return role - roles::customPropertiesBeginRole < properties.count()
 			? properties[role - roles::customPropertiesBeginRole]
 			: QString();
 }
 
+int AbstractModel::roleByPropertyName(const Id &id, const QString &propertyName) const
+{
+	return roleTable(id).indices.value(propertyName, -1) + roles::customPropertiesBeginRole;
+}
+
+int AbstractModel::metamodelPropertiesCount(const Id &id) const
+{
+	return roleTable(id).propertyNames.count();
+}
+
+const AbstractModel::RoleTable &AbstractModel::roleTable(const Id &id) const
+{
+	const int revision = mEditorManagerInterface.metamodelRevision();
+	if (revision != mRoleTablesRevision) {
+		mRoleTables.clear();
+		mRoleTablesRevision = revision;
+	}
+
+	const Id type = id.type();
+	auto table = mRoleTables.find(type);
+	if (table == mRoleTables.end()) {
+		RoleTable newTable;
+		newTable.propertyNames = mEditorManagerInterface.propertyNames(type);
+		for (int i = 0; i < newTable.propertyNames.count(); ++i) {
+			// The first property wins if names repeat, like QStringList::indexOf() does.
+			if (!newTable.indices.contains(newTable.propertyNames[i])) {
+				newTable.indices.insert(newTable.propertyNames[i], i);
+			}
+		}
+
+		table = mRoleTables.insert(type, newTable);
+	}
+
+	return table.value();
+}
+
 Qt::DropActions AbstractModel::supportedDropActions() const
 {
 	return Qt::CopyAction | Qt::MoveAction | Qt::LinkAction;
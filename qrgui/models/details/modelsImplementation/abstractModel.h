@@ -77,6 +77,14 @@ public:
 
 	void reinit();
 
+	/// Returns role of a property described in the metamodel of element type of @p id,
+	/// roles::customPropertiesBeginRole - 1 if there is no such property.
+	int roleByPropertyName(const Id &id, const QString &propertyName) const;
+
+	/// Returns the number of properties described in the metamodel of element type of @p id.
+	/// Roles of dynamic properties follow roles of these ones.
+	int metamodelPropertiesCount(const Id &id) const;
+
 signals:
 	/// Emitted each time when new element was added into model.
 	void elementAdded(const Id &id);
@@ -95,10 +103,24 @@ protected:
 	void removeModelItems(details::modelsImplementation::AbstractModelItem *const root);
 
 private:
+	/// Properties of one element type described in the metamodel. Role of a property is
+	/// roles::customPropertiesBeginRole plus its index in propertyNames.
+	struct RoleTable
+	{
+		QStringList propertyNames;
+		QHash<QString, int> indices;
+	};
+
+	/// Returns role table of element type of @p id, tables are built once and dropped when metamodel changes.
+	const RoleTable &roleTable(const Id &id) const;
+
 	virtual AbstractModelItem *createModelItem(const Id &id, AbstractModelItem *parentItem) const = 0;
 	virtual void init() = 0;
 	virtual void removeModelItemFromApi(details::modelsImplementation::AbstractModelItem *const root
 			, details::modelsImplementation::AbstractModelItem *child) = 0;
+
+	mutable QHash<Id, RoleTable> mRoleTables;
+	mutable int mRoleTablesRevision = -1;
 };
 
 }
@@ -55,13 +55,17 @@ void AbstractModelItem::addChild(AbstractModelItem *child)
 				+ "  to object " + mId.toString());
 	}
 
+	child->mRow = mChildren.size();
 	mChildren.append(child);
 }
 
 void AbstractModelItem::removeChild(AbstractModelItem *child)
 {
-	if (mChildren.contains(child)) {
+	const int index = mChildren.indexOf(child);
+	if (index >= 0) {
 		mChildren.removeAll(child);
+		child->mRow = -1;
+		updateRows(index);
 	} else {
 		throw Exception("Model: Removing nonexistent child " + child->id().toString()
 				+ "  from object " + mId.toString());
@@ -82,16 +86,31 @@ void AbstractModelItem::stackBefore(AbstractModelItem *element, AbstractModelIte
 		throw Exception("Model: Trying to stack element before nonexistent child " + sibling->id().toString());
 	}
 
+	const int from = qMin(mChildren.indexOf(element), mChildren.indexOf(sibling));
 	mChildren.removeOne(element);
 	mChildren.insert(mChildren.indexOf(sibling), element);
+	updateRows(from);
 }
 
 int AbstractModelItem::row() const
 {
-	return mParent->children().indexOf(const_cast<AbstractModelItem *>(this));
+	const PointerList &siblings = mParent->mChildren;
+	if (mRow < 0 || mRow >= siblings.size() || siblings[mRow] != this) {
+		mRow = siblings.indexOf(const_cast<AbstractModelItem *>(this));
+	}
+
+	return mRow;
 }
 
 void AbstractModelItem::clearChildren()
 {
+	// Children may be already deleted here, their rows are not touched.
 	mChildren.clear();
 }
+
+void AbstractModelItem::updateRows(int from) const
+{
+	for (int i = from; i < mChildren.size(); ++i) {
+		mChildren[i]->mRow = i;
+	}
+}
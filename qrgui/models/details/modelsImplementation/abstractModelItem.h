@@ -34,6 +34,7 @@ public:
 	AbstractModelItem *parent() const;
 	PointerList children() const;
 
+	/// Returns position of this item among children of its parent.
 	int row() const;
 	void addChild(AbstractModelItem *child);
 	void removeChild(AbstractModelItem *child);
@@ -45,9 +46,16 @@ public:
 	void stackBefore(AbstractModelItem *element, AbstractModelItem *sibling);
 
 private:
+	/// Updates cached rows of children starting from the given position.
+	void updateRows(int from) const;
+
 	AbstractModelItem *mParent;
 	const Id mId;
 	PointerList mChildren;
+
+	/// Cached position among children of the parent, maintained by parent on children list changes and checked
+	/// before use, so an item moved without notifying parent still reports correct row.
+	mutable int mRow = -1;
 };
 
 }
@@ -111,7 +111,7 @@ void LogicalModelAssistApi::setPropertyByRoleName(const Id &elem, const QVariant
 			return;
 		}
 
-		const int propertiesCount = editorManagerInterface().propertyNames(elem.type()).count();
+		const int propertiesCount = mLogicalModel.metamodelPropertiesCount(elem);
 		int index = 0;
 		QDomDocument dynamicPropertiesXml;
 		dynamicPropertiesXml.setContent(dynamicProperties);
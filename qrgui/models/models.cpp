@@ -73,6 +73,11 @@ qrRepo::RepoControlInterface &Models::repoControlApi() const
 	return *mRepoApi;
 }
 
+qrRepo::RepoApi &Models::mutableRepoApi() const
+{
+	return static_cast<qrRepo::RepoApi &>(*mRepoApi);
+}
+
 const qrRepo::LogicalRepoApi &Models::logicalRepoApi() const
 {
 	return mLogicalModel->api();
@@ -16,6 +16,8 @@
 
 #include <QtCore/QScopedPointer>
 
+#include <qrrepo/repoApi.h>
+
 #include "qrgui/models/details/graphicalModel.h"
 #include "qrgui/models/details/logicalModel.h"
 #include "qrgui/models/graphicalModelAssistApi.h"
@@ -41,6 +43,10 @@ public:
 
 	qrRepo::RepoControlInterface &repoControlApi() const;
 
+	/// Returns the repository itself, bypassing models. Used to preprocess raw save contents before models
+	/// are (re)initialized, model contents must be reinitialized after modifications made through it.
+	qrRepo::RepoApi &mutableRepoApi() const;
+
 	const qrRepo::LogicalRepoApi &logicalRepoApi() const;
 	qrRepo::LogicalRepoApi &mutableLogicalRepoApi() const;
 
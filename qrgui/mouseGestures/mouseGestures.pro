@@ -42,6 +42,7 @@ HEADERS += \
 	$$PWD/private/keyBuilder.h \
 	$$PWD/private/abstractRecognizer.h \
 	$$PWD/private/mixedgesturesmanager.h \
+	$$PWD/private/gestureIndex.h \
 	$$PWD/private/rectanglegesturesmanager.h \
 	$$PWD/private/nearestposgridgesturesmanager.h \
 	$$PWD/private/sorts.h \
@@ -56,6 +57,7 @@ SOURCES += \
 	$$PWD/private/keyManager.cpp \
 	$$PWD/private/keyBuilder.cpp \
 	$$PWD/private/mixedgesturesmanager.cpp \
+	$$PWD/private/gestureIndex.cpp \
 	$$PWD/private/rectanglegesturesmanager.cpp \
 	$$PWD/private/nearestposgridgesturesmanager.cpp \
 	$$PWD/dummyMouseMovementManager.cpp
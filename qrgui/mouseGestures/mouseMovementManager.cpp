@@ -36,6 +36,7 @@ MouseMovementManager::MouseMovementManager(const Id &diagram
 		, const qReal::EditorManagerInterface &editorManagerInterface)
 	: mDiagram(diagram)
 	, mEditorManagerInterface(editorManagerInterface)
+	, mDeletionGesture(-1)
 	, mInitializing(true)
 {
 	mKeyStringManager.reset(new KeyManager);
@@ -114,18 +115,39 @@ void MouseMovementManager::initializeGestures()
 		return;
 	}
 
-	QMap<QString, PathVector> gestures;
-	gestures.insert(deletionGestureKey, stringToPath(deletionGesture));
+	buildIndex();
+	mInitializing = false;
+}
+
+void MouseMovementManager::buildIndex()
+{
+	// Gestures are indexed in order of their keys, so equally near gestures are resolved as they always were.
+	QMap<QString, QPair<Id, QString>> gestures;
+	gestures.insert(deletionGestureKey, qMakePair(Id(), deletionGesture));
 	for (const Id &element : mEditorManagerInterface.elements(mDiagram)) {
 		const QString pathStr = mEditorManagerInterface.mouseGesture(element);
-		if (!pathStr.isEmpty() && !mInitializedGestures.contains(element)) {
-			gestures.insert(element.toString(), stringToPath(pathStr));
-			mInitializedGestures << element;
+		if (!pathStr.isEmpty()) {
+			gestures.insert(element.toString(), qMakePair(element, pathStr));
 		}
 	}
 
-	mGesturesManager->initIdealGestures(gestures);
-	mInitializing = false;
+	mGestureIndex.clear();
+	mGestureElements.clear();
+	for (auto gesture = gestures.cbegin(); gesture != gestures.cend(); ++gesture) {
+		if (gesture.key() == deletionGestureKey) {
+			mDeletionGesture = mGestureElements.size();
+		}
+
+		mGestureIndex.insert(mGesturesManager->getKey(stringToPath(gesture.value().second)));
+		mGestureElements << gesture.value().first;
+	}
+
+	mIndexedVersion = editorVersion();
+}
+
+qReal::Version MouseMovementManager::editorVersion() const
+{
+	return mEditorManagerInterface.version(Id(mDiagram.editor()));
 }
 
 void MouseMovementManager::recountCentre()
@@ -195,31 +217,19 @@ MouseMovementManager::GestureResult MouseMovementManager::result()
 		return GestureResult(invalidGesture);
 	}
 
-	initializeGestures();
-	GestureResult result;
-	mGesturesManager->setKey(mPath);
-	mPath.clear();
-	qreal minDist = INT_MAX;
-
-	QMap<QString, Id> gestures;
-	gestures[deletionGestureKey] = Id();
-	for (const Id &element : mEditorManagerInterface.elements(mDiagram)) {
-		if (mInitializedGestures.contains(element)) {
-			gestures[element.toString()] = element;
-		}
+	if (editorVersion() != mIndexedVersion) {
+		buildIndex();
 	}
 
-	for (const QString &key: gestures.keys()) {
-		minDist = qMin(minDist, mGesturesManager->getMaxDistance(key));
-		const qreal dist = mGesturesManager->getDistance(key);
-		if (dist < minDist) {
-			minDist = dist;
-			result.setType(key == deletionGestureKey ? deleteGesture : createElementGesture);
-			result.setElementType(gestures[key]);
-		}
+	const auto key = mGesturesManager->getKey(mPath);
+	mPath.clear();
+	const int nearest = mGestureIndex.nearest(key, mGesturesManager->getMaxDistance(QString()));
+	if (nearest == -1) {
+		return GestureResult();
 	}
 
-	return result;
+	return GestureResult(nearest == mDeletionGesture ? deleteGesture : createElementGesture
+			, mGestureElements[nearest]);
 }
 
 QPointF MouseMovementManager::firstPoint()
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <qrkernel/ids.h>
+#include <qrkernel/version.h>
 
 #include <QtCore/QMap>
 #include <QtWidgets/QWidget>
@@ -24,6 +25,7 @@
 
 #include "private/keyManager.h"
 #include "private/mixedgesturesmanager.h"
+#include "private/gestureIndex.h"
 #include "private/geometricForms.h"
 
 #include "plugins/pluginManager/editorManagerInterface.h"
@@ -62,13 +64,21 @@ private:
 	void recountCentre();
 	void drawIdealPath();
 
+	/// Computes keys of all gestures of the diagram and puts them into the index. Keys depend only on metamodel,
+	/// so it is done once and then again only when the version of the editor changes.
+	void buildIndex();
+	Version editorVersion() const;
+
 	const Id mDiagram;
 	const EditorManagerInterface &mEditorManagerInterface;
 	PathVector mPath;
 	QPointF mCenter;
-	QSet<Id> mInitializedGestures;
 	QScopedPointer<KeyManager> mKeyStringManager;
-	QScopedPointer<GesturesManager> mGesturesManager;
+	QScopedPointer<MixedGesturesManager> mGesturesManager;
+	GestureIndex mGestureIndex;
+	QVector<Id> mGestureElements;  // Element types of gestures in the index, in the same order.
+	int mDeletionGesture;  // Index of deletion metagesture in the index.
+	Version mIndexedVersion;
 	bool mInitializing;
 };
 
@@ -0,0 +1,111 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "gestureIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace qReal::gestures;
+
+/// Width of a group of children, in units of distance between keys.
+static const qreal bucketWidth = 1.0;
+
+/// Distances are computed in floating point, so triangle inequality is relaxed a little to not lose exact ties.
+static const qreal tolerance = 1e-9;
+
+void GestureIndex::clear()
+{
+	mKeys.clear();
+	mNodes.clear();
+}
+
+void GestureIndex::insert(const Key &key)
+{
+	const int newNode = mKeys.size();
+	mKeys << key;
+	mNodes << Node();
+	if (newNode == 0) {
+		return;
+	}
+
+	int node = 0;
+	forever {
+		const int newBucket = bucket(MixedGesturesManager::distance(mKeys[node], key
+				, std::numeric_limits<qreal>::infinity()));
+		QVector<Child> &children = mNodes[node].children;
+		auto position = std::lower_bound(children.begin(), children.end(), newBucket
+				, [](const Child &child, int value) { return child.bucket < value; });
+		if (position == children.end() || position->bucket != newBucket) {
+			children.insert(position, {newBucket, newNode});
+			return;
+		}
+
+		node = position->node;
+	}
+}
+
+int GestureIndex::size() const
+{
+	return mKeys.size();
+}
+
+int GestureIndex::nearest(const Key &key, qreal maxDistance) const
+{
+	int best = -1;
+	qreal bestDistance = maxDistance;
+	if (!mKeys.isEmpty()) {
+		search(0, key, bestDistance, best);
+	}
+
+	return best;
+}
+
+int GestureIndex::bucket(qreal distance)
+{
+	return static_cast<int>(std::floor(distance / bucketWidth));
+}
+
+void GestureIndex::search(int node, const Key &key, qreal &bestDistance, int &best) const
+{
+	// Distance is needed for pruning children even if this node itself is too far, but only while some child
+	// still may be visited. Beyond that bound the comparison is cut off and all children are skipped.
+	const QVector<Child> &children = mNodes[node].children;
+	const qreal bound = children.isEmpty()
+			? bestDistance
+			: bestDistance + (children.last().bucket + 1) * bucketWidth + tolerance;
+	const qreal distance = MixedGesturesManager::distance(mKeys[node], key, bound);
+	if (distance < bestDistance || (distance == bestDistance && best != -1 && node < best)) {
+		bestDistance = distance;
+		best = node;
+	}
+
+	// Any gesture g in child subtree with d(node, g) outside of [distance - best, distance + best] is farther
+	// from the key than the best one.
+	for (const Child &child : children) {
+		const qreal low = child.bucket * bucketWidth;
+		const qreal high = low + bucketWidth;
+		if (high < distance - bestDistance - tolerance) {
+			continue;
+		}
+
+		if (low > distance + bestDistance + tolerance) {
+			break;
+		}
+
+		search(child.node, key, bestDistance, best);
+	}
+}
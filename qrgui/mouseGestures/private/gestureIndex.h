@@ -0,0 +1,70 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QVector>
+
+#include "mixedgesturesmanager.h"
+
+namespace qReal {
+namespace gestures {
+
+/// Metric tree (BK-tree) over keys of ideal gestures, finds the nearest gesture to the drawn one without comparing
+/// it with every gesture. Keys are compared with MixedGesturesManager::distance(), which is a metric, children of
+/// each node are grouped by integer part of the distance to this node, so triangle inequality allows to skip
+/// groups that can not contain anything closer than the best gesture found so far.
+class GestureIndex
+{
+public:
+	using Key = MixedGesturesManager::key_type;
+
+	/// Removes all gestures from the index.
+	void clear();
+
+	/// Adds a gesture with the given key, gestures get indices in order of addition.
+	void insert(const Key &key);
+
+	/// Returns a number of gestures in the index.
+	int size() const;
+
+	/// Returns index of the gesture nearest to \a key with distance strictly less than \a maxDistance or -1 if there
+	/// is no such gesture. If several gestures are equally near, the one added first wins, just like in linear scan.
+	int nearest(const Key &key, qreal maxDistance) const;
+
+private:
+	struct Child
+	{
+		int bucket;
+		int node;
+	};
+
+	struct Node
+	{
+		/// Children sorted by bucket, each bucket holds at most one child.
+		QVector<Child> children;
+	};
+
+	static int bucket(qreal distance);
+
+	void search(int node, const Key &key, qreal &bestDistance, int &best) const;
+
+	/// Node i holds gesture with index i.
+	QVector<Key> mKeys;
+	QVector<Node> mNodes;
+};
+
+}
+}
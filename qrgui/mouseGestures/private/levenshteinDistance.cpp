@@ -14,44 +14,56 @@
 
 #include "levenshteinDistance.h"
 
-#include <QtCore/QList>
+#include <QtCore/QVarLengthArray>
 
 using namespace qReal::gestures;
 
-int LevenshteinDistance::getLevenshteinDistance(const QString &key1, const QString &key2)
+int LevenshteinDistance::getLevenshteinDistance(const QString &key1, const QString &key2, int bound)
 {
-	const int m = key1.size();
-	const int n = key2.size();
+	// Keeping the shorter key along the row, so the row is as short as possible.
+	const QString &rowKey = key1.size() <= key2.size() ? key1 : key2;
+	const QString &columnKey = key1.size() <= key2.size() ? key2 : key1;
+	const int m = columnKey.size();
+	const int n = rowKey.size();
 
-	if (m == 0)
-		return n;
+	// Distance is at least the difference of lengths and at most the longer length.
+	if (m - n > bound) {
+		return bound + 1;
+	}
 
-	if (n == 0)
-		return m;
+	const int band = qMin(bound, m);
+	const int beyondBound = band + 1;
 
-	QList<QList<int> > matrix;
-	for (int i = 0; i <= m; i++) {
-		QList<int> list;
-		for (int j = 0; j <= n; j++)
-			list << 0;
-		matrix << list;
+	QVarLengthArray<int, 256> firstRow(n + 1);
+	QVarLengthArray<int, 256> secondRow(n + 1);
+	int *previous = firstRow.data();
+	int *current = secondRow.data();
+	for (int j = 0; j <= n; ++j) {
+		previous[j] = qMin(j, beyondBound);
 	}
 
-	for (int i = 0; i <= m; i++)
-		for (int j = 0; j <= n; j++)
-			if (i == 0 || j == 0)
-				matrix[i][j] = std::max(i, j);
-
-	matrix[0][0] = 0;
-	int cost = 0;
 	for (int i = 1; i <= m; ++i) {
-		for(int j = 1; j <= n; ++j) {
-			cost = (key1[i - 1] == key2[j - 1]) ? 0 : 1;
-			const int aboveCell = matrix[i - 1][j];
-			const int leftCell = matrix[i][j - 1];
-			const int diagonalCell = matrix[i - 1][j - 1];
-			matrix[i][j] = std::min(std::min(aboveCell + 1, leftCell + 1), diagonalCell + cost);
+		// Cells outside of the band [i - band, i + band] can not be within the bound and are never read.
+		const int from = qMax(1, i - band);
+		const int to = qMin(n, i + band);
+		current[from - 1] = from == 1 ? qMin(i, beyondBound) : beyondBound;
+		int rowMinimum = current[from - 1];
+		const QChar symbol = columnKey[i - 1];
+		for (int j = from; j <= to; ++j) {
+			const int cost = symbol == rowKey[j - 1] ? 0 : 1;
+			const int aboveCell = j <= i - 1 + band ? previous[j] : beyondBound;
+			const int value = qMin(qMin(aboveCell + 1, current[j - 1] + 1), previous[j - 1] + cost);
+			current[j] = qMin(value, beyondBound);
+			rowMinimum = qMin(rowMinimum, current[j]);
+		}
+
+		if (rowMinimum > band) {
+			// Values along any path never decrease, so the final distance can not fit into the bound too.
+			return bound + 1;
 		}
+
+		std::swap(previous, current);
 	}
-	return matrix[m][n];
+
+	return previous[n] > band ? bound + 1 : previous[n];
 }
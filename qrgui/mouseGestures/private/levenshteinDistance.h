@@ -14,8 +14,9 @@
 
 #pragma once
 
+#include <climits>
+
 #include <QtCore/QString>
-#include <QtCore/QList>
 
 namespace qReal {
 namespace gestures {
@@ -23,7 +24,10 @@ namespace gestures {
 class LevenshteinDistance
 {
 public:
-	static int getLevenshteinDistance(const QString &key1, const QString &key2);
+	/// Returns edit distance between \a key1 and \a key2. If it is greater than \a bound, some value greater
+	/// than \a bound is returned instead. Only a band of 2 * bound + 1 diagonals is computed, so the cost is
+	/// O(min(m, n) * bound) and nothing is allocated for keys shorter than a few hundred symbols.
+	static int getLevenshteinDistance(const QString &key1, const QString &key2, int bound = INT_MAX);
 };
 
 }
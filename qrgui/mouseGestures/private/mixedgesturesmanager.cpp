@@ -14,6 +14,8 @@
 
 #include "mixedgesturesmanager.h"
 
+#include <limits>
+
 #include "rectanglegesturesmanager.h"
 #include "nearestposgridgesturesmanager.h"
 #include "keyBuilder.h"
@@ -38,11 +40,37 @@ bool MixedGesturesManager::isMultistroke()
 
 qreal MixedGesturesManager::getDistance(const key_type &key1, const key_type &key2)
 {
-	RectangleGesturesManager rectMan;
-	NearestPosGridGesturesManager gridMan;
-	qreal dist1 = rectMan.getDistance(key1.first, key2.first);
-	qreal dist2 = gridMan.getDistance(key1.second, key2.second);
-	return dist1 * weight1 + dist2 * weight2;
+	return distance(key1, key2, std::numeric_limits<qreal>::infinity());
+}
+
+qreal MixedGesturesManager::distance(const key_type &key1, const key_type &key2, qreal bound)
+{
+	// Fused RectangleGesturesManager::getDistance() and NearestPosGridGesturesManager::getDistance(), summing
+	// in the same order, so the result is exactly the same. All terms are non-negative, so the value for a
+	// prefix of keys is a lower bound of the final one and is checked after each grid row.
+	const int size = gridSize * gridSize;
+	const qreal *rect1 = key1.first.constData();
+	const qreal *rect2 = key2.first.constData();
+	const qreal *grid1 = key1.second.constData();
+	const qreal *grid2 = key2.second.constData();
+	qreal rectSum = 0;
+	qreal gridSum = 0;
+	qreal gridNorm = 0;
+	for (int row = 0; row < size; row += gridSize) {
+		for (int i = row; i < row + gridSize; ++i) {
+			rectSum += qAbs(rect1[i] - rect2[i]);
+			const qreal gridDifference = qAbs(grid1[i] - grid2[i]);
+			gridSum += gridDifference;
+			gridNorm = qMax(gridNorm, gridDifference);
+		}
+
+		const qreal lowerBound = rectSum / size * weight1 + (gridNorm + gridSum / size) * weight2;
+		if (lowerBound > bound) {
+			return lowerBound;
+		}
+	}
+
+	return rectSum / size * weight1 + (gridNorm + gridSum / size) * weight2;
 }
 
 MixedGesturesManager::key_type MixedGesturesManager::getKey(const PathVector &path)
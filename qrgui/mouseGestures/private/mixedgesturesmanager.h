@@ -37,6 +37,10 @@ public:
 
 	qreal getDistance(const key_type &key1, const key_type &key2) override;
 	key_type  getKey(const PathVector &path) override;
+
+	/// Returns the same value as getDistance(key1, key2) if it does not exceed \a bound, otherwise returns some
+	/// value greater than \a bound, possibly without looking at the whole keys. Does not allocate.
+	static qreal distance(const key_type &key1, const key_type &key2, qreal bound);
 };
 
 class MixedClassifier
@@ -104,6 +104,7 @@ bool EditorManager::registerPlugin(MetamodelLoaderInterface * const loader)
 	loader->load(*metamodel);
 	mPluginFileNames[metamodel->id()] << pluginName;
 	mMetamodels[metamodel->id()] = metamodel;
+	++mMetamodelRevision;
 	return true;
 }
 
@@ -132,6 +133,7 @@ QString EditorManager::unloadPlugin(const QString &metamodelName)
 	if (mMetamodels.keys().contains(metamodelName)) {
 		mMetamodels.remove(metamodelName);
 		mPluginFileNames.remove(metamodelName);
+		++mMetamodelRevision;
 
 		if (!resultOfUnloading.isEmpty()) {
 			QLOG_WARN() << "Editor plugin" << metamodelName << "unloading failed: " + resultOfUnloading;
@@ -160,6 +162,12 @@ void EditorManager::loadMetamodel(const QSharedPointer<Metamodel> &metamodel)
 	}
 
 	mMetamodels[metamodel->id()] = metamodel;
+	++mMetamodelRevision;
+}
+
+int EditorManager::metamodelRevision() const
+{
+	return mMetamodelRevision;
 }
 
 IdList EditorManager::editors() const
@@ -552,6 +560,7 @@ void EditorManager::deleteProperty(const QString &propDisplayedName) const
 void EditorManager::addProperty(const Id &id, const QString &propDisplayedName) const
 {
 	elementType(id).addProperty(propDisplayedName, "string", QString(), propDisplayedName, QString(), false);
+	++mMetamodelRevision;
 }
 
 void EditorManager::updateProperties(const Id &id, const QString &property, const QString &propertyType
@@ -65,6 +65,7 @@ public:
 	QString unloadPlugin(const QString &metamodelName) override;
 	bool unloadAllPlugins() override;
 	void loadMetamodel(const QSharedPointer<Metamodel> &metamodel) override;
+	int metamodelRevision() const override;
 
 	QString mouseGesture(const Id &id) const override;
 	QString friendlyName(const Id &id) const override;
@@ -161,6 +162,9 @@ private:
 	QMap<QString, Pattern> mGroups;
 	QMap<QString, QSharedPointer<Metamodel>> mMetamodels;
 
+	/// Incremented on each change of metamodels, modifiable from const methods editing element types.
+	mutable int mMetamodelRevision = 0;
+
 	QDir mPluginsDir;
 
 	/// Common part of plugin loaders
@@ -61,6 +61,10 @@ public:
 	/// Takes ownership on \a metamodel.
 	virtual void loadMetamodel(const QSharedPointer<Metamodel> &metamodel) = 0;
 
+	/// Returns a number that changes each time metamodels are loaded, unloaded or their properties are modified.
+	/// Allows to invalidate information cached from the metamodel.
+	virtual int metamodelRevision() const = 0;
+
 	virtual QString mouseGesture(const Id &id) const = 0;
 	virtual QString friendlyName(const Id &id) const = 0;
 	virtual QString description(const Id &id) const = 0;
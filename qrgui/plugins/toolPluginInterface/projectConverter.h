@@ -19,10 +19,15 @@
 #include <qrkernel/version.h>
 #include <qrgui/plugins/toolPluginInterface/usedInterfaces/graphicalModelAssistInterface.h>
 #include <qrgui/plugins/toolPluginInterface/usedInterfaces/logicalModelAssistInterface.h>
+#include <qrgui/plugins/toolPluginInterface/repoSnapshot.h>
 
 namespace qReal {
 
 /// A converter that transforms models from some version to later one.
+/// Converter may be either a model-level one (it works with GUI models after they were built) or
+/// a repository-level one. Repository-level converters consist of a project-level step and an element-level
+/// rewrite step that are executed on raw repository contents before GUI models are built, so element
+/// steps of consecutive applicable converters can be composed and executed in a single pass over the save.
 class ProjectConverter
 {
 public:
@@ -42,6 +47,16 @@ public:
 	typedef std::function<ConvertionResult(GraphicalModelAssistInterface &
 			, LogicalModelAssistInterface &)> Converter;
 
+	/// Project-level step of repository converter, executed once after element steps of all earlier converters
+	/// and before element step of its own converter.
+	typedef std::function<ConvertionResult(RepoSnapshot &)> ProjectRewriter;
+
+	/// Element-level step of repository converter. Takes logical id of an element and returns the logical id
+	/// element has after conversion (a converter may recreate element with another type) or null id
+	/// if element was deleted. The last parameter must be set to true if something was modified.
+	typedef std::function<Id(const Id &, RepoSnapshot &, bool &)> ElementRewriter;
+
+	/// Constructs model-level converter.
 	ProjectConverter(const QString &editor
 			, const Version &fromVersion
 			, const Version &toVersion
@@ -53,6 +68,20 @@ public:
 	{
 	}
 
+	/// Constructs repository-level converter. Any of the steps may be empty.
+	ProjectConverter(const QString &editor
+			, const Version &fromVersion
+			, const Version &toVersion
+			, const ProjectRewriter &projectRewriter
+			, const ElementRewriter &elementRewriter)
+		: mEditor(editor)
+		, mFromVersion(fromVersion)
+		, mToVersion(toVersion)
+		, mProjectRewriter(projectRewriter)
+		, mElementRewriter(elementRewriter)
+	{
+	}
+
 	/// Returns an editor whoose diagrams will be converted by this converter instance.
 	QString editor() const
 	{
@@ -74,17 +103,52 @@ public:
 	/// Performs conversion process and returns the success or the fail reason of this operation.
 	/// If operation was unsuccessful then the whole save is not accepted by the system
 	/// and corresponding error message will be shown.
+	/// Must be called only for model-level converters.
 	ConvertionResult convert(GraphicalModelAssistInterface &graphicalApi
 			, LogicalModelAssistInterface &logicalApi)
 	{
+		Q_ASSERT(!isRepoConverter());
 		return mConverter(graphicalApi, logicalApi);
 	}
 
+	/// Returns true if this converter works on raw repository contents.
+	bool isRepoConverter() const
+	{
+		return !mConverter;
+	}
+
+	/// Performs project-level step of repository converter, if any.
+	ConvertionResult rewriteProject(RepoSnapshot &snapshot) const
+	{
+		return mProjectRewriter ? mProjectRewriter(snapshot) : NoModificationsMade;
+	}
+
+	/// Returns true if this converter has project-level step.
+	bool hasProjectRewriter() const
+	{
+		return static_cast<bool>(mProjectRewriter);
+	}
+
+	/// Returns true if this converter has element-level step.
+	bool hasElementRewriter() const
+	{
+		return static_cast<bool>(mElementRewriter);
+	}
+
+	/// Performs element-level step of repository converter on the given logical element.
+	/// @returns logical id of an element after conversion or null id if element was deleted.
+	Id rewriteElement(const Id &element, RepoSnapshot &snapshot, bool &modified) const
+	{
+		return mElementRewriter ? mElementRewriter(element, snapshot, modified) : element;
+	}
+
 private:
 	QString mEditor;
 	Version mFromVersion;
 	Version mToVersion;
 	Converter mConverter;
+	ProjectRewriter mProjectRewriter;
+	ElementRewriter mElementRewriter;
 };
 
 }
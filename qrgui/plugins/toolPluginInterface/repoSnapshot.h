@@ -0,0 +1,95 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QHash>
+
+#include <qrkernel/ids.h>
+#include <qrrepo/repoApi.h>
+
+namespace qReal {
+
+/// A raw view on the repository contents used by project converters before GUI models are built.
+/// Gives direct access to the repository and maintains logical id -> graphical ids index that is
+/// built by a single pass over the repository, so converters do not need to ask models for it.
+class RepoSnapshot
+{
+public:
+	explicit RepoSnapshot(qrRepo::RepoApi &repo)
+		: mRepo(repo)
+	{
+		for (const Id &graphicalId : mRepo.graphicalElements()) {
+			if (graphicalId != Id::rootId()) {
+				mGraphicalIds.insertMulti(mRepo.logicalId(graphicalId), graphicalId);
+			}
+		}
+	}
+
+	/// Returns the repository itself.
+	qrRepo::RepoApi &repo()
+	{
+		return mRepo;
+	}
+
+	/// Returns all logical elements of the save in the order they are stored in repository.
+	IdList logicalElements() const
+	{
+		IdList result;
+		for (const Id &element : mRepo.children(Id::rootId())) {
+			if (mRepo.isLogicalElement(element)) {
+				result << element;
+			}
+		}
+
+		return result;
+	}
+
+	/// Returns all graphical instances of the given logical element.
+	IdList graphicalIds(const Id &logicalId) const
+	{
+		return mGraphicalIds.values(logicalId);
+	}
+
+	/// Returns the first graphical instance of the given logical element or null id if it has no instances.
+	Id firstGraphicalId(const Id &logicalId) const
+	{
+		const IdList ids = graphicalIds(logicalId);
+		return ids.isEmpty() ? Id() : ids.last();
+	}
+
+	/// Must be called when converter creates new graphical instance of a logical element.
+	void registerGraphicalId(const Id &logicalId, const Id &graphicalId)
+	{
+		mGraphicalIds.insertMulti(logicalId, graphicalId);
+	}
+
+	/// Must be called when converter removes graphical instance of a logical element.
+	void unregisterGraphicalId(const Id &logicalId, const Id &graphicalId)
+	{
+		mGraphicalIds.remove(logicalId, graphicalId);
+	}
+
+	/// Must be called when converter removes a logical element with all its graphical instances.
+	void unregisterLogicalId(const Id &logicalId)
+	{
+		mGraphicalIds.remove(logicalId);
+	}
+
+private:
+	qrRepo::RepoApi &mRepo;
+	QMultiHash<Id, Id> mGraphicalIds;
+};
+
+}
@@ -44,6 +44,7 @@ HEADERS += \
 	$$PWD/usedInterfaces/mainWindowDockInterface.h \
 	$$PWD/usedInterfaces/editorInterface.h \
 	$$PWD/projectConverter.h \
+	$$PWD/repoSnapshot.h \
 	$$PWD/hotKeyActionInfo.h \
 	$$PWD/systemEvents.h \
 	$$PWD/pluginInterface.h \
@@ -90,6 +90,15 @@ signals:
 	/// @param fileName Opened project location
 	void afterOpen(const QString &fileName);
 
+	/// Emitted each time when project manager is going to write current project into a file.
+	/// Components that postpone writing their changes into the repository must write them in handlers.
+	void beforeSave();
+
+	/// Emitted each time when project manager is going to close current project or to ask whether it should be
+	/// saved before closing. Components that postpone writing their changes into the repository must write them
+	/// in handlers.
+	void beforeClose();
+
 	/// Emitted each time when project manager has closed current project
 	void closed();
 };
@@ -21,6 +21,8 @@
 #include <qrgui/models/models.h>
 #include <qrrepo/exceptions/qrrepoException.h>
 
+#include "qrgui/systemFacade/components/repositoryConverter.h"
+
 using namespace qReal;
 
 ProjectManager::ProjectManager(models::Models &models)
@@ -135,6 +137,8 @@ bool ProjectManager::openProject(const QString &fileName)
 		return false;
 	}
 
+	const bool repositoryConverted = convertRepository();
+
 	try {
 		mModels.reinit();
 	} catch (qReal::Exception & error) {
@@ -142,7 +146,7 @@ bool ProjectManager::openProject(const QString &fileName)
 		QLOG_ERROR() << error.message();
 		return false;
 	}
-	if (!pluginsEnough() || !checkVersions() || !checkForUnknownElements()) {
+	if (!repositoryConverted || !pluginsEnough() || !checkVersions() || !checkForUnknownElements()) {
 		// restoring the session
 		if (someProjectWasOpened) {
 			mSomeProjectOpened = open(mSaveFilePath);
@@ -234,6 +238,34 @@ void ProjectManager::checkNeededPluginsRecursive(const details::ModelsAssistInte
 	}
 }
 
+void ProjectManager::addProjectConverters(const QList<ProjectConverter> &converters)
+{
+	for (const ProjectConverter &converter : converters) {
+		mProjectConverters.insert(std::make_pair(converter.editor(), converter));
+	}
+}
+
+bool ProjectManager::convertRepository()
+{
+	RepositoryConverter converter(mModels.mutableRepoApi()
+			, mModels.logicalModelAssistApi().editorManagerInterface(), mProjectConverters);
+	switch (converter.convert()) {
+	case ProjectConverter::Success:
+	case ProjectConverter::NoModificationsMade:
+		return true;
+	case ProjectConverter::VersionTooOld:
+		showMessage(tr("Can`t open project file"), tr("This project was created by too old version %1 of the editor "
+				"and can`t be converted to the current one.").arg(converter.failedSaveVersion().toString()));
+		return false;
+	case ProjectConverter::SaveInvalid:
+		break;
+	}
+
+	showMessage(tr("Can`t open project file"), tr("The attempt to automaticly convert this project "
+			"to the current enviroment version failed and thus save file can`t be opened."));
+	return false;
+}
+
 bool ProjectManager::checkVersions()
 {
 	/// @todo: Versions validation must occure in console mode too
@@ -280,6 +312,7 @@ bool ProjectManager::openEmptyWithSuggestToSaveChanges()
 
 void ProjectManager::close()
 {
+	emit beforeClose();
 	mAutosaver.removeAutoSave();
 	mAutosaver.removeTemp();
 	mSomeProjectOpened = false;
@@ -290,6 +323,7 @@ void ProjectManager::close()
 
 bool ProjectManager::saveTo(const QString &fileName)
 {
+	emit beforeSave();
 	QLOG_INFO() << "Saving project into" << fileName;
 	return mModels.repoControlApi().saveTo(fileName);
 }
@@ -337,6 +371,7 @@ bool ProjectManager::saveAs(const QString &fileName)
 		return false;
 	}
 
+	emit beforeSave();
 	mAutosaver.removeAutoSave();
 	if (mModels.repoControlApi().saveTo(workingFileName)) {
 		setSaveFilePath(workingFileName);
@@ -14,8 +14,11 @@
 
 #pragma once
 
+#include <map>
+
 #include <QtCore/QFileInfo>
 
+#include <qrgui/plugins/toolPluginInterface/projectConverter.h>
 #include <qrgui/plugins/toolPluginInterface/usedInterfaces/projectManagementInterface.h>
 #include <qrgui/models/models.h>
 #include "qrgui/systemFacade/components/autosaver.h"
@@ -59,6 +62,9 @@ public:
 	QString saveFilePath() const override;
 	void setSaveFilePath(const QString &filePath = QString());
 
+	/// Registers converters applied to raw repository contents of opened saves made by older editor versions.
+	void addProjectConverters(const QList<ProjectConverter> &converters);
+
 	/// Prompts user to restore last session if it was incorrectly terminated
 	/// and returns yes if he agrees. Otherwise returns false
 	bool restoreIncorrectlyTerminated();
@@ -80,6 +86,9 @@ protected:
 	void checkNeededPluginsRecursive(const details::ModelsAssistInterface &api, const Id &id
 			, QStringList &result) const;
 
+	/// Converts raw repository contents of the opened save before models are built. Returns false if the save
+	/// can not be converted and thus opened.
+	virtual bool convertRepository();
 	virtual bool checkVersions();
 	bool checkForUnknownElements();
 
@@ -99,6 +108,7 @@ protected:
 	bool mUnsavedIndicator;
 	QString mSaveFilePath;
 	bool mSomeProjectOpened;
+	std::multimap<QString, ProjectConverter> mProjectConverters;
 };
 
 }
@@ -0,0 +1,229 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "repositoryConverter.h"
+
+#include <algorithm>
+
+#include <QtCore/QDebug>
+#include <QtCore/QScopedPointer>
+#include <QtCore/QSet>
+
+#include <qrrepo/repoApi.h>
+#include <qrgui/plugins/pluginManager/editorManagerInterface.h>
+
+using namespace qReal;
+
+RepositoryConverter::RepositoryConverter(qrRepo::RepoApi &repo
+		, const EditorManagerInterface &editorManager
+		, const std::multimap<QString, ProjectConverter> &converters)
+	: mRepo(repo)
+	, mEditorManager(editorManager)
+	, mConverters(converters)
+{
+}
+
+ProjectConverter::ConvertionResult RepositoryConverter::convert()
+{
+	mConvertedVersions.clear();
+	mFailedSaveVersion = Version();
+
+	const IdList loadedEditors = mEditorManager.editors();
+	QSet<QString> editorsToCheck;
+	for (const Id &element : mRepo.children(Id::rootId())) {
+		if (mRepo.isLogicalElement(element)) {
+			editorsToCheck << element.editor();
+		}
+	}
+
+	const QStringList metaInformationKeys = mRepo.metaInformationKeys();
+	QScopedPointer<RepoSnapshot> snapshot;
+	bool modificationsMade = false;
+
+	for (const QString &editor : editorsToCheck) {
+		if (!loadedEditors.contains(Id(editor))) {
+			// Missing plugins will be reported after models are built.
+			continue;
+		}
+
+		const QString versionKey = editor + "Version";
+		const Version currentVersion = mEditorManager.version(Id(editor));
+		const Version savedVersion = metaInformationKeys.contains(versionKey)
+				? Version::fromString(mRepo.metaInformation(versionKey).toString())
+				: Version();
+
+		if (currentVersion <= savedVersion) {
+			// Nothing to do or too old enviroment, the last case is reported by model-level validation.
+			continue;
+		}
+
+		QList<ProjectConverter> editorConverters;
+		const auto &range = mConverters.equal_range(editor);
+		for (auto i = range.first; i != range.second && i != mConverters.end(); ++i) {
+			editorConverters << i->second;
+		}
+
+		bool ok = true;
+		const QList<ProjectConverter> toApply = applicableConverters(currentVersion, savedVersion
+				, editorConverters, ok);
+		if (!ok) {
+			mFailedSaveVersion = savedVersion;
+			return ProjectConverter::SaveInvalid;
+		}
+
+		const bool allRepoConverters = std::all_of(toApply.begin(), toApply.end()
+				, [](const ProjectConverter &converter) { return converter.isRepoConverter(); });
+		if (!allRepoConverters) {
+			// Model-level converters need models, so this editor will be converted after models are built.
+			continue;
+		}
+
+		if (!snapshot) {
+			snapshot.reset(new RepoSnapshot(mRepo));
+		}
+
+		const ProjectConverter::ConvertionResult result = toApply.isEmpty()
+				? ProjectConverter::NoModificationsMade
+				: runRepoConverters(toApply, *snapshot, mEditorManager);
+		if (result != ProjectConverter::Success && result != ProjectConverter::NoModificationsMade) {
+			mFailedSaveVersion = savedVersion;
+			return result;
+		}
+
+		if (result == ProjectConverter::Success) {
+			modificationsMade = true;
+			mConvertedVersions << qMakePair(savedVersion, currentVersion);
+		}
+
+		// Marking save as converted even if nothing changed, so model-level validation will not run it again.
+		mRepo.setMetaInformation(versionKey, currentVersion.toString());
+	}
+
+	return modificationsMade ? ProjectConverter::Success : ProjectConverter::NoModificationsMade;
+}
+
+QList<QPair<Version, Version>> RepositoryConverter::convertedVersions() const
+{
+	return mConvertedVersions;
+}
+
+Version RepositoryConverter::failedSaveVersion() const
+{
+	return mFailedSaveVersion;
+}
+
+QList<ProjectConverter> RepositoryConverter::applicableConverters(const Version &enviromentVersion
+		, const Version &saveVersion
+		, QList<ProjectConverter> const &converters
+		, bool &ok)
+{
+	// Stage I: Sorting converters by versions
+	QList<ProjectConverter> sortedConverters = converters;
+	std::sort(sortedConverters.begin(), sortedConverters.end()
+		, [=](const ProjectConverter &converter1, const ProjectConverter &converter2)
+	{
+		return converter1.fromVersion() < converter2.fromVersion();
+	});
+
+	// Stage II: Checking that versions are not overlapped
+	for (int index = 0; index < sortedConverters.count() - 1; ++index) {
+		if (sortedConverters[index].toVersion() > sortedConverters[index + 1].fromVersion()) {
+			qWarning() << "Converter versions are overlapped!";
+			ok = false;
+			return {};
+		}
+	}
+
+	// Stage III: Filtering converters by versions
+	QList<ProjectConverter> result;
+	for (const ProjectConverter &converter : sortedConverters) {
+		if (converter.fromVersion() >= saveVersion && converter.toVersion() <= enviromentVersion) {
+			result << converter;
+		}
+	}
+
+	ok = true;
+	return result;
+}
+
+ProjectConverter::ConvertionResult RepositoryConverter::runRepoConverters(
+		QList<ProjectConverter> const &converters
+		, RepoSnapshot &snapshot
+		, const EditorManagerInterface &editorManager)
+{
+	bool modificationsMade = false;
+
+	// Steps are executed in version order. Consecutive element steps are fused into one pass, but a project step
+	// must see the save already processed by element steps of all earlier converters, so it ends the pass.
+	QList<const ProjectConverter *> elementSteps;
+	for (const ProjectConverter &converter : converters) {
+		if (converter.hasProjectRewriter()) {
+			runElementSteps(elementSteps, snapshot, editorManager, modificationsMade);
+			elementSteps.clear();
+
+			const ProjectConverter::ConvertionResult result = converter.rewriteProject(snapshot);
+			switch (result) {
+			case ProjectConverter::Success:
+				modificationsMade = true;
+				break;
+			case ProjectConverter::NoModificationsMade:
+				break;
+			default:
+				return result;
+			}
+		}
+
+		if (converter.hasElementRewriter()) {
+			elementSteps << &converter;
+		}
+	}
+
+	runElementSteps(elementSteps, snapshot, editorManager, modificationsMade);
+	return modificationsMade ? ProjectConverter::Success : ProjectConverter::NoModificationsMade;
+}
+
+void RepositoryConverter::runElementSteps(QList<const ProjectConverter *> const &steps
+		, RepoSnapshot &snapshot
+		, const EditorManagerInterface &editorManager
+		, bool &modificationsMade)
+{
+	if (steps.isEmpty()) {
+		return;
+	}
+
+	// Every element of converted editor is visited once and passed through the whole chain of steps.
+	// Nodes are visited before edges, so edges see already recreated nodes.
+	const QString editor = steps.first()->editor();
+	IdList nodes;
+	IdList edges;
+	for (const Id &element : snapshot.logicalElements()) {
+		if (element.editor() != editor) {
+			continue;
+		}
+
+		const bool isEdge = editorManager.hasElement(element.type())
+				&& editorManager.isNodeOrEdge(element.type()) < 0;
+		(isEdge ? edges : nodes) << element;
+	}
+
+	for (Id element : nodes + edges) {
+		for (const ProjectConverter *step : steps) {
+			element = step->rewriteElement(element, snapshot, modificationsMade);
+			if (element.isNull()) {
+				// Element was deleted by this step.
+				break;
+			}
+		}
+	}
+}
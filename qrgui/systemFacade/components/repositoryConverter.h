@@ -0,0 +1,82 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <map>
+
+#include <QtCore/QPair>
+
+#include <qrgui/plugins/toolPluginInterface/projectConverter.h>
+
+#include "qrgui/systemFacade/systemFacadeDeclSpec.h"
+
+namespace qrRepo {
+class RepoApi;
+}
+
+namespace qReal {
+
+class EditorManagerInterface;
+
+/// Converts raw repository contents of an opened save before models are built. Only editors for which all
+/// applicable converters are repository-level ones are converted here, consecutive element steps of such converters
+/// are composed and executed in a single pass over the save. Other editors are left for model-level convertion.
+/// Used both by GUI and console project managers, so saves are converted the same way everywhere.
+class QRGUI_SYSTEM_FACADE_EXPORT RepositoryConverter
+{
+public:
+	RepositoryConverter(qrRepo::RepoApi &repo
+			, const EditorManagerInterface &editorManager
+			, const std::multimap<QString, ProjectConverter> &converters);
+
+	/// Performs convertion. Returns Success if something was converted, NoModificationsMade if nothing changed,
+	/// SaveInvalid or VersionTooOld if the save can not be opened.
+	ProjectConverter::ConvertionResult convert();
+
+	/// Returns pairs of save and current versions of editors converted by the last convert() call.
+	QList<QPair<Version, Version>> convertedVersions() const;
+
+	/// Returns save version of the editor which failed to convert.
+	Version failedSaveVersion() const;
+
+	/// Returns converters from \a converters that must be applied to transform save of \a saveVersion
+	/// to \a enviromentVersion, sorted by versions. Sets \a ok to false if converter versions are overlapped.
+	static QList<ProjectConverter> applicableConverters(const Version &enviromentVersion
+			, const Version &saveVersion
+			, QList<ProjectConverter> const &converters
+			, bool &ok);
+
+	/// Composes given repository-level converters of one editor into one program and executes it over
+	/// repository contents. Converters must be sorted by versions, each project step is executed after
+	/// element steps of all preceding converters.
+	static ProjectConverter::ConvertionResult runRepoConverters(QList<ProjectConverter> const &converters
+			, RepoSnapshot &snapshot
+			, const EditorManagerInterface &editorManager);
+
+private:
+	/// Executes given element steps in one pass over elements of the save.
+	static void runElementSteps(QList<const ProjectConverter *> const &steps
+			, RepoSnapshot &snapshot
+			, const EditorManagerInterface &editorManager
+			, bool &modificationsMade);
+
+	qrRepo::RepoApi &mRepo;
+	const EditorManagerInterface &mEditorManager;
+	const std::multimap<QString, ProjectConverter> mConverters;
+	QList<QPair<Version, Version>> mConvertedVersions;
+	Version mFailedSaveVersion;
+};
+
+}
@@ -20,7 +20,7 @@ include(../../global.pri)
 
 QT += widgets
 
-links(qrkernel qrutils qrgui-models qrgui-plugin-manager qrgui-text-editor qrgui-tool-plugin-interface)
+links(qrkernel qrutils qrrepo qrgui-models qrgui-plugin-manager qrgui-text-editor qrgui-tool-plugin-interface)
 
 TRANSLATIONS = \
 	$$PWD/../../qrtranslations/ru/qrgui_system_facade_ru.ts \
@@ -36,6 +36,7 @@ HEADERS += \
 	$$PWD/components/nullTextManager.h \
 	$$PWD/components/projectManager.h \
 	$$PWD/components/autosaver.h \
+	$$PWD/components/repositoryConverter.h \
 	$$PWD/components/nullMainWindow.h \
 
 SOURCES += \
@@ -45,4 +46,5 @@ SOURCES += \
 	$$PWD/components/nullTextManager.cpp \
 	$$PWD/components/projectManager.cpp \
 	$$PWD/components/autosaver.cpp \
+	$$PWD/components/repositoryConverter.cpp \
 	$$PWD/components/nullMainWindow.cpp \
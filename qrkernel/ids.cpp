@@ -15,69 +15,129 @@
 #include "ids.h"
 
 #include <QtCore/QVariant>
-#include <QtCore/QUuid>
+
+#include "private/symbolTable.h"
 
 using namespace qReal;
 
+namespace {
+
+/// Type part of an Id: editor, diagram and element names.
+struct TypeTriple
+{
+	QString editor;
+	QString diagram;
+	QString element;
+};
+
+bool operator==(const TypeTriple &t1, const TypeTriple &t2)
+{
+	return t1.editor == t2.editor && t1.diagram == t2.diagram && t1.element == t2.element;
+}
+
+uint qHash(const TypeTriple &key)
+{
+	return qHash(key.editor) ^ (qHash(key.diagram) * 31) ^ (qHash(key.element) * 961);
+}
+
+// Tables are intentionally never destroyed, Ids may be used by other static objects on exit.
+details::SymbolTable<TypeTriple> &types()
+{
+	static auto * const table = new details::SymbolTable<TypeTriple>();
+	return *table;
+}
+
+details::SymbolTable<QString> &idSymbols()
+{
+	static auto * const table = new details::SymbolTable<QString>();
+	return *table;
+}
+
+quint32 internType(const QString &editor, const QString &diagram, const QString &element)
+{
+	return types().intern({editor, diagram, element});
+}
+
+/// Compares UUIDs in the same order as their string representations. QUuid::operator<() can not be used
+/// since it compares variants first.
+bool uuidLess(const QUuid &u1, const QUuid &u2)
+{
+	if (u1.data1 != u2.data1) {
+		return u1.data1 < u2.data1;
+	}
+
+	if (u1.data2 != u2.data2) {
+		return u1.data2 < u2.data2;
+	}
+
+	if (u1.data3 != u2.data3) {
+		return u1.data3 < u2.data3;
+	}
+
+	for (int i = 0; i < 8; ++i) {
+		if (u1.data4[i] != u2.data4[i]) {
+			return u1.data4[i] < u2.data4[i];
+		}
+	}
+
+	return false;
+}
+
+}
+
 Id Id::loadFromString(const QString &string)
 {
 	const QStringList path = string.split('/');
 	Q_ASSERT(path.count() > 0 && path.count() <= 5);
 	Q_ASSERT(path[0] == "qrm:");
 
+	const QString empty;
 	Id result;
-	switch (path.count()) {
-	case 5: result.mId = path[4];
-		// Fall-thru
-	case 4: result.mElement = path[3];
-		// Fall-thru
-	case 3: result.mDiagram = path[2];
-		// Fall-thru
-	case 2: result.mEditor = path[1];
-		// Fall-thru
-	}
+	result.mType = internType(path.value(1, empty), path.value(2, empty), path.value(3, empty));
+	result.setIdPart(path.value(4, empty));
 	Q_ASSERT(string == result.toString());
 	return result;
 }
 
 Id Id::createElementId(const QString &editor, const QString &diagram, const QString &element)
 {
-	return Id(editor, diagram, element, QUuid::createUuid().toString());
+	Id result(editor, diagram, element);
+	result.mUuid = QUuid::createUuid();
+	return result;
 }
 
 Id Id::rootId()
 {
-	return Id("ROOT_ID", "ROOT_ID", "ROOT_ID", "ROOT_ID");
+	static const Id root("ROOT_ID", "ROOT_ID", "ROOT_ID", "ROOT_ID");
+	return root;
 }
 
 Id::Id(const QString &editor, QString  const &diagram, QString  const &element, QString  const &id)
-		: mEditor(editor)
-		, mDiagram(diagram)
-		, mElement(element)
-		, mId(id)
+		: mType(internType(editor, diagram, element))
 {
+	setIdPart(id);
 	Q_ASSERT(checkIntegrity());
 }
 
 Id::Id(const Id &base, const QString &additional)
-		: mEditor(base.mEditor)
-		, mDiagram(base.mDiagram)
-		, mElement(base.mElement)
-		, mId(base.mId)
+		: mType(base.mType)
+		, mIdSymbol(base.mIdSymbol)
+		, mUuid(base.mUuid)
 {
+	const TypeTriple type = types().value(mType);
 	const unsigned baseSize = base.idSize();
 	switch (baseSize) {
 	case 0:
-		mEditor = additional;
+		mType = internType(additional, type.diagram, type.element);
 		break;
 	case 1:
-		mDiagram = additional;
+		mType = internType(type.editor, additional, type.element);
 		break;
 	case 2:
-		mElement = additional;
+		mType = internType(type.editor, type.diagram, additional);
 		break;
 	case 3:
-		mId = additional;
+		setIdPart(additional);
 		break;
 	default:
 		Q_ASSERT(!"Can not add a part to Id, it will be too long");
@@ -85,52 +145,75 @@ Id::Id(const Id &base, const QString &additional)
 	Q_ASSERT(checkIntegrity());
 }
 
+void Id::setIdPart(const QString &id)
+{
+	mIdSymbol = 0;
+	mUuid = QUuid();
+	if (id.isEmpty()) {
+		return;
+	}
+
+	// Only canonical form goes to UUID, otherwise string representation could not be restored exactly.
+	// Null UUID is reserved for Ids without id part.
+	const QUuid uuid(id);
+	if (!uuid.isNull() && uuid.toString() == id) {
+		mUuid = uuid;
+	} else {
+		mIdSymbol = idSymbols().intern(id);
+	}
+}
 
 bool Id::isNull() const
 {
-	return mEditor.isEmpty() && mDiagram.isEmpty()
-			&& mElement.isEmpty() && mId.isEmpty();
+	return mType == 0 && mIdSymbol == 0 && mUuid.isNull();
 }
 
 QString Id::editor() const
 {
-	return mEditor;
+	return types().value(mType).editor;
 }
 
 QString Id::diagram() const
 {
-	return mDiagram;
+	return types().value(mType).diagram;
 }
 
 QString Id::element() const
 {
-	return mElement;
+	return types().value(mType).element;
 }
 
 QString Id::id() const
 {
-	return mId;
+	return mIdSymbol ? idSymbols().value(mIdSymbol) : mUuid.isNull() ? QString() : mUuid.toString();
 }
 
 Id Id::type() const
 {
-	return Id(mEditor, mDiagram, mElement);
+	Id result;
+	result.mType = mType;
+	return result;
 }
 
 Id Id::sameTypeId() const
 {
-	return Id(mEditor, mDiagram, mElement, QUuid::createUuid().toString());
+	Id result = type();
+	result.mUuid = QUuid::createUuid();
+	return result;
 }
 
 unsigned Id::idSize() const
 {
-	if (!mId.isEmpty()) {
+	if (mIdSymbol || !mUuid.isNull()) {
 		return 4;
-	} if (!mElement.isEmpty()) {
+	}
+
+	const TypeTriple &type = types().value(mType);
+	if (!type.element.isEmpty()) {
 		return 3;
-	} if (!mDiagram.isEmpty()) {
+	} if (!type.diagram.isEmpty()) {
 		return 2;
-	} if (!mEditor.isEmpty()) {
+	} if (!type.editor.isEmpty()) {
 		return 1;
 	}
 	return 0;
@@ -143,44 +226,71 @@ QUrl Id::toUrl() const
 
 QString Id::toString() const
 {
-	QString path = "qrm:/" + mEditor;
-	if (mDiagram != "") {
-		path += "/" + mDiagram;
-	} if (mElement != "") {
-		path += "/" + mElement;
-	} if (mId != "") {
-		path += "/" + mId;
+	const TypeTriple &type = types().value(mType);
+	const QString id = this->id();
+	QString path = "qrm:/" + type.editor;
+	if (!type.diagram.isEmpty()) {
+		path += "/" + type.diagram;
+	} if (!type.element.isEmpty()) {
+		path += "/" + type.element;
+	} if (!id.isEmpty()) {
+		path += "/" + id;
 	}
 	return path;
 }
 
+QStringList Id::parts() const
+{
+	const TypeTriple &type = types().value(mType);
+	return (QStringList() << type.editor << type.diagram << type.element << id()).mid(0, idSize());
+}
+
 bool Id::checkIntegrity() const
 {
+	const TypeTriple &type = types().value(mType);
 	bool emptyPartsAllowed = true;
 
-	if (!mId.isEmpty()) {
+	if (mIdSymbol || !mUuid.isNull()) {
 		emptyPartsAllowed = false;
 	}
 
-	if (!mElement.isEmpty()) {
+	if (!type.element.isEmpty()) {
 		emptyPartsAllowed = false;
 	} else if (!emptyPartsAllowed) {
 		return false;
 	}
 
-	if (!mDiagram.isEmpty()) {
+	if (!type.diagram.isEmpty()) {
 		emptyPartsAllowed = false;
 	} else if (!emptyPartsAllowed) {
 		return false;
 	}
 
-	if (mEditor.isEmpty() && !emptyPartsAllowed) {
+	if (type.editor.isEmpty() && !emptyPartsAllowed) {
 		return false;
 	}
 
 	return true;
 }
 
+bool qReal::operator<(const Id &i1, const Id &i2)
+{
+	if (i1.mType != i2.mType) {
+		const TypeTriple &t1 = types().value(i1.mType);
+		const TypeTriple &t2 = types().value(i2.mType);
+		return t1.editor != t2.editor ? t1.editor < t2.editor
+				: t1.diagram != t2.diagram ? t1.diagram < t2.diagram
+				: t1.element < t2.element;
+	}
+
+	if (!i1.mIdSymbol && !i2.mIdSymbol) {
+		// Null UUID stands for empty id part and is less than any other UUID, as empty string is.
+		return uuidLess(i1.mUuid, i2.mUuid);
+	}
+
+	return i1.mIdSymbol != i2.mIdSymbol && i1.id() < i2.id();
+}
+
 QVariant Id::toVariant() const
 {
 	QVariant result;
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <QtCore/QUrl>
+#include <QtCore/QUuid>
 #include <QtCore/QDebug>
 
 #include "kernelDeclSpec.h"
@@ -25,6 +26,9 @@ namespace qReal {
 /// editor (metamodel to which our element belongs to), diagram in that editor
 /// (a tab in palette where this element will appear), element (type of
 /// an element, actually), id (id of an element).
+/// Internally type parts are interned in a global symbol table and id part is stored as 128-bit UUID
+/// (or also interned if it is not an UUID in canonical form), so copying, comparing and hashing Ids
+/// does not touch strings at all.
 class QRKERNEL_EXPORT Id
 {
 public:
@@ -96,6 +100,9 @@ public:
 	/// Converts Id to string in format "qrm:/<editor>/<diagram>/<element>/<id>".
 	QString toString() const;
 
+	/// Returns first idSize() parts of an Id, in the same order as in string representation.
+	QStringList parts() const;
+
 	/// Returns number of parts Id has.
 	unsigned idSize() const;
 
@@ -113,23 +120,27 @@ private:
 	/// Used only for debug. Checks that Id is correct.
 	bool checkIntegrity() const;
 
-	QString mEditor;
-	QString mDiagram;
-	QString mElement;
-	QString mId;
+	/// Sets id part of an Id, as UUID if possible, as interned string otherwise.
+	void setIdPart(const QString &id);
+
+	/// Index of editor, diagram and element parts triple in global symbol table, 0 for empty triple.
+	quint32 mType = 0;
+
+	/// Index of id part in global symbol table if it is not an UUID in canonical form, 0 otherwise.
+	quint32 mIdSymbol = 0;
+
+	/// Id part if it is a non-null UUID in canonical form.
+	QUuid mUuid;
 
 	friend bool operator==(const Id &i1, const Id &i2);
-	friend bool operator<(const Id &i1, const Id &i2);
+	friend QRKERNEL_EXPORT bool operator<(const Id &i1, const Id &i2);
 	friend uint qHash(const Id &key);
 };
 
 /// Id equality operator. Ids are equal when all their parts are equal.
 inline bool operator==(const Id &i1, const Id &i2)
 {
-	return i1.mEditor == i2.mEditor
-			&& i1.mDiagram == i2.mDiagram
-			&& i1.mElement == i2.mElement
-			&& i1.mId == i2.mId;
+	return i1.mType == i2.mType && i1.mIdSymbol == i2.mIdSymbol && i1.mUuid == i2.mUuid;
 }
 
 /// Id inequality operator.
@@ -138,20 +149,14 @@ inline bool operator!=(const Id &i1, const Id &i2)
 	return !(i1 == i2);
 }
 
-/// Comparison operator for using Id in maps
-inline bool operator<(const Id &i1, const Id &i2)
-{
-	// Faster implementation then just comapring toString().
-	return i1.mEditor != i2.mEditor ? i1.mEditor < i2.mEditor
-			: i1.mDiagram != i2.mDiagram ? i1.mDiagram < i2.mDiagram
-			: i1.mElement != i2.mElement ? i1.mElement < i2.mElement
-			: i1.mId < i2.mId;
-}
+/// Comparison operator for using Id in maps. Orders Ids lexicographically by their parts.
+QRKERNEL_EXPORT bool operator<(const Id &i1, const Id &i2);
 
 /// Hash function for Id for using it in QHash.
 inline uint qHash(const Id &key)
 {
-	return qHash(key.mEditor) ^ qHash(key.mDiagram) ^ qHash(key.mElement) ^ qHash(key.mId);
+	// UUIDs are random, so their first 32 bits are already a good hash.
+	return key.mUuid.data1 ^ (key.mType * 2654435761u) ^ (key.mIdSymbol << 16 | key.mIdSymbol >> 16);
 }
 
 /// Operator for printing Id in QDebug.
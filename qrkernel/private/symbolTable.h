@@ -0,0 +1,104 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <atomic>
+
+#include <QtCore/QHash>
+#include <QtCore/QReadWriteLock>
+
+#include "qrkernel/exception/exception.h"
+
+namespace qReal {
+namespace details {
+
+/// Thread-safe append-only table of interned values. Every distinct value gets stable dense index,
+/// index 0 is reserved for default-constructed value. Values are stored in pages that are never moved or freed,
+/// so getting value by index needs no locking, only interning of a new value takes a lock.
+template<typename T>
+class SymbolTable
+{
+	Q_DISABLE_COPY(SymbolTable)
+public:
+	SymbolTable()
+	{
+		for (std::atomic<T *> &page : mPages) {
+			page.store(nullptr, std::memory_order_relaxed);
+		}
+
+		mPages[0].store(new T[pageSize], std::memory_order_release);
+		mIndices.insert(T(), 0);
+		mCount = 1;
+	}
+
+	~SymbolTable()
+	{
+		for (std::atomic<T *> &page : mPages) {
+			delete[] page.load(std::memory_order_relaxed);
+		}
+	}
+
+	/// Returns index of given value, adding it to the table if it is not there yet.
+	quint32 intern(const T &value)
+	{
+		{
+			QReadLocker locker(&mLock);
+			const auto existing = mIndices.constFind(value);
+			if (existing != mIndices.constEnd()) {
+				return existing.value();
+			}
+		}
+
+		QWriteLocker locker(&mLock);
+		const auto existing = mIndices.constFind(value);
+		if (existing != mIndices.constEnd()) {
+			return existing.value();
+		}
+
+		if (mCount == pageSize * pagesCount) {
+			throw Exception("Symbol table overflow");
+		}
+
+		const quint32 index = mCount;
+		T *page = mPages[index / pageSize].load(std::memory_order_relaxed);
+		if (!page) {
+			page = new T[pageSize];
+			mPages[index / pageSize].store(page, std::memory_order_release);
+		}
+
+		page[index % pageSize] = value;
+		mIndices.insert(value, index);
+		++mCount;
+		return index;
+	}
+
+	/// Returns value with given index. Index must be obtained from intern() of this table.
+	const T &value(quint32 index) const
+	{
+		return mPages[index / pageSize].load(std::memory_order_acquire)[index % pageSize];
+	}
+
+private:
+	static const quint32 pageSize = 1024;
+	static const quint32 pagesCount = 4096;
+
+	std::atomic<T *> mPages[pagesCount];
+	QHash<T, quint32> mIndices;
+	quint32 mCount;
+	QReadWriteLock mLock;
+};
+
+}
+}
@@ -20,12 +20,14 @@ HEADERS += \
 	$$PWD/roles.h \
 	$$PWD/settingsManager.h \
 	$$PWD/settingsListener.h \
+	$$PWD/settingsKey.h \
 	$$PWD/kernelDeclSpec.h \
 	$$PWD/timeMeasurer.h \
 	$$PWD/version.h \
 	$$PWD/logging.h \
 	$$PWD/platformInfo.h \
 	$$PWD/private/listeners.h \
+	$$PWD/private/symbolTable.h \
 
 SOURCES += \
 	$$PWD/ids.cpp \
@@ -0,0 +1,67 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <atomic>
+
+#include "qrkernel/settingsManager.h"
+
+namespace qReal {
+
+/// Typed settings key that is declared once and resolved to a slot in SettingsManager snapshot on first use.
+/// Reading value by such key takes neither locks nor string hashing, so it can be used on hot paths and from
+/// any thread. Typical usage:
+///     static const SettingsKey<int> stackSize("interpreterStackSize");
+///     ...
+///     if (stack.count() >= stackSize.value()) { ... }
+template<typename T>
+class SettingsKey
+{
+	Q_DISABLE_COPY(SettingsKey)
+public:
+	/// Constructor.
+	/// @param name Name of a setting, the same as used in SettingsManager::value().
+	/// @param defaultValue Value that is returned when setting is present neither in settings nor in defaults.
+	explicit SettingsKey(const QString &name, const T &defaultValue = T())
+		: mName(name)
+		, mDefaultValue(defaultValue)
+	{
+	}
+
+	/// Returns name of a setting.
+	QString name() const
+	{
+		return mName;
+	}
+
+	/// Returns current value of a setting.
+	T value() const
+	{
+		int slot = mSlot.load(std::memory_order_acquire);
+		if (slot < 0) {
+			slot = SettingsManager::registerKey(mName, QVariant::fromValue(mDefaultValue));
+			mSlot.store(slot, std::memory_order_release);
+		}
+
+		return SettingsManager::snapshotValue(slot).template value<T>();
+	}
+
+private:
+	const QString mName;
+	const T mDefaultValue;
+	mutable std::atomic<int> mSlot { -1 };
+};
+
+}
@@ -21,10 +21,10 @@
 
 using namespace qReal;
 
-SettingsManager* SettingsManager::mInstance = nullptr;
-
 SettingsManager::SettingsManager()
-	: mSettings(QSettings::IniFormat, QSettings::UserScope, "CyberTech Labs", "TRIK Studio")
+	: mSnapshot(new Snapshot())
+	, mReaders(0)
+	, mSettings(QSettings::IniFormat, QSettings::UserScope, "CyberTech Labs", "TRIK Studio")
 {
 	initDefaultValues();
 	load();
@@ -32,6 +32,8 @@ SettingsManager::SettingsManager()
 
 SettingsManager::~SettingsManager()
 {
+	qDeleteAll(mRetiredSnapshots);
+	delete mSnapshot.load();
 }
 
 void SettingsManager::setValue(const QString &name, const QVariant &value)
@@ -51,18 +53,67 @@ QVariant SettingsManager::value(const QString &key, const QVariant &defaultValue
 
 SettingsManager* SettingsManager::instance()
 {
-	if (mInstance == nullptr) {
-		mInstance = new SettingsManager();
+	// Initialization of local static is thread-safe, and typed keys may be read from any thread.
+	static SettingsManager * const instance = new SettingsManager();
+	return instance;
+}
+
+int SettingsManager::registerKey(const QString &name, const QVariant &defaultValue)
+{
+	SettingsManager * const manager = instance();
+	QMutexLocker locker(&manager->mWriteLock);
+	const auto existing = manager->mSlots.constFind(name);
+	if (existing != manager->mSlots.constEnd()) {
+		return existing.value();
+	}
+
+	const int slot = manager->mSlotNames.size();
+	manager->mSlots.insert(name, slot);
+	manager->mSlotNames << name;
+	manager->mSlotDefaults << defaultValue;
+	manager->publishSnapshot();
+	return slot;
+}
+
+QVariant SettingsManager::snapshotValue(int slot)
+{
+	SettingsManager * const manager = instance();
+	// Writer frees replaced snapshots only when there are no active readers, so the snapshot can not be deleted
+	// while we copy a value out of it.
+	++manager->mReaders;
+	const QVariant result = manager->mSnapshot.load()->values[slot];
+	--manager->mReaders;
+	return result;
+}
+
+void SettingsManager::publishSnapshot()
+{
+	Snapshot * const snapshot = new Snapshot();
+	snapshot->values.reserve(mSlotNames.size());
+	for (int slot = 0; slot < mSlotNames.size(); ++slot) {
+		snapshot->values << get(mSlotNames[slot], mSlotDefaults[slot]);
 	}
 
-	return mInstance;
+	mRetiredSnapshots << mSnapshot.exchange(snapshot);
+	if (mReaders.load() == 0) {
+		// Readers that come after this point will see only the new snapshot.
+		qDeleteAll(mRetiredSnapshots);
+		mRetiredSnapshots.clear();
+	}
 }
 
 void SettingsManager::set(const QString &name, const QVariant &value)
 {
 	const QVariant oldValue = this->value(name);
 	if (oldValue != value) {
-		mData[name] = value;
+		{
+			QMutexLocker locker(&mWriteLock);
+			mData[name] = value;
+			if (mSlots.contains(name)) {
+				publishSnapshot();
+			}
+		}
+
 		emit settingsChanged(name, oldValue, value);
 	}
 }
@@ -101,9 +152,12 @@ void SettingsManager::saveSettings(const QString &fileNameForExport)
 
 void SettingsManager::load()
 {
+	QMutexLocker locker(&mWriteLock);
 	for (const QString &name : mSettings.allKeys()) {
 		mData[name] = mSettings.value(name);
 	}
+
+	publishSnapshot();
 }
 
 void SettingsManager::loadSettings(const QString &fileNameForImport)
@@ -124,22 +178,43 @@ void SettingsManager::loadDefaultSettings(const QString &filePath)
 
 void SettingsManager::mergeSettings(const QString &fileNameForImport, QHash<QString, QVariant> &target)
 {
-	QSettings settings(fileNameForImport, QSettings::IniFormat);
-	for (const QString &name : settings.allKeys()) {
-		const QVariant newValue = settings.value(name);
-		const QVariant oldValue = target[name];
-		if (newValue != oldValue) {
-			target[name] = settings.value(name);
-			if (target == mData || !mData.contains(name)) {
-				emit settingsChanged(name, oldValue, newValue);
+	struct Change
+	{
+		QString name;
+		QVariant oldValue;
+		QVariant newValue;
+	};
+
+	// Notifications are sent only after new snapshot is published, so listeners see consistent typed values.
+	QList<Change> changes;
+	{
+		QMutexLocker locker(&mWriteLock);
+		QSettings settings(fileNameForImport, QSettings::IniFormat);
+		for (const QString &name : settings.allKeys()) {
+			const QVariant newValue = settings.value(name);
+			const QVariant oldValue = target[name];
+			if (newValue != oldValue) {
+				target[name] = settings.value(name);
+				if (&target == &mData || !mData.contains(name)) {
+					changes << Change{name, oldValue, newValue};
+				}
 			}
 		}
+
+		publishSnapshot();
+	}
+
+	for (const Change &change : changes) {
+		emit settingsChanged(change.name, change.oldValue, change.newValue);
 	}
 }
 
 void SettingsManager::clearSettings()
 {
-	instance()->mSettings.clear();
-	instance()->mData.clear();
-	instance()->mDefaultValues.clear();
+	SettingsManager * const manager = instance();
+	QMutexLocker locker(&manager->mWriteLock);
+	manager->mSettings.clear();
+	manager->mData.clear();
+	manager->mDefaultValues.clear();
+	manager->publishSnapshot();
 }
@@ -14,7 +14,10 @@
 
 #pragma once
 
+#include <atomic>
+
 #include <QtCore/QSettings>
+#include <QtCore/QMutex>
 #include <QtCore/QString>
 #include <QtCore/QHash>
 #include <QtCore/QVariant>
@@ -55,6 +58,15 @@ public:
 	/// Returns an instance of a singleton.
 	static SettingsManager *instance();
 
+	/// Registers a typed key and returns its slot in settings snapshots, registering the same name twice gives
+	/// the same slot. Used by SettingsKey, there is no need to call it directly.
+	/// @param defaultValue Value used when setting is present neither in settings nor in defaults.
+	static int registerKey(const QString &name, const QVariant &defaultValue);
+
+	/// Returns value from the current settings snapshot by a slot obtained from registerKey().
+	/// Takes no locks, may be called from any thread.
+	static QVariant snapshotValue(int slot);
+
 	/// Saves settings into persistent external storage (for example, Windows
 	/// registry), making them available to new instances of an application.
 	void saveData();
@@ -77,6 +89,12 @@ signals:
 	void settingsChanged(const QString &name, const QVariant &oldValue, const QVariant &newValue);
 
 private:
+	/// Immutable values of all registered typed keys, indexed by slot.
+	struct Snapshot
+	{
+		QVector<QVariant> values;
+	};
+
 	/// Private constructor.
 	SettingsManager();
 	~SettingsManager() override;
@@ -89,8 +107,26 @@ private:
 
 	void initDefaultValues();
 
-	/// Singleton sole instance.
-	static SettingsManager *mInstance;
+	/// Builds new snapshot from in-memory storage and atomically replaces current one with it.
+	/// Must be called with mWriteLock held.
+	void publishSnapshot();
+
+	/// Snapshot that is currently visible to readers of typed keys.
+	std::atomic<Snapshot *> mSnapshot;
+
+	/// Number of readers that are accessing some snapshot right now.
+	std::atomic<int> mReaders;
+
+	/// Replaced snapshots that may still be accessed by readers. Freed when no reader is active.
+	QList<Snapshot *> mRetiredSnapshots;
+
+	/// Slots of registered typed keys and their default values.
+	QHash<QString, int> mSlots;
+	QStringList mSlotNames;
+	QVector<QVariant> mSlotDefaults;
+
+	/// Serializes modifications of in-memory storage and snapshot publishing.
+	QMutex mWriteLock;
 
 	/// In-memory settings storage.
 	QHash<QString, QVariant> mData;
@@ -52,5 +52,10 @@ public:
 
 	/// Clear the meta-information.
 	virtual void clearMetaInformation() = 0;
+
+	/// Declares properties that elements of the given type are expected to have, usually all properties from
+	/// the metamodel. Elements created afterwards keep values of these properties in an array instead of
+	/// a map, other properties are still allowed. The declaration is shared by all repositories.
+	virtual void setPropertySchema(const qReal::Id &type, const QStringList &propertyNames) = 0;
 };
 }
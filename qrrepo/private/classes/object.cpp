@@ -21,6 +21,7 @@
 
 #include "logicalObject.h"
 #include "graphicalObject.h"
+#include "propertySchema.h"
 #include "qrrepo/private/valuesSerializer.h"
 
 using namespace qrRepo::details;
@@ -28,11 +29,13 @@ using namespace qReal;
 
 Object::Object(const Id &id)
 	: mId(id)
+	, mSchema(PropertySchema::forType(id.type()))
 {
 }
 
 Object::Object(const QDomElement &element)
 	: mId(Id::loadFromString(element.attribute("id", "")))
+	, mSchema(PropertySchema::forType(mId.type()))
 {
 	if (mId.isNull()) {
 		throw Exception("Id deserialization failed");
@@ -50,7 +53,9 @@ Object::Object(const QDomElement &element)
 	}
 
 	QDomElement properties = propertiesList.at(0).toElement();
-	ValuesSerializer::deserializeNamedVariantsMap(mProperties, properties);
+	QMap<QString, QVariant> values;
+	ValuesSerializer::deserializeNamedVariantsMap(values, properties);
+	setProperties(values);
 }
 
 Object::~Object()
@@ -59,9 +64,15 @@ Object::~Object()
 
 void Object::replaceProperties(const QString &value, const QString &newValue)
 {
-	for (const QVariant &val : mProperties.values()) {
+	for (QVariant &val : mValues) {
+		if (val.isValid() && val.toString().contains(value)) {
+			val = newValue;
+		}
+	}
+
+	for (QVariant &val : mDynamicProperties) {
 		if (val.toString().contains(value)) {
-			mProperties[mProperties.key(val)] = newValue;
+			val = newValue;
 		}
 	}
 }
@@ -79,8 +90,7 @@ Object *Object::clone(QHash<Id, Object*> &objHash) const
 		result->addChild(child->id());
 	}
 
-	// Using copy constructor.
-	result->mProperties = mProperties;
+	result->copyPropertiesFrom(*this);
 
 	return result;
 }
@@ -110,7 +120,13 @@ void Object::removeChild(const Id &child)
 
 void Object::copyPropertiesFrom(const Object &src)
 {
-	mProperties = src.mProperties;
+	if (mSchema == src.mSchema) {
+		// Both containers are implicitly shared, so this is cheap until one of the objects is modified.
+		mValues = src.mValues;
+		mDynamicProperties = src.mDynamicProperties;
+	} else {
+		setProperties(src.properties());
+	}
 }
 
 IdList Object::children() const
@@ -149,46 +165,66 @@ void Object::setProperty(const QString &name, const QVariant &value)
 		Q_ASSERT(!"Empty QVariant set as a property");
 	}
 
-	mProperties.insert(name,value);
+	storeProperty(name, value);
+}
+
+void Object::storeProperty(const QString &name, const QVariant &value)
+{
+	const int slot = mSchema ? mSchema->slot(name) : -1;
+	if (slot < 0) {
+		mDynamicProperties.insert(name, value);
+		return;
+	}
+
+	if (slot >= mValues.size()) {
+		mValues.resize(slot + 1);
+	}
+
+	mValues[slot] = value;
+}
+
+bool Object::containsProperty(const QString &name) const
+{
+	const int slot = mSchema ? mSchema->slot(name) : -1;
+	return slot < 0 ? mDynamicProperties.contains(name) : mValues.value(slot).isValid();
 }
 
 void Object::setProperties(QMap<QString, QVariant> const &properties)
 {
-	mProperties = properties;
+	mValues.clear();
+	mDynamicProperties.clear();
+	for (auto it = properties.cbegin(); it != properties.cend(); ++it) {
+		storeProperty(it.key(), it.value());
+	}
 }
 
 QVariant Object::property(const QString &name) const
 {
-	if (mProperties.contains(name)) {
-		return mProperties[name];
-	} else if (name == "backReferences") {
-		return QVariant();
-	} else {
-		// TODO: replace with exception when there is some kind of model migration tool
-		return QVariant();
-	}
+	// TODO: throw an exception for unknown properties when there is some kind of model migration tool
+	const int slot = mSchema ? mSchema->slot(name) : -1;
+	return slot < 0 ? mDynamicProperties.value(name) : mValues.value(slot);
 }
 
 void Object::setBackReference(const qReal::Id &reference)
 {
-	IdList references = mProperties["backReferences"].value<IdList>();
+	IdList references = property("backReferences").value<IdList>();
 	references << reference;
-	mProperties.insert("backReferences", qReal::IdListHelper::toVariant(references));
+	storeProperty("backReferences", qReal::IdListHelper::toVariant(references));
 }
 
 void Object::removeBackReference(const qReal::Id &reference)
 {
-	if (!mProperties.contains("backReferences")) {
+	if (!containsProperty("backReferences")) {
 		throw Exception("Object " + mId.toString() + ": removing nonexsistent reference " + reference.toString());
 	}
 
-	IdList references = mProperties["backReferences"].value<IdList>();
+	IdList references = property("backReferences").value<IdList>();
 	if (!references.contains(reference)) {
 		throw Exception("Object " + mId.toString() + ": removing nonexsistent reference " + reference.toString());
 	}
 
 	references.removeOne(reference);
-	mProperties.insert("backReferences", qReal::IdListHelper::toVariant(references));
+	storeProperty("backReferences", qReal::IdListHelper::toVariant(references));
 }
 
 void Object::setTemporaryRemovedLinks(const QString &direction, const qReal::IdList &listValue)
@@ -208,8 +244,8 @@ IdList Object::temporaryRemovedLinks() const
 
 void Object::removeTemporaryRemovedLinksAt(const QString &direction)
 {
-	if (mTemporaryRemovedLinks.contains(direction)) {
-		mProperties.remove(direction);
+	if (mTemporaryRemovedLinks.contains(direction) && containsProperty(direction)) {
+		removeProperty(direction);
 	}
 }
 
@@ -222,7 +258,7 @@ void Object::removeTemporaryRemovedLinks()
 
 bool Object::hasProperty(const QString &name, bool sensitivity, bool regExpression) const
 {
-	QStringList properties = mProperties.keys();
+	const QStringList properties = this->properties().keys();
 	Qt::CaseSensitivity caseSensitivity;
 
 	if (sensitivity) {
@@ -241,11 +277,16 @@ bool Object::hasProperty(const QString &name, bool sensitivity, bool regExpressi
 
 void Object::removeProperty(const QString &name)
 {
-	if (mProperties.contains(name)) {
-		mProperties.remove(name);
-	} else {
+	if (!containsProperty(name)) {
 		throw Exception("Object " + mId.toString() + ": removing nonexistent property " + name);
 	}
+
+	const int slot = mSchema ? mSchema->slot(name) : -1;
+	if (slot < 0) {
+		mDynamicProperties.remove(name);
+	} else {
+		mValues[slot] = QVariant();
+	}
 }
 
 Id Object::id() const
@@ -255,12 +296,20 @@ Id Object::id() const
 
 QMapIterator<QString, QVariant> Object::propertiesIterator() const
 {
-	return QMapIterator<QString, QVariant>(mProperties);
+	// Iterator keeps its own copy of the map.
+	return QMapIterator<QString, QVariant>(properties());
 }
 
 QMap<QString, QVariant> Object::properties() const
 {
-	return mProperties;
+	QMap<QString, QVariant> result = mDynamicProperties;
+	for (int slot = 0; slot < mValues.size(); ++slot) {
+		if (mValues[slot].isValid()) {
+			result.insert(mSchema->name(slot), mValues[slot]);
+		}
+	}
+
+	return result;
 }
 
 QDomElement Object::serialize(QDomDocument &document) const
@@ -269,6 +318,6 @@ QDomElement Object::serialize(QDomDocument &document) const
 	result.setAttribute("id", id().toString());
 	result.setAttribute("parent", parent().toString());
 	result.appendChild(ValuesSerializer::serializeIdList("children", children(), document));
-	result.appendChild(ValuesSerializer::serializeNamedVariantsMap("properties", mProperties, document));
+	result.appendChild(ValuesSerializer::serializeNamedVariantsMap("properties", properties(), document));
 	return result;
 }
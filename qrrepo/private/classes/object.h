@@ -17,16 +17,22 @@
 #include <qrkernel/ids.h>
 
 #include <QtCore/QMap>
+#include <QtCore/QSharedPointer>
 #include <QtCore/QVariant>
 #include <QtCore/QString>
+#include <QtCore/QVector>
 #include <QtXml/QDomDocument>
 #include <QtXml/QDomElement>
 
 namespace qrRepo {
 namespace details {
 
+class PropertySchema;
+
 /// Abstract class, general object in repository. Has id, parent, children and properties, able to
 /// serialize/deserialize and clone itself.
+/// Properties declared in the schema of element type are kept in an array indexed by the schema, other ones
+/// (and all properties of types without a schema) are kept in a map.
 class Object
 {
 	Q_DISABLE_COPY(Object)
@@ -94,8 +100,24 @@ protected:
 	const qReal::Id mId;
 	qReal::Id mParent;
 	qReal::IdList mChildren;
-	QMap<QString, QVariant> mProperties;
 	QMap<QString, qReal::IdList> mTemporaryRemovedLinks;
+
+private:
+	/// Returns true if the object has a property with exactly given name.
+	bool containsProperty(const QString &name) const;
+
+	/// Sets property value without checks.
+	void storeProperty(const QString &name, const QVariant &value);
+
+	/// Layout of mValues, may be null if element type has no schema.
+	const QSharedPointer<const PropertySchema> mSchema;
+
+	/// Values of properties from the schema indexed by their slots, invalid value means there is no such property.
+	/// Has no more elements than needed to hold the last set property.
+	QVector<QVariant> mValues;
+
+	/// Properties that are not in the schema.
+	QMap<QString, QVariant> mDynamicProperties;
 };
 
 }
@@ -0,0 +1,82 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "propertySchema.h"
+
+#include <QtCore/QReadWriteLock>
+
+using namespace qrRepo::details;
+using namespace qReal;
+
+namespace {
+
+/// Properties the repository sets itself. Properties of graphical objects go first, so graphical objects
+/// that have only them keep short value arrays.
+const QStringList systemProperties = {
+	"name", "from", "to", "fromPort", "toPort", "links", "position", "configuration"
+	, "outgoingExplosion", "incomingExplosions", "backReferences", "linkShape"
+};
+
+QReadWriteLock registryLock;
+QHash<Id, QSharedPointer<const PropertySchema>> registry;
+
+}
+
+PropertySchema::PropertySchema(const QStringList &propertyNames)
+{
+	for (const QStringList &names : {systemProperties, propertyNames}) {
+		for (const QString &name : names) {
+			if (!mSlots.contains(name)) {
+				mSlots.insert(name, mNames.size());
+				mNames << name;
+			}
+		}
+	}
+}
+
+int PropertySchema::slot(const QString &name) const
+{
+	return mSlots.value(name, -1);
+}
+
+QString PropertySchema::name(int slot) const
+{
+	return mNames[slot];
+}
+
+int PropertySchema::size() const
+{
+	return mNames.size();
+}
+
+QStringList PropertySchema::names() const
+{
+	return mNames;
+}
+
+void PropertySchema::registerType(const Id &type, const QStringList &propertyNames)
+{
+	QSharedPointer<const PropertySchema> schema(new PropertySchema(propertyNames));
+	QWriteLocker lock(&registryLock);
+	const auto existing = registry.value(type);
+	if (!existing || existing->names() != schema->names()) {
+		registry.insert(type, schema);
+	}
+}
+
+QSharedPointer<const PropertySchema> PropertySchema::forType(const Id &type)
+{
+	QReadLocker lock(&registryLock);
+	return registry.value(type);
+}
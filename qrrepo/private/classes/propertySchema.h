@@ -0,0 +1,61 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QHash>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QStringList>
+
+#include <qrkernel/ids.h>
+
+namespace qrRepo {
+namespace details {
+
+/// Layout of properties of repository objects of one element type. Maps names of properties known in advance
+/// (from the metamodel) to indices in a value array of an object. A schema is shared by all objects of its type
+/// and never changes after creation, so objects created before and after metamodel changes stay consistent.
+class PropertySchema
+{
+	Q_DISABLE_COPY(PropertySchema)
+public:
+	/// Creates schema with system properties set by repository itself followed by the given ones.
+	explicit PropertySchema(const QStringList &propertyNames);
+
+	/// Returns index of a property in the value array or -1 if the property is not in the schema.
+	int slot(const QString &name) const;
+
+	/// Returns the name of a property with given index.
+	QString name(int slot) const;
+
+	/// Returns the number of properties in the schema.
+	int size() const;
+
+	/// Returns names of all properties in the schema in slot order.
+	QStringList names() const;
+
+	/// Sets properties for objects of the given element type created from now on. Objects created earlier keep
+	/// their schema. Does nothing if the type already has a schema with the same properties.
+	static void registerType(const qReal::Id &type, const QStringList &propertyNames);
+
+	/// Returns schema for objects of the given element type or null pointer if there is none.
+	static QSharedPointer<const PropertySchema> forType(const qReal::Id &type);
+
+private:
+	QStringList mNames;
+	QHash<QString, int> mSlots;
+};
+
+}
+}
@@ -14,6 +14,7 @@
 
 #include "repoApi.h"
 #include "private/repository.h"
+#include "private/classes/propertySchema.h"
 
 using namespace qrRepo;
 using namespace qrRepo::details;
@@ -644,3 +645,8 @@ void RepoApi::clearMetaInformation()
 {
 	mRepository->clearMetaInformation();
 }
+
+void RepoApi::setPropertySchema(const Id &type, const QStringList &propertyNames)
+{
+	PropertySchema::registerType(type, propertyNames);
+}
@@ -34,6 +34,7 @@ void Repository::resetToEmpty()
 	mObjects.clear();
 	mObjects.insert(Id::rootId(), new LogicalObject(Id::rootId()));
 	mObjects[Id::rootId()]->setProperty("name", Id::rootId().toString());
+	mSearchIndex.markAllDirty();
 }
 
 Repository::~Repository()
@@ -54,19 +55,11 @@ IdList Repository::findElementsByName(const QString &name, bool sensitivity, boo
 	const QRegExp regExp(name, caseSensitivity);
 	IdList result;
 
-	if (regExpression){
-		for (Object * const element : mObjects.values()) {
-			if (element->property("name").toString().contains(regExp)
-					&& !isLogicalId(mObjects.key(element))) {
-				result.append(mObjects.key(element));
-			}
-		}
-	} else {
-		for (Object * const element : mObjects.values()) {
-			if (element->property("name").toString().contains(name, caseSensitivity)
-					&& !isLogicalId(mObjects.key(element))) {
-				result.append(mObjects.key(element));
-			}
+	for (Object * const element : candidates(SearchIndex::Field::name, name, caseSensitivity, regExpression)) {
+		const QString elementName = element->property("name").toString();
+		const bool matches = regExpression ? elementName.contains(regExp) : elementName.contains(name, caseSensitivity);
+		if (matches && !element->isLogicalObject()) {
+			result.append(element->id());
 		}
 	}
 
@@ -76,12 +69,14 @@ IdList Repository::findElementsByName(const QString &name, bool sensitivity, boo
 qReal::IdList Repository::elementsByProperty(const QString &property, bool sensitivity
 		, bool regExpression) const
 {
+	const Qt::CaseSensitivity caseSensitivity = sensitivity ? Qt::CaseSensitive : Qt::CaseInsensitive;
 	IdList result;
 
-	for (Object *element : mObjects.values()) {
-		if ((element->hasProperty(property, sensitivity, regExpression))
-				&& (!isLogicalId(mObjects.key(element)))) {
-			result.append(mObjects.key(element));
+	for (Object * const element
+			: candidates(SearchIndex::Field::propertyName, property, caseSensitivity, regExpression))
+	{
+		if (element->hasProperty(property, sensitivity, regExpression) && !element->isLogicalObject()) {
+			result.append(element->id());
 		}
 	}
 
@@ -96,19 +91,21 @@ qReal::IdList Repository::elementsByPropertyContent(const QString &propertyValue
 	const QRegExp regExp(propertyValue, caseSensitivity);
 	IdList result;
 
-	for (Object * const element : mObjects.values()) {
+	for (Object * const element
+			: candidates(SearchIndex::Field::propertyValue, propertyValue, caseSensitivity, regExpression))
+	{
 		QMapIterator<QString, QVariant> iterator = element->propertiesIterator();
 		if (regExpression) {
 			while (iterator.hasNext()) {
 				if (iterator.next().value().toString().contains(regExp)) {
-					result.append(mObjects.key(element));
+					result.append(element->id());
 					break;
 				}
 			}
 		} else {
 			while (iterator.hasNext()) {
 				if (iterator.next().value().toString().contains(propertyValue, caseSensitivity)) {
-					result.append(mObjects.key(element));
+					result.append(element->id());
 					break;
 				}
 			}
@@ -118,10 +115,33 @@ qReal::IdList Repository::elementsByPropertyContent(const QString &propertyValue
 	return result;
 }
 
+QList<Object *> Repository::candidates(SearchIndex::Field field, const QString &text
+		, Qt::CaseSensitivity caseSensitivity, bool regExpression) const
+{
+	mSearchIndex.update(mObjects);
+	QSet<Id> ids;
+	const bool indexed = regExpression
+			? mSearchIndex.regExpCandidates(field, text, caseSensitivity, ids)
+			: mSearchIndex.substringCandidates(field, text, ids);
+
+	if (!indexed) {
+		return mObjects.values();
+	}
+
+	QList<Object *> result;
+	result.reserve(ids.size());
+	for (const Id &id : ids) {
+		result << mObjects.value(id);
+	}
+
+	return result;
+}
+
 void Repository::replaceProperties(const qReal::IdList &toReplace, const QString &value, const QString &newValue)
 {
 	for (const qReal::Id &currentId : toReplace) {
 		mObjects[currentId]->replaceProperties(value, newValue);
+		mSearchIndex.markDirty(currentId);
 	}
 }
 
@@ -146,6 +166,10 @@ Id Repository::parent(const Id &id) const
 Id Repository::cloneObject(const qReal::Id &id)
 {
 	const Object * const result = mObjects[id]->clone(mObjects);
+	for (const Id &clone : idsOfAllChildrenOf(result->id())) {
+		mSearchIndex.markDirty(clone);
+	}
+
 	return result->id();
 }
 
@@ -187,6 +211,7 @@ void Repository::addChild(const Id &id, const Id &child, const Id &logicalId)
 			object->setParent(id);
 
 			mObjects.insert(child, object);
+			mSearchIndex.markDirty(child);
 		}
 	} else {
 		throw Exception("Repository: Adding child " + child.toString() + " to nonexistent object " + id.toString());
@@ -247,6 +272,7 @@ void Repository::setProperty(const Id &id, const QString &name, const QVariant &
 //				 ? mObjects[id]->property(name).userType() == value.userType()
 //				 : true);
 		mObjects[id]->setProperty(name, value);
+		mSearchIndex.markDirty(id);
 	} else {
 		throw Exception("Repository: Setting property " + name + " of nonexistent object " + id.toString());
 	}
@@ -255,6 +281,7 @@ void Repository::setProperty(const Id &id, const QString &name, const QVariant &
 void Repository::copyProperties(const Id &dest, const Id &src)
 {
 	mObjects[dest]->copyPropertiesFrom(*mObjects[src]);
+	mSearchIndex.markDirty(dest);
 }
 
 QMap<QString, QVariant> Repository::properties(const Id &id) const
@@ -265,6 +292,7 @@ QMap<QString, QVariant> Repository::properties(const Id &id) const
 void Repository::setProperties(const Id &id, QMap<QString, QVariant> const &properties)
 {
 	mObjects[id]->setProperties(properties);
+	mSearchIndex.markDirty(id);
 }
 
 QVariant Repository::property(const Id &id, const QString &name) const
@@ -279,6 +307,7 @@ QVariant Repository::property(const Id &id, const QString &name) const
 void Repository::removeProperty(const Id &id, const QString &name)
 {
 	if (mObjects.contains(id)) {
+		mSearchIndex.markDirty(id);
 		return mObjects[id]->removeProperty(name);
 	} else {
 		throw Exception("Repository: Removing property of nonexistent object " + id.toString());
@@ -300,6 +329,7 @@ void Repository::setBackReference(const Id &id, const Id &reference) const
 	if (mObjects.contains(id)) {
 		if (mObjects.contains(reference)) {
 			mObjects[id]->setBackReference(reference);
+			mSearchIndex.markDirty(id);
 		} else {
 			throw Exception("Repository: setting nonexistent back reference " + reference.toString()
 							+ " to object " + id.toString());
@@ -314,6 +344,7 @@ void Repository::removeBackReference(const Id &id, const Id &reference) const
 	if (mObjects.contains(id)) {
 		if (mObjects.contains(reference)) {
 			mObjects[id]->removeBackReference(reference);
+			mSearchIndex.markDirty(id);
 		} else {
 			throw Exception("Repository: removing nonexistent back reference " + reference.toString()
 							+ " of object " + id.toString());
@@ -353,6 +384,7 @@ IdList Repository::temporaryRemovedLinks(const Id &id) const
 void Repository::removeTemporaryRemovedLinks(const Id &id)
 {
 	if (mObjects.contains(id)) {
+		mSearchIndex.markDirty(id);
 		return mObjects[id]->removeTemporaryRemovedLinks();
 	} else {
 		throw Exception("Repository: Removing temporaryRemovedLinks of nonexistent object " + id.toString());
@@ -362,6 +394,7 @@ void Repository::removeTemporaryRemovedLinks(const Id &id)
 void Repository::loadFromDisk()
 {
 	mSerializer.loadFromDisk(mObjects, mMetaInfo);
+	mSearchIndex.markAllDirty();
 	if (mObjects.isEmpty()) {
 		// Nothing loaded
 		resetToEmpty();
@@ -491,6 +524,7 @@ void Repository::remove(const qReal::Id &id)
 	if (mObjects.contains(id)) {
 		delete mObjects[id];
 		mObjects.remove(id);
+		mSearchIndex.markDirty(id);
 	} else {
 		throw Exception("Repository: Trying to remove nonexistent object " + id.toString());
 	}
@@ -21,6 +21,7 @@
 
 #include "classes/graphicalObject.h"
 #include "classes/logicalObject.h"
+#include "searchIndex.h"
 #include "serializer.h"
 
 namespace qrRepo {
@@ -164,6 +165,10 @@ private:
 	void loadFromDisk();
 	void addChildrenToRootObject();
 
+	/// Returns objects that may match a search query, using search index when possible.
+	QList<Object *> candidates(SearchIndex::Field field, const QString &text, Qt::CaseSensitivity caseSensitivity
+			, bool regExpression) const;
+
 	qReal::IdList idsOfAllChildrenOf(const qReal::Id &id) const;
 	QList<Object*> allChildrenOf(const qReal::Id &id) const;
 	QList<Object*> allChildrenOfWithLogicalId(const qReal::Id &id) const;
@@ -174,6 +179,9 @@ private:
 	/// Name of the current save file for project.
 	QString mWorkingFile;
 	Serializer mSerializer;
+
+	/// Index for search queries, updated lazily by queries, so it is mutable.
+	mutable SearchIndex mSearchIndex;
 };
 
 }
@@ -0,0 +1,273 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "searchIndex.h"
+
+#include <algorithm>
+
+#include "classes/object.h"
+
+using namespace qReal;
+using namespace qrRepo::details;
+
+static bool isHexDigit(QChar c)
+{
+	const QChar lower = c.toLower();
+	return (c >= '0' && c <= '9') || (lower >= 'a' && lower <= 'f');
+}
+
+static quint64 trigramKey(SearchIndex::Field field, const QChar *chars)
+{
+	return (static_cast<quint64>(field) << 48)
+			| (static_cast<quint64>(chars[0].unicode()) << 32)
+			| (static_cast<quint64>(chars[1].unicode()) << 16)
+			| static_cast<quint64>(chars[2].unicode());
+}
+
+void SearchIndex::markDirty(const Id &id)
+{
+	if (!mAllDirty) {
+		mDirty.insert(id);
+	}
+}
+
+void SearchIndex::markAllDirty()
+{
+	mAllDirty = true;
+	mDirty.clear();
+}
+
+void SearchIndex::update(const QHash<Id, Object *> &objects)
+{
+	if (mAllDirty) {
+		mPostings.clear();
+		mObjectTrigrams.clear();
+		for (auto object = objects.constBegin(); object != objects.constEnd(); ++object) {
+			if (object.value()) {
+				index(object.key(), *object.value());
+			}
+		}
+
+		mAllDirty = false;
+		return;
+	}
+
+	for (const Id &id : mDirty) {
+		const Object * const object = objects.value(id);
+		if (object) {
+			index(id, *object);
+		} else {
+			remove(id);
+		}
+	}
+
+	mDirty.clear();
+}
+
+bool SearchIndex::substringCandidates(Field field, const QString &substring, QSet<Id> &result) const
+{
+	// Case insensitive comparison of strings uses case folding, so folded text is searched in any case.
+	return candidates(field, substring.toCaseFolded(), result);
+}
+
+bool SearchIndex::regExpCandidates(Field field, const QString &pattern, Qt::CaseSensitivity caseSensitivity
+		, QSet<Id> &result) const
+{
+	const QString literal = requiredLiteral(pattern);
+	// QRegExp compares characters in lower case when case insensitive, both variants of text are in the index.
+	return candidates(field, caseSensitivity == Qt::CaseInsensitive ? literal.toLower() : literal.toCaseFolded()
+			, result);
+}
+
+QString SearchIndex::requiredLiteral(const QString &pattern)
+{
+	if (pattern.contains('|')) {
+		// Any branch of alternation may match, let's not bother.
+		return QString();
+	}
+
+	QString best;
+	QString current;
+	const auto finishRun = [&best, &current]() {
+		if (current.size() > best.size()) {
+			best = current;
+		}
+
+		current.clear();
+	};
+
+	const int size = pattern.size();
+	for (int i = 0; i < size; ++i) {
+		const QChar c = pattern[i];
+		if (c == '\\' && i + 1 < size) {
+			++i;
+			const QChar escaped = pattern[i];
+			if (escaped.isLetterOrNumber()) {
+				// Character class like \d, a back reference or a character code like \x41 or \0101.
+				finishRun();
+				// Digits of a code or of a back reference are not literal text.
+				if (escaped == 'x' || escaped == 'u') {
+					for (int digits = 0; digits < 4 && i + 1 < size && isHexDigit(pattern[i + 1]); ++digits) {
+						++i;
+					}
+				} else if (escaped.isDigit()) {
+					while (i + 1 < size && pattern[i + 1].isDigit()) {
+						++i;
+					}
+				}
+			} else {
+				current += pattern[i];
+			}
+		} else if (c == '*' || c == '?' || c == '{') {
+			// Previous character may be absent.
+			current.chop(1);
+			finishRun();
+			if (c == '{') {
+				while (i < size && pattern[i] != '}') {
+					++i;
+				}
+			}
+		} else if (c == '+') {
+			finishRun();
+		} else if (c == '[') {
+			// Character class matches one of many characters, skipping it up to the closing bracket.
+			finishRun();
+			++i;
+			if (i < size && pattern[i] == '^') {
+				++i;
+			}
+
+			if (i < size && pattern[i] == ']') {
+				++i;
+			}
+
+			for (; i < size && pattern[i] != ']'; ++i) {
+				if (pattern[i] == '\\') {
+					++i;
+				}
+			}
+		} else if (c == '(') {
+			// Contents of a group may be optional, skipping it entirely.
+			finishRun();
+			int depth = 1;
+			for (++i; i < size; ++i) {
+				if (pattern[i] == '\\') {
+					++i;
+				} else if (pattern[i] == '(') {
+					++depth;
+				} else if (pattern[i] == ')' && --depth == 0) {
+					break;
+				}
+			}
+		} else if (c == '.' || c == '^' || c == '$' || c == ')' || c == ']') {
+			finishRun();
+		} else {
+			current += c;
+		}
+	}
+
+	finishRun();
+	return best;
+}
+
+void SearchIndex::index(const Id &id, const Object &object)
+{
+	QSet<quint64> trigrams;
+	const QMap<QString, QVariant> properties = object.properties();
+	addTrigrams(Field::name, properties.value("name").toString(), trigrams);
+	for (auto property = properties.constBegin(); property != properties.constEnd(); ++property) {
+		addTrigrams(Field::propertyName, property.key(), trigrams);
+		addTrigrams(Field::propertyValue, property.value().toString(), trigrams);
+	}
+
+	QSet<quint64> &oldTrigrams = mObjectTrigrams[id];
+	for (const quint64 trigram : oldTrigrams) {
+		if (!trigrams.contains(trigram)) {
+			auto posting = mPostings.find(trigram);
+			posting->remove(id);
+			if (posting->isEmpty()) {
+				mPostings.erase(posting);
+			}
+		}
+	}
+
+	for (const quint64 trigram : trigrams) {
+		if (!oldTrigrams.contains(trigram)) {
+			mPostings[trigram].insert(id);
+		}
+	}
+
+	oldTrigrams = trigrams;
+}
+
+void SearchIndex::remove(const Id &id)
+{
+	for (const quint64 trigram : mObjectTrigrams.take(id)) {
+		auto posting = mPostings.find(trigram);
+		posting->remove(id);
+		if (posting->isEmpty()) {
+			mPostings.erase(posting);
+		}
+	}
+}
+
+void SearchIndex::addTrigrams(Field field, const QString &text, QSet<quint64> &trigrams)
+{
+	if (text.size() < 3) {
+		return;
+	}
+
+	// Both variants are needed since QString and QRegExp normalize case differently.
+	const QString folded = text.toCaseFolded();
+	const QString lower = text.toLower();
+	for (const QString &variant : {folded, lower}) {
+		const QChar * const chars = variant.constData();
+		for (int i = 0; i + 3 <= variant.size(); ++i) {
+			trigrams.insert(trigramKey(field, chars + i));
+		}
+
+		if (folded == lower) {
+			break;
+		}
+	}
+}
+
+bool SearchIndex::candidates(Field field, const QString &text, QSet<Id> &result) const
+{
+	if (text.size() < 3) {
+		return false;
+	}
+
+	QList<const QSet<Id> *> postings;
+	for (int i = 0; i + 3 <= text.size(); ++i) {
+		const auto posting = mPostings.constFind(trigramKey(field, text.constData() + i));
+		if (posting == mPostings.constEnd()) {
+			result.clear();
+			return true;
+		}
+
+		postings << &posting.value();
+	}
+
+	std::sort(postings.begin(), postings.end(), [](const QSet<Id> *a, const QSet<Id> *b) {
+		return a->size() < b->size();
+	});
+
+	result = *postings.first();
+	for (int i = 1; i < postings.size() && !result.isEmpty(); ++i) {
+		result.intersect(*postings[i]);
+	}
+
+	return true;
+}
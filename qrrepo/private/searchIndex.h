@@ -0,0 +1,87 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QHash>
+#include <QtCore/QSet>
+
+#include <qrkernel/ids.h>
+
+namespace qrRepo {
+namespace details {
+
+class Object;
+
+/// Inverted trigram index over names, property names and property values of repository objects. Allows to find
+/// a small set of candidate objects that may contain given substring or match given regular expression without
+/// looking at every object, the caller still has to check candidates precisely.
+///
+/// Index is maintained incrementally: repository marks changed objects with markDirty() and they are re-indexed
+/// on the next query by update(), so a burst of property changes costs nothing until somebody searches.
+class SearchIndex
+{
+public:
+	/// Indexed parts of an object.
+	enum class Field
+	{
+		name = 0
+		, propertyName
+		, propertyValue
+	};
+
+	/// Schedules re-indexing of given object, it may be changed, created or removed.
+	void markDirty(const qReal::Id &id);
+
+	/// Schedules re-indexing of all objects, used after bulk changes like loading of a project.
+	void markAllDirty();
+
+	/// Brings index up to date with given objects.
+	void update(const QHash<qReal::Id, Object *> &objects);
+
+	/// Collects objects whose \a field may contain \a substring in any letter case.
+	/// @returns false if the substring is too short to use the index, \a result is untouched then.
+	bool substringCandidates(Field field, const QString &substring, QSet<qReal::Id> &result) const;
+
+	/// Collects objects whose \a field may have a match of given regular expression.
+	/// @returns false if no literal required by the expression can be found, \a result is untouched then.
+	bool regExpCandidates(Field field, const QString &pattern, Qt::CaseSensitivity caseSensitivity
+			, QSet<qReal::Id> &result) const;
+
+	/// Returns the longest sequence of characters that every match of given regular expression must contain,
+	/// or empty string if it can not be determined cheaply.
+	static QString requiredLiteral(const QString &pattern);
+
+private:
+	void index(const qReal::Id &id, const Object &object);
+	void remove(const qReal::Id &id);
+
+	/// Collects trigrams of given text in the given field into \a trigrams.
+	static void addTrigrams(Field field, const QString &text, QSet<quint64> &trigrams);
+
+	/// Intersects objects having all trigrams of already normalized \a text.
+	bool candidates(Field field, const QString &text, QSet<qReal::Id> &result) const;
+
+	/// Objects containing each trigram, key is a field in the highest 16 bits and three UTF-16 code units.
+	QHash<quint64, QSet<qReal::Id>> mPostings;
+
+	/// Trigrams of each indexed object, to remove outdated postings on re-indexing.
+	QHash<qReal::Id, QSet<quint64>> mObjectTrigrams;
+
+	QSet<qReal::Id> mDirty;
+	bool mAllDirty = true;
+};
+
+}
+}
@@ -210,13 +210,13 @@ QString Serializer::pathToElement(const Id &id) const
 {
 	QString dirName = mWorkingDir;
 
-	QStringList partsList = id.toString().split('/');
-	Q_ASSERT(partsList.size() >=1 && partsList.size() <= 5);
-	for (int i = 1; i < partsList.size() - 1; ++i) {
-		dirName += "/" + partsList[i];
+	QStringList partsList = id.parts();
+	const QString fileName = partsList.isEmpty() ? QString() : partsList.takeLast();
+	for (const QString &part : partsList) {
+		dirName += "/" + part;
 	}
 
-	return dirName + "/" + partsList[partsList.size() - 1];
+	return dirName + "/" + fileName;
 }
 
 QString Serializer::createDirectory(const Id &id, bool logical) const
@@ -224,17 +224,17 @@ QString Serializer::createDirectory(const Id &id, bool logical) const
 	QString dirName = mWorkingDir + "/tree";
 	dirName += logical ? "/logical" : "/graphical";
 
-	const QStringList partsList = id.toString().split('/');
-	Q_ASSERT(partsList.size() >= 1 && partsList.size() <= 5);
-	for (int i = 1; i < partsList.size() - 1; ++i) {
-		dirName += "/" + partsList[i];
+	QStringList partsList = id.parts();
+	const QString fileName = partsList.isEmpty() ? QString() : partsList.takeLast();
+	for (const QString &part : partsList) {
+		dirName += "/" + part;
 	}
 
 	QDir dir;
 	dir.rmdir(mWorkingDir);
 	dir.mkpath(dirName);
 
-	return dirName + "/" + partsList[partsList.size() - 1];
+	return dirName + "/" + fileName;
 }
 
 void Serializer::decompressFile(const QString &fileName)
@@ -20,6 +20,7 @@ PKGCONFIG *= zlib
 
 HEADERS += \
 	$$PWD/private/repository.h \
+	$$PWD/private/searchIndex.h \
 	$$PWD/private/folderCompressor.h \
 	$$PWD/private/qrRepoGlobal.h \
 	$$PWD/private/serializer.h \
@@ -29,9 +30,11 @@ HEADERS += \
 	$$PWD/private/classes/logicalObject.h \
 	$$PWD/private/classes/graphicalObject.h \
 	$$PWD/private/classes/graphicalPart.h \
+	$$PWD/private/classes/propertySchema.h \
 
 SOURCES += \
 	$$PWD/private/repository.cpp \
+	$$PWD/private/searchIndex.cpp \
 	$$PWD/private/folderCompressor.cpp \
 	$$PWD/private/repoApi.cpp \
 	$$PWD/private/serializer.cpp \
@@ -41,6 +44,7 @@ SOURCES += \
 	$$PWD/private/classes/logicalObject.cpp \
 	$$PWD/private/classes/graphicalObject.cpp \
 	$$PWD/private/classes/graphicalPart.cpp \
+	$$PWD/private/classes/propertySchema.cpp \
 
 # repo API
 HEADERS += \
@@ -175,6 +175,8 @@ public:
 	void setMetaInformation(const QString &key, const QVariant &info) override;
 	void clearMetaInformation() override;
 
+	void setPropertySchema(const qReal::Id &type, const QStringList &propertyNames) override;
+
 private:
 	RepoApi(const RepoApi &other);  // Copying is not allowed.
 	RepoApi& operator =(const RepoApi &);  // Assigning is not allowed.
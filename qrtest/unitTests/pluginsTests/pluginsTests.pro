@@ -18,3 +18,4 @@ SUBDIRS += \
 	blockDiagramTests \
         robotsTests \
 	generationRulesToolTest \
+	visualInterpreterTests \
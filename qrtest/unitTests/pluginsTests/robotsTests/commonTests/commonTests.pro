@@ -15,5 +15,6 @@
 TEMPLATE = subdirs
 
 SUBDIRS = \
+	ev3KitTests \
 	kitBaseTests \
 	twoDModelTests \
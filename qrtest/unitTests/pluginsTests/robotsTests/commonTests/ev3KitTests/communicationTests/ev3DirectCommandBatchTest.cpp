@@ -0,0 +1,81 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <ev3Kit/communication/ev3DirectCommandBatch.h>
+
+#include "gtest/gtest.h"
+
+using namespace ev3::communication;
+
+namespace {
+
+/// Request that writes one byte with the given tag followed by the global offset.
+Ev3DirectCommandBatch::Writer tagged(char tag)
+{
+	return [tag](QByteArray &command, int &index, quint8 globalOffset) {
+		command[index++] = tag;
+		command[index++] = static_cast<char>(globalOffset);
+	};
+}
+
+}
+
+TEST(Ev3DirectCommandBatchTest, layoutTest)
+{
+	Ev3DirectCommandBatch batch;
+	EXPECT_TRUE(batch.isEmpty());
+	EXPECT_EQ(0, batch.add(2, 4, tagged('a')));
+	EXPECT_EQ(1, batch.add(2, 1, tagged('b')));
+	EXPECT_EQ(2, batch.add(2, 4, tagged('c')));
+	EXPECT_EQ(3, batch.size());
+
+	const QByteArray command = batch.command(0x1234);
+	ASSERT_EQ(13, command.size());
+	EXPECT_EQ(11, command[0]);
+	EXPECT_EQ(0x34, command[2]);
+	EXPECT_EQ(0x12, command[3]);
+	// Globals are aligned to 4 bytes: 0..3, 4, 8..11.
+	EXPECT_EQ(12, command[5]);
+	EXPECT_EQ(QByteArray("a\x00" "b\x04" "c\x08", 6), command.mid(7));
+	EXPECT_EQ(17, batch.responseSize());
+
+	QByteArray reply = QByteArray::fromHex("0f00341202");
+	reply.append(QByteArray::fromHex("0102030405000000090a0b0c"));
+	EXPECT_EQ(QByteArray::fromHex("070034120201020304"), batch.response(0, reply));
+	EXPECT_EQ(QByteArray::fromHex("040034120205"), batch.response(1, reply));
+	EXPECT_EQ(QByteArray::fromHex("0700341202090a0b0c"), batch.response(2, reply));
+}
+
+TEST(Ev3DirectCommandBatchTest, overflowTest)
+{
+	Ev3DirectCommandBatch batch;
+	int added = 0;
+	while (batch.add(2, 1, tagged('x')) >= 0) {
+		++added;
+	}
+
+	// One-byte global offsets allow 64 aligned requests.
+	EXPECT_EQ(64, added);
+	EXPECT_EQ(64, batch.size());
+}
+
+TEST(Ev3DirectCommandBatchTest, badReplyTest)
+{
+	Ev3DirectCommandBatch batch;
+	batch.add(2, 4, tagged('a'));
+
+	EXPECT_TRUE(batch.response(0, QByteArray::fromHex("0700010004")).isEmpty());
+	EXPECT_TRUE(batch.response(0, QByteArray::fromHex("070001000401020304")).isEmpty());
+	EXPECT_TRUE(batch.response(0, QByteArray()).isEmpty());
+}
@@ -0,0 +1,172 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <cstring>
+
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QtEndian>
+
+#include <ev3Kit/communication/commandConstants.h>
+#include <ev3Kit/communication/ev3DirectCommand.h>
+#include <ev3Kit/communication/ev3DirectCommandBatch.h>
+
+#include "support/ev3RobotEmulator.h"
+
+#include "gtest/gtest.h"
+
+using namespace ev3;
+using namespace ev3::communication;
+using namespace qrTest::robotsTests::ev3KitTests;
+
+namespace {
+
+/// Chunk size used by file upload.
+const int chunkSize = 960;
+
+QString writeFile(const QTemporaryDir &dir, const QString &name, const QByteArray &data)
+{
+	const QString path = dir.path() + "/" + name;
+	QFile file(path);
+	file.open(QIODevice::WriteOnly);
+	file.write(data);
+	return path;
+}
+
+QByteArray testData(int size)
+{
+	QByteArray result(size, '\0');
+	for (int i = 0; i < size; ++i) {
+		result[i] = static_cast<char>(i * 7 + i / 256);
+	}
+
+	return result;
+}
+
+void enqueueReadySi(Ev3DirectCommandBatch &batch, int port)
+{
+	batch.add(14, 4, [port](QByteArray &command, int &index, quint8 globalOffset) {
+		Ev3DirectCommand::addOpcode(enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_SI, command, index);
+		Ev3DirectCommand::addByteParameter(enums::daisyChainLayer::DaisyChainLayerEnum::EV3, command, index);
+		Ev3DirectCommand::addByteParameter(static_cast<qint8>(port), command, index);
+		Ev3DirectCommand::addByteParameter(0, command, index);
+		Ev3DirectCommand::addByteParameter(0, command, index);
+		Ev3DirectCommand::addByteParameter(1, command, index);
+		Ev3DirectCommand::addGlobalIndex(static_cast<qint8>(globalOffset), command, index);
+	});
+}
+
+float siValue(const QByteArray &response)
+{
+	const quint32 bits = qFromLittleEndian<quint32>(reinterpret_cast<const uchar *>(response.constData() + 5));
+	float result = 0;
+	std::memcpy(&result, &bits, sizeof(result));
+	return result;
+}
+
+}
+
+TEST(Ev3RobotCommunicationThreadTest, uploadTest)
+{
+	QTemporaryDir dir;
+	const QByteArray data = testData(10 * chunkSize + 17);
+	const QString file = writeFile(dir, "program.rbf", data);
+
+	Ev3RobotEmulator emulator;
+	emulator.connect();
+	const QString pathOnRobot = emulator.uploadFile(file, "../prjs/program");
+	EXPECT_EQ("../prjs/program/program.rbf", pathOnRobot);
+	EXPECT_EQ(data, emulator.files().value(pathOnRobot));
+	// Begin command and 11 chunks.
+	EXPECT_EQ(12, emulator.commandsCount());
+	EXPECT_EQ(4, emulator.maxCommandsInFlight());
+
+	EXPECT_TRUE(emulator.runProgram(pathOnRobot));
+	EXPECT_EQ(pathOnRobot, emulator.startedProgram());
+}
+
+TEST(Ev3RobotCommunicationThreadTest, outOfOrderRepliesTest)
+{
+	QTemporaryDir dir;
+	const QByteArray data = testData(9 * chunkSize);
+	const QString file = writeFile(dir, "program.rbf", data);
+
+	Ev3RobotEmulator emulator;
+	emulator.connect();
+	emulator.setRoundTripTime(500);
+	emulator.setReverseReplies(true);
+	emulator.addStrayReply();
+	const QString pathOnRobot = emulator.uploadFile(file, "../prjs/program");
+	EXPECT_FALSE(pathOnRobot.isEmpty());
+	EXPECT_EQ(data, emulator.files().value(pathOnRobot));
+}
+
+TEST(Ev3RobotCommunicationThreadTest, lostCommandTest)
+{
+	QTemporaryDir dir;
+	const QString file = writeFile(dir, "program.rbf", testData(8 * chunkSize));
+
+	// The brick can not hold as many commands as the communicator sends, so some of them are never answered.
+	Ev3RobotEmulator emulator;
+	emulator.connect();
+	emulator.setCapacity(2);
+	EXPECT_TRUE(emulator.uploadFile(file, "../prjs/program").isEmpty());
+}
+
+TEST(Ev3RobotCommunicationThreadTest, pipelinedUploadTest)
+{
+	const int chunks = 24;
+	QTemporaryDir dir;
+	const QString file = writeFile(dir, "program.rbf", testData(chunks * chunkSize));
+
+	for (const int window : {1, 8}) {
+		Ev3RobotEmulator emulator;
+		emulator.connect();
+		emulator.setUploadWindow(window);
+		EXPECT_FALSE(emulator.uploadFile(file, "../prjs/test").isEmpty());
+
+		// Begin command is answered alone, then each reply lets one more chunk go while the window stays full.
+		QList<int> expected = {1};
+		for (int reply = 0; reply < chunks; ++reply) {
+			expected << 1 + qMin(chunks, window + reply);
+		}
+
+		EXPECT_EQ(expected, emulator.commandsBeforeReplies()) << "window " << window;
+		EXPECT_EQ(window, emulator.maxCommandsInFlight());
+	}
+}
+
+TEST(Ev3RobotCommunicationThreadTest, batchedPollingTest)
+{
+	Ev3RobotEmulator emulator;
+	emulator.connect();
+	for (int port = 0; port < 4; ++port) {
+		emulator.setSensorValue(port, 10.5f * (port + 1));
+	}
+
+	Ev3DirectCommandBatch batch;
+	for (int port = 0; port < 4; ++port) {
+		enqueueReadySi(batch, port);
+	}
+
+	emulator.addStrayReply();
+	QByteArray reply;
+	ASSERT_TRUE(emulator.send(batch.command(0), batch.responseSize(), reply));
+	EXPECT_EQ(1, emulator.commandsCount());
+	for (int port = 0; port < 4; ++port) {
+		const QByteArray response = batch.response(port, reply);
+		ASSERT_EQ(9, response.size());
+		EXPECT_FLOAT_EQ(10.5f * (port + 1), siValue(response));
+	}
+}
@@ -0,0 +1,428 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "ev3RobotEmulator.h"
+
+#include <cstring>
+
+#include <QtCore/QThread>
+#include <QtCore/QtEndian>
+
+#include <ev3Kit/communication/commandConstants.h>
+
+using namespace qrTest::robotsTests::ev3KitTests;
+using namespace ev3;
+
+static const uchar systemCommandReply = 0x01;
+static const uchar systemCommandNoReply = 0x81;
+static const uchar systemReply = 0x03;
+static const uchar systemReplyError = 0x05;
+static const uchar beginDownload = 0x92;
+static const uchar continueDownload = 0x93;
+static const uchar statusSuccess = 0x00;
+static const uchar statusUnknownHandle = 0x01;
+static const uchar statusEndOfFile = 0x08;
+
+static const uchar opProgramStop = 0x02;
+static const uchar opProgramStart = 0x03;
+static const uchar opUiButton = 0x83;
+static const uchar opKeepAlive = 0x90;
+static const uchar opInputDevice = 0x99;
+static const uchar opFile = 0xC0;
+static const uchar uiButtonPressed = 0x09;
+static const uchar inputDeviceReadyPct = 0x1B;
+static const uchar inputDeviceReadyRaw = 0x1C;
+static const uchar inputDeviceReadySi = 0x1D;
+static const uchar fileLoadImage = 0x08;
+
+static QByteArray reply(quint16 counter, uchar type, const QByteArray &payload)
+{
+	const int length = 3 + payload.size();
+	QByteArray result;
+	result.append(static_cast<char>(length & 0xFF));
+	result.append(static_cast<char>((length >> 8) & 0xFF));
+	result.append(static_cast<char>(counter & 0xFF));
+	result.append(static_cast<char>((counter >> 8) & 0xFF));
+	result.append(static_cast<char>(type));
+	result.append(payload);
+	return result;
+}
+
+static QByteArray int32Bytes(qint32 value)
+{
+	QByteArray result(4, '\0');
+	qToLittleEndian(value, reinterpret_cast<uchar *>(result.data()));
+	return result;
+}
+
+static quint16 counterOf(const QByteArray &message)
+{
+	return static_cast<quint16>(static_cast<uchar>(message[2]) | (static_cast<uchar>(message[3]) << 8));
+}
+
+Ev3RobotEmulator::Ev3RobotEmulator()
+{
+	mClock.start();
+}
+
+void Ev3RobotEmulator::setRoundTripTime(int microseconds)
+{
+	mRoundTripTime = microseconds;
+}
+
+void Ev3RobotEmulator::setCapacity(int commands)
+{
+	mCapacity = commands;
+}
+
+void Ev3RobotEmulator::setUploadWindow(int window)
+{
+	mUploadWindow = window;
+}
+
+void Ev3RobotEmulator::setReverseReplies(bool reverse)
+{
+	mReverseReplies = reverse;
+}
+
+void Ev3RobotEmulator::addStrayReply()
+{
+	mReplies << Reply{reply(0, enums::replyType::ReplyTypeEnum::DIRECT_REPLY, QByteArray()), 0};
+}
+
+void Ev3RobotEmulator::setSensorValue(int port, float value)
+{
+	mSensors[port] = value;
+}
+
+void Ev3RobotEmulator::setButtonPressed(int button, bool pressed)
+{
+	mButtons[button] = pressed;
+}
+
+QHash<QString, QByteArray> Ev3RobotEmulator::files() const
+{
+	return mFiles;
+}
+
+QString Ev3RobotEmulator::startedProgram() const
+{
+	return mStartedProgram;
+}
+
+int Ev3RobotEmulator::commandsCount() const
+{
+	return mCommandsCount;
+}
+
+int Ev3RobotEmulator::maxCommandsInFlight() const
+{
+	return mMaxCommandsInFlight;
+}
+
+QList<int> Ev3RobotEmulator::commandsBeforeReplies() const
+{
+	return mCommandsBeforeReplies;
+}
+
+bool Ev3RobotEmulator::send(QObject *addressee, const QByteArray &buffer, int responseSize)
+{
+	if (buffer.size() >= 5 && buffer[4] == enums::commandType::CommandTypeEnum::DIRECT_COMMAND_REPLY) {
+		const QByteArray result = exchange(buffer, responseSize);
+		emit response(addressee, result);
+		return !result.isEmpty();
+	}
+
+	const bool result = send1(buffer);
+	emit response(addressee, QByteArray());
+	return result;
+}
+
+bool Ev3RobotEmulator::send(const QByteArray &buffer, int responseSize, QByteArray &outputBuffer)
+{
+	outputBuffer = exchange(buffer, responseSize);
+	return !outputBuffer.isEmpty();
+}
+
+bool Ev3RobotEmulator::connect()
+{
+	mConnected = true;
+	emit connected(true, QString());
+	return true;
+}
+
+void Ev3RobotEmulator::reconnect()
+{
+	connect();
+}
+
+void Ev3RobotEmulator::disconnect()
+{
+	mConnected = false;
+	mReplies.clear();
+	emit disconnected();
+}
+
+void Ev3RobotEmulator::allowLongJobs(bool allow)
+{
+	Q_UNUSED(allow)
+}
+
+bool Ev3RobotEmulator::send1(const QByteArray &buffer) const
+{
+	if (!mConnected || buffer.size() < 5 || buffer.size() != 2 + (static_cast<uchar>(buffer[0])
+			| (static_cast<uchar>(buffer[1]) << 8))) {
+		return false;
+	}
+
+	++mCommandsCount;
+	const uchar type = static_cast<uchar>(buffer[4]);
+	if (type == systemCommandReply || type == systemCommandNoReply) {
+		const QByteArray answer = systemCommand(buffer);
+		if (type == systemCommandReply) {
+			enqueue(answer);
+		}
+	} else {
+		const QByteArray answer = directCommand(buffer);
+		if (type == enums::commandType::CommandTypeEnum::DIRECT_COMMAND_REPLY) {
+			enqueue(answer);
+		}
+	}
+
+	return true;
+}
+
+QByteArray Ev3RobotEmulator::receive(int size) const
+{
+	if (mReplies.isEmpty()) {
+		return QByteArray();
+	}
+
+	const qint64 wait = mReplies.first().readyAt - mClock.nsecsElapsed() / 1000;
+	if (wait > 0) {
+		QThread::usleep(static_cast<unsigned long>(wait));
+	}
+
+	int chosen = 0;
+	if (mReverseReplies) {
+		const qint64 now = mClock.nsecsElapsed() / 1000;
+		while (chosen + 1 < mReplies.size() && mReplies[chosen + 1].readyAt <= now) {
+			++chosen;
+		}
+	}
+
+	mCommandsBeforeReplies << mCommandsCount;
+	return mReplies.takeAt(chosen).data.left(size);
+}
+
+int Ev3RobotEmulator::uploadWindow() const
+{
+	return mUploadWindow > 0 ? mUploadWindow : Ev3RobotCommunicationThread::uploadWindow();
+}
+
+QByteArray Ev3RobotEmulator::systemCommand(const QByteArray &command) const
+{
+	const quint16 counter = counterOf(command);
+	const uchar code = static_cast<uchar>(command.at(5));
+	if (code == beginDownload && command.size() > 10) {
+		const qint32 size = qFromLittleEndian<qint32>(reinterpret_cast<const uchar *>(command.constData() + 6));
+		const QString path = QString::fromLatin1(command.constData() + 10);
+		const int handle = mNextHandle++;
+		mDownloads[handle] = path;
+		mExpectedSizes[handle] = size;
+		mFiles[path] = QByteArray();
+		return reply(counter, systemReply, QByteArray(1, static_cast<char>(code))
+				+ static_cast<char>(statusSuccess) + static_cast<char>(handle));
+	}
+
+	if (code == continueDownload && command.size() > 6) {
+		const int handle = static_cast<uchar>(command.at(6));
+		if (!mDownloads.contains(handle)) {
+			return reply(counter, systemReplyError, QByteArray(1, static_cast<char>(code))
+					+ static_cast<char>(statusUnknownHandle) + static_cast<char>(handle));
+		}
+
+		QByteArray &file = mFiles[mDownloads[handle]];
+		file.append(command.mid(7));
+		uchar status = statusSuccess;
+		if (file.size() >= mExpectedSizes[handle]) {
+			mDownloads.remove(handle);
+			status = statusEndOfFile;
+		}
+
+		return reply(counter, systemReply, QByteArray(1, static_cast<char>(code))
+				+ static_cast<char>(status) + static_cast<char>(handle));
+	}
+
+	return reply(counter, systemReplyError, QByteArray(1, static_cast<char>(code)) + static_cast<char>(0x0A));
+}
+
+QByteArray Ev3RobotEmulator::directCommand(const QByteArray &command) const
+{
+	const int globalSize = static_cast<uchar>(command.at(5)) | ((static_cast<uchar>(command.at(6)) & 0x03) << 8);
+	QByteArray globals(globalSize, '\0');
+	int index = 7;
+	while (index < command.size()) {
+		if (!instruction(command, index, globals)) {
+			return reply(counterOf(command), enums::replyType::ReplyTypeEnum::DIRECT_NO_REPLY, globals);
+		}
+	}
+
+	return reply(counterOf(command), enums::replyType::ReplyTypeEnum::DIRECT_REPLY, globals);
+}
+
+bool Ev3RobotEmulator::instruction(const QByteArray &command, int &index, QByteArray &globals) const
+{
+	const uchar opcode = static_cast<uchar>(command.at(index++));
+	switch (opcode) {
+	case opKeepAlive:
+	case opProgramStop:
+		parameter(command, index);
+		return true;
+	case opProgramStart:
+		for (int i = 0; i < 4; ++i) {
+			parameter(command, index);
+		}
+
+		mStartedProgram = mLoadedImage;
+		return true;
+	case opFile: {
+		if (parameter(command, index).value != fileLoadImage) {
+			return false;
+		}
+
+		parameter(command, index);
+		mLoadedImage = QString::fromLatin1(parameter(command, index).string);
+		store(globals, parameter(command, index), int32Bytes(mFiles.value(mLoadedImage).size()));
+		store(globals, parameter(command, index), int32Bytes(0));
+		return mFiles.contains(mLoadedImage);
+	}
+	case opUiButton: {
+		if (parameter(command, index).value != uiButtonPressed) {
+			return false;
+		}
+
+		const int button = parameter(command, index).value;
+		store(globals, parameter(command, index), QByteArray(1, mButtons.value(button) ? 1 : 0));
+		return true;
+	}
+	case opInputDevice: {
+		const int subcode = parameter(command, index).value;
+		if (subcode != inputDeviceReadyPct && subcode != inputDeviceReadyRaw && subcode != inputDeviceReadySi) {
+			return false;
+		}
+
+		parameter(command, index);  // Layer
+		const int port = parameter(command, index).value;
+		parameter(command, index);  // Type
+		parameter(command, index);  // Mode
+		const int values = parameter(command, index).value;
+		for (int i = 0; i < values; ++i) {
+			store(globals, parameter(command, index), sensorReading(subcode, port));
+		}
+
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+Ev3RobotEmulator::Parameter Ev3RobotEmulator::parameter(const QByteArray &command, int &index)
+{
+	Parameter result;
+	if (index >= command.size()) {
+		return result;
+	}
+
+	const uchar head = static_cast<uchar>(command.at(index++));
+	if (!(head & 0x80)) {
+		// Short format: 6-bit constant or 5-bit variable index.
+		result.isVariable = head & 0x40;
+		if (result.isVariable) {
+			result.isGlobal = head & 0x20;
+			result.value = head & 0x1F;
+		} else {
+			result.value = (head & 0x20) ? (head & 0x3F) - 0x40 : head & 0x3F;
+		}
+
+		return result;
+	}
+
+	result.isVariable = head & 0x40;
+	result.isGlobal = result.isVariable && (head & 0x20);
+	switch (head & 0x07) {
+	case 1:
+		result.value = static_cast<qint8>(command.at(index));
+		index += 1;
+		break;
+	case 2:
+		result.value = static_cast<qint16>(static_cast<uchar>(command.at(index))
+				| (static_cast<uchar>(command.at(index + 1)) << 8));
+		index += 2;
+		break;
+	case 3:
+		result.value = qFromLittleEndian<qint32>(reinterpret_cast<const uchar *>(command.constData() + index));
+		index += 4;
+		break;
+	case 4:
+		result.string = QByteArray(command.constData() + index);
+		index += result.string.size() + 1;
+		break;
+	default:
+		break;
+	}
+
+	if (result.isVariable) {
+		result.value &= 0xFF;
+	}
+
+	return result;
+}
+
+void Ev3RobotEmulator::store(QByteArray &globals, const Parameter &target, const QByteArray &value)
+{
+	if (!target.isGlobal || target.value + value.size() > globals.size()) {
+		return;
+	}
+
+	globals.replace(target.value, value.size(), value);
+}
+
+QByteArray Ev3RobotEmulator::sensorReading(int opcode, int port) const
+{
+	const float value = mSensors.value(port);
+	if (opcode == inputDeviceReadyPct) {
+		return QByteArray(1, static_cast<char>(qBound(0, static_cast<int>(value), 100)));
+	}
+
+	if (opcode == inputDeviceReadySi) {
+		qint32 bits = 0;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return int32Bytes(bits);
+	}
+
+	return int32Bytes(static_cast<qint32>(value));
+}
+
+void Ev3RobotEmulator::enqueue(const QByteArray &answer) const
+{
+	if (mCapacity > 0 && mReplies.size() >= mCapacity) {
+		// The brick has no room for the command, it is lost without reply.
+		return;
+	}
+
+	mReplies << Reply{answer, mClock.nsecsElapsed() / 1000 + mRoundTripTime};
+	mMaxCommandsInFlight = qMax(mMaxCommandsInFlight, mReplies.size());
+}
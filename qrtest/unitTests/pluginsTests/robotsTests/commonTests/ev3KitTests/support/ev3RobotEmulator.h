@@ -0,0 +1,134 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+
+#include <ev3Kit/communication/ev3RobotCommunicationThread.h>
+
+namespace qrTest {
+namespace robotsTests {
+namespace ev3KitTests {
+
+/// In-process emulator of EV3 brick behind the same interface as USB and Bluetooth communicators.
+/// Understands file download system commands and direct commands used by the interpreter to poll sensors
+/// and run programs, answers them after configurable round trip time. Replies may be delivered out of order
+/// and mixed with stray replies to check matching of replies to requests.
+class Ev3RobotEmulator : public ev3::communication::Ev3RobotCommunicationThread
+{
+	Q_OBJECT
+
+public:
+	Ev3RobotEmulator();
+
+	/// Sets time between receiving a command and its reply becoming available, in microseconds.
+	void setRoundTripTime(int microseconds);
+
+	/// Sets maximal number of commands waiting for replies, the brick ignores commands sent over this limit.
+	/// Zero means no limit.
+	void setCapacity(int commands);
+
+	/// Sets how many file chunks the communicator sends before awaiting replies, zero means default value.
+	void setUploadWindow(int window);
+
+	/// If set, replies are delivered in reverse order of commands when several of them are available.
+	void setReverseReplies(bool reverse);
+
+	/// Puts a reply to a message with counter 0 into the queue, like a late reply to keep-alive request.
+	void addStrayReply();
+
+	/// Sets value returned by READY_SI, READY_PCT and READY_RAW requests for a sensor on the given port.
+	void setSensorValue(int port, float value);
+
+	/// Sets state of a brick button.
+	void setButtonPressed(int button, bool pressed);
+
+	/// Returns contents of files downloaded to the brick.
+	QHash<QString, QByteArray> files() const;
+
+	/// Returns path of the last started program or empty string.
+	QString startedProgram() const;
+
+	/// Returns the number of commands that were received by the brick.
+	int commandsCount() const;
+
+	/// Returns the maximal number of commands that waited for replies at once.
+	int maxCommandsInFlight() const;
+
+	/// Returns, for every reply taken by the communicator, how many commands were received by the brick before.
+	QList<int> commandsBeforeReplies() const;
+
+public slots:
+	bool send(QObject *addressee, const QByteArray &buffer, int responseSize) override;
+	bool send(const QByteArray &buffer, int responseSize, QByteArray &outputBuffer) override;
+	bool connect() override;
+	void reconnect() override;
+	void disconnect() override;
+	void allowLongJobs(bool allow = true) override;
+
+private:
+	struct Reply
+	{
+		QByteArray data;
+		qint64 readyAt;
+	};
+
+	/// Parameter of a direct command bytecode.
+	struct Parameter
+	{
+		bool isVariable = false;
+		bool isGlobal = false;
+		qint32 value = 0;
+		QByteArray string;
+	};
+
+	bool send1(const QByteArray &buffer) const override;
+	QByteArray receive(int size) const override;
+	int uploadWindow() const override;
+
+	QByteArray systemCommand(const QByteArray &command) const;
+	QByteArray directCommand(const QByteArray &command) const;
+	bool instruction(const QByteArray &command, int &index, QByteArray &globals) const;
+	static Parameter parameter(const QByteArray &command, int &index);
+	static void store(QByteArray &globals, const Parameter &target, const QByteArray &value);
+	QByteArray sensorReading(int opcode, int port) const;
+	void enqueue(const QByteArray &reply) const;
+
+	QElapsedTimer mClock;
+	int mRoundTripTime = 0;
+	int mCapacity = 0;
+	int mUploadWindow = 0;
+	bool mReverseReplies = false;
+	bool mConnected = false;
+	QHash<int, float> mSensors;
+	QHash<int, bool> mButtons;
+
+	mutable QList<Reply> mReplies;
+	mutable QHash<int, QString> mDownloads;
+	mutable QHash<QString, QByteArray> mFiles;
+	mutable QHash<int, int> mExpectedSizes;
+	mutable QString mLoadedImage;
+	mutable QString mStartedProgram;
+	mutable int mNextHandle = 0;
+	mutable int mCommandsCount = 0;
+	mutable int mMaxCommandsInFlight = 0;
+	mutable QList<int> mCommandsBeforeReplies;
+};
+
+}
+}
+}
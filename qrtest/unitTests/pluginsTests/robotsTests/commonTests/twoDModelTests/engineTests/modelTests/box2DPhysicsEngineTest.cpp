@@ -0,0 +1,200 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <QtCore/QDataStream>
+
+#include <box2d/box2d.h>
+
+#include <twoDModel/engine/model/timeline.h>
+#include <twoDModel/engine/model/worldModel.h>
+#include <src/engine/items/ballItem.h>
+#include <src/engine/items/wallItem.h>
+#include <src/engine/model/physics/box2DPhysicsEngine.h>
+
+#include "gtest/gtest.h"
+
+using namespace twoDModel::model;
+using namespace twoDModel::model::physics;
+using namespace twoDModel::items;
+
+namespace {
+
+/// Final state of a ball thrown into a wall.
+struct BallState
+{
+	float x;
+	float y;
+	float angle;
+	float velocityX;
+	float velocityY;
+};
+
+/// A world with a wall and a ball thrown into it.
+class BallThrow
+{
+public:
+	explicit BallThrow(int subSteps)
+		: mEngine(mWorld, {})
+	{
+		mEngine.setStepParameters(subSteps, 8, 3);
+		mWorld.addWall(QSharedPointer<WallItem>::create(QPointF(100, -200), QPointF(100, 200)));
+		mWorld.addBall(QSharedPointer<BallItem>::create(QPointF(0, 0)));
+
+		b2Body * const ball = this->ball();
+		for (b2Body *body = mEngine.box2DWorld().GetBodyList(); body; body = body->GetNext()) {
+			if (body != ball) {
+				EXPECT_EQ(b2_staticBody, body->GetType());
+				EXPECT_FALSE(body->IsAwake());
+			}
+		}
+
+		// Two hundred pixels per second towards the wall and a bit aside.
+		const float speed = 2 * mEngine.positionToBox2D(QPointF(100, 0)).x;
+		ball->SetLinearVelocity(b2Vec2(speed, 0.2f * speed));
+		ball->SetAngularVelocity(1.0f);
+	}
+
+	Box2DPhysicsEngine &engine()
+	{
+		return mEngine;
+	}
+
+	/// Returns the only dynamic body, it may change when the world is rebuilt.
+	b2Body *ball()
+	{
+		for (b2Body *body = mEngine.box2DWorld().GetBodyList(); body; body = body->GetNext()) {
+			if (body->GetType() == b2_dynamicBody) {
+				return body;
+			}
+		}
+
+		ADD_FAILURE() << "No ball in the world";
+		return nullptr;
+	}
+
+	/// Returns true if the ball is touching the wall now.
+	bool ballTouchesWall()
+	{
+		for (b2ContactEdge *edge = ball()->GetContactList(); edge; edge = edge->next) {
+			if (edge->contact->IsTouching()) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/// Runs simulation for \a ticks, \a slices describes how each tick of model time is passed to the engine.
+	BallState run(int ticks, const QList<qreal> &slices = {Timeline::timeInterval})
+	{
+		for (int tick = 0; tick < ticks; ++tick) {
+			for (const qreal slice : slices) {
+				mEngine.recalculateParameters(slice);
+			}
+		}
+
+		b2Body * const ball = this->ball();
+		const b2Vec2 position = ball->GetPosition();
+		const b2Vec2 velocity = ball->GetLinearVelocity();
+		return {position.x, position.y, ball->GetAngle(), velocity.x, velocity.y};
+	}
+
+private:
+	WorldModel mWorld;
+	Box2DPhysicsEngine mEngine;
+};
+
+/// Simulates a ball thrown into a wall for 3 seconds.
+BallState throwBall(int subSteps, const QList<qreal> &slices)
+{
+	return BallThrow(subSteps).run(300, slices);
+}
+
+void expectSame(const BallState &expected, const BallState &actual)
+{
+	// Exact comparison is intended: simulation must be bit-reproducible.
+	EXPECT_EQ(expected.x, actual.x);
+	EXPECT_EQ(expected.y, actual.y);
+	EXPECT_EQ(expected.angle, actual.angle);
+	EXPECT_EQ(expected.velocityX, actual.velocityX);
+	EXPECT_EQ(expected.velocityY, actual.velocityY);
+}
+
+/// Saves a snapshot of \a simulation, continues it for a while and checks that restored simulation goes the same way.
+void checkSnapshot(BallThrow &simulation)
+{
+	QByteArray snapshot;
+	QDataStream output(&snapshot, QIODevice::WriteOnly);
+	simulation.engine().saveState(output);
+	const BallState notRestored = simulation.run(200);
+	// The ball has bounced off the wall after the snapshot.
+	EXPECT_LT(notRestored.velocityX, 0);
+
+	QDataStream input(snapshot);
+	ASSERT_TRUE(simulation.engine().restoreState(input));
+	const BallState continued = simulation.run(200);
+	expectSame(notRestored, continued);
+
+	// Restoring the same snapshot many times always gives the same result.
+	QDataStream secondInput(snapshot);
+	ASSERT_TRUE(simulation.engine().restoreState(secondInput));
+	simulation.run(100);
+	expectSame(continued, simulation.run(100));
+}
+
+}
+
+TEST(Box2DPhysicsEngineTest, reproducibilityTest)
+{
+	const BallState first = throwBall(1, {Timeline::timeInterval});
+	// The ball has reached the wall and bounced off it.
+	EXPECT_LT(first.velocityX, 0);
+	expectSame(first, throwBall(1, {Timeline::timeInterval}));
+
+	const BallState fine = throwBall(4, {Timeline::timeInterval});
+	EXPECT_LT(fine.velocityX, 0);
+	expectSame(fine, throwBall(4, {Timeline::timeInterval}));
+}
+
+TEST(Box2DPhysicsEngineTest, timeSlicingTest)
+{
+	// The same model time passed in different portions results in exactly the same world.
+	const qreal half = Timeline::timeInterval / 2.0;
+	const qreal quarter = Timeline::timeInterval / 4.0;
+	const BallState whole = throwBall(2, {Timeline::timeInterval});
+	expectSame(whole, throwBall(2, {half, half}));
+	expectSame(whole, throwBall(2, {quarter, 3 * quarter}));
+	expectSame(whole, throwBall(2, {0, Timeline::timeInterval, 0}));
+}
+
+TEST(Box2DPhysicsEngineTest, snapshotTest)
+{
+	BallThrow simulation(2);
+	// Stopping right before the ball hits the wall, so contact is created after the snapshot.
+	simulation.run(40);
+	ASSERT_FALSE(simulation.ballTouchesWall());
+	checkSnapshot(simulation);
+}
+
+TEST(Box2DPhysicsEngineTest, snapshotInContactTest)
+{
+	BallThrow simulation(2);
+	// Saving while the ball is pressed into the wall, so the live contact and its impulses are dropped.
+	for (int tick = 0; tick < 100 && !simulation.ballTouchesWall(); ++tick) {
+		simulation.run(1);
+	}
+
+	ASSERT_TRUE(simulation.ballTouchesWall());
+	checkSnapshot(simulation);
+}
@@ -0,0 +1,75 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <QtCore/QTemporaryDir>
+#include <QtGui/QImage>
+#include <QtXml/QDomDocument>
+
+#include <twoDModel/engine/model/image.h>
+#include <twoDModel/engine/model/worldModel.h>
+#include <src/engine/items/imageItem.h>
+
+#include "gtest/gtest.h"
+
+using namespace twoDModel::model;
+using namespace twoDModel::items;
+
+namespace {
+
+QString writeImage(const QTemporaryDir &dir, const QString &name, const QColor &color)
+{
+	QImage image(16, 16, QImage::Format_ARGB32);
+	image.fill(color);
+	const QString path = dir.filePath(name);
+	image.save(path, "PNG");
+	return path;
+}
+
+QString blobs(const WorldModel &world)
+{
+	QDomDocument document;
+	QDomElement root = document.createElement("root");
+	document.appendChild(root);
+	world.serializeBlobs(root);
+	return document.toString();
+}
+
+}
+
+TEST(WorldModelBlobsTest, changedImageIsReencodedTest)
+{
+	QTemporaryDir dir;
+	ASSERT_TRUE(dir.isValid());
+	const QString red = writeImage(dir, "red.png", Qt::red);
+	const QString blue = writeImage(dir, "blue.png", Qt::blue);
+
+	WorldModel world;
+	const auto item = QSharedPointer<ImageItem>::create(QSharedPointer<Image>::create(red, true), QRect(0, 0, 16, 16));
+	world.addImageItem(item);
+
+	const QString first = blobs(world);
+	EXPECT_TRUE(first.contains(item->image()->imageId()));
+	EXPECT_EQ(first, blobs(world));
+
+	item->setPath(blue);
+	const QString changed = blobs(world);
+	EXPECT_NE(first, changed);
+
+	WorldModel freshWorld;
+	freshWorld.addImageItem(item);
+	EXPECT_EQ(blobs(freshWorld), changed);
+
+	world.removeImageItem(item);
+	EXPECT_FALSE(blobs(world).contains(item->image()->imageId()));
+}
@@ -30,6 +30,8 @@ HEADERS += \
 
 SOURCES += \
 	$$PWD/engineTests/constraintsTests/constraintsParserTests.cpp \
+	$$PWD/engineTests/modelTests/worldModelBlobsTest.cpp \
+	$$PWD/engineTests/modelTests/box2DPhysicsEngineTest.cpp \
 
 # Support classes
 HEADERS += \
@@ -0,0 +1,29 @@
+# Copyright 2026 CyberTech Labs Ltd.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+TARGET = ev3-rbf-generator-tests
+
+include($$PWD/../../../../common.pri)
+
+include($$PWD/../../../../../../plugins/robots/generators/ev3/ev3RbfGenerator/lmsAssembler/lmsAssembler.pri)
+
+INCLUDEPATH += \
+	$$PWD/../../../../../../plugins/robots/generators/ev3/ev3RbfGenerator \
+
+SOURCES += \
+	$$PWD/lmsAssemblerTest.cpp \
+
+copyToDestdir($$PWD/support/testData/lmsAssembler, NOW)
+copyToDestdir($$PWD/../../../../../../plugins/robots/generators/ev3/ev3RbfGenerator/thirdparty, NOW, lmsAssemblerReference/)
+copyToDestdir($$PWD/../../../../../../plugins/robots/generators/ev3/ev3RbfGenerator/templates, NOW, ev3Templates/)
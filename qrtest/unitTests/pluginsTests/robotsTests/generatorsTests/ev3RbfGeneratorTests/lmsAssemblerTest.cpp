@@ -0,0 +1,247 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QMap>
+#include <QtCore/QProcess>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QtEndian>
+
+#include <lmsAssembler/lmsAssembler.h>
+
+#include "gtest/gtest.h"
+
+using namespace ev3::rbf;
+
+namespace {
+
+QByteArray readFile(const QString &fileName)
+{
+	QFile file(fileName);
+	if (!file.open(QIODevice::ReadOnly)) {
+		ADD_FAILURE() << "Can not open " << fileName.toStdString();
+		return QByteArray();
+	}
+
+	return file.readAll();
+}
+
+/// Directory with assembler.jar, its Logo sources and bytecode tables, copied from ev3RbfGenerator/thirdparty.
+const QString referenceAssemblerPath = "lmsAssemblerReference/thirdparty";
+
+bool javaAvailable()
+{
+	QProcess java;
+	java.start("java", {"-version"});
+	return java.waitForFinished() && java.exitStatus() == QProcess::NormalExit && java.exitCode() == 0;
+}
+
+/// Assembles \a source with the Java assembler the way Ev3RbfGeneratorPlugin used to do it.
+QByteArray referenceImage(const QString &name, const QByteArray &source)
+{
+	QTemporaryDir workingDir;
+	const QDir reference(referenceAssemblerPath);
+	for (const QString &file : reference.entryList(QDir::Files)) {
+		if (!QFile::copy(reference.filePath(file), workingDir.path() + "/" + file)) {
+			ADD_FAILURE() << "Can not copy " << file.toStdString();
+			return QByteArray();
+		}
+	}
+
+	QFile lms(workingDir.path() + "/" + name + ".lms");
+	lms.open(QIODevice::WriteOnly);
+	lms.write(source);
+	lms.close();
+
+	QProcess java;
+	java.setWorkingDirectory(workingDir.path());
+	java.start("java", {"-jar", "assembler.jar", name});
+	if (!java.waitForFinished(60000) || java.exitCode() != 0) {
+		ADD_FAILURE() << "Java assembler failed: " << java.readAll().toStdString();
+		return QByteArray();
+	}
+
+	return readFile(workingDir.path() + "/" + name + ".rbf");
+}
+
+/// Directory with EV3 generator templates, copied from ev3RbfGenerator/templates.
+const QString templatesPath = "ev3Templates/templates";
+
+/// Reads a generator template and substitutes its placeholders the way generators do.
+QString fromTemplate(const QString &path, const QMap<QString, QString> &substitutions = {})
+{
+	QString result = QString::fromUtf8(readFile(templatesPath + "/" + path));
+	// Some templates are saved with byte order mark.
+	result.remove(QChar(0xFEFF));
+	for (auto substitution = substitutions.constBegin(); substitution != substitutions.constEnd(); ++substitution) {
+		result.replace("@@" + substitution.key() + "@@", substitution.value());
+	}
+
+	return result;
+}
+
+/// Composes a program from main and thread templates and templates of motors, drawing, sound, waiting
+/// and control flow blocks, just like the generator does for a diagram with these blocks.
+QString templateProgram()
+{
+	const QString redraw = fromTemplate("drawing/redraw.t");
+	const QStringList mainCode = {
+		fromTemplate("drawing/clearScreen.t", {{"REDRAW", redraw}})
+		, fromTemplate("drawing/printText.t", {{"X", "10"}, {"Y", "20"}, {"TEXT", "'Hello, EV3!'"}
+				, {"REDRAW", redraw}})
+		, fromTemplate("drawing/drawLine.t", {{"X1CoordinateLine", "0"}, {"Y1CoordinateLine", "0"}
+				, {"X2CoordinateLine", "177"}, {"Y2CoordinateLine", "127"}, {"REDRAW", redraw}})
+		, fromTemplate("threads/call.t", {{"NAME", "worker"}})
+		, fromTemplate("engines/forward.t", {{"RANDOM_ID", "__power_1"}, {"POWER", "120"}
+				, {"PORT", fromTemplate("ports/A.t")}})
+		, fromTemplate("beep.t", {{"VOLUME", "50"}, {"WAIT_FOR_COMPLETION", "1"}, {"RANDOM_ID", "__beep_1"}})
+		, fromTemplate("playTone.t", {{"FREQUENCY", "440"}, {"VOLUME", "50"}, {"DURATION", "200"}
+				, {"WAIT_FOR_COMPLETION", "0"}, {"RANDOM_ID_1", "__tone_1"}, {"RANDOM_ID_2", "__tone_2"}})
+		, fromTemplate("label.t", {{"ID", "__loop"}, {"ADDITIONAL_CODE", ""}})
+		, fromTemplate("wait/timer.t", {{"DELAY", "1000"}})
+		, fromTemplate("conditional/if.t", {{"CONDITION", "flag"}, {"RANDOM_ID", "__if_1"}
+				, {"THEN_BODY", fromTemplate("goto.t", {{"ID", "__loop"}})}})
+		, fromTemplate("engines/nullifyEncoder.t", {{"PORT", fromTemplate("ports/B.t")}})
+		, fromTemplate("engines/stop.t", {{"PORT", fromTemplate("ports/A.t")}
+				, {"BREAK_MODE", fromTemplate("engines/brakeMode/brake.t")}})
+		, fromTemplate("finalNodeMain.t")
+	};
+
+	const QStringList variables = {
+		fromTemplate("variables/variableDeclaration.t", {{"TYPE", fromTemplate("types/int.t")}, {"NAME", "counter"}})
+		, fromTemplate("variables/variableDeclaration.t", {{"TYPE", fromTemplate("types/bool.t")}, {"NAME", "flag"}})
+	};
+
+	const QString threads = fromTemplate("threads/implementationsSectionHeader.t") + "\n"
+			+ fromTemplate("threads/implementation.t", {{"NAME", "worker"}
+					, {"BODY", fromTemplate("wait/timer.t", {{"DELAY", "500"}})}});
+
+	return fromTemplate("main.t", {{"VARIABLES", variables.join("\n")}
+			, {"CONSTANTS_INITIALIZATION", ""}
+			, {"ARRAYS_INITIALIZATION", ""}
+			, {"MAILBOXES_OPENING", ""}
+			, {"MAIN_CODE", mainCode.join("\n")}
+			, {"MAILBOXES_CLOSING", ""}
+			, {"THREADS", threads}
+			, {"SUBPROGRAMS", ""}});
+}
+
+/// Returns all test programs by their names: hand-written ones from test data and ones composed from
+/// generator templates.
+QMap<QString, QString> corpus()
+{
+	QMap<QString, QString> result;
+	const QDir testData("lmsAssembler");
+	for (const QString &program : testData.entryList({"*.lms"}, QDir::Files, QDir::Name)) {
+		result[QFileInfo(program).baseName()] = QString::fromUtf8(readFile(testData.filePath(program)));
+	}
+
+	result["templates"] = templateProgram();
+	return result;
+}
+
+}
+
+/// Compares output with images produced by assembler.jar for each program in the corpus.
+/// The jar is the reference implementation and is kept in the tree only for this test, so the test fails
+/// when it can not be run: without it nothing checks that produced images are the ones EV3 expects.
+TEST(LmsAssemblerTest, referenceAssemblerTest)
+{
+	ASSERT_TRUE(QFile::exists(referenceAssemblerPath + "/assembler.jar"));
+	ASSERT_TRUE(javaAvailable()) << "Java is not installed, reference assembler can not be run";
+
+	const QMap<QString, QString> programs = corpus();
+	for (auto program = programs.constBegin(); program != programs.constEnd(); ++program) {
+		SCOPED_TRACE(program.key().toStdString());
+		const QByteArray expected = referenceImage(program.key(), program.value().toUtf8());
+		ASSERT_FALSE(expected.isEmpty());
+
+		LmsAssembler assembler;
+		EXPECT_EQ(expected.toHex().toStdString(), assembler.assemble(program.value()).toHex().toStdString());
+	}
+}
+
+/// Checks that each program in the corpus is assembled without errors into a well-formed image.
+TEST(LmsAssemblerTest, corpusTest)
+{
+	const QMap<QString, QString> programs = corpus();
+	ASSERT_GT(programs.size(), 1);
+
+	for (auto program = programs.constBegin(); program != programs.constEnd(); ++program) {
+		SCOPED_TRACE(program.key().toStdString());
+		ASSERT_FALSE(program.value().isEmpty());
+
+		LmsAssembler assembler;
+		const QByteArray image = assembler.assemble(program.value());
+		EXPECT_TRUE(assembler.errors().isEmpty()) << assembler.errors().join("\n").toStdString();
+		ASSERT_GE(image.size(), 16);
+		EXPECT_EQ("LEGO", image.left(4));
+		EXPECT_EQ(static_cast<quint32>(image.size())
+				, qFromLittleEndian<quint32>(reinterpret_cast<const uchar *>(image.constData()) + 4));
+	}
+}
+
+TEST(LmsAssemblerTest, headerTest)
+{
+	LmsAssembler assembler;
+	const QByteArray image = assembler.assemble(
+			"DATA32 counter\n"
+			"vmthread MAIN\n"
+			"{\n"
+			"	DATA8 flag\n"
+			"	DATA32 value\n"
+			"	MOVE32_32(counter, value)\n"
+			"}\n");
+	ASSERT_TRUE(assembler.errors().isEmpty()) << assembler.errors().join("\n").toStdString();
+	ASSERT_GE(image.size(), 28);
+
+	const auto uchars = reinterpret_cast<const uchar *>(image.constData());
+	EXPECT_EQ("LEGO", image.left(4));
+	EXPECT_EQ(static_cast<quint32>(image.size()), qFromLittleEndian<quint32>(uchars + 4));
+	EXPECT_EQ(1, qFromLittleEndian<quint16>(uchars + 10));
+	EXPECT_EQ(4u, qFromLittleEndian<quint32>(uchars + 12));
+	EXPECT_EQ(28u, qFromLittleEndian<quint32>(uchars + 16));
+	// Local DATA32 is aligned after DATA8, so locals take 8 bytes.
+	EXPECT_EQ(8u, qFromLittleEndian<quint32>(uchars + 24));
+}
+
+TEST(LmsAssemblerTest, unknownInstructionTest)
+{
+	LmsAssembler assembler;
+	EXPECT_TRUE(assembler.assemble("vmthread MAIN\n{\n\tNO_SUCH_OPCODE(1)\n}\n").isEmpty());
+	ASSERT_EQ(1, assembler.errors().size());
+	EXPECT_TRUE(assembler.errors().first().contains("NO_SUCH_OPCODE"));
+	EXPECT_TRUE(assembler.errors().first().contains("MAIN"));
+}
+
+TEST(LmsAssemblerTest, undefinedSymbolTest)
+{
+	LmsAssembler assembler;
+	EXPECT_TRUE(assembler.assemble("vmthread MAIN\n{\n\tDATA32 a\n\tMOVE32_32(missing, a)\n}\n").isEmpty());
+	ASSERT_FALSE(assembler.errors().isEmpty());
+	EXPECT_TRUE(assembler.errors().first().contains("missing"));
+}
+
+TEST(LmsAssemblerTest, undefinedLabelTest)
+{
+	LmsAssembler assembler;
+	EXPECT_TRUE(assembler.assemble("vmthread MAIN\n{\n\tJR(nowhere)\n}\n").isEmpty());
+	ASSERT_FALSE(assembler.errors().isEmpty());
+	EXPECT_TRUE(assembler.errors().first().contains("nowhere"));
+
+	// Errors of previous run must not leak into the next one.
+	EXPECT_FALSE(assembler.assemble("vmthread MAIN\n{\n\tOBJECT_END\n}\n").isEmpty());
+	EXPECT_TRUE(assembler.errors().isEmpty());
+}
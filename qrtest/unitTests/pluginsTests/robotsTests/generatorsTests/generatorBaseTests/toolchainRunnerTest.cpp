@@ -0,0 +1,272 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <functional>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QTimer>
+
+#include <generatorBase/toolchainRunner.h>
+#include <mocks/qrgui/plugins/toolPluginInterface/usedInterfaces/errorReporterMock.h>
+
+#include "gtest/gtest.h"
+
+using namespace generatorBase;
+using namespace ::testing;
+
+namespace {
+
+/// Runs event loop until the condition holds or timeout expires.
+bool waitFor(const std::function<bool()> &condition, int timeout = 5000)
+{
+	QTimer ticker;
+	ticker.start(10);
+	QElapsedTimer timer;
+	timer.start();
+	while (!condition() && timer.elapsed() < timeout) {
+		QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+	}
+
+	return condition();
+}
+
+ToolchainStep shellStep(const QString &command)
+{
+	ToolchainStep step;
+	step.program = "sh";
+	step.arguments = {"-c", command};
+	return step;
+}
+
+QByteArray readFile(const QString &path)
+{
+	QFile file(path);
+	file.open(QIODevice::ReadOnly);
+	return file.readAll();
+}
+
+void writeFile(const QString &path, const QByteArray &contents)
+{
+	QFile file(path);
+	file.open(QIODevice::WriteOnly);
+	file.write(contents);
+}
+
+/// Runs steps and collects everything the runner reports.
+class ToolchainRunnerTest : public Test
+{
+protected:
+	void SetUp() override
+	{
+		ON_CALL(mErrorReporter, addInformation(_, _)).WillByDefault(Invoke(
+				[this](const QString &message, const qReal::Id &) { mInformation << message; }));
+		ON_CALL(mErrorReporter, addWarning(_, _)).WillByDefault(Invoke(
+				[this](const QString &message, const qReal::Id &) { mWarnings << message; }));
+		ON_CALL(mErrorReporter, addError(_, _)).WillByDefault(Invoke(
+				[this](const QString &message, const qReal::Id &) { mErrors << message; }));
+
+		mRunner.reset(new ToolchainRunner(&mErrorReporter));
+		mRunner->setCacheDirectory(mDirectory.path() + "/cache");
+		QObject::connect(mRunner.data(), &ToolchainRunner::finished, [this](bool success) {
+			mResults << success;
+		});
+	}
+
+	/// Runs \a steps and waits for the pipeline to finish, returns its result.
+	bool run(const QList<ToolchainStep> &steps)
+	{
+		const int results = mResults.size();
+		mRunner->run(steps);
+		EXPECT_TRUE(waitFor([this, results]() { return mResults.size() > results; }));
+		return !mResults.isEmpty() && mResults.last();
+	}
+
+	QTemporaryDir mDirectory;
+	NiceMock<qrTest::ErrorReporterMock> mErrorReporter;
+	QScopedPointer<ToolchainRunner> mRunner;
+	QList<bool> mResults;
+	QStringList mInformation;
+	QStringList mWarnings;
+	QStringList mErrors;
+};
+
+}
+
+TEST_F(ToolchainRunnerTest, outputStreamingTest)
+{
+	ToolchainStep step = shellStep("echo first; echo second >&2; printf third");
+	step.description = "Compiling...";
+	ASSERT_TRUE(run({step}));
+	// Standard output and error are read independently, so only the order within one channel is defined.
+	ASSERT_EQ(4, mInformation.size());
+	EXPECT_EQ("Compiling...", mInformation.first());
+	EXPECT_LT(mInformation.indexOf("first"), mInformation.indexOf("third"));
+	EXPECT_TRUE(mInformation.contains("second"));
+	EXPECT_TRUE(mErrors.isEmpty());
+	EXPECT_FALSE(mRunner->isRunning());
+}
+
+TEST_F(ToolchainRunnerTest, failedStepTest)
+{
+	const QString marker = mDirectory.path() + "/marker";
+	ToolchainStep optional = shellStep("exit 1");
+	optional.optional = true;
+
+	EXPECT_FALSE(run({optional, shellStep("exit 3"), shellStep("touch " + marker)}));
+	EXPECT_EQ(1, mWarnings.size());
+	EXPECT_EQ(QStringList{"sh finished with exit code 3"}, mErrors);
+	EXPECT_FALSE(QFile::exists(marker));
+
+	ToolchainStep missing;
+	missing.program = mDirectory.path() + "/noSuchCompiler";
+	EXPECT_FALSE(run({missing}));
+	EXPECT_EQ(2, mErrors.size());
+}
+
+TEST_F(ToolchainRunnerTest, missingOutputTest)
+{
+	const QString output = mDirectory.path() + "/program.exe";
+	writeFile(output, "stale");
+
+	ToolchainStep step = shellStep("true");
+	step.outputs = {output};
+	EXPECT_FALSE(run({step}));
+	EXPECT_FALSE(QFile::exists(output));
+}
+
+TEST_F(ToolchainRunnerTest, timeoutAndCancelTest)
+{
+	ToolchainStep step = shellStep("sleep 10");
+	step.timeout = 200;
+
+	QElapsedTimer timer;
+	timer.start();
+	EXPECT_FALSE(run({step}));
+	EXPECT_LT(timer.elapsed(), 5000);
+	EXPECT_EQ(1, mErrors.size());
+
+	step.timeout = 0;
+	mRunner->run({step});
+	EXPECT_TRUE(mRunner->isRunning());
+	mRunner->cancel();
+	EXPECT_FALSE(mRunner->isRunning());
+	EXPECT_EQ((QList<bool>{false, false}), mResults);
+}
+
+TEST_F(ToolchainRunnerTest, outputCacheTest)
+{
+	const QString source = mDirectory.path() + "/program.pas";
+	const QString binary = mDirectory.path() + "/program.exe";
+	const QString log = mDirectory.path() + "/log";
+	writeFile(source, "begin end.");
+
+	ToolchainStep compile = shellStep(QString("cat %1 > %2; echo run >> %3").arg(source, binary, log));
+	compile.inputs = {source};
+	compile.outputs = {binary};
+
+	ASSERT_TRUE(run({compile}));
+	EXPECT_EQ("begin end.", readFile(binary));
+	EXPECT_FALSE(ToolchainRunner::cacheKey(compile).isEmpty());
+
+	// Unchanged source, compiler is not launched, binary is restored from cache.
+	QFile::remove(binary);
+	ASSERT_TRUE(run({compile}));
+	EXPECT_EQ("begin end.", readFile(binary));
+	EXPECT_EQ("run\n", readFile(log));
+
+	const QString key = ToolchainRunner::cacheKey(compile);
+	writeFile(source, "begin writeln end.");
+	EXPECT_NE(key, ToolchainRunner::cacheKey(compile));
+	ASSERT_TRUE(run({compile}));
+	EXPECT_EQ("begin writeln end.", readFile(binary));
+	EXPECT_EQ("run\nrun\n", readFile(log));
+
+	mRunner->setCacheDirectory(QString());
+	ASSERT_TRUE(run({compile}));
+	EXPECT_EQ("run\nrun\nrun\n", readFile(log));
+}
+
+TEST_F(ToolchainRunnerTest, restartTest)
+{
+	// A caller (like "Run program" pressed during upload) prepares its state and restarts the pipeline, the old
+	// pipeline must not report its failure into the new state.
+	ToolchainStep step = shellStep("sleep 10");
+	step.timeout = 0;
+	mRunner->run({step});
+	ASSERT_TRUE(mRunner->isRunning());
+
+	bool runAfterUpload = true;
+	const QMetaObject::Connection connection = QObject::connect(mRunner.data(), &ToolchainRunner::finished
+			, [&runAfterUpload](bool success) {
+				if (!success) {
+					runAfterUpload = false;
+				}
+			});
+
+	EXPECT_TRUE(run({shellStep("true")}));
+	EXPECT_TRUE(runAfterUpload);
+	EXPECT_EQ(QList<bool>{true}, mResults);
+	QObject::disconnect(connection);
+}
+
+TEST_F(ToolchainRunnerTest, toolInCacheKeyTest)
+{
+	const QString source = mDirectory.path() + "/program.pas";
+	const QString compiler = mDirectory.path() + "/pabcnetc.exe";
+	writeFile(source, "begin end.");
+	writeFile(compiler, "old compiler");
+
+	ToolchainStep compile;
+	compile.program = "mono";
+	compile.arguments = {compiler, source};
+	compile.inputs = {source};
+	compile.outputs = {mDirectory.path() + "/program.exe"};
+
+	const QString key = ToolchainRunner::cacheKey(compile);
+	writeFile(compiler, "new, larger compiler");
+	EXPECT_NE(key, ToolchainRunner::cacheKey(compile));
+}
+
+TEST_F(ToolchainRunnerTest, cacheLimitTest)
+{
+	mRunner->setCacheLimit(2);
+	const QString log = mDirectory.path() + "/log";
+	QList<ToolchainStep> steps;
+	for (const QString &name : {"first", "second", "third"}) {
+		const QString source = mDirectory.path() + "/" + name + ".pas";
+		writeFile(source, name.toUtf8());
+		ToolchainStep compile = shellStep(QString("cp %1 %2.exe; echo %3 >> %4").arg(source, source, name, log));
+		compile.inputs = {source};
+		compile.outputs = {source + ".exe"};
+		steps << compile;
+	}
+
+	ASSERT_TRUE(run({steps[0]}));
+	ASSERT_TRUE(run({steps[1]}));
+	// The first entry becomes the most recently used one, so the second is evicted by the third.
+	waitFor([]() { return false; }, 20);
+	ASSERT_TRUE(run({steps[0]}));
+	waitFor([]() { return false; }, 20);
+	ASSERT_TRUE(run({steps[2]}));
+
+	const QDir cache(mRunner->cacheDirectory());
+	EXPECT_EQ(2, cache.entryList(QDir::Dirs | QDir::NoDotAndDotDot).size());
+	EXPECT_TRUE(cache.exists(ToolchainRunner::cacheKey(steps[0])));
+	EXPECT_FALSE(cache.exists(ToolchainRunner::cacheKey(steps[1])));
+	EXPECT_EQ("first\nsecond\nthird\n", readFile(log));
+}
@@ -15,4 +15,6 @@
 TEMPLATE = subdirs
 
 SUBDIRS = \
+	ev3RbfGeneratorTests \
+	generatorBaseTests \
 	trikV62QtsGeneratorTests \
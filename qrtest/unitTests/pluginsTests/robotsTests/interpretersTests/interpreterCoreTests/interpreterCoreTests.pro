@@ -18,7 +18,7 @@ include(../../../../common.pri)
 
 include(../../../../../../plugins/robots/interpreters/interpreterCore/interpreterCore.pri)
 
-links(qrkernel test-utils qrgui-text-editor)
+links(qrkernel test-utils qrgui-text-editor qrgui-facade)
 
 includes(plugins/robots/interpreters \
 	plugins/robots/interpreters/interpreterCore \
@@ -32,6 +32,7 @@ HEADERS += \
 	interpreterTests/interpreterTest.h \
 	interpreterTests/detailsTests/blocksTableTest.h \
 	managersTests/sensorsConfigurationManagerTest.h \
+	managersTests/saveConvertionManagerTest.h \
 	support/dummySensorsConfigurer.h \
 
 SOURCES += \
@@ -39,6 +40,7 @@ SOURCES += \
 	interpreterTests/interpreterTest.cpp \
 	interpreterTests/detailsTests/blocksTableTest.cpp \
 	managersTests/sensorsConfigurationManagerTest.cpp \
+	managersTests/saveConvertionManagerTest.cpp \
 	support/dummySensorsConfigurer.cpp \
 
 # Mocks
@@ -0,0 +1,79 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "saveConvertionManagerTest.h"
+
+#include <qrgui/plugins/toolPluginInterface/repoSnapshot.h>
+#include <qrgui/systemFacade/components/repositoryConverter.h>
+
+#include <interpreterCore/managers/saveConvertionManager.h>
+
+using namespace qrTest::robotsTests::interpreterCoreTests;
+using namespace qReal;
+
+void SaveConvertionManagerTest::SetUp()
+{
+	mRepo.reset(new qrRepo::RepoApi("saveConvertionTest.qrs", true));
+}
+
+Id SaveConvertionManagerTest::addDiagram(const QString &worldModel)
+{
+	const Id logicalDiagram = Id::createElementId("RobotsMetamodel", "RobotsDiagram", "RobotsDiagramNode");
+	const Id graphicalDiagram = logicalDiagram.sameTypeId();
+	mRepo->addChild(Id::rootId(), logicalDiagram);
+	mRepo->addChild(Id::rootId(), graphicalDiagram, logicalDiagram);
+	mRepo->setProperty(logicalDiagram, "worldModel", worldModel);
+	return logicalDiagram;
+}
+
+ProjectConverter::ConvertionResult SaveConvertionManagerTest::convert(const QString &saveVersion)
+{
+	const QList<ProjectConverter> converters = interpreterCore::SaveConvertionManager::converters();
+	bool ok = false;
+	const QList<ProjectConverter> toApply = RepositoryConverter::applicableConverters(
+			converters.last().toVersion(), Version::fromString(saveVersion), converters, ok);
+	EXPECT_TRUE(ok);
+
+	RepoSnapshot snapshot(*mRepo);
+	return RepositoryConverter::runRepoConverters(toApply, snapshot, mEditorManager);
+}
+
+TEST_F(SaveConvertionManagerTest, pre310SaveGoesThroughWholeChainTest)
+{
+	// Before 3.1.0 world model was stored in diagram property and is copied to meta information by 3.0.2 -> 3.1.0
+	// step. Project steps of later converters must see this world model, not the one they run before the copy.
+	addDiagram("<world/><robot id=\"trikV62KitRobot\">"
+			"<port value=\"trik::robotModel::twoD::parts::TwoDInfraredSensor###A1\"/>"
+			"<model value=\"commonTwoDModel\"/></robot>");
+
+	ASSERT_EQ(ProjectConverter::Success, convert("3.0.2"));
+
+	const QString worldModel = mRepo->metaInformation("worldModel").toString();
+	EXPECT_TRUE(worldModel.contains("id=\"trikKitRobot\""));
+	EXPECT_FALSE(worldModel.contains("trikV62KitRobot"));
+	EXPECT_TRUE(worldModel.contains("value=\"twoDModel::robotModel::parts::RangeSensor###A1\""));
+	EXPECT_FALSE(worldModel.contains("TwoDInfraredSensor"));
+	EXPECT_TRUE(worldModel.contains("value=\"twoDModel\""));
+}
+
+TEST_F(SaveConvertionManagerTest, unchangedWorldModelIsNotModificationTest)
+{
+	const QString worldModel = "<world/><robot id=\"trikKitRobot\"/>";
+	addDiagram(worldModel);
+	mRepo->setMetaInformation("worldModel", worldModel);
+
+	ASSERT_EQ(ProjectConverter::NoModificationsMade, convert("3.0.2"));
+	EXPECT_EQ(worldModel, mRepo->metaInformation("worldModel").toString());
+}
@@ -0,0 +1,48 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QScopedPointer>
+
+#include <gtest/gtest.h>
+
+#include <qrrepo/repoApi.h>
+#include <qrgui/plugins/pluginManager/editorManager.h>
+#include <qrgui/plugins/toolPluginInterface/projectConverter.h>
+
+namespace qrTest {
+namespace robotsTests {
+namespace interpreterCoreTests {
+
+/// Runs robots save converters over raw repository contents of old saves.
+class SaveConvertionManagerTest : public testing::Test
+{
+protected:
+	void SetUp() override;
+
+	/// Adds logical and graphical robots diagram to the save with the given world model property.
+	qReal::Id addDiagram(const QString &worldModel);
+
+	/// Converts the save from \a saveVersion to the most recent version known to converters.
+	qReal::ProjectConverter::ConvertionResult convert(const QString &saveVersion);
+
+	qReal::EditorManager mEditorManager;
+	QScopedPointer<qrRepo::RepoApi> mRepo;
+};
+
+}
+}
+}
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <QtNetwork/QTcpServer>
+#include <QtCore/QMap>
 #include <QtCore/QScopedPointer>
 #include <QPointer>
 
@@ -26,7 +27,7 @@ namespace tcpRobotSimulator {
 
 class Connection;
 
-/// TCP server that simulates TRIK robot behavior (at least, as required by run program protocol).
+/// TCP server that simulates TRIK robot behavior (at least, as required by run program protocol and telemetry).
 class TCP_ROBOT_SIMULATOR_EXPORT TcpRobotSimulator : public QTcpServer
 {
 	Q_OBJECT
@@ -50,6 +51,18 @@ public:
 	/// Check that server received "version" command.
 	bool versionRequestReceived() const;
 
+	/// Makes server use 4-byte big-endian length prefix instead of "<length>:" for new connections.
+	void setBinaryFraming(bool binary);
+
+	/// Sets a value which server reports for a given port in replies to telemetry requests.
+	void setSensorValue(const QString &port, const QString &value);
+
+	/// Sets a delay of replies to telemetry requests for new connections, simulates slow network or robot.
+	void setReplyDelay(int milliseconds);
+
+	/// Returns the number of telemetry requests received by current connection.
+	int telemetryRequestsCount() const;
+
 signals:
 	/// Emitted when "run" command received.
 	void runProgramRequestReceivedSignal();
@@ -67,6 +80,15 @@ private:
 
 	/// Robot casing version used to respond to "configVersion" command.
 	QString mConfigVersion;
+
+	/// Protocol used by new connections.
+	bool mBinaryFraming = false;
+
+	/// Sensor values reported by telemetry.
+	QMap<QString, QString> mSensorValues;
+
+	/// Delay of telemetry replies in milliseconds.
+	int mReplyDelay = 0;
 };
 
 }
@@ -17,6 +17,8 @@
 #include <QtNetwork/QTcpSocket>
 #include <QtCore/QTimer>
 #include <QtCore/QThread>
+#include <QtCore/QtEndian>
+#include <QtCore/QStringList>
 
 #include <QtCore/QDebug>
 
@@ -69,9 +71,20 @@ void Connection::send(const QByteArray &data)
 		mKeepAliveTimer->start();
 	}
 
-	const QByteArray message = mProtocol == Protocol::messageLength
-			? QByteArray::number(data.size()) + ':' + data
-			: data + '\n';
+	QByteArray message;
+	switch (mProtocol) {
+	case Protocol::messageLength:
+		message = QByteArray::number(data.size()) + ':' + data;
+		break;
+	case Protocol::endOfLineSeparator:
+		message = data + '\n';
+		break;
+	case Protocol::binaryLength:
+		message.resize(4);
+		qToBigEndian<quint32>(static_cast<quint32>(data.size()), reinterpret_cast<uchar *>(message.data()));
+		message.append(data);
+		break;
+	}
 
 	mSocket->write(message);
 }
@@ -116,36 +129,39 @@ void Connection::processBuffer()
 	switch (mProtocol) {
 	case Protocol::messageLength:
 	{
-		while (!mBuffer.isEmpty()) {
+		// Consumed messages are removed at once, otherwise a burst of requests would be copied quadratically.
+		int offset = 0;
+		while (offset < mBuffer.size()) {
 			if (mExpectedBytes == 0) {
 				// Determining the length of a message.
-				const int delimiterIndex = mBuffer.indexOf(':');
+				const int delimiterIndex = mBuffer.indexOf(':', offset);
 				if (delimiterIndex == -1) {
 					// We did not receive full message length yet.
-					return;
-				} else {
-					const QByteArray length = mBuffer.left(delimiterIndex);
-					mBuffer = mBuffer.mid(delimiterIndex + 1);
-					bool ok = false;
-					mExpectedBytes = length.toInt(&ok);
-					if (!ok) {
-						mExpectedBytes = 0;
-					}
+					break;
 				}
-			} else {
-				if (mBuffer.size() >= mExpectedBytes) {
-					QByteArray const message = mBuffer.left(mExpectedBytes);
-					mBuffer = mBuffer.mid(mExpectedBytes);
-
-					handleIncomingData(message);
 
+				bool ok = false;
+				mExpectedBytes = mBuffer.mid(offset, delimiterIndex - offset).toInt(&ok);
+				if (!ok) {
 					mExpectedBytes = 0;
-				} else {
+				}
+
+				offset = delimiterIndex + 1;
+			} else {
+				if (mBuffer.size() - offset < mExpectedBytes) {
 					// We don't have all message yet.
-					return;
+					break;
 				}
+
+				const QByteArray message = mBuffer.mid(offset, mExpectedBytes);
+				offset += mExpectedBytes;
+				mExpectedBytes = 0;
+
+				handleIncomingData(message);
 			}
 		}
+
+		mBuffer.remove(0, offset);
 		break;
 	}
 	case Protocol::endOfLineSeparator:
@@ -160,6 +176,23 @@ void Connection::processBuffer()
 		}
 		break;
 	}
+	case Protocol::binaryLength:
+	{
+		int offset = 0;
+		while (mBuffer.size() - offset >= 4) {
+			const int length = static_cast<int>(
+					qFromBigEndian<quint32>(reinterpret_cast<const uchar *>(mBuffer.constData() + offset)));
+			if (mBuffer.size() - offset - 4 < length) {
+				break;
+			}
+
+			handleIncomingData(mBuffer.mid(offset + 4, length));
+			offset += 4 + length;
+		}
+
+		mBuffer.remove(0, offset);
+		break;
+	}
 	}
 }
 
@@ -265,9 +298,51 @@ void Connection::processData(const QByteArray &data)
 	} else if (command == "configVersion") {
 		mConfigVersionRequestReceived = true;
 		send(("configVersion: " + mConfigVersion).toUtf8());
+	} else if (command.startsWith("sensor:") || command == "data") {
+		processTelemetryRequest(command);
 	}
 }
 
+void Connection::processTelemetryRequest(const QString &command)
+{
+	mTelemetryRequestsCount.fetchAndAddOrdered(1);
+
+	QString reply;
+	if (command == "data") {
+		QStringList values;
+		for (auto it = mSensorValues.cbegin(); it != mSensorValues.cend(); ++it) {
+			values << it.key() + ":" + it.value();
+		}
+
+		reply = "allData:" + values.join(';');
+	} else {
+		const QString port = command.mid(QString("sensor:").length());
+		reply = "sensor:" + port + ":" + mSensorValues.value(port, "0");
+	}
+
+	if (mReplyDelay > 0) {
+		// Each request has its own timer, so requests that arrived together are answered together.
+		QTimer::singleShot(mReplyDelay, this, [this, reply]() { send(reply.toUtf8()); });
+	} else {
+		send(reply.toUtf8());
+	}
+}
+
+void Connection::setSensorValues(const QMap<QString, QString> &values)
+{
+	mSensorValues = values;
+}
+
+void Connection::setReplyDelay(int milliseconds)
+{
+	mReplyDelay = milliseconds;
+}
+
+int Connection::telemetryRequestsCount() const
+{
+	return mTelemetryRequestsCount.load();
+}
+
 bool Connection::runProgramRequestReceived() const
 {
 	return mRunProgramRequestReceived;
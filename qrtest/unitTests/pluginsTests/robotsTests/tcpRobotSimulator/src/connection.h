@@ -15,6 +15,8 @@
 #pragma once
 
 #include <QPointer>
+#include <QtCore/QAtomicInt>
+#include <QtCore/QMap>
 #include <QtCore/QObject>
 #include <QtNetwork/QAbstractSocket>
 
@@ -32,6 +34,9 @@ enum class Protocol
 
 	/// Message is in form "<data>\n".
 	, endOfLineSeparator
+
+	/// Message is prefixed with its length as 4-byte big-endian unsigned integer.
+	, binaryLength
 };
 
 /// Heartbeat protocol option.
@@ -70,6 +75,15 @@ public:
 	/// Sends given byte array to peer.
 	Q_INVOKABLE void send(const QByteArray &data);
 
+	/// Sets values of sensors reported in replies to telemetry requests. Shall be called before init().
+	void setSensorValues(const QMap<QString, QString> &values);
+
+	/// Sets delay of replies to telemetry requests in milliseconds. Shall be called before init().
+	void setReplyDelay(int milliseconds);
+
+	/// Returns the number of received "sensor" and "data" telemetry requests.
+	int telemetryRequestsCount() const;
+
 	/// Check that server received "run" command.
 	bool runProgramRequestReceived() const;
 
@@ -116,6 +130,9 @@ private:
 	/// Processes received data.
 	virtual void processData(const QByteArray &data);
 
+	/// Answers "sensor:<port>" and "data" requests like telemetry connection of TRIK Runtime.
+	void processTelemetryRequest(const QString &command);
+
 	/// Handles incoming data: sending version or processing received data.
 	void handleIncomingData(const QByteArray &data);
 
@@ -166,6 +183,15 @@ private:
 
 	/// Simulated config version.
 	const QString mConfigVersion;
+
+	/// Simulated sensor values by port names.
+	QMap<QString, QString> mSensorValues;
+
+	/// Delay of telemetry replies.
+	int mReplyDelay = 0;
+
+	/// Number of received telemetry requests, read from the thread of the server.
+	QAtomicInt mTelemetryRequestsCount;
 };
 
 }
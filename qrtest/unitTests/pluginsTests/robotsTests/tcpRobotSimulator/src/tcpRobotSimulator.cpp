@@ -39,7 +39,10 @@ TcpRobotSimulator::~TcpRobotSimulator()
 
 void TcpRobotSimulator::incomingConnection(qintptr socketDescriptor)
 {
-	mConnection = new Connection(Protocol::messageLength, Heartbeat::use, mConfigVersion);
+	mConnection = new Connection(mBinaryFraming ? Protocol::binaryLength : Protocol::messageLength
+			, Heartbeat::use, mConfigVersion);
+	mConnection->setSensorValues(mSensorValues);
+	mConnection->setReplyDelay(mReplyDelay);
 	mConnectionThread.reset(new QThread());
 	mConnection->moveToThread(mConnectionThread.data());
 	connect(mConnectionThread.data(), &QThread::finished, mConnection, &QObject::deleteLater);
@@ -69,3 +72,23 @@ void TcpRobotSimulator::setConfigVersion(const QString &configVersion)
 {
 	mConfigVersion = configVersion;
 }
+
+void TcpRobotSimulator::setBinaryFraming(bool binary)
+{
+	mBinaryFraming = binary;
+}
+
+void TcpRobotSimulator::setSensorValue(const QString &port, const QString &value)
+{
+	mSensorValues[port] = value;
+}
+
+void TcpRobotSimulator::setReplyDelay(int milliseconds)
+{
+	mReplyDelay = milliseconds;
+}
+
+int TcpRobotSimulator::telemetryRequestsCount() const
+{
+	return mConnection ? mConnection->telemetryRequestsCount() : 0;
+}
@@ -0,0 +1,169 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QTemporaryDir>
+
+#include <utils/deployment/deployer.h>
+#include <utils/deployment/deploymentArchive.h>
+#include <utils/deployment/deploymentManifest.h>
+#include <utils/deployment/localDeploymentTransport.h>
+
+#include "gtest/gtest.h"
+
+using namespace utils::deployment;
+
+namespace {
+
+void writeFile(const QString &directory, const QString &path, const QByteArray &contents)
+{
+	const QString fullPath = QDir(directory).filePath(path);
+	QDir().mkpath(QFileInfo(fullPath).absolutePath());
+	QFile file(fullPath);
+	ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+	file.write(contents);
+}
+
+QByteArray readFile(const QString &directory, const QString &path)
+{
+	QFile file(QDir(directory).filePath(path));
+	return file.open(QIODevice::ReadOnly) ? file.readAll() : QByteArray();
+}
+
+/// Produces poorly compressible contents, so transfer volume depends on amount of changed data.
+QByteArray noise(int size, int seed)
+{
+	QByteArray result;
+	quint32 state = static_cast<quint32>(seed) * 2654435761u + 1;
+	for (int i = 0; i < size; ++i) {
+		state = state * 1664525u + 1013904223u;
+		result.append(static_cast<char>(state >> 24));
+	}
+
+	return result;
+}
+
+}
+
+TEST(DeploymentTest, archiveRoundTripTest)
+{
+	QTemporaryDir source;
+	QTemporaryDir target;
+	const QString longPath = QString("nested/%1/%2.txt").arg(QString(60, 'd'), QString(90, 'f'));
+	writeFile(source.path(), "plain.txt", "Hello");
+	writeFile(source.path(), "empty", "");
+	writeFile(source.path(), "lib/binary.so", noise(5000, 1));
+	writeFile(source.path(), longPath, "long");
+	writeFile(source.path(), "trikGui", "#!/bin/sh");
+	QFile(QDir(source.path()).filePath("trikGui")).setPermissions(
+			QFile::ReadOwner | QFile::WriteOwner | QFile::ExeOwner | QFile::ReadUser | QFile::ExeUser);
+
+	const DeploymentManifest manifest = DeploymentManifest::scan(source.path());
+	EXPECT_EQ(5, manifest.size());
+
+	QString error;
+	const QByteArray archive = DeploymentArchive::pack(source.path(), manifest.files(), error);
+	ASSERT_FALSE(archive.isEmpty()) << qPrintable(error);
+	ASSERT_TRUE(DeploymentArchive::unpack(archive, target.path(), error)) << qPrintable(error);
+
+	const DeploymentManifest unpacked = DeploymentManifest::scan(target.path());
+	EXPECT_EQ(manifest.files(), unpacked.files());
+	EXPECT_TRUE(manifest.changedFiles(unpacked).isEmpty());
+	EXPECT_EQ("long", readFile(target.path(), longPath));
+	EXPECT_TRUE(QFileInfo(QDir(target.path()).filePath("trikGui")).isExecutable());
+	EXPECT_FALSE(QFileInfo(QDir(target.path()).filePath("plain.txt")).isExecutable());
+}
+
+TEST(DeploymentTest, unsafePathTest)
+{
+	QTemporaryDir root;
+	writeFile(root.path(), "outside.txt", "secret");
+	writeFile(root.path(), "source/inside.txt", "data");
+
+	QString error;
+	const QByteArray archive = DeploymentArchive::pack(QDir(root.path()).filePath("source")
+			, {"inside.txt", "../outside.txt"}, error);
+	ASSERT_FALSE(archive.isEmpty()) << qPrintable(error);
+
+	EXPECT_FALSE(DeploymentArchive::unpack(archive, QDir(root.path()).filePath("target"), error));
+	EXPECT_FALSE(DeploymentArchive::unpack(QByteArray("garbage"), root.path(), error));
+}
+
+TEST(DeploymentTest, md5sumOutputTest)
+{
+	const QByteArray hash = QCryptographicHash::hash("Hello", QCryptographicHash::Md5).toHex();
+	const QString output = QString("%1  ./plain.txt\n%1 *./dir/file name.txt\n\nmd5sum: can't open 'x'\n")
+			.arg(QString::fromLatin1(hash).toUpper());
+
+	const DeploymentManifest manifest = DeploymentManifest::fromMd5sumOutput(output);
+	EXPECT_EQ(QStringList({"dir/file name.txt", "plain.txt"}), manifest.files());
+	EXPECT_EQ(hash, manifest.hash("plain.txt"));
+
+	QTemporaryDir directory;
+	writeFile(directory.path(), "plain.txt", "Hello");
+	EXPECT_EQ(hash, DeploymentManifest::scan(directory.path()).hash("plain.txt"));
+}
+
+TEST(DeploymentTest, unreadableFileIsChangedTest)
+{
+	// Unreadable files are scanned with empty hash, they must be packed anyway, so packing reports the error.
+	DeploymentManifest local;
+	local.insert("unreadable.bin", QByteArray());
+	EXPECT_EQ(QStringList({"unreadable.bin"}), local.changedFiles(DeploymentManifest()));
+
+	DeploymentManifest remote;
+	remote.insert("unreadable.bin", QByteArray());
+	EXPECT_EQ(QStringList({"unreadable.bin"}), local.changedFiles(remote));
+}
+
+TEST(DeploymentTest, deltaDeploymentTest)
+{
+	QTemporaryDir source;
+	QTemporaryDir target;
+	const int filesCount = 50;
+	const int fileSize = 10000;
+	for (int i = 0; i < filesCount; ++i) {
+		writeFile(source.path(), QString("dir%1/file%2.bin").arg(i % 5).arg(i), noise(fileSize, i));
+	}
+
+	LocalDeploymentTransport transport(target.path());
+	Deployer deployer(transport);
+
+	ASSERT_TRUE(deployer.deploy(source.path())) << qPrintable(deployer.errorString());
+	EXPECT_EQ(filesCount, deployer.transferredFiles().size());
+	EXPECT_EQ(1, transport.uploadsCount());
+	const qint64 fullSize = deployer.transferredBytes();
+	EXPECT_GT(fullSize, filesCount * fileSize / 2);
+	EXPECT_TRUE(DeploymentManifest::scan(source.path()).changedFiles(DeploymentManifest::scan(target.path())).isEmpty());
+
+	// Nothing changed, nothing is sent.
+	ASSERT_TRUE(deployer.deploy(source.path()));
+	EXPECT_TRUE(deployer.transferredFiles().isEmpty());
+	EXPECT_EQ(0, deployer.transferredBytes());
+	EXPECT_EQ(1, transport.uploadsCount());
+
+	// One file changed and one added, only they are sent in one stream.
+	writeFile(source.path(), "dir3/file3.bin", noise(fileSize, 1000));
+	writeFile(source.path(), "new/file.txt", "new");
+	ASSERT_TRUE(deployer.deploy(source.path()));
+	EXPECT_EQ(QStringList({"dir3/file3.bin", "new/file.txt"}), deployer.transferredFiles());
+	EXPECT_EQ(2, transport.uploadsCount());
+	EXPECT_LT(deployer.transferredBytes() * 10, fullSize);
+	EXPECT_EQ(fullSize + deployer.transferredBytes(), transport.receivedBytes());
+	EXPECT_EQ(noise(fileSize, 1000), readFile(target.path(), "dir3/file3.bin"));
+	EXPECT_EQ("new", readFile(target.path(), "new/file.txt"));
+}
@@ -0,0 +1,63 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <src/graphicsWatcher/pointsQueueProcessor.h>
+
+#include "gtest/gtest.h"
+
+using namespace utils::sensorsGraph;
+
+TEST(PointsQueueProcessorTest, columnsDecimationTest)
+{
+	const qreal step = 2;
+	PointsQueueProcessor processor(100, -10);
+
+	for (int i = 0; i < 100; ++i) {
+		processor.addNewValue(i % 2 ? 1 : -1);
+	}
+
+	processor.makeShiftLeft(step);
+	processor.addNewValue(0.5);
+
+	// Hundred samples in one column must be drawn with at most four points.
+	const QPolygonF polyline = processor.visiblePolyline();
+	EXPECT_LE(polyline.size(), 8);
+	EXPECT_EQ(polyline.first().x(), -step);
+	EXPECT_EQ(polyline.last(), processor.latestPosition());
+	EXPECT_EQ(processor.samples().size(), 101);
+	EXPECT_EQ(processor.minLimit(), -1);
+	EXPECT_EQ(processor.maxLimit(), 1);
+}
+
+TEST(PointsQueueProcessorTest, scrollingAndPeaksTest)
+{
+	const qreal step = 2;
+	PointsQueueProcessor processor(100, -10);
+	processor.addNewValue(100);
+	for (int i = 0; i < 20; ++i) {
+		processor.makeShiftLeft(step);
+		processor.addNewValue(i);
+	}
+
+	// Only columns from -10 to 0 are kept.
+	const QPolygonF polyline = processor.visiblePolyline();
+	EXPECT_EQ(polyline.first().x(), -10);
+	EXPECT_EQ(polyline.last().x(), 0);
+
+	processor.checkPeaks();
+	EXPECT_EQ(processor.maxLimit(), 19);
+	EXPECT_EQ(processor.minLimit(), 13);
+	EXPECT_EQ(processor.pointOfVerticalIntersection(QPointF(-4.3, 0)).x(), -4);
+	EXPECT_DOUBLE_EQ(processor.pointToAbsoluteValue(processor.pointOfVerticalIntersection(QPointF(-4, 0)).y()), 17);
+}
@@ -0,0 +1,125 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <QtCore/QList>
+
+#include <src/robotCommunication/messageFramer.h>
+
+#include "gtest/gtest.h"
+
+using namespace utils::robotCommunication;
+
+namespace {
+
+QList<QByteArray> drain(MessageFramer &framer)
+{
+	QList<QByteArray> result;
+	const char *message = nullptr;
+	int size = 0;
+	while (framer.next(message, size)) {
+		result << QByteArray(message, size);
+	}
+
+	return result;
+}
+
+/// Frames given messages and feeds them to the framer one byte at a time.
+QList<QByteArray> roundTrip(Framing framing, const QList<QByteArray> &messages)
+{
+	MessageFramer framer(framing);
+	QByteArray stream;
+	for (const QByteArray &message : messages) {
+		framer.frame(message, stream);
+	}
+
+	QList<QByteArray> result;
+	for (const char byte : stream) {
+		framer.append(&byte, 1);
+		result << drain(framer);
+	}
+
+	EXPECT_EQ(0, framer.pendingBytes());
+	return result;
+}
+
+const QList<QByteArray> testMessages = {
+	"keepalive"
+	, ""
+	, "sensor:A1:(1,2,3)"
+	, QString::fromUtf8("print: привет").toUtf8()
+	, QByteArray("\0\1\2:\n", 5)
+	, QByteArray(5000, 'x')
+};
+
+}
+
+TEST(MessageFramerTest, textFramingTest)
+{
+	MessageFramer framer;
+	QByteArray stream;
+	framer.frame("data", stream);
+	EXPECT_EQ("4:data", stream);
+
+	EXPECT_EQ(testMessages, roundTrip(Framing::text, testMessages));
+}
+
+TEST(MessageFramerTest, binaryFramingTest)
+{
+	MessageFramer framer(Framing::binary);
+	QByteArray stream;
+	framer.frame("data", stream);
+	EXPECT_EQ(QByteArray("\0\0\0\4data", 8), stream);
+
+	EXPECT_EQ(testMessages, roundTrip(Framing::binary, testMessages));
+}
+
+TEST(MessageFramerTest, malformedLengthTest)
+{
+	MessageFramer framer;
+	const QByteArray stream = "x:5:hello12345678901234";
+	framer.append(stream.constData(), stream.size());
+	EXPECT_EQ(QList<QByteArray>{"hello"}, drain(framer));
+	// Garbage without a delimiter is dropped instead of being accumulated forever.
+	EXPECT_EQ(0, framer.pendingBytes());
+
+	MessageFramer binaryFramer(Framing::binary);
+	binaryFramer.append("\xff\xff\xff\xff" "abc", 7);
+	EXPECT_TRUE(drain(binaryFramer).isEmpty());
+	EXPECT_EQ(0, binaryFramer.pendingBytes());
+}
+
+TEST(MessageFramerTest, bufferReuseTest)
+{
+	MessageFramer framer;
+	QByteArray stream;
+	framer.frame(QByteArray(100, 'a'), stream);
+
+	// Messages are consumed as soon as they arrive, so the buffer does not grow.
+	for (int i = 0; i < 1000; ++i) {
+		framer.append(stream.constData(), stream.size());
+		ASSERT_EQ(1, drain(framer).size());
+	}
+
+	const int capacity = framer.capacity();
+
+	// Partially received message is kept while consumed space is reused.
+	for (int i = 0; i < 1000; ++i) {
+		framer.append(stream.constData(), 50);
+		EXPECT_TRUE(drain(framer).isEmpty());
+		framer.append(stream.constData() + 50, stream.size() - 50);
+		ASSERT_EQ(QList<QByteArray>{QByteArray(100, 'a')}, drain(framer));
+	}
+
+	EXPECT_EQ(capacity, framer.capacity());
+}
@@ -0,0 +1,197 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <functional>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QTimer>
+#include <QtNetwork/QTcpServer>
+
+#include <src/robotCommunication/tcpConnectionHandler.h>
+#include <tcpRobotSimulator/tcpRobotSimulator.h>
+
+#include "gtest/gtest.h"
+
+using namespace utils::robotCommunication;
+
+namespace {
+
+/// Runs event loop until the condition holds or timeout expires.
+bool waitFor(const std::function<bool()> &condition, int timeout = 5000)
+{
+	// Wakes up the event loop to check the condition even if nothing happens.
+	QTimer ticker;
+	ticker.start(10);
+	QElapsedTimer timer;
+	timer.start();
+	while (!condition() && timer.elapsed() < timeout) {
+		QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+	}
+
+	return condition();
+}
+
+/// Collects messages received by a connection, ignoring keepalive packets.
+class Receiver
+{
+public:
+	explicit Receiver(TcpConnectionHandler &connection)
+	{
+		QObject::connect(&connection, &TcpConnectionHandler::messageReceived, [this](const QString &message) {
+			if (message != "keepalive") {
+				mMessages << message;
+			}
+		});
+	}
+
+	QStringList &messages()
+	{
+		return mMessages;
+	}
+
+	bool waitFor(int count, int timeout = 5000)
+	{
+		return ::waitFor([this, count]() { return mMessages.size() >= count; }, timeout);
+	}
+
+private:
+	QStringList mMessages;
+};
+
+/// Returns a port nobody listens to, taken from the ephemeral range.
+int freePort()
+{
+	QTcpServer server;
+	server.listen(QHostAddress::LocalHost, 0);
+	return server.serverPort();
+}
+
+void sendSensorRequests(TcpConnectionHandler &connection, const QStringList &ports)
+{
+	for (const QString &port : ports) {
+		connection.send("sensor:" + port);
+	}
+}
+
+bool connectTo(TcpConnectionHandler &connection)
+{
+	connection.connect(QHostAddress(QHostAddress::LocalHost));
+	return waitFor([&connection]() { return connection.isConnected(); });
+}
+
+}
+
+TEST(TcpConnectionHandlerTest, nonBlockingConnectTest)
+{
+	tcpRobotSimulator::TcpRobotSimulator server(0);
+	TcpConnectionHandler connection(server.serverPort());
+	Receiver receiver(connection);
+	bool connected = false;
+	QObject::connect(&connection, &TcpConnectionHandler::connected, [&connected]() { connected = true; });
+
+	connection.connect(QHostAddress(QHostAddress::LocalHost));
+	EXPECT_FALSE(connection.isConnected());
+	EXPECT_TRUE(connection.isOpen());
+
+	// Sent before connection is established, delivered after.
+	connection.send("version");
+	ASSERT_TRUE(receiver.waitFor(1));
+	EXPECT_TRUE(connected);
+	EXPECT_TRUE(connection.isConnected());
+	EXPECT_EQ(QStringList{"version: 3.1.3"}, receiver.messages());
+	EXPECT_TRUE(server.versionRequestReceived());
+
+	connection.disconnect();
+	EXPECT_FALSE(connection.isOpen());
+}
+
+TEST(TcpConnectionHandlerTest, connectionFailedTest)
+{
+	TcpConnectionHandler connection(freePort());
+	QString error;
+	QObject::connect(&connection, &TcpConnectionHandler::connectionFailed, [&error](const QString &message) {
+		error = message;
+	});
+
+	connection.connect(QHostAddress(QHostAddress::LocalHost));
+	ASSERT_TRUE(waitFor([&error]() { return !error.isEmpty(); }));
+	EXPECT_FALSE(connection.isOpen());
+}
+
+TEST(TcpConnectionHandlerTest, pipelinedTelemetryTest)
+{
+	const QStringList ports = {"A1", "A2", "A3", "A4", "A5", "A6", "D1", "D2"};
+	tcpRobotSimulator::TcpRobotSimulator server(0);
+	for (int i = 0; i < ports.size(); ++i) {
+		server.setSensorValue(ports[i], QString::number(i * 10));
+	}
+
+	// Every reply is held long enough for all requests to reach the robot before the first one is answered.
+	server.setReplyDelay(200);
+
+	TcpConnectionHandler connection(server.serverPort());
+	Receiver receiver(connection);
+	int requestsBeforeFirstReply = -1;
+	QObject::connect(&connection, &TcpConnectionHandler::messageReceived
+			, [&server, &requestsBeforeFirstReply](const QString &message) {
+				if (message != "keepalive" && requestsBeforeFirstReply < 0) {
+					requestsBeforeFirstReply = server.telemetryRequestsCount();
+				}
+			});
+
+	ASSERT_TRUE(connectTo(connection));
+
+	sendSensorRequests(connection, ports);
+	ASSERT_TRUE(receiver.waitFor(ports.size()));
+
+	// Requests do not wait for replies to previous ones, and replies come in the order of requests.
+	EXPECT_EQ(ports.size(), requestsBeforeFirstReply);
+	QStringList expected;
+	for (int i = 0; i < ports.size(); ++i) {
+		expected << "sensor:" + ports[i] + ":" + QString::number(i * 10);
+	}
+
+	EXPECT_EQ(expected, receiver.messages());
+	EXPECT_EQ(ports.size(), server.telemetryRequestsCount());
+}
+
+TEST(TcpConnectionHandlerTest, framingTest)
+{
+	const int requestsCount = 2000;
+	for (const bool binary : {false, true}) {
+		tcpRobotSimulator::TcpRobotSimulator server(0);
+		server.setBinaryFraming(binary);
+		server.setSensorValue("E1", "(1,-2,3)");
+
+		TcpConnectionHandler connection(server.serverPort(), binary ? Framing::binary : Framing::text);
+		Receiver receiver(connection);
+		ASSERT_TRUE(connectTo(connection));
+
+		sendSensorRequests(connection, {"E1"});
+		connection.send("data");
+		ASSERT_TRUE(receiver.waitFor(2));
+		EXPECT_EQ((QStringList{"sensor:E1:(1,-2,3)", "allData:E1:(1,-2,3)"}), receiver.messages());
+		receiver.messages().clear();
+
+		// Many replies arrive split at arbitrary points and glued together, each of them must be extracted whole.
+		for (int i = 0; i < requestsCount; ++i) {
+			sendSensorRequests(connection, {"E1"});
+		}
+
+		ASSERT_TRUE(receiver.waitFor(requestsCount, 30000));
+		EXPECT_EQ(requestsCount, receiver.messages().count("sensor:E1:(1,-2,3)"));
+		EXPECT_EQ(requestsCount + 2, server.telemetryRequestsCount());
+	}
+}
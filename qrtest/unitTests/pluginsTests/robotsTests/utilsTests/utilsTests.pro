@@ -18,10 +18,13 @@ include(../../../common.pri)
 
 include(../../../../../plugins/robots/utils/utils.pri)
 
-links(test-utils)
+links(test-utils tcp-robot-simulator)
 
 includes(plugins/robots/utils)
 
+INCLUDEPATH += \
+	$$PWD/../tcpRobotSimulator/include \
+
 # Tests
 HEADERS += \
 	$$PWD/circularQueueTest.h \
@@ -29,4 +32,8 @@ HEADERS += \
 
 SOURCES += \
 	$$PWD/circularQueueTest.cpp \
+	$$PWD/pointsQueueProcessorTest.cpp \
+	$$PWD/deploymentTests/deployerTest.cpp \
+	$$PWD/robotCommunicationTests/messageFramerTest.cpp \
 	$$PWD/robotCommunicationTests/runProgramProtocolTest.cpp \
+	$$PWD/robotCommunicationTests/tcpConnectionHandlerTest.cpp \
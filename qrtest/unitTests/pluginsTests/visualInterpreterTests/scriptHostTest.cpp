@@ -0,0 +1,224 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <iostream>
+
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QProcess>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QTimer>
+
+#include "textualPart/pythonScriptHost.h"
+#include "textualPart/qtScriptHost.h"
+
+#include "gtest/gtest.h"
+
+using namespace qReal;
+
+namespace {
+
+int const timeout = 5000;
+
+/// Returns python interpreter available in the system or empty string if there is no one.
+QString pythonPath()
+{
+	for (QString const &candidate : { "python3", "python" }) {
+		QProcess process;
+		process.start(candidate, { "--version" });
+		if (process.waitForFinished() && process.exitStatus() == QProcess::NormalExit && process.exitCode() == 0) {
+			return candidate;
+		}
+	}
+
+	return QString();
+}
+
+#ifdef GTEST_SKIP
+#define SKIP_WITHOUT_PYTHON(python) \
+	if (python.isEmpty()) { \
+		GTEST_SKIP() << "Python is not installed"; \
+	}
+#else
+#define SKIP_WITHOUT_PYTHON(python) \
+	if (python.isEmpty()) { \
+		std::cerr << "Python is not installed, test is skipped" << std::endl; \
+		return; \
+	}
+#endif
+
+/// Checks behaviour common for all hosts: requests are executed in order in one session, errors do not break it.
+void checkSession(ScriptHost &host, QString const &initialization, QString const &increment, QString const &failure)
+{
+	host.startSession();
+	ASSERT_TRUE(host.run(ScriptHost::initialization, initialization, {}, timeout).ok);
+
+	for (int i = 1; i <= 3; ++i) {
+		ScriptHost::Result const result = host.run(ScriptHost::reaction, increment, { { "x", 0 } }, timeout);
+		ASSERT_TRUE(result.ok) << result.error.toStdString();
+		EXPECT_EQ(i, result.values["x"].toInt());
+	}
+
+	ScriptHost::Result const error = host.run(ScriptHost::reaction, failure, { { "x", 0 } }, timeout);
+	EXPECT_FALSE(error.ok);
+	EXPECT_TRUE(error.error.contains("boom")) << error.error.toStdString();
+
+	// Session survives errors in rule code.
+	ScriptHost::Result const next = host.run(ScriptHost::reaction, increment, { { "x", 0 } }, timeout);
+	ASSERT_TRUE(next.ok) << next.error.toStdString();
+	EXPECT_EQ(4, next.values["x"].toInt());
+
+	host.stopSession();
+}
+
+}
+
+TEST(QtScriptHostTest, sessionTest)
+{
+	QtScriptHost host;
+	checkSession(host, "var counter = 0;", "counter += 1; x = counter;", "throw 'boom';");
+}
+
+TEST(QtScriptHostTest, conditionTest)
+{
+	QtScriptHost host;
+	host.startSession();
+	EXPECT_TRUE(host.run(ScriptHost::applicationCondition, "a > 1", { { "a", 2 } }, timeout).condition);
+	EXPECT_FALSE(host.run(ScriptHost::applicationCondition, "a > 1", { { "a", 1 } }, timeout).condition);
+}
+
+TEST(QtScriptHostTest, timeoutTest)
+{
+	QtScriptHost host;
+	host.startSession();
+	ScriptHost::Result const result = host.run(ScriptHost::reaction, "while (true) {}", {}, 200);
+	EXPECT_FALSE(result.ok);
+	EXPECT_FALSE(result.error.isEmpty());
+
+	// The engine is usable after interruption.
+	EXPECT_TRUE(host.run(ScriptHost::reaction, "x = 1;", { { "x", 0 } }, timeout).ok);
+}
+
+TEST(QtScriptHostTest, pendingRequestTest)
+{
+	QtScriptHost host;
+	host.startSession();
+
+	// Started from the event loop while the first request waits for its reply.
+	ScriptHost::Result nested;
+	QTimer::singleShot(50, [&]() {
+		nested = host.run(ScriptHost::reaction, "x = 2;", { { "x", 0 } }, timeout);
+		host.abort();
+	});
+
+	ScriptHost::Result const first = host.run(ScriptHost::reaction, "while (true) {}", {}, timeout);
+	EXPECT_FALSE(first.ok);
+	EXPECT_FALSE(nested.ok);
+	EXPECT_FALSE(nested.error.isEmpty());
+	EXPECT_TRUE(host.run(ScriptHost::reaction, "x = 3;", { { "x", 0 } }, timeout).ok);
+}
+
+TEST(PythonScriptHostTest, sessionTest)
+{
+	QString const python = pythonPath();
+	SKIP_WITHOUT_PYTHON(python)
+
+	PythonScriptHost host;
+	host.setPythonPath(python);
+	checkSession(host, "counter = 0", "counter += 1\nx = counter", "raise Exception('boom')");
+}
+
+TEST(PythonScriptHostTest, crashAndRestartTest)
+{
+	QString const python = pythonPath();
+	SKIP_WITHOUT_PYTHON(python)
+
+	PythonScriptHost host;
+	host.setPythonPath(python);
+	host.startSession();
+	ASSERT_TRUE(host.run(ScriptHost::initialization, "counter = 5", {}, timeout).ok);
+
+	ScriptHost::Result const crash = host.run(ScriptHost::reaction, "import os\nos._exit(3)", {}, timeout);
+	EXPECT_FALSE(crash.ok);
+	EXPECT_FALSE(crash.error.isEmpty());
+
+	// Interpreter is started again with clean state.
+	ScriptHost::Result const restarted = host.run(ScriptHost::reaction
+			, "x = globals().get('counter', -1)", { { "x", 0 } }, timeout);
+	ASSERT_TRUE(restarted.ok) << restarted.error.toStdString();
+	EXPECT_EQ(-1, restarted.values["x"].toInt());
+
+	ScriptHost::Result const hanging = host.run(ScriptHost::reaction, "while True: pass", {}, 200);
+	EXPECT_FALSE(hanging.ok);
+	EXPECT_TRUE(host.run(ScriptHost::reaction, "x = 1", { { "x", 0 } }, timeout).ok);
+}
+
+TEST(ScriptHostDriverTest, protocolTest)
+{
+	QString const python = pythonPath();
+	SKIP_WITHOUT_PYTHON(python)
+
+	QTemporaryDir directory;
+	QString const driverPath = directory.filePath("scriptHostDriver.py");
+	ASSERT_TRUE(QFile::copy(":/textualPart/scriptHostDriver.py", driverPath));
+
+	QProcess driver;
+	driver.start(python, { "-u", driverPath });
+	ASSERT_TRUE(driver.waitForStarted());
+
+	auto const request = [&driver](int id, QString const &type, QString const &code, QVariantMap const &values) {
+		QJsonObject message;
+		message["id"] = id;
+		message["type"] = type;
+		message["code"] = code;
+		message["values"] = QJsonObject::fromVariantMap(values);
+		driver.write(QJsonDocument(message).toJson(QJsonDocument::Compact) + '\n');
+	};
+
+	auto const reply = [&driver]() {
+		while (!driver.canReadLine() && driver.waitForReadyRead(timeout)) {
+		}
+
+		return QJsonDocument::fromJson(driver.readLine()).object();
+	};
+
+	// Requests are sent without waiting for replies, replies come in the same order.
+	request(1, "reset", directory.path(), {});
+	request(2, "initialization", "total = 10", {});
+	request(3, "applicationCondition", "def big(v):\n    return v > 5\nbig(total + a)", { { "a", 1 } });
+	request(4, "reaction", "print('hello')\nb = total + a", { { "a", 1 }, { "b", 0 } });
+	request(5, "reaction", "raise ValueError('boom')", {});
+	request(6, "reset", directory.path(), {});
+	request(7, "reaction", "b = globals().get('total', -1)", { { "b", 0 } });
+
+	QList<QJsonObject> replies;
+	for (int i = 0; i < 7; ++i) {
+		replies << reply();
+		ASSERT_EQ(i + 1, replies.last()["id"].toInt());
+	}
+
+	EXPECT_TRUE(replies[1]["ok"].toBool());
+	EXPECT_TRUE(replies[2]["condition"].toBool());
+	EXPECT_EQ("hello\n", replies[3]["output"].toString());
+	EXPECT_EQ(11, replies[3]["values"].toObject()["b"].toInt());
+	EXPECT_EQ(1, replies[3]["values"].toObject()["a"].toInt());
+	EXPECT_FALSE(replies[4]["ok"].toBool());
+	EXPECT_TRUE(replies[4]["error"].toString().contains("ValueError: boom"));
+	EXPECT_EQ(-1, replies[6]["values"].toObject()["b"].toInt());
+
+	driver.closeWriteChannel();
+	EXPECT_TRUE(driver.waitForFinished(timeout));
+	EXPECT_EQ(0, driver.exitCode());
+}
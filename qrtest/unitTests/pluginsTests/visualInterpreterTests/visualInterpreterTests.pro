@@ -0,0 +1,37 @@
+# Copyright 2026 CyberTech Labs Ltd.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+TARGET = visualInterpreter_unittests
+include(../../common.pri)
+
+QT += script
+
+VISUAL_INTERPRETER_DIR = $$PWD/../../../../plugins/tools/visualInterpreter
+
+HEADERS += \
+	$$VISUAL_INTERPRETER_DIR/textualPart/scriptHost.h \
+	$$VISUAL_INTERPRETER_DIR/textualPart/qtScriptHost.h \
+	$$VISUAL_INTERPRETER_DIR/textualPart/pythonScriptHost.h \
+
+SOURCES += \
+	$$VISUAL_INTERPRETER_DIR/textualPart/scriptHost.cpp \
+	$$VISUAL_INTERPRETER_DIR/textualPart/qtScriptHost.cpp \
+	$$VISUAL_INTERPRETER_DIR/textualPart/pythonScriptHost.cpp \
+	scriptHostTest.cpp \
+
+RESOURCES += \
+	$$VISUAL_INTERPRETER_DIR/visualInterpreter.qrc \
+
+INCLUDEPATH += \
+	$$VISUAL_INTERPRETER_DIR \
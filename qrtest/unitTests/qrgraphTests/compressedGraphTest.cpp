@@ -0,0 +1,169 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <QtCore/QSet>
+
+#include <qrgraph/compressedGraph.h>
+#include <qrgraph/queries.h>
+#include "multigraphTest.h"
+
+using namespace qrTest;
+using namespace qrgraph;
+
+static QSet<int> toSet(const CompressedGraph::Range &range)
+{
+	QSet<int> result;
+	for (const int vertex : range) {
+		result << vertex;
+	}
+
+	return result;
+}
+
+TEST(CompressedGraphTest, adjacencyTest)
+{
+	Multigraph graph;
+	MultigraphTest::setUpCase1(graph);
+	const Node &nodeC = *graph.vertices()[2];
+	// Hanging edge must not appear in the view.
+	graph.produceEdge(*graph.vertices()[0], 0);
+
+	const CompressedGraph view(graph, 0);
+	ASSERT_EQ(5, view.verticesCount());
+	ASSERT_EQ(5, view.edgesCount());
+	ASSERT_EQ(2, view.index(nodeC));
+	ASSERT_EQ(&nodeC, &view.node(2));
+
+	ASSERT_EQ((QSet<int>{1}), toSet(view.successors(0)));
+	ASSERT_EQ(1, view.successors(0).size());
+	ASSERT_EQ((QSet<int>{2, 3}), toSet(view.successors(2)));
+	ASSERT_TRUE(view.successors(4).isEmpty());
+	ASSERT_TRUE(view.predecessors(0).isEmpty());
+	ASSERT_EQ((QSet<int>{1, 2}), toSet(view.predecessors(2)));
+	ASSERT_EQ((QSet<int>{3}), toSet(view.predecessors(4)));
+
+	for (int vertex = 0; vertex < view.verticesCount(); ++vertex) {
+		const int offset = view.successorsOffset(vertex);
+		for (int i = 0; i < view.successors(vertex).size(); ++i) {
+			const Edge &edge = view.outgoingEdge(offset + i);
+			ASSERT_EQ(&view.node(vertex), edge.begin());
+			ASSERT_EQ(&view.node(view.successors(vertex).begin()[i]), edge.end());
+		}
+	}
+
+	const CompressedGraph otherView(graph, 1);
+	ASSERT_EQ(5, otherView.edgesCount());
+	ASSERT_EQ(2, otherView.successors(0).size());
+	ASSERT_EQ((QSet<int>{3}), toSet(otherView.predecessors(3)));
+}
+
+TEST(CompressedGraphTest, actualityTest)
+{
+	Multigraph graph;
+	MultigraphTest::setUpCase1(graph);
+	const CompressedGraph view(graph, 0);
+	ASSERT_TRUE(view.isActual());
+
+	Edge &edge = graph.produceEdge(0);
+	ASSERT_FALSE(view.isActual());
+
+	const CompressedGraph newView(graph, 0);
+	ASSERT_TRUE(newView.isActual());
+	edge.connect(*graph.vertices()[4], *graph.vertices()[0]);
+	ASSERT_FALSE(newView.isActual());
+}
+
+TEST(CompressedGraphTest, reachabilityTest)
+{
+	Multigraph graph;
+	MultigraphTest::setUpCase2(graph);
+
+	for (const uint type : {0u, 1u}) {
+		const CompressedGraph view(graph, type);
+		for (const Node *from : graph.vertices()) {
+			for (const Node *to : graph.vertices()) {
+				ASSERT_EQ(Queries::isReachable(*from, *to, type)
+						, Queries::isReachable(view, view.index(*from), view.index(*to)));
+			}
+
+			const QVector<int> reachable = Queries::reachableSet(view, view.index(*from));
+			ASSERT_EQ(view.index(*from), reachable.first());
+			ASSERT_EQ(Queries::reachableSet(*from, type).count(), reachable.count());
+		}
+	}
+}
+
+TEST(CompressedGraphTest, topologicalOrderTest)
+{
+	Multigraph graph;
+	MultigraphTest::setUpCase1(graph);
+	// Both edge types have loops.
+	ASSERT_TRUE(Queries::topologicalOrder(CompressedGraph(graph, 0)).isEmpty());
+	ASSERT_TRUE(Queries::topologicalOrder(CompressedGraph(graph, 1)).isEmpty());
+
+	graph.clear();
+	Node &nodeA = graph.produceNode();
+	Node &nodeB = graph.produceNode();
+	Node &nodeC = graph.produceNode();
+	Node &nodeD = graph.produceNode();
+	graph.produceEdge(nodeD, nodeB);
+	graph.produceEdge(nodeB, nodeA);
+	graph.produceEdge(nodeD, nodeC);
+	graph.produceEdge(nodeC, nodeA);
+	graph.produceEdge(nodeD, nodeA);
+
+	const CompressedGraph view(graph, 0);
+	const QVector<int> order = Queries::topologicalOrder(view);
+	ASSERT_EQ(4, order.count());
+	for (int vertex = 0; vertex < view.verticesCount(); ++vertex) {
+		for (const int successor : view.successors(vertex)) {
+			ASSERT_LT(order.indexOf(vertex), order.indexOf(successor));
+		}
+	}
+
+	graph.produceEdge(nodeA, nodeD);
+	ASSERT_TRUE(Queries::topologicalOrder(CompressedGraph(graph, 0)).isEmpty());
+}
+
+TEST(CompressedGraphTest, dominatorsTest)
+{
+	// Control flow graph of a loop with a branch inside and an unreachable block:
+	// R -> A -> B -> D -> A, A -> C -> D, D -> E, U -> E.
+	Multigraph graph;
+	Node &nodeR = graph.produceNode();
+	Node &nodeA = graph.produceNode();
+	Node &nodeB = graph.produceNode();
+	Node &nodeC = graph.produceNode();
+	Node &nodeD = graph.produceNode();
+	Node &nodeE = graph.produceNode();
+	Node &nodeU = graph.produceNode();
+	graph.produceEdge(nodeR, nodeA);
+	graph.produceEdge(nodeA, nodeB);
+	graph.produceEdge(nodeA, nodeC);
+	graph.produceEdge(nodeB, nodeD);
+	graph.produceEdge(nodeC, nodeD);
+	graph.produceEdge(nodeD, nodeA);
+	graph.produceEdge(nodeD, nodeE);
+	graph.produceEdge(nodeU, nodeE);
+
+	const CompressedGraph view(graph, 0);
+	const QVector<int> dominators = Queries::immediateDominators(view, view.index(nodeR));
+	ASSERT_EQ(view.index(nodeR), dominators[view.index(nodeR)]);
+	ASSERT_EQ(view.index(nodeR), dominators[view.index(nodeA)]);
+	ASSERT_EQ(view.index(nodeA), dominators[view.index(nodeB)]);
+	ASSERT_EQ(view.index(nodeA), dominators[view.index(nodeC)]);
+	ASSERT_EQ(view.index(nodeA), dominators[view.index(nodeD)]);
+	ASSERT_EQ(view.index(nodeD), dominators[view.index(nodeE)]);
+	ASSERT_EQ(-1, dominators[view.index(nodeU)]);
+}
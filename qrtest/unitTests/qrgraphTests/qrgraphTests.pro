@@ -23,6 +23,7 @@ INCLUDEPATH += $$PWD/../../../
 SOURCES += \
 	$$PWD/multigraphTest.cpp \
 	$$PWD/queriesTest.cpp \
+	$$PWD/compressedGraphTest.cpp \
 
 HEADERS += \
 	$$PWD/multigraphTest.h \
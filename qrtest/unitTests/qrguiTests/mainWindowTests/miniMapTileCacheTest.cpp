@@ -0,0 +1,146 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include <QtGui/QImage>
+#include <QtGui/QPainter>
+#include <QtWidgets/QGraphicsRectItem>
+#include <QtWidgets/QGraphicsScene>
+
+#include <mainWindow/miniMapTileCache.h>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+/// Minimap pixels per scene unit, a tile covers 1280 scene units.
+const qreal scale = 0.1;
+
+QPolygonF rectOutline(const QGraphicsItem &item)
+{
+	const QGraphicsRectItem * const rectItem = dynamic_cast<const QGraphicsRectItem *>(&item);
+	if (!rectItem) {
+		return QPolygonF();
+	}
+
+	QPolygonF result = rectItem->mapToScene(rectItem->rect());
+	result << result.first();
+	return result;
+}
+
+class MiniMapTileCacheTest : public testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		mScene.setSceneRect(0, 0, 3000, 3000);
+		mTiles.setSource(&mScene);
+		mTiles.setScale(scale);
+	}
+
+	/// Draws the whole scene with the cache and tells if there is something at the given scene point.
+	bool isDrawn(const QPointF &point)
+	{
+		const QRectF area = mScene.sceneRect();
+		QImage image((area.size() * scale).toSize(), QImage::Format_ARGB32);
+		image.fill(Qt::white);
+		QPainter painter(&image);
+		painter.scale(scale, scale);
+		mTiles.draw(&painter, area);
+		painter.end();
+		return image.pixel((point * scale).toPoint()) != QColor(Qt::white).rgb();
+	}
+
+	static bool covers(const QList<QRectF> &areas, const QPointF &point)
+	{
+		for (const QRectF &area : areas) {
+			if (area.contains(point)) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	QGraphicsScene mScene;
+	MiniMapTileCache mTiles { &rectOutline };
+};
+
+}
+
+TEST_F(MiniMapTileCacheTest, offScreenItemMoveTest)
+{
+	QGraphicsRectItem * const item = mScene.addRect(0, 0, 200, 200);
+	item->setPos(100, 100);
+	ASSERT_TRUE(isDrawn(QPointF(200, 200)));
+	ASSERT_FALSE(isDrawn(QPointF(2600, 2600)));
+
+	// Scene rect is fixed and nothing repaints the item, the only hint is the change report.
+	item->setPos(2500, 2500);
+	mTiles.itemChanged(item);
+	const QList<QRectF> changed = mTiles.synchronize();
+	EXPECT_TRUE(covers(changed, QPointF(200, 200)));
+	EXPECT_TRUE(covers(changed, QPointF(2600, 2600)));
+
+	EXPECT_FALSE(isDrawn(QPointF(200, 200)));
+	EXPECT_TRUE(isDrawn(QPointF(2600, 2600)));
+	EXPECT_TRUE(mTiles.synchronize().isEmpty());
+}
+
+TEST_F(MiniMapTileCacheTest, itemMovedBeforeSynchronizeIsDrawnTest)
+{
+	QGraphicsRectItem * const item = mScene.addRect(0, 0, 200, 200);
+	item->setPos(100, 100);
+	ASSERT_TRUE(isDrawn(QPointF(200, 200)));
+
+	// Tiles at the new place are rendered before the change is applied, the old place must be dropped anyway.
+	item->setPos(2500, 2500);
+	mTiles.itemChanged(item);
+	mTiles.invalidate(QRectF(2500, 2500, 200, 200));
+	ASSERT_TRUE(isDrawn(QPointF(2600, 2600)));
+
+	EXPECT_TRUE(covers(mTiles.synchronize(), QPointF(200, 200)));
+	EXPECT_FALSE(isDrawn(QPointF(200, 200)));
+	EXPECT_TRUE(isDrawn(QPointF(2600, 2600)));
+}
+
+TEST_F(MiniMapTileCacheTest, removedItemTest)
+{
+	QGraphicsRectItem * const item = mScene.addRect(0, 0, 200, 200);
+	item->setPos(2500, 100);
+	ASSERT_TRUE(isDrawn(QPointF(2600, 200)));
+
+	mScene.removeItem(item);
+	mTiles.itemRemoved(item);
+	delete item;
+
+	EXPECT_TRUE(covers(mTiles.synchronize(), QPointF(2600, 200)));
+	EXPECT_FALSE(isDrawn(QPointF(2600, 200)));
+}
+
+TEST_F(MiniMapTileCacheTest, childrenFollowParentTest)
+{
+	QGraphicsRectItem * const parent = mScene.addRect(0, 0, 100, 100);
+	QGraphicsRectItem * const child = new QGraphicsRectItem(300, 300, 100, 100, parent);
+	parent->setPos(100, 100);
+	ASSERT_TRUE(isDrawn(QPointF(450, 450)));
+
+	// Only the parent is reported, children move with it silently.
+	parent->setPos(2000, 2000);
+	mTiles.itemChanged(parent);
+	mTiles.synchronize();
+
+	EXPECT_FALSE(isDrawn(QPointF(450, 450)));
+	EXPECT_TRUE(isDrawn(child->mapToScene(child->rect().center())));
+}
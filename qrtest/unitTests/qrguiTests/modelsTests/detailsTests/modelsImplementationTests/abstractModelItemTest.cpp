@@ -0,0 +1,64 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <gtest/gtest.h>
+
+#include <models/details/modelsImplementation/abstractModelItem.h>
+
+using namespace qReal;
+using namespace qReal::models::details::modelsImplementation;
+
+namespace {
+
+/// Checks that every child reports its actual position.
+void expectRows(const AbstractModelItem &parent)
+{
+	const AbstractModelItem::PointerList children = parent.children();
+	for (int i = 0; i < children.size(); ++i) {
+		EXPECT_EQ(i, children[i]->row());
+	}
+}
+
+}
+
+TEST(AbstractModelItemTest, rowsTest)
+{
+	AbstractModelItem root(Id::rootId(), nullptr);
+	QList<AbstractModelItem *> items;
+	for (int i = 0; i < 5; ++i) {
+		items << new AbstractModelItem(Id("editor", "diagram", "element", QString::number(i)), &root);
+		root.addChild(items.last());
+	}
+
+	expectRows(root);
+
+	root.removeChild(items[1]);
+	expectRows(root);
+	EXPECT_EQ(1, items[2]->row());
+
+	root.stackBefore(items[4], items[0]);
+	expectRows(root);
+	EXPECT_EQ(0, items[4]->row());
+	EXPECT_EQ(1, items[0]->row());
+
+	root.stackBefore(items[4], items[3]);
+	expectRows(root);
+
+	// Item attached again is found even if its cached row is stale.
+	root.addChild(items[1]);
+	expectRows(root);
+	EXPECT_EQ(4, items[1]->row());
+
+	qDeleteAll(items);
+}
@@ -24,3 +24,4 @@ HEADERS += \
 
 SOURCES += \
 	$$PWD/detailsTests/graphicalPartModelTest.cpp \
+	$$PWD/detailsTests/modelsImplementationTests/abstractModelItemTest.cpp \
@@ -0,0 +1,116 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include <QtCore/QtMath>
+
+#include <gestureIndex.h>
+#include <levenshteinDistance.h>
+
+#include "gtest/gtest.h"
+
+using namespace qReal::gestures;
+
+namespace {
+
+/// Makes a gesture of a few random strokes.
+PathVector randomPath(int seed)
+{
+	qsrand(static_cast<uint>(seed));
+	PathVector result;
+	const int strokes = 1 + qrand() % 3;
+	for (int stroke = 0; stroke < strokes; ++stroke) {
+		PointVector points;
+		const int count = 2 + qrand() % 4;
+		for (int i = 0; i < count; ++i) {
+			points << QPointF(qrand() % 200, qrand() % 200);
+		}
+
+		result << points;
+	}
+
+	return result;
+}
+
+int linearNearest(const QList<GestureIndex::Key> &keys, const GestureIndex::Key &key, qreal maxDistance)
+{
+	MixedGesturesManager manager;
+	int result = -1;
+	qreal minDistance = maxDistance;
+	for (int i = 0; i < keys.size(); ++i) {
+		const qreal distance = manager.getDistance(key, keys[i]);
+		if (distance < minDistance) {
+			minDistance = distance;
+			result = i;
+		}
+	}
+
+	return result;
+}
+
+}
+
+TEST(GestureIndexTest, boundedDistanceTest)
+{
+	MixedGesturesManager manager;
+	const GestureIndex::Key key1 = manager.getKey(randomPath(1));
+	const GestureIndex::Key key2 = manager.getKey(randomPath(2));
+	const qreal distance = manager.getDistance(key1, key2);
+	EXPECT_EQ(distance, MixedGesturesManager::distance(key1, key2, distance));
+	EXPECT_GT(MixedGesturesManager::distance(key1, key2, distance / 2), distance / 2);
+	EXPECT_EQ(0, MixedGesturesManager::distance(key1, key1, 0));
+}
+
+TEST(GestureIndexTest, sameAsLinearScanTest)
+{
+	MixedGesturesManager manager;
+	GestureIndex index;
+	QList<GestureIndex::Key> keys;
+	for (int i = 0; i < 60; ++i) {
+		keys << manager.getKey(randomPath(i));
+		index.insert(keys.last());
+	}
+
+	// Duplicate gesture, the first one shall win.
+	keys << keys[10];
+	index.insert(keys.last());
+	ASSERT_EQ(keys.size(), index.size());
+
+	for (int i = 0; i < keys.size(); ++i) {
+		EXPECT_EQ(i == keys.size() - 1 ? 10 : i, index.nearest(keys[i], 30));
+	}
+
+	for (int i = 1000; i < 1100; ++i) {
+		const GestureIndex::Key key = manager.getKey(randomPath(i));
+		for (const qreal maxDistance : {5.0, 30.0, 1000.0}) {
+			EXPECT_EQ(linearNearest(keys, key, maxDistance), index.nearest(key, maxDistance));
+		}
+	}
+
+	index.clear();
+	EXPECT_EQ(-1, index.nearest(keys[0], 30));
+}
+
+TEST(GestureIndexTest, levenshteinDistanceTest)
+{
+	EXPECT_EQ(0, LevenshteinDistance::getLevenshteinDistance("", ""));
+	EXPECT_EQ(3, LevenshteinDistance::getLevenshteinDistance("abc", ""));
+	EXPECT_EQ(3, LevenshteinDistance::getLevenshteinDistance("kitten", "sitting"));
+	EXPECT_EQ(3, LevenshteinDistance::getLevenshteinDistance("sitting", "kitten", 3));
+	EXPECT_EQ(3, LevenshteinDistance::getLevenshteinDistance("sitting", "kitten", 2));
+	EXPECT_LT(1, LevenshteinDistance::getLevenshteinDistance("abcdef", "fedcba", 1));
+	EXPECT_EQ(1, LevenshteinDistance::getLevenshteinDistance("abcdef", "abcxef", 1));
+	EXPECT_EQ(6, LevenshteinDistance::getLevenshteinDistance(QString(300, 'a'), QString(294, 'a')));
+	EXPECT_EQ(1, LevenshteinDistance::getLevenshteinDistance("a", "abcdefgh", 0));
+}
@@ -0,0 +1,34 @@
+# Copyright 2026 CyberTech Labs Ltd.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+INCLUDEPATH += $$PWD/../../../../qrgui/mouseGestures/private
+
+HEADERS += \
+	$$PWD/../../../../qrgui/mouseGestures/private/gestureIndex.h \
+	$$PWD/../../../../qrgui/mouseGestures/private/keyBuilder.h \
+	$$PWD/../../../../qrgui/mouseGestures/private/levenshteinDistance.h \
+	$$PWD/../../../../qrgui/mouseGestures/private/mixedgesturesmanager.h \
+	$$PWD/../../../../qrgui/mouseGestures/private/nearestposgridgesturesmanager.h \
+	$$PWD/../../../../qrgui/mouseGestures/private/pathCorrector.h \
+	$$PWD/../../../../qrgui/mouseGestures/private/rectanglegesturesmanager.h \
+
+SOURCES += \
+	$$PWD/../../../../qrgui/mouseGestures/private/gestureIndex.cpp \
+	$$PWD/../../../../qrgui/mouseGestures/private/keyBuilder.cpp \
+	$$PWD/../../../../qrgui/mouseGestures/private/levenshteinDistance.cpp \
+	$$PWD/../../../../qrgui/mouseGestures/private/mixedgesturesmanager.cpp \
+	$$PWD/../../../../qrgui/mouseGestures/private/nearestposgridgesturesmanager.cpp \
+	$$PWD/../../../../qrgui/mouseGestures/private/pathCorrector.cpp \
+	$$PWD/../../../../qrgui/mouseGestures/private/rectanglegesturesmanager.cpp \
+	$$PWD/gestureIndexTest.cpp \
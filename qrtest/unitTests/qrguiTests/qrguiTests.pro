@@ -27,4 +27,8 @@ INCLUDEPATH += \
 
 include(modelsTests/modelsTests.pri)
 
+include(mainWindowTests/mainWindowTests.pri)
+
+include(mouseGesturesTests/mouseGesturesTests.pri)
+
 include(helpers/helpers.pri)
@@ -161,3 +161,50 @@ TEST(IdsTest, idInputOutputStreamTest) {
 
 	EXPECT_EQ(in, out);
 }
+
+TEST(IdsTest, internedRepresentationTest) {
+	const Id created = Id::createElementId("editor", "diagram", "element");
+	const Id loaded = Id::loadFromString(created.toString());
+	EXPECT_EQ(loaded, created);
+	EXPECT_EQ(qHash(loaded), qHash(created));
+	EXPECT_EQ(loaded.id(), created.id());
+	EXPECT_EQ(Id(created.type(), created.id()), created);
+
+	// Non-canonical UUID strings must be kept as is.
+	const QString upperCase = created.id().toUpper();
+	const Id upperCaseId("editor", "diagram", "element", upperCase);
+	EXPECT_EQ(upperCaseId.id(), upperCase);
+	EXPECT_NE(upperCaseId, created);
+
+	const Id nullUuid("editor", "diagram", "element", QUuid().toString());
+	EXPECT_EQ(nullUuid.id(), QUuid().toString());
+	EXPECT_EQ(nullUuid.idSize(), (uint) 4);
+	EXPECT_NE(nullUuid, Id("editor", "diagram", "element"));
+
+	EXPECT_TRUE(Id().isNull());
+	EXPECT_TRUE(Id::loadFromString("qrm:/").isNull());
+	EXPECT_FALSE(created.type().isNull());
+}
+
+TEST(IdsTest, orderingTest) {
+	QList<Id> ids;
+	for (int i = 0; i < 20; ++i) {
+		ids << Id::createElementId("editor", "diagram", i % 2 ? "a" : "b");
+	}
+
+	ids << Id("editor", "diagram", "a", "ROOT_ID") << Id("editor", "diagram", "b", "id")
+			<< Id("editor", "diagram", "a") << Id("editor") << Id::rootId() << Id();
+
+	for (const Id &first : ids) {
+		for (const Id &second : ids) {
+			EXPECT_EQ(first < second, first.toString() < second.toString());
+		}
+	}
+}
+
+TEST(IdsTest, partsTest) {
+	EXPECT_EQ(Id::loadFromString("qrm:/editor/diagram/element/id").parts()
+			, QStringList({"editor", "diagram", "element", "id"}));
+	EXPECT_EQ(Id("editor", "diagram").parts(), QStringList({"editor", "diagram"}));
+	EXPECT_TRUE(Id().parts().isEmpty());
+}
@@ -14,6 +14,10 @@
 
 #include "settingsManagerTest.h"
 
+#include <thread>
+
+#include <qrkernel/settingsKey.h>
+
 using namespace qrTest;
 
 void SettingsManagerTest::SetUp() {
@@ -50,3 +54,35 @@ TEST_F(SettingsManagerTest, defaultValueTest) {
 	QString const val = mSettingsManager->value("aabbccTestProperty", "default value").toString();
 	EXPECT_EQ(val, "default value");
 }
+
+TEST_F(SettingsManagerTest, typedKeyTest) {
+	const qReal::SettingsKey<QString> debugColor("debugColor");
+	mSettingsManager->setValue("debugColor", "test color");
+	EXPECT_EQ(debugColor.value(), "test color");
+
+	mSettingsManager->setValue("debugColor", "other color");
+	EXPECT_EQ(debugColor.value(), "other color");
+
+	const qReal::SettingsKey<int> missing("aabbccTestIntProperty", 42);
+	EXPECT_EQ(missing.value(), 42);
+}
+
+TEST_F(SettingsManagerTest, concurrentTypedReadTest) {
+	const qReal::SettingsKey<QString> debugColor("debugColor");
+	mSettingsManager->setValue("debugColor", "first");
+
+	bool consistent = true;
+	std::thread reader([&debugColor, &consistent]() {
+		for (int i = 0; i < 100000; ++i) {
+			const QString value = debugColor.value();
+			consistent = consistent && (value == "first" || value == "second");
+		}
+	});
+
+	for (int i = 0; i < 1000; ++i) {
+		mSettingsManager->setValue("debugColor", i % 2 ? "first" : "second");
+	}
+
+	reader.join();
+	EXPECT_TRUE(consistent);
+}
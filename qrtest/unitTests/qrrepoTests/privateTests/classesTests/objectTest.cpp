@@ -19,6 +19,7 @@
 #include <qrkernel/exception/exception.h>
 #include <qrrepo/private/classes/logicalObject.h>
 #include <qrrepo/private/classes/graphicalObject.h>
+#include <qrrepo/private/classes/propertySchema.h>
 
 using namespace qReal;
 using namespace qrRepo::details;
@@ -376,3 +377,66 @@ TEST(ObjectTest, replacePropertiesTest)
 	EXPECT_EQ(obj.property("property_test2").toString(), "replace_value");
 	EXPECT_EQ(obj.property("property").toString(), "val");
 }
+
+TEST(ObjectTest, schemaPropertiesTest)
+{
+	const Id type("schemaEditor", "diagram", "element");
+	PropertySchema::registerType(type, {"condition", "body"});
+	const auto schema = PropertySchema::forType(type);
+	ASSERT_FALSE(schema.isNull());
+	EXPECT_EQ(schema->slot("condition"), schema->slot("body") - 1);
+	EXPECT_EQ(schema->slot("unknown"), -1);
+
+	// The same properties do not produce a new schema.
+	PropertySchema::registerType(type, {"condition", "body"});
+	EXPECT_EQ(schema, PropertySchema::forType(type));
+
+	qrRepo::details::LogicalObject obj(type.sameTypeId());
+	obj.setProperty("condition", "x > 0");
+	obj.setProperty("name", "if");
+	obj.setProperty("dynamic", 42);
+
+	EXPECT_EQ(obj.property("condition").toString(), "x > 0");
+	EXPECT_EQ(obj.property("dynamic").toInt(), 42);
+	EXPECT_EQ(obj.property("body"), QVariant());
+	EXPECT_TRUE(obj.hasProperty("Condition"));
+	EXPECT_FALSE(obj.hasProperty("body"));
+	EXPECT_THROW(obj.removeProperty("body"), Exception);
+
+	const QMap<QString, QVariant> properties = obj.properties();
+	EXPECT_EQ(properties.keys(), (QStringList{"condition", "dynamic", "name"}));
+
+	obj.removeProperty("condition");
+	obj.removeProperty("dynamic");
+	EXPECT_FALSE(obj.hasProperty("condition"));
+	EXPECT_EQ(obj.properties().keys(), QStringList{"name"});
+
+	obj.setProperties(properties);
+	EXPECT_EQ(obj.properties(), properties);
+
+	// Objects of a type without schema receive properties through a map.
+	qrRepo::details::LogicalObject other(Id("editor", "diagram", "element", "id"));
+	other.copyPropertiesFrom(obj);
+	EXPECT_EQ(other.properties(), properties);
+
+	QHash<Id, Object *> objHash;
+	Object * const cloned = obj.clone(objHash);
+	EXPECT_EQ(cloned->properties(), properties);
+	cloned->setProperty("condition", "x < 0");
+	EXPECT_EQ(obj.property("condition").toString(), "x > 0");
+	qDeleteAll(objHash);
+}
+
+TEST(ObjectTest, schemaSerializationTest)
+{
+	const Id type("schemaEditor", "diagram", "serializedElement");
+	PropertySchema::registerType(type, {"condition"});
+
+	qrRepo::details::LogicalObject obj(type.sameTypeId());
+	obj.setProperty("condition", "x > 0");
+	obj.setProperty("dynamic", "value");
+
+	QDomDocument document;
+	const qrRepo::details::LogicalObject deserialized(obj.serialize(document));
+	EXPECT_EQ(deserialized.properties(), obj.properties());
+}
@@ -646,3 +646,29 @@ TEST_F(RepositoryTest, saveDiagramsByIdTest) {
 
 	QFile::remove("diagram1.qrs");
 }
+
+TEST_F(RepositoryTest, searchAfterChangesTest) {
+	EXPECT_TRUE(mRepository->findElementsByName("renamed", false, false).isEmpty());
+
+	mRepository->setProperty(child1, "name", "renamed child");
+	IdList list = mRepository->findElementsByName("renamed", false, false);
+	EXPECT_EQ(list, IdList({child1}));
+
+	list = mRepository->findElementsByName("ChilD1", false, false);
+	EXPECT_EQ(list, IdList({child1_child}));
+
+	mRepository->addChild(child1, newId1, child1LogicalId);
+	mRepository->setProperty(newId1, "name", "renamed too");
+	list = mRepository->findElementsByName("ren.*d", false, true);
+	EXPECT_EQ(2, list.size());
+	EXPECT_TRUE(list.contains(child1));
+	EXPECT_TRUE(list.contains(newId1));
+
+	mRepository->removeChild(child1, newId1);
+	mRepository->remove(newId1);
+	EXPECT_EQ(IdList({child1}), mRepository->findElementsByName("renamed", false, false));
+
+	mRepository->removeProperty(root, "property1");
+	EXPECT_TRUE(mRepository->elementsByProperty("property1", false, false).isEmpty());
+	EXPECT_TRUE(mRepository->elementsByPropertyContent("value1", false, false).isEmpty());
+}
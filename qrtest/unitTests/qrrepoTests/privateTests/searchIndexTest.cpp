@@ -0,0 +1,76 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <qrrepo/private/searchIndex.h>
+
+#include <gtest/gtest.h>
+
+#include <qrrepo/private/classes/logicalObject.h>
+
+using namespace qReal;
+using namespace qrRepo::details;
+
+TEST(SearchIndexTest, requiredLiteralTest)
+{
+	EXPECT_EQ("abc", SearchIndex::requiredLiteral("abc"));
+	EXPECT_EQ("child", SearchIndex::requiredLiteral("c.*child.*"));
+	EXPECT_EQ("prop", SearchIndex::requiredLiteral("prop.*[1,2]"));
+	EXPECT_EQ("value", SearchIndex::requiredLiteral("^valu?value$"));
+	EXPECT_EQ("a.b", SearchIndex::requiredLiteral("a\\.b\\d"));
+	EXPECT_EQ("tail", SearchIndex::requiredLiteral("(optional)?tail"));
+	EXPECT_EQ("abc", SearchIndex::requiredLiteral("[]x]abc[^]]"));
+	EXPECT_EQ("", SearchIndex::requiredLiteral("first|second"));
+	EXPECT_EQ("a", SearchIndex::requiredLiteral("ab{2}"));
+	EXPECT_EQ("name", SearchIndex::requiredLiteral("\\x41name"));
+	EXPECT_EQ("name", SearchIndex::requiredLiteral("name\\u0041"));
+	EXPECT_EQ("name", SearchIndex::requiredLiteral("\\0101name"));
+	EXPECT_EQ("g1", SearchIndex::requiredLiteral("(g)\\12g1"));
+}
+
+TEST(SearchIndexTest, incrementalUpdateTest)
+{
+	const Id first("editor", "diagram", "element", "first");
+	const Id second("editor", "diagram", "element", "second");
+	LogicalObject firstObject(first);
+	LogicalObject secondObject(second);
+	firstObject.setProperty("name", "Initial node");
+	secondObject.setProperty("condition", "x > 100");
+
+	QHash<Id, Object *> objects;
+	objects.insert(first, &firstObject);
+	objects.insert(second, &secondObject);
+
+	SearchIndex index;
+	index.update(objects);
+
+	QSet<Id> result;
+	ASSERT_TRUE(index.substringCandidates(SearchIndex::Field::name, "INITIAL", result));
+	EXPECT_EQ(QSet<Id>({first}), result);
+	ASSERT_TRUE(index.substringCandidates(SearchIndex::Field::propertyValue, "> 100", result));
+	EXPECT_EQ(QSet<Id>({second}), result);
+	ASSERT_TRUE(index.regExpCandidates(SearchIndex::Field::propertyName, "cond.*", Qt::CaseSensitive, result));
+	EXPECT_EQ(QSet<Id>({second}), result);
+	EXPECT_FALSE(index.substringCandidates(SearchIndex::Field::name, "no", result));
+
+	secondObject.setProperty("name", "Final node");
+	index.markDirty(second);
+	objects.remove(first);
+	index.markDirty(first);
+	index.update(objects);
+
+	ASSERT_TRUE(index.substringCandidates(SearchIndex::Field::name, "node", result));
+	EXPECT_EQ(QSet<Id>({second}), result);
+	ASSERT_TRUE(index.substringCandidates(SearchIndex::Field::name, "initial", result));
+	EXPECT_TRUE(result.isEmpty());
+}
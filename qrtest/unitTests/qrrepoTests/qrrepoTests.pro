@@ -26,6 +26,7 @@ SOURCES += \
 	privateTests/folderCompressorTest.cpp \
 	privateTests/serializerTest.cpp \
 	privateTests/repositoryTest.cpp \
+	privateTests/searchIndexTest.cpp \
 	privateTests/classesTests/objectTest.cpp \
 	privateTests/classesTests/graphicalObjectTest.cpp \
 
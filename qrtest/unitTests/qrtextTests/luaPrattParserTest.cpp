@@ -0,0 +1,239 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "luaPrattParserTest.h"
+
+#include <random>
+#include <typeinfo>
+
+#include "qrtext/lua/ast/fieldInitialization.h"
+#include "qrtext/lua/ast/identifier.h"
+#include "qrtext/lua/ast/number.h"
+#include "qrtext/lua/ast/string.h"
+
+#include "gtest/gtest.h"
+
+using namespace qrtext;
+using namespace qrtext::lua;
+using namespace qrtext::lua::details;
+using namespace qrTest;
+
+namespace {
+
+/// Code snippets from qrtext tests.
+const QStringList corpus = {
+	"123"
+	, "-123"
+	, "1+2"
+	, "1 + 2 + 3"
+	, "1 ^ 2 ^ 3"
+	, "1 * 2 + 3 * 4 + 5 * 6"
+	, "'1' .. '2'"
+	, "(a[1].someObject):method(1, 2, 3)"
+	, "a = -123; a = 1.0"
+	, "a = -123; b = a; a = 1.0"
+	, "a = f(0.5, 'a')"
+	, "a = f(b, c); b = 0.5"
+	, "a = {1}; a[0] = 1.1"
+	, "a2 = 3 + 7 | 15 & 40"
+	, "b = 1; c = 'c'; a = f(b, c)"
+	, "a = 1; b = 2; a, b"
+	, "a = {10; 15}"
+	, "a = {[1] = 10; [3] = 15}"
+	, "a = {{{1, 2}, {3, 4}}, {{5, 6}, {7, 8}}}"
+	, "a[1 - 1] = 239; a[3 * 0]"
+	, "a[-1][0] = 5"
+	, "s = \"a = \" .. \"1\""
+	, "S=sensorA1; Sold=S;"
+	, "sensorA1 = 30; M4 = 'M4'; M3 = 'M3'"
+	, "{1, 2} ~= {1, 3}"
+	, "not 'abcd' and 1 || 2 && true"
+	, "0 ^ -1"
+	, "~~2"
+	, "#'asdf' // 2 % 3 << 1 >> 2"
+	, "1 <= 2 == 3 >= 4 != 5 < 6 > 7"
+	, "x, y = y, x"
+	, "print 'text'; f{1, 2}; t:m{x = 1}"
+	, "f()()[1].a:b()"
+	, ";;a = nil;"
+	, "1 *"
+	, "* 1"
+	, "true ||| false"
+	, "a = {1, 2,}"
+	, "f(1) = 2"
+	, "a, b = 1"
+	, "..."
+};
+
+/// Returns string representation of a tree with connections of each node.
+QString dump(const QSharedPointer<core::ast::Node> &node)
+{
+	if (!node) {
+		return "null";
+	}
+
+	QString result = typeid(*node).name();
+	if (node->is<ast::Identifier>()) {
+		result += " " + as<ast::Identifier>(node)->name();
+	} else if (node->is<ast::Number>()) {
+		result += " " + as<ast::Number>(node)->stringRepresentation();
+	} else if (node->is<ast::String>()) {
+		result += " " + as<ast::String>(node)->string();
+	} else if (node->is<ast::FieldInitialization>()) {
+		result += as<ast::FieldInitialization>(node)->implicitKey() ? " implicit" : " explicit";
+	}
+
+	result += QString(" [%1, %2](").arg(node->start().absolutePosition()).arg(node->end().absolutePosition());
+	for (const auto &child : node->children()) {
+		result += dump(child) + " ";
+	}
+
+	return result + ")";
+}
+
+/// Generates random expression of at most given depth.
+QString randomExpression(std::mt19937 &random, int depth)
+{
+	const QStringList atoms = {"1", "2.5", "'s'", "x", "nil", "true", "false", "...", "f(1)", "t.a", "t[1]"
+			, "o:m(2)", "{}", "{1, x = 2; [3] = 4}", "f 'x'", "f{1}", "g()"};
+	const QStringList binaryOperators = {"+", "-", "*", "/", "//", "^", "%", "&", "~", "|", ">>", "<<", "..", "<"
+			, "<=", ">", ">=", "==", "~=", "!=", "and", "or", "&&", "||"};
+	const QStringList unaryOperators = {"-", "not ", "#", "~"};
+	const QStringList suffixes = {"", ".b", "[1]", "(x, y)", ":m()", "{}"};
+
+	if (depth == 0 || random() % 4 == 0) {
+		return atoms[random() % atoms.size()];
+	}
+
+	switch (random() % 4) {
+	case 0:
+		return unaryOperators[random() % unaryOperators.size()] + randomExpression(random, depth - 1);
+	case 1:
+		return "(" + randomExpression(random, depth - 1) + ")" + suffixes[random() % suffixes.size()];
+	default:
+		return randomExpression(random, depth - 1) + " " + binaryOperators[random() % binaryOperators.size()]
+				+ " " + randomExpression(random, depth - 1);
+	}
+}
+
+}
+
+void LuaPrattParserTest::SetUp()
+{
+	mErrors.clear();
+	mLexer.reset(new LuaLexer(mErrors));
+	mParser.reset(new LuaParser(mErrors));
+	mPrattParser.reset(new LuaPrattParser(mErrors));
+}
+
+void LuaPrattParserTest::compare(const QString &code)
+{
+	mErrors.clear();
+	const auto tokens = mLexer->tokenize(code);
+	if (!mErrors.isEmpty()) {
+		// Lexer errors are not interesting here.
+		return;
+	}
+
+	const auto expected = mParser->parse(tokens, mLexer->userFriendlyTokenNames());
+	const QList<core::Error> expectedErrors = mErrors;
+	mErrors.clear();
+
+	const auto actual = mPrattParser->parse(tokens, mLexer->userFriendlyTokenNames());
+
+	ASSERT_EQ(expectedErrors.isEmpty(), mErrors.isEmpty()) << code.toStdString();
+	if (expectedErrors.isEmpty()) {
+		ASSERT_EQ(dump(expected).toStdString(), dump(actual).toStdString()) << code.toStdString();
+	} else {
+		// Combinators go on parsing after an error and report its consequences too, while Pratt parser stops,
+		// so only the first error shall be the same.
+		ASSERT_EQ(expectedErrors.first().errorMessage().toStdString(), mErrors.first().errorMessage().toStdString())
+				<< code.toStdString();
+		ASSERT_EQ(expectedErrors.first().connection(), mErrors.first().connection()) << code.toStdString();
+	}
+}
+
+TEST_F(LuaPrattParserTest, corpusTest)
+{
+	for (const QString &code : corpus) {
+		compare(code);
+	}
+}
+
+TEST_F(LuaPrattParserTest, tokenMutationsTest)
+{
+	std::mt19937 random(239);
+	QStringList lexemes;
+	for (const QString &code : corpus) {
+		for (const auto &token : mLexer->tokenize(code)) {
+			lexemes << token.lexeme();
+		}
+	}
+
+	for (int i = 0; i < 5000; ++i) {
+		QStringList code;
+		for (const auto &token : mLexer->tokenize(corpus[random() % corpus.size()])) {
+			code << token.lexeme();
+		}
+
+		for (int mutations = 1 + random() % 3; mutations > 0 && !code.isEmpty(); --mutations) {
+			const int position = random() % code.size();
+			switch (random() % 4) {
+			case 0:
+				code.removeAt(position);
+				break;
+			case 1:
+				code.insert(position, code[position]);
+				break;
+			case 2:
+				std::swap(code[position], code[random() % code.size()]);
+				break;
+			default:
+				code.insert(position, lexemes[random() % lexemes.size()]);
+				break;
+			}
+		}
+
+		compare(code.join(' '));
+		if (HasFatalFailure()) {
+			return;
+		}
+	}
+}
+
+TEST_F(LuaPrattParserTest, randomProgramsTest)
+{
+	std::mt19937 random(30);
+	for (int i = 0; i < 2000; ++i) {
+		const QString code = QString("a = %1; b, c = %2, %3; %4")
+				.arg(randomExpression(random, 4))
+				.arg(randomExpression(random, 3))
+				.arg(randomExpression(random, 3))
+				.arg(randomExpression(random, 5));
+
+		compare(code);
+		if (HasFatalFailure()) {
+			return;
+		}
+	}
+}
+
+TEST_F(LuaPrattParserTest, errorsTest)
+{
+	const QStringList code = {"1 +", "a = (1", "f(1, )", "t.1", "t:m", "{[1] 2}", "a = = 1", "1 + * 2", ") a"};
+	for (const QString &line : code) {
+		compare(line);
+		EXPECT_FALSE(mErrors.isEmpty()) << line.toStdString();
+	}
+}
@@ -0,0 +1,42 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QScopedPointer>
+
+#include <gtest/gtest.h>
+
+#include "qrtext/src/lua/luaParser.h"
+#include "qrtext/src/lua/luaPrattParser.h"
+#include "qrtext/src/lua/luaLexer.h"
+
+namespace qrTest {
+
+/// Compares LuaPrattParser with combinator-based LuaParser which is used as a reference.
+class LuaPrattParserTest : public testing::Test
+{
+protected:
+	void SetUp() override;
+
+	/// Parses given code by both parsers and checks that they produce the same trees or report the same first error.
+	void compare(const QString &code);
+
+	QScopedPointer<qrtext::lua::details::LuaParser> mParser;
+	QScopedPointer<qrtext::lua::details::LuaPrattParser> mPrattParser;
+	QScopedPointer<qrtext::lua::details::LuaLexer> mLexer;
+	QList<qrtext::core::Error> mErrors;
+};
+
+}
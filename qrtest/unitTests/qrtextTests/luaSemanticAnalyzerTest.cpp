@@ -35,6 +35,18 @@ using namespace qrtext::lua;
 using namespace qrtext::lua::details;
 using namespace qrtext::lua::types;
 
+namespace {
+
+/// Gives tests direct access to unification of types.
+class UnifyingAnalyzer : public LuaSemanticAnalyzer
+{
+public:
+	using LuaSemanticAnalyzer::LuaSemanticAnalyzer;
+	using LuaSemanticAnalyzer::unify;
+};
+
+}
+
 void LuaSemanticAnalyzerTest::SetUp()
 {
 	mAnalyzer.reset(new LuaSemanticAnalyzer(mErrors));
@@ -130,6 +142,47 @@ TEST_F(LuaSemanticAnalyzerTest, integerFloatCoercion)
 	EXPECT_TRUE(mAnalyzer->type(secondValue)->is<types::Float>());
 }
 
+TEST_F(LuaSemanticAnalyzerTest, repeatedAnalysis)
+{
+	auto tree = parse("a = -123; b = a; a = 1.0");
+	for (int i = 0; i < 3; ++i) {
+		mAnalyzer->analyze(tree);
+	}
+
+	EXPECT_TRUE(mErrors.isEmpty());
+
+	auto block = as<ast::Block>(tree);
+	auto b = as<ast::Assignment>(block->children()[1])->variable();
+	EXPECT_TRUE(mAnalyzer->type(b)->is<types::Float>());
+
+	// Tree is unchanged, but the analyzer rules are, so the tree shall be checked again.
+	mAnalyzer->addReadOnlyVariable("b");
+	mAnalyzer->analyze(tree);
+	EXPECT_FALSE(mErrors.isEmpty());
+}
+
+TEST_F(LuaSemanticAnalyzerTest, unificationOfClasses)
+{
+	UnifyingAnalyzer analyzer(mErrors);
+	const auto first = parse("a = 1");
+	const auto second = parse("b = 0.5");
+	const auto third = parse("c = -a");
+	analyzer.analyze(first);
+	analyzer.analyze(second);
+	analyzer.analyze(third);
+	ASSERT_TRUE(mErrors.isEmpty());
+
+	const auto a = as<ast::Assignment>(first)->variable();
+	const auto b = as<ast::Assignment>(second)->variable();
+	const auto minus = as<ast::Assignment>(third)->value();
+	ASSERT_TRUE(analyzer.type(minus)->is<types::Integer>());
+
+	// "-a" shares the type with "a" and shall follow it without analyzing its tree again.
+	analyzer.unify(a, b);
+	EXPECT_TRUE(analyzer.type(a)->is<types::Float>());
+	EXPECT_TRUE(analyzer.type(minus)->is<types::Float>());
+}
+
 TEST_F(LuaSemanticAnalyzerTest, functionReturnType)
 {
 	auto tree = parse("a = f(1)");
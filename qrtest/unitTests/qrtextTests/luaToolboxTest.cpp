@@ -178,3 +178,38 @@ TEST_F(LuaToolboxTest, twoFunctions)
 	mToolbox->interpret<int>("cos(1)");
 	ASSERT_TRUE(mToolbox->errors().isEmpty());
 }
+
+TEST_F(LuaToolboxTest, changedIdentifiers)
+{
+	const quint64 initialRevision = mToolbox->valuesRevision();
+	mToolbox->interpret<int>("a = 1; b = 2");
+	EXPECT_EQ(QStringList({"a", "b"}), mToolbox->changedIdentifiers(initialRevision));
+
+	const quint64 identifiersRevision = mToolbox->identifiersRevision();
+	const quint64 valuesRevision = mToolbox->valuesRevision();
+	EXPECT_NE(initialRevision, valuesRevision);
+
+	// Assigning the same value is not a change.
+	mToolbox->interpret<int>("a = 1");
+	EXPECT_EQ(valuesRevision, mToolbox->valuesRevision());
+	EXPECT_TRUE(mToolbox->changedIdentifiers(valuesRevision).isEmpty());
+
+	mToolbox->interpret<int>("b = 3");
+	mToolbox->interpret<int>("a = 5");
+	EXPECT_EQ(QStringList({"b", "a"}), mToolbox->changedIdentifiers(valuesRevision));
+	EXPECT_EQ(identifiersRevision, mToolbox->identifiersRevision());
+
+	mToolbox->interpret<int>("c = {1, 2}");
+	EXPECT_NE(identifiersRevision, mToolbox->identifiersRevision());
+
+	const quint64 tableRevision = mToolbox->valuesRevision();
+	mToolbox->interpret<int>("c[1] = 3");
+	EXPECT_EQ(QStringList({"c"}), mToolbox->changedIdentifiers(tableRevision));
+
+	// Value of another type is a change even if QVariant considers it equal.
+	mToolbox->interpret<int>("d = 1");
+	const quint64 typeRevision = mToolbox->valuesRevision();
+	mToolbox->interpret<int>("d = 1.0");
+	EXPECT_EQ(QStringList({"d"}), mToolbox->changedIdentifiers(typeRevision));
+	EXPECT_EQ(QVariant::Double, mToolbox->value<QVariant>("d").type());
+}
@@ -26,6 +26,7 @@ HEADERS += \
 	luaLexerTest.h \
 	luaParserIncorrectInputTest.h \
 	luaParserTest.h \
+	luaPrattParserTest.h \
 	luaSemanticAnalyzerTest.h \
 	luaToolboxTest.h \
 
@@ -34,6 +35,7 @@ SOURCES += \
 	luaInterpreterTest.cpp \
 	luaParserIncorrectInputTest.cpp \
 	luaParserTest.cpp \
+	luaPrattParserTest.cpp \
 	luaSemanticAnalyzerTest.cpp \
 	luaToolboxTest.cpp \
 	luaLexerTest.cpp \
@@ -0,0 +1,98 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <QtCore/QBuffer>
+#include <QtGui/QImage>
+
+#include <qrutils/blobStore.h>
+
+#include "gtest/gtest.h"
+
+using namespace utils;
+
+namespace {
+
+QByteArray png(const QSize &size, const QColor &color)
+{
+	QImage image(size, QImage::Format_RGB32);
+	image.fill(color);
+	QByteArray bytes;
+	QBuffer buffer(&bytes);
+	image.save(&buffer, "PNG");
+	return bytes;
+}
+
+}
+
+TEST(BlobStoreTest, deduplicationTest)
+{
+	const auto store = BlobStore::instance();
+	const QByteArray red = png(QSize(8, 8), Qt::red);
+
+	const auto first = store->put(red);
+	const auto second = store->put(QByteArray(red.constData(), red.size()));
+	EXPECT_EQ(first, second);
+	EXPECT_EQ(BlobStore::hash(red), first->hash());
+	EXPECT_EQ(first, store->find(first->hash()));
+
+	const auto other = store->put(png(QSize(8, 8), Qt::blue));
+	EXPECT_NE(first->hash(), other->hash());
+}
+
+TEST(BlobStoreTest, expiredBlobTest)
+{
+	const auto store = BlobStore::instance();
+	QString hash;
+	{
+		const auto blob = store->put("some data");
+		hash = blob->hash();
+		EXPECT_FALSE(store->find(hash).isNull());
+	}
+
+	EXPECT_TRUE(store->find(hash).isNull());
+}
+
+TEST(BlobStoreTest, lazyScaledDecodingTest)
+{
+	const auto store = BlobStore::instance();
+	const auto blob = store->put(png(QSize(400, 200), Qt::green));
+
+	EXPECT_EQ(QSize(400, 200), blob->imageSize());
+	EXPECT_EQ(QSize(400, 200), blob->image().size());
+
+	// Nearest halving that still covers requested size.
+	EXPECT_EQ(QSize(100, 50), blob->image(QSize(90, 40)).size());
+	EXPECT_EQ(QSize(200, 100), blob->image(QSize(101, 10)).size());
+	EXPECT_EQ(QSize(400, 200), blob->image(QSize(1000, 1000)).size());
+	EXPECT_EQ(QColor(Qt::green).rgb(), blob->image(QSize(10, 10)).pixel(0, 0));
+
+	const auto garbage = store->put("not an image");
+	EXPECT_TRUE(garbage->imageSize().isEmpty());
+	EXPECT_TRUE(garbage->image(QSize(10, 10)).isNull());
+}
+
+TEST(BlobStoreTest, decodedResolutionsCacheTest)
+{
+	const auto store = BlobStore::instance();
+	const auto blob = store->put(png(QSize(400, 200), Qt::green));
+
+	// Switching between zooms reuses images decoded before instead of keeping only the last one.
+	const qint64 full = blob->image().cacheKey();
+	const qint64 half = blob->image(QSize(200, 100)).cacheKey();
+	const qint64 quarter = blob->image(QSize(100, 50)).cacheKey();
+	EXPECT_EQ(full, blob->image().cacheKey());
+	EXPECT_EQ(half, blob->image(QSize(150, 100)).cacheKey());
+	EXPECT_EQ(quarter, blob->image(QSize(90, 40)).cacheKey());
+	EXPECT_NE(full, half);
+}
@@ -0,0 +1,352 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <qrutils/graphUtils/incrementalMatcher.h>
+
+#include "gtest/gtest.h"
+
+using namespace qReal;
+
+namespace {
+
+Id element(const QString &type, const QString &name)
+{
+	return Id("editor", "diagram", type, name);
+}
+
+/// In-memory model with control flow marks, like models interpreted by block diagram semantics.
+/// Pattern nodes named "marked" match only marked nodes, "Element" pattern nodes match nodes of any type.
+class TestModel : public IncrementalMatcher::Context
+{
+public:
+	Id addNode(const QString &type, const QString &name)
+	{
+		const Id id = element(type, name);
+		mNodes << id;
+		mLinks[id];
+		return id;
+	}
+
+	Id addLink(const QString &name, const Id &from, const Id &to)
+	{
+		const Id id = element("ControlFlow", name);
+		mEnds[id] = qMakePair(from, to);
+		mLinks[from] << id;
+		if (to != from) {
+			mLinks[to] << id;
+		}
+
+		return id;
+	}
+
+	void removeLink(const Id &link)
+	{
+		const QPair<Id, Id> ends = mEnds.take(link);
+		mLinks[ends.first].removeAll(link);
+		mLinks[ends.second].removeAll(link);
+	}
+
+	void setMarked(const Id &node, bool marked)
+	{
+		if (marked) {
+			mMarked.insert(node);
+		} else {
+			mMarked.remove(node);
+		}
+	}
+
+	const IdList &nodes() const
+	{
+		return mNodes;
+	}
+
+	IdList marked() const
+	{
+		IdList result;
+		for (const Id &node : mNodes) {
+			if (mMarked.contains(node)) {
+				result << node;
+			}
+		}
+
+		return result;
+	}
+
+	IdList links(const Id &node) const override
+	{
+		return mLinks.value(node);
+	}
+
+	Id linkFrom(const Id &link) const override
+	{
+		return mEnds.value(link, qMakePair(Id::rootId(), Id::rootId())).first;
+	}
+
+	Id linkTo(const Id &link) const override
+	{
+		return mEnds.value(link, qMakePair(Id::rootId(), Id::rootId())).second;
+	}
+
+	bool isNodeCompatible(const Id &modelNode, const Id &patternNode) const override
+	{
+		++mComparisons;
+		return (patternNode.element() == "Element" || patternNode.element() == modelNode.element())
+				&& (patternNode.id() != "marked" || mMarked.contains(modelNode));
+	}
+
+	bool isEdgeCompatible(const Id &modelLink, const Id &patternLink) const override
+	{
+		++mComparisons;
+		return modelLink.element() == patternLink.element();
+	}
+
+	/// Finds matches without any memory, searching the whole model.
+	QList<SubgraphMatcher::Match> fullMatches(const GraphSnapshot &pattern, const IdList &starts) const
+	{
+		GraphSnapshot model;
+		for (const Id &node : starts + mNodes) {
+			model.addNode(node);
+		}
+
+		for (const Id &node : mNodes) {
+			for (const Id &link : mLinks.value(node)) {
+				if (linkFrom(link) == node) {
+					model.addEdge(link, model.nodeIndex(node), model.nodeIndex(linkTo(link)));
+				}
+			}
+		}
+
+		SubgraphMatcher matcher(pattern, model);
+		for (int patternNode = 0; patternNode < pattern.nodesCount(); ++patternNode) {
+			QVector<int> candidates;
+			for (int node = 0; node < model.nodesCount(); ++node) {
+				if ((patternNode != 0 || starts.contains(model.node(node)))
+						&& isNodeCompatible(model.node(node), pattern.node(patternNode))) {
+					candidates << node;
+				}
+			}
+
+			matcher.setNodeCandidates(patternNode, candidates);
+		}
+
+		for (int patternEdge = 0; patternEdge < pattern.edgesCount(); ++patternEdge) {
+			QVector<int> candidates;
+			for (int edge = 0; edge < model.edgesCount(); ++edge) {
+				if (isEdgeCompatible(model.edge(edge).id, pattern.edge(patternEdge).id)) {
+					candidates << edge;
+				}
+			}
+
+			matcher.setEdgeCandidates(patternEdge, candidates);
+		}
+
+		return matcher.findAll();
+	}
+
+	mutable int mComparisons = 0;
+
+private:
+	IdList mNodes;
+	QSet<Id> mMarked;
+	QHash<Id, IdList> mLinks;
+	QHash<Id, QPair<Id, Id>> mEnds;
+};
+
+/// Rule of block diagram semantics: control mark goes from a block to the next one.
+GraphSnapshot moveMarkRule()
+{
+	GraphSnapshot rule;
+	const int current = rule.addNode(element("Element", "marked"));
+	const int next = rule.addNode(element("Element", "next"));
+	rule.addEdge(element("ControlFlow", "flow"), current, next);
+	return rule;
+}
+
+/// Rule of block diagram semantics: condition with both branches leading to actions.
+GraphSnapshot conditionRule()
+{
+	GraphSnapshot rule;
+	const int condition = rule.addNode(element("Condition", "marked"));
+	const int thenBranch = rule.addNode(element("Action", "then"));
+	const int elseBranch = rule.addNode(element("Action", "else"));
+	const int after = rule.addNode(element("Element", "after"));
+	rule.addEdge(element("ControlFlow", "then"), condition, thenBranch);
+	rule.addEdge(element("ControlFlow", "else"), condition, elseBranch);
+	rule.addEdge(element("ControlFlow", "join"), thenBranch, after);
+	return rule;
+}
+
+/// Builds a block diagram with \a size blocks: a cycle of actions with conditions branching on every 5th block.
+void buildBlockDiagram(TestModel &model, int size)
+{
+	IdList blocks;
+	for (int i = 0; i < size; ++i) {
+		blocks << model.addNode(i % 5 ? "Action" : "Condition", QString::number(i));
+	}
+
+	for (int i = 0; i < size; ++i) {
+		model.addLink(QString("next%1").arg(i), blocks[i], blocks[(i + 1) % size]);
+		if (i % 5 == 0) {
+			model.addLink(QString("branch%1").arg(i), blocks[i], blocks[(i + 2) % size]);
+		}
+	}
+
+	for (int i = 0; i < size; i += size / 10) {
+		model.setMarked(blocks[i + 1], true);
+	}
+}
+
+/// Returns matches in comparable form, ignoring their order.
+QStringList canonical(const QList<SubgraphMatcher::Match> &matches)
+{
+	QStringList result;
+	for (const SubgraphMatcher::Match &match : matches) {
+		QStringList pairs;
+		for (auto pair = match.cbegin(); pair != match.cend(); ++pair) {
+			pairs << pair.key().toString() + "=" + pair.value().toString();
+		}
+
+		pairs.sort();
+		result << pairs.join(";");
+	}
+
+	result.sort();
+	return result;
+}
+
+}
+
+TEST(IncrementalMatcherTest, followsChangesTest)
+{
+	TestModel model;
+	buildBlockDiagram(model, 100);
+	const GraphSnapshot rule = moveMarkRule();
+	IncrementalMatcher matcher(rule, model);
+
+	// Every marked block with the following one.
+	EXPECT_EQ(canonical(model.fullMatches(rule, model.nodes())), canonical(matcher.matches(model.nodes())));
+	EXPECT_EQ(10, matcher.matches(model.nodes()).size());
+	EXPECT_EQ(100, matcher.searchedStarts());
+
+	// Marks shall be reported too, because compatibility depends on them.
+	const GraphSnapshot conditions = conditionRule();
+	IncrementalMatcher conditionMatcher(conditions, model);
+	EXPECT_TRUE(conditionMatcher.matches(model.nodes()).isEmpty());
+	model.setMarked(element("Condition", "50"), true);
+	matcher.elementChanged(element("Condition", "50"));
+	conditionMatcher.elementChanged(element("Condition", "50"));
+	EXPECT_EQ(canonical(model.fullMatches(conditions, model.nodes())), canonical(conditionMatcher.matches(model.nodes())));
+	EXPECT_EQ(1, conditionMatcher.matches(model.nodes()).size());
+	model.addLink("extra", element("Condition", "50"), element("Action", "53"));
+	matcher.elementChanged(element("ControlFlow", "extra"));
+	conditionMatcher.elementChanged(element("ControlFlow", "extra"));
+	const QList<SubgraphMatcher::Match> found = conditionMatcher.matches(model.nodes());
+	EXPECT_EQ(canonical(model.fullMatches(conditions, model.nodes())), canonical(found));
+	ASSERT_EQ(4, found.size());
+	EXPECT_EQ(canonical(model.fullMatches(rule, model.nodes())), canonical(matcher.matches(model.nodes())));
+	EXPECT_EQ(13, matcher.matches(model.nodes()).size());
+
+	// Removing a link drops matches containing it and searches again only for their start elements.
+	const int searched = matcher.searchedStarts();
+	model.removeLink(element("ControlFlow", "next71"));
+	matcher.elementChanged(element("ControlFlow", "next71"));
+	const QList<SubgraphMatcher::Match> matches = matcher.matches(model.nodes());
+	EXPECT_EQ(canonical(model.fullMatches(rule, model.nodes())), canonical(matches));
+	EXPECT_EQ(searched + 1, matcher.searchedStarts());
+	EXPECT_EQ(12, matches.size());
+	for (const SubgraphMatcher::Match &match : matches) {
+		EXPECT_NE(element("Action", "71"), match.value(element("Element", "marked")));
+	}
+}
+
+TEST(IncrementalMatcherTest, randomChangesTest)
+{
+	TestModel model;
+	buildBlockDiagram(model, 60);
+	const QList<GraphSnapshot> rules = {moveMarkRule(), conditionRule()};
+	QList<QSharedPointer<IncrementalMatcher>> matchers;
+	for (const GraphSnapshot &rule : rules) {
+		matchers << QSharedPointer<IncrementalMatcher>::create(rule, model);
+	}
+
+	qsrand(42);
+	IdList extraLinks;
+	for (int step = 0; step < 300; ++step) {
+		const Id node = model.nodes()[qrand() % model.nodes().size()];
+		IdList changed = {node};
+		switch (qrand() % 3) {
+		case 0:
+			model.setMarked(node, !model.marked().contains(node));
+			break;
+		case 1: {
+			const Id to = model.nodes()[qrand() % model.nodes().size()];
+			extraLinks << model.addLink(QString("extra%1").arg(step), node, to);
+			changed = {extraLinks.last()};
+			break;
+		}
+		default:
+			if (!extraLinks.isEmpty()) {
+				const Id link = extraLinks.takeAt(qrand() % extraLinks.size());
+				model.removeLink(link);
+				changed = {link};
+			}
+		}
+
+		for (const QSharedPointer<IncrementalMatcher> &matcher : matchers) {
+			for (const Id &id : changed) {
+				matcher->elementChanged(id);
+			}
+		}
+
+		const IdList starts = step % 2 ? model.marked() : model.nodes();
+		for (int i = 0; i < rules.size(); ++i) {
+			ASSERT_EQ(canonical(model.fullMatches(rules[i], starts)), canonical(matchers[i]->matches(starts)))
+					<< "step " << step << ", rule " << i;
+		}
+	}
+}
+
+TEST(IncrementalMatcherTest, stepsCompareFewerElements)
+{
+	// Interpretation of a big block diagram: on each step the first found mark moves along the control flow.
+	const int size = 5000;
+	const int steps = 300;
+	const GraphSnapshot rule = moveMarkRule();
+	int comparisons[2] = {0, 0};
+	QList<Id> trace[2];
+	for (const bool incremental : {false, true}) {
+		TestModel model;
+		buildBlockDiagram(model, size);
+		IncrementalMatcher matcher(rule, model);
+		for (int step = 0; step < steps; ++step) {
+			const IdList starts = model.marked();
+			const QList<SubgraphMatcher::Match> matches = incremental
+					? matcher.matches(starts)
+					: model.fullMatches(rule, starts);
+			ASSERT_FALSE(matches.isEmpty());
+			const Id from = matches.first().value(element("Element", "marked"));
+			const Id to = matches.first().value(element("Element", "next"));
+			model.setMarked(from, false);
+			model.setMarked(to, true);
+			matcher.elementChanged(from);
+			matcher.elementChanged(to);
+			trace[incremental] << to;
+		}
+
+		comparisons[incremental] = model.mComparisons;
+	}
+
+	EXPECT_EQ(trace[false], trace[true]);
+	EXPECT_LT(comparisons[true] * 10, comparisons[false]);
+}
@@ -29,7 +29,11 @@ SOURCES += \
 	expressionsParser/numberTest.cpp \
 	metamodelGeneratorSupportTest.cpp \
 	inFileTest.cpp \
+	blobStoreTest.cpp \
 	outFileTest.cpp \
+	subgraphMatcherTest.cpp \
+	incrementalMatcherTest.cpp \
+	watchListModelTest.cpp \
 	xmlUtilsTest.cpp \
 
 # Mocks
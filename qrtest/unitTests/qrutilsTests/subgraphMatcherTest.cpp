@@ -0,0 +1,157 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <qrutils/graphUtils/subgraphMatcher.h>
+
+#include "gtest/gtest.h"
+
+using namespace qReal;
+
+namespace {
+
+Id node(const QString &type, const QString &name)
+{
+	return Id("editor", "diagram", type, name);
+}
+
+/// Makes every pattern element compatible with target elements of the same type.
+void setCandidatesByType(SubgraphMatcher &matcher, const GraphSnapshot &pattern, const GraphSnapshot &target)
+{
+	for (int patternNode = 0; patternNode < pattern.nodesCount(); ++patternNode) {
+		QVector<int> candidates;
+		for (int targetNode = 0; targetNode < target.nodesCount(); ++targetNode) {
+			if (target.node(targetNode).element() == pattern.node(patternNode).element()) {
+				candidates << targetNode;
+			}
+		}
+
+		matcher.setNodeCandidates(patternNode, candidates);
+	}
+
+	for (int patternEdge = 0; patternEdge < pattern.edgesCount(); ++patternEdge) {
+		QVector<int> candidates;
+		for (int targetEdge = 0; targetEdge < target.edgesCount(); ++targetEdge) {
+			candidates << targetEdge;
+		}
+
+		matcher.setEdgeCandidates(patternEdge, candidates);
+	}
+}
+
+}
+
+TEST(SubgraphMatcherTest, chainInTriangleTest)
+{
+	GraphSnapshot pattern;
+	const int a = pattern.addNode(node("A", "a"));
+	const int b = pattern.addNode(node("B", "b"));
+	pattern.addEdge(node("Link", "ab"), a, b);
+
+	GraphSnapshot target;
+	const int a1 = target.addNode(node("A", "a1"));
+	const int b1 = target.addNode(node("B", "b1"));
+	const int b2 = target.addNode(node("B", "b2"));
+	target.addEdge(node("Link", "a1b1"), a1, b1);
+	target.addEdge(node("Link", "a1b2"), a1, b2);
+	target.addEdge(node("Link", "b1b2"), b1, b2);
+
+	SubgraphMatcher matcher(pattern, target);
+	setCandidatesByType(matcher, pattern, target);
+
+	const QList<SubgraphMatcher::Match> matches = matcher.findAll();
+	ASSERT_EQ(2, matches.size());
+	EXPECT_EQ(node("B", "b1"), matches[0].value(node("B", "b")));
+	EXPECT_EQ(node("Link", "a1b1"), matches[0].value(node("Link", "ab")));
+	EXPECT_EQ(node("B", "b2"), matches[1].value(node("B", "b")));
+	EXPECT_EQ(node("Link", "a1b2"), matches[1].value(node("Link", "ab")));
+}
+
+TEST(SubgraphMatcherTest, directionAndInjectivityTest)
+{
+	GraphSnapshot pattern;
+	const int a = pattern.addNode(node("A", "a"));
+	const int b1 = pattern.addNode(node("A", "b1"));
+	const int b2 = pattern.addNode(node("A", "b2"));
+	pattern.addEdge(node("Link", "1"), a, b1);
+	pattern.addEdge(node("Link", "2"), a, b2);
+
+	GraphSnapshot target;
+	const int x = target.addNode(node("A", "x"));
+	const int y = target.addNode(node("A", "y"));
+	target.addEdge(node("Link", "xy"), x, y);
+	target.addEdge(node("Link", "yx"), y, x);
+
+	SubgraphMatcher matcher(pattern, target);
+	setCandidatesByType(matcher, pattern, target);
+
+	// Node with two outgoing links can not be embedded into a graph where every node has one.
+	EXPECT_TRUE(matcher.findAll().isEmpty());
+}
+
+TEST(SubgraphMatcherTest, parallelEnumerationTest)
+{
+	GraphSnapshot pattern;
+	const int a = pattern.addNode(node("A", "a"));
+	const int b = pattern.addNode(node("B", "b"));
+	const int c = pattern.addNode(node("A", "c"));
+	pattern.addEdge(node("Link", "ab"), a, b);
+	pattern.addEdge(node("Link", "bc"), b, c);
+	pattern.addNode(node("B", "disconnected"));
+
+	GraphSnapshot target;
+	const int size = 50;
+	for (int i = 0; i < size; ++i) {
+		target.addNode(node(i % 2 ? "B" : "A", QString::number(i)));
+	}
+
+	for (int i = 0; i + 1 < size; ++i) {
+		target.addEdge(node("Link", QString::number(i)), i, i + 1);
+	}
+
+	SubgraphMatcher matcher(pattern, target);
+	setCandidatesByType(matcher, pattern, target);
+
+	EXPECT_FALSE(matcher.isMatched(pattern.nodeIndex(node("B", "disconnected"))));
+
+	const QList<SubgraphMatcher::Match> sequential = matcher.findAll(false);
+	const QList<SubgraphMatcher::Match> parallel = matcher.findAll(true);
+	EXPECT_EQ(size / 2 - 1, sequential.size());
+	EXPECT_EQ(sequential, parallel);
+}
+
+TEST(SubgraphMatcherTest, parallelEdgesTest)
+{
+	GraphSnapshot pattern;
+	const int a = pattern.addNode(node("A", "a"));
+	const int b = pattern.addNode(node("B", "b"));
+	const int any = pattern.addEdge(node("Link", "any"), a, b);
+	const int special = pattern.addEdge(node("Link", "special"), a, b);
+
+	GraphSnapshot target;
+	const int a1 = target.addNode(node("A", "a1"));
+	const int b1 = target.addNode(node("B", "b1"));
+	const int first = target.addEdge(node("Link", "first"), a1, b1);
+	const int second = target.addEdge(node("Link", "second"), a1, b1);
+
+	SubgraphMatcher matcher(pattern, target);
+	setCandidatesByType(matcher, pattern, target);
+	matcher.setEdgeCandidates(any, {first, second});
+	matcher.setEdgeCandidates(special, {first});
+
+	// "any" link gets the first target link at first, then it must give it up for "special" one.
+	const QList<SubgraphMatcher::Match> matches = matcher.findAll();
+	ASSERT_EQ(1, matches.size());
+	EXPECT_EQ(node("Link", "second"), matches[0].value(node("Link", "any")));
+	EXPECT_EQ(node("Link", "first"), matches[0].value(node("Link", "special")));
+}
@@ -0,0 +1,66 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <qrutils/watchListModel.h>
+
+#include "gtest/gtest.h"
+
+using namespace utils;
+
+TEST(WatchListModelTest, rowsTest)
+{
+	WatchListModel model;
+	model.setRows({"a", "b"}, {"1", "2"});
+	ASSERT_EQ(2, model.rowCount());
+	EXPECT_EQ(2, model.columnCount());
+	EXPECT_EQ("a", model.index(0, 0).data().toString());
+	EXPECT_EQ("2", model.index(1, 1).data().toString());
+
+	int inserted = 0;
+	int removed = 0;
+	QObject::connect(&model, &WatchListModel::rowsInserted, [&inserted]() { ++inserted; });
+	QObject::connect(&model, &WatchListModel::rowsRemoved, [&removed]() { ++removed; });
+
+	model.setRows({"a", "b", "c"}, {"1", "2", "3"});
+	EXPECT_EQ(1, inserted);
+	EXPECT_EQ(3, model.rowCount());
+
+	model.setRows({"c"}, {"3"});
+	EXPECT_EQ(1, removed);
+	EXPECT_EQ(QStringList{"c"}, model.identifiers());
+	EXPECT_EQ("3", model.index(0, 1).data().toString());
+}
+
+TEST(WatchListModelTest, valueTest)
+{
+	WatchListModel model;
+	model.setRows({"a", "b"}, {"1", "2"});
+
+	QList<QModelIndex> changed;
+	QObject::connect(&model, &WatchListModel::dataChanged
+			, [&changed](const QModelIndex &topLeft, const QModelIndex &bottomRight) {
+		changed << topLeft << bottomRight;
+	});
+
+	model.setValue("b", "5");
+	ASSERT_EQ(2, changed.size());
+	EXPECT_EQ(model.index(1, 1), changed[0]);
+	EXPECT_EQ(model.index(1, 1), changed[1]);
+	EXPECT_EQ("5", model.index(1, 1).data().toString());
+
+	// Same value and unknown identifier do not touch the view.
+	model.setValue("b", "5");
+	model.setValue("c", "1");
+	EXPECT_EQ(2, changed.size());
+}
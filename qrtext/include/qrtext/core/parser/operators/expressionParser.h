@@ -75,7 +75,7 @@ private:
 			return resultAst;
 		}
 
-		while (mPrecedenceTable->binaryOperators().contains(tokenStream.next().token())
+		while (mPrecedenceTable->isBinaryOperator(tokenStream.next().token())
 				&& mPrecedenceTable->precedence(tokenStream.next().token(), Arity::binary) >= currentPrecedence)
 		{
 			const int newPrecedence = mPrecedenceTable->associativity(tokenStream.next().token()) == Associativity::left
@@ -62,6 +62,12 @@ public:
 		return mBinaryOperatorPrecedences[token].second;
 	}
 
+	/// Returns true if a given token denotes a binary operator.
+	bool isBinaryOperator(TokenType token) const
+	{
+		return mBinaryOperatorPrecedences.contains(token);
+	}
+
 	/// Returns a set of all known binary operators (their token types).
 	QSet<TokenType> binaryOperators() const
 	{
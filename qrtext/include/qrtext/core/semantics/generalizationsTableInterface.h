@@ -30,6 +30,15 @@ public:
 	/// Shall return true if "specific" type is a subtype of "general" type, including case when they are equivalent.
 	virtual bool isGeneralization(const QSharedPointer<types::TypeExpression> &specific
 			, const QSharedPointer<types::TypeExpression> &general) const = 0;
+
+	/// Returns prototypes of simple types of a language, one per kind of type. Type is simple if it has no parameters,
+	/// so its generalization relation with other simple types depends only on its C++ class (like integer, but not
+	/// table of integers). Simple types are numbered and handled as bit masks during type inference, all other types
+	/// are compared by isGeneralization() each time. Default implementation has no simple types.
+	virtual QList<QSharedPointer<types::TypeExpression>> simpleTypes() const
+	{
+		return {};
+	}
 };
 
 }
@@ -17,6 +17,7 @@
 #include <QtCore/QSharedPointer>
 #include <QtCore/QHash>
 #include <QtCore/QList>
+#include <QtCore/QSet>
 
 #include <qrkernel/ids.h>
 
@@ -74,7 +75,8 @@ public:
 	virtual ~SemanticAnalyzer();
 
 	/// Analyzes given tree and assigns types for each found expression. Then types can be retrieved by calling type().
-	/// Returns analyzed tree (as of now, it is unmodified).
+	/// Returns analyzed tree (as of now, it is unmodified). If the last analysis of this tree changed nothing and
+	/// reported no errors, and nothing was changed by other analyses since then, the tree is not traversed again.
 	QSharedPointer<ast::Node> analyze(QSharedPointer<ast::Node> const &root);
 
 	/// Returns type for a given expression (if that expression was seen by "analyze" method before, or nullptr).
@@ -83,6 +85,10 @@ public:
 	/// Returns list of identifier names known to semantic analyzer.
 	QStringList identifiers() const;
 
+	/// Returns a number that is increased each time when something known to semantic analyzer changes, including
+	/// the set of identifiers.
+	int revision() const;
+
 	/// Returns a mapping of variable identifiers known to semantic analyzer to their types.
 	QMap<QString, QSharedPointer<core::types::TypeExpression>> variableTypes() const;
 
@@ -107,7 +113,8 @@ protected:
 			, QSharedPointer<ast::Node> const &node, QList<QSharedPointer<types::TypeExpression>> const &types);
 
 	/// Unifies left-hand side expression with right-hand side expression, so the type of left expressions becomes the
-	/// same type as right expression. These types change together afterwards.
+	/// same type as right expression. These types change together afterwards. All expressions that already had the
+	/// same type as left expression get the type of right expression too.
 	void unify(QSharedPointer<ast::Node> const &lhs, QSharedPointer<ast::Node> const &rhs);
 
 	/// Reports given semantic error on a given node.
@@ -128,6 +135,9 @@ protected:
 	/// Provides generalizations table for descendants.
 	const GeneralizationsTableInterface &generalizationsTable() const;
 
+	/// Provides numbered universe of simple types of a language for descendants.
+	const QSharedPointer<const types::TypeLattice> &typeLattice() const;
+
 	/// Provides acces to type variable for given expression to descendants. Note that type() will return resolved type.
 	QSharedPointer<types::TypeVariable> typeVariable(QSharedPointer<ast::Node> const &expression) const;
 
@@ -135,10 +145,17 @@ protected:
 	/// and request another pass on AST to recheck type constraints.
 	void requestRecheck();
 
+	/// Tells that some information used by analysis has changed (type variable was constrained directly, new
+	/// intrinsic function was added and so on), so all trees shall be analyzed again.
+	void invalidate();
+
 private:
 	/// Collects type information on a subtree.
 	void collect(QSharedPointer<ast::Node> const &node);
 
+	/// Returns type variable that represents a class of unified variables the given one belongs to.
+	QSharedPointer<types::TypeVariable> representative(const QSharedPointer<types::TypeVariable> &typeVariable) const;
+
 	/// Checks that all nodes in AST have their types.
 	void finalizeResolve(QSharedPointer<ast::Node> const &node);
 
@@ -155,6 +172,10 @@ private:
 	/// more convenient.
 	QHash<QSharedPointer<ast::Expression>, QSharedPointer<types::TypeVariable>> mTypes;
 
+	/// Union-find links from type variables to variables they were unified with, variables without a link represent
+	/// their classes. Variables are kept alive by the links, so a class never gets a stray member.
+	mutable QHash<QSharedPointer<types::TypeVariable>, QSharedPointer<types::TypeVariable>> mUnifiedVariables;
+
 	/// Contains mapping from identifier names to their declarations (or first appearance of an identifier).
 	QHash<QString, QSharedPointer<ast::Node>> mIdentifierDeclarations;
 
@@ -167,6 +188,18 @@ private:
 	/// Table with information about relations of types.
 	QSharedPointer<GeneralizationsTableInterface> mGeneralizationsTable;
 
+	/// Simple types of a language with precomputed generalization relation.
+	QSharedPointer<const types::TypeLattice> mTypeLattice;
+
+	/// Declarations from mIdentifierDeclarations, for fast lookup.
+	QSet<QSharedPointer<ast::Node>> mDeclarations;
+
+	/// Incremented each time when types, declarations or analysis rules change.
+	int mRevision = 0;
+
+	/// Roots of trees which last analysis changed nothing, with the revision at that time.
+	QHash<QSharedPointer<ast::Node>, int> mStableTrees;
+
 	/// True when we need to traverse AST and check type constraints again.
 	bool mRecheckNeeded = true;
 };
@@ -0,0 +1,79 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QVector>
+#include <QtCore/QSharedPointer>
+
+#include "qrtext/core/types/typeExpression.h"
+#include "qrtext/core/semantics/generalizationsTableInterface.h"
+
+#include "qrtext/declSpec.h"
+
+namespace qrtext {
+namespace core {
+namespace types {
+
+/// Fixed numbered universe of simple types of a language, provided by GeneralizationsTableInterface::simpleTypes().
+/// Sets of simple types are represented as bit masks and generalization relation between them is precomputed as
+/// transitively closed matrix of masks, so type variables do not consult generalizations table for them. Complex
+/// types (like tables or functions) are not numbered and are still compared by generalizations table. Any is not
+/// a part of the universe, type variables treat it specially.
+class QRTEXT_EXPORT TypeLattice
+{
+public:
+	/// Set of simple types, bit i is set if a type with index i is in the set.
+	typedef quint32 Mask;
+
+	/// Maximal number of simple types in a language.
+	static const int maxTypes = 32;
+
+	/// Builds the lattice, calls generalizations table for each pair of simple types once.
+	explicit TypeLattice(const QSharedPointer<GeneralizationsTableInterface> &generalizationsTable);
+
+	/// Returns generalizations table this lattice was built from.
+	const GeneralizationsTableInterface &generalizationsTable() const;
+
+	/// Returns a number of simple types.
+	int count() const;
+
+	/// Returns index of a simple type of the same kind as \a type or -1 if \a type is not simple.
+	int index(const TypeExpression &type) const;
+
+	/// Returns prototype of a simple type with given index.
+	const QSharedPointer<TypeExpression> &type(int index) const;
+
+	/// Returns a set of types that are generalizations of a type with given index, including type itself.
+	Mask generalizations(int index) const;
+
+	/// Returns a set of types that are specializations of a type with given index, including type itself.
+	Mask specializations(int index) const;
+
+	/// Returns a set consisting of one type with given index.
+	static Mask mask(int index)
+	{
+		return Mask(1) << index;
+	}
+
+private:
+	QSharedPointer<GeneralizationsTableInterface> mGeneralizationsTable;
+	QList<QSharedPointer<TypeExpression>> mTypes;
+	QVector<Mask> mGeneralizations;
+	QVector<Mask> mSpecializations;
+};
+
+}
+}
+}
@@ -14,11 +14,11 @@
 
 #pragma once
 
-#include <QtCore/QSet>
+#include <QtCore/QList>
 #include <QtCore/QSharedPointer>
 
 #include "qrtext/core/types/typeExpression.h"
-#include "qrtext/core/semantics/generalizationsTableInterface.h"
+#include "qrtext/core/types/typeLattice.h"
 
 namespace qrtext {
 namespace core {
@@ -27,6 +27,8 @@ namespace types {
 /// A type that can be one of a set of types. Type variable can be constrained by a given set of types, reducing its
 /// possiblities. It can be constrained "too much", so there are no valid types for this variable, then it is called
 /// "empty". When variable can be of only one type, it is called "resolved".
+/// Simple types of a language are kept as a bit mask over the type lattice, so constraining variables of simple types
+/// takes constant time, complex types are kept as a list and compared by generalizations table.
 class QRTEXT_EXPORT TypeVariable : public TypeExpression
 {
 public:
@@ -36,6 +38,10 @@ public:
 	/// Creates already resolved variable that can contain only one type, but it can become empty later.
 	TypeVariable(const QSharedPointer<types::TypeExpression> &singleType);
 
+	/// Creates already resolved variable, simple type is stored as a position in a given type lattice.
+	TypeVariable(const QSharedPointer<types::TypeExpression> &singleType
+			, const QSharedPointer<const TypeLattice> &lattice);
+
 	/// Returns true if a variable can be of only one type (so its type is known).
 	bool isResolved() const;
 
@@ -45,26 +51,60 @@ public:
 	/// Returns a type of a resolved variable.
 	QSharedPointer<types::TypeExpression> finalType() const;
 
-	/// Constrains a variable with possible types of other variable, with respect of given generalizations table.
-	void constrain(const QSharedPointer<TypeVariable> &other
-			, const GeneralizationsTableInterface &generalizationsTable);
+	/// Constrains a variable with possible types of other variable, with respect of given type lattice.
+	/// Returns true if a set of possible types of this variable has changed.
+	bool constrain(const QSharedPointer<TypeVariable> &other, const QSharedPointer<const TypeLattice> &lattice);
 
-	/// Constrains a variable with a list of possible types, with respect of given generalizations table. Follows the
+	/// Constrains a variable with a list of possible types, with respect of given type lattice. Follows the
 	/// same rules as other overload of constrain().
-	void constrain(const QList<QSharedPointer<TypeExpression>> &types
-			, const GeneralizationsTableInterface &generalizationsTable);
+	bool constrain(const QList<QSharedPointer<TypeExpression>> &types
+			, const QSharedPointer<const TypeLattice> &lattice);
 
-	/// Constrains an assignment with respect of given generalizations table.
+	/// Constrains an assignment with respect of given type lattice.
 	/// If a variable can not contain any of other variable's types, then it will be generalized to closest more general
 	/// type that can. For example, in "a<int> = 0.5<float>;" identifier "a" will be generalized to type "float".
-	void constrainAssignment(const QSharedPointer<TypeVariable> &other
-			, const GeneralizationsTableInterface &generalizationsTable
+	/// Returns true if a set of possible types of this variable has changed.
+	bool constrainAssignment(const QSharedPointer<TypeVariable> &other
+			, const QSharedPointer<const TypeLattice> &lattice
 			, bool *wasCoercion);
 
 	QString toString() const override;
 
 private:
-	QSet<QSharedPointer<TypeExpression>> mAllowedTypes;
+	/// Set of types in the same form as in type variable.
+	struct TypeSet
+	{
+		/// Instance of Any type if it is in the set.
+		QSharedPointer<TypeExpression> any;
+		TypeLattice::Mask simpleTypes = 0;
+		QList<QSharedPointer<TypeExpression>> complexTypes;
+
+		bool operator==(const TypeSet &other) const;
+		void addComplex(const QSharedPointer<TypeExpression> &type);
+	};
+
+	/// Starts using given lattice, moving simple types that were stored without lattice to the bit mask.
+	void attach(const QSharedPointer<const TypeLattice> &lattice);
+
+	/// Splits given list of types into a set.
+	TypeSet split(const QList<QSharedPointer<TypeExpression>> &types) const;
+
+	/// Constrains this variable with a given set of types, returns true if something has changed.
+	bool constrain(const TypeSet &other);
+
+	/// Returns true if \a type is a specialization of some type from \a set other than Any. \a index is a position
+	/// of \a type in the lattice or -1 if it is complex.
+	bool hasGeneralizationIn(int index, const QSharedPointer<TypeExpression> &type, const TypeSet &set) const;
+
+	/// Returns true if \a type is a generalization of some type from \a set other than Any.
+	bool hasSpecializationIn(int index, const QSharedPointer<TypeExpression> &type, const TypeSet &set) const;
+
+	/// Adds to \a result all types from \a set other than Any that are generalizations of \a type.
+	void addGeneralizationsFrom(int index, const QSharedPointer<TypeExpression> &type, const TypeSet &set
+			, TypeSet &result) const;
+
+	QSharedPointer<const TypeLattice> mLattice;
+	TypeSet mAllowedTypes;
 };
 
 }
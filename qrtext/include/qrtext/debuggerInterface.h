@@ -30,6 +30,16 @@ public:
 	/// A list of identifiers currently known to interpreter.
 	virtual QStringList identifiers() const = 0;
 
+	/// A number that changes each time when the list of identifiers may have changed. Watchers can compare it with
+	/// previously seen one to avoid pulling identifiers again.
+	virtual quint64 identifiersRevision() const = 0;
+
+	/// A number that changes each time when a value of some identifier changes or identifier gets forgotten.
+	virtual quint64 valuesRevision() const = 0;
+
+	/// A list of identifiers whose values changed after given values revision (see valuesRevision()).
+	virtual QStringList changedIdentifiers(quint64 valuesRevision) const = 0;
+
 	/// A value of identifier with given name.
 	template<typename T>
 	T value(const QString &identifier) const
@@ -26,7 +26,7 @@ namespace lua {
 
 namespace details {
 class LuaLexer;
-class LuaParser;
+class LuaPrattParser;
 class LuaSemanticAnalyzer;
 class LuaInterpreter;
 }
@@ -92,6 +92,12 @@ public:
 
 	QStringList identifiers() const override;
 
+	quint64 identifiersRevision() const override;
+
+	quint64 valuesRevision() const override;
+
+	QStringList changedIdentifiers(quint64 valuesRevision) const override;
+
 	QMap<QString, QSharedPointer<core::types::TypeExpression>> variableTypes() const override;
 
 	const QStringList &specialIdentifiers() const override;
@@ -138,7 +144,7 @@ private:
 	QList<core::Error> mErrors;
 
 	QScopedPointer<details::LuaLexer> mLexer;
-	QScopedPointer<details::LuaParser> mParser;
+	QScopedPointer<details::LuaPrattParser> mParser;
 	QScopedPointer<details::LuaSemanticAnalyzer> mAnalyzer;
 	QScopedPointer<details::LuaInterpreter> mInterpreter;
 
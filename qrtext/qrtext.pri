@@ -54,6 +54,7 @@ HEADERS += \
 	$$PWD/include/qrtext/core/types/any.h \
 	$$PWD/include/qrtext/core/types/typeExpression.h \
 	$$PWD/include/qrtext/core/types/typeVariable.h \
+	$$PWD/include/qrtext/core/types/typeLattice.h \
 	$$PWD/include/qrtext/lua/luaAstVisitorInterface.h \
 	$$PWD/include/qrtext/lua/luaStringEscapeUtils.h \
 	$$PWD/include/qrtext/lua/luaToolbox.h \
@@ -113,6 +114,7 @@ HEADERS += \
 	$$PWD/src/lua/luaInterpreter.h \
 	$$PWD/src/lua/luaLexer.h \
 	$$PWD/src/lua/luaParser.h \
+	$$PWD/src/lua/luaPrattParser.h \
 	$$PWD/src/lua/luaPrecedenceTable.h \
 	$$PWD/src/lua/luaSemanticAnalyzer.h \
 	$$PWD/src/lua/luaTokenTypes.h \
@@ -124,10 +126,12 @@ SOURCES += \
 	$$PWD/src/core/ast/node.cpp \
 	$$PWD/src/core/semantics/semanticAnalyzer.cpp \
 	$$PWD/src/core/types/typeVariable.cpp \
+	$$PWD/src/core/types/typeLattice.cpp \
 	$$PWD/src/lua/luaGeneralizationsTable.cpp \
 	$$PWD/src/lua/luaInterpreter.cpp \
 	$$PWD/src/lua/luaLexer.cpp \
 	$$PWD/src/lua/luaParser.cpp \
+	$$PWD/src/lua/luaPrattParser.cpp \
 	$$PWD/src/lua/luaPrecedenceTable.cpp \
 	$$PWD/src/lua/luaSemanticAnalyzer.cpp \
 	$$PWD/src/lua/luaStringEscapeUtils.cpp \
@@ -21,6 +21,7 @@ using namespace qrtext::core;
 SemanticAnalyzer::SemanticAnalyzer(QSharedPointer<GeneralizationsTableInterface> const &generalizationsTable
 	, QList<Error> &errors)
 	: mAny(new types::Any()), mErrors(errors), mGeneralizationsTable(generalizationsTable)
+	, mTypeLattice(new types::TypeLattice(generalizationsTable))
 {
 }
 
@@ -34,6 +35,14 @@ QSharedPointer<ast::Node> SemanticAnalyzer::analyze(QSharedPointer<ast::Node> co
 		return root;
 	}
 
+	if (mStableTrees.value(root, -1) == mRevision) {
+		// Analysis would be repeated from the same state, so it would change nothing again.
+		return root;
+	}
+
+	const int revision = mRevision;
+	const int errorsCount = mErrors.size();
+
 	precheck(root);
 
 	mRecheckNeeded = true;
@@ -44,6 +53,13 @@ QSharedPointer<ast::Node> SemanticAnalyzer::analyze(QSharedPointer<ast::Node> co
 	}
 
 	finalizeResolve(root);
+
+	if (mRevision == revision && mErrors.size() == errorsCount) {
+		mStableTrees.insert(root, mRevision);
+	} else {
+		mStableTrees.remove(root);
+	}
+
 	return root;
 }
 
@@ -63,7 +79,7 @@ void SemanticAnalyzer::finalizeResolve(const QSharedPointer<ast::Node> &node)
 	if (node->is<ast::Expression>()) {
 		const auto expression = as<ast::Expression>(node);
 		if (mTypes.contains(expression)) {
-			const QSharedPointer<types::TypeVariable> &typeVariable = mTypes.value(expression);
+			const QSharedPointer<types::TypeVariable> typeVariable = representative(mTypes.value(expression));
 			if (typeVariable->isEmpty()) {
 				reportError(expression, QObject::tr("Type mismatch"));
 			} else if (!typeVariable->isResolved()) {
@@ -89,7 +105,7 @@ QSharedPointer<types::TypeExpression> SemanticAnalyzer::type(QSharedPointer<ast:
 {
 	auto castedExpression = as<ast::Expression>(expression);
 	if (mTypes.contains(castedExpression)) {
-		return mTypes.value(castedExpression)->finalType();
+		return representative(mTypes.value(castedExpression))->finalType();
 	} else {
 		return mAny;
 	}
@@ -100,6 +116,11 @@ QStringList SemanticAnalyzer::identifiers() const
 	return mIdentifierDeclarations.keys();
 }
 
+int SemanticAnalyzer::revision() const
+{
+	return mRevision;
+}
+
 QMap<QString, QSharedPointer<types::TypeExpression> > SemanticAnalyzer::variableTypes() const
 {
 	QMap<QString, QSharedPointer<qrtext::core::types::TypeExpression>> result;
@@ -114,6 +135,10 @@ void SemanticAnalyzer::clear()
 {
 	mTypes.clear();
 	mIdentifierDeclarations.clear();
+	mDeclarations.clear();
+	mStableTrees.clear();
+	mUnifiedVariables.clear();
+	invalidate();
 }
 
 void SemanticAnalyzer::forget(const QSharedPointer<ast::Node> &root)
@@ -122,7 +147,10 @@ void SemanticAnalyzer::forget(const QSharedPointer<ast::Node> &root)
 		return;
 	}
 
-	if (!mIdentifierDeclarations.values().contains(root)) {
+	mStableTrees.remove(root);
+	invalidate();
+
+	if (!mDeclarations.contains(root)) {
 		const auto expression = root.dynamicCast<ast::Expression>();
 		if (expression) {
 			mTypes.remove(expression);
@@ -147,31 +175,81 @@ void SemanticAnalyzer::assign(const QSharedPointer<ast::Node> &expression
 			// new variable. Else it doesn't play well with coercion --- variable gets created, then coerced,
 			// then program is rechecked to verify coercion results, new variable is created during recheck,
 			// gets coerced and so on, infinitely.
-			mTypes[castExpression]->constrain(QList<QSharedPointer<types::TypeExpression>>{type}
-					, *mGeneralizationsTable);
+			if (representative(mTypes[castExpression])->constrain(QList<QSharedPointer<types::TypeExpression>>{type}
+					, mTypeLattice))
+			{
+				invalidate();
+			}
 		} else {
-			mTypes.insert(castExpression, QSharedPointer<types::TypeVariable>(new types::TypeVariable(type)));
+			mTypes.insert(castExpression
+					, QSharedPointer<types::TypeVariable>(new types::TypeVariable(type, mTypeLattice)));
+			invalidate();
 		}
 	} else {
-		mTypes.insert(castExpression, type.dynamicCast<types::TypeVariable>());
+		const auto typeVariable = representative(type.dynamicCast<types::TypeVariable>());
+		if (representative(mTypes.value(castExpression)) != typeVariable) {
+			mTypes.insert(castExpression, typeVariable);
+			invalidate();
+		}
 	}
 }
 
 void SemanticAnalyzer::unify(QSharedPointer<ast::Node> const &lhs, QSharedPointer<ast::Node> const &rhs)
 {
-	mTypes.insert(as<ast::Expression>(lhs), mTypes.value(as<ast::Expression>(rhs)));
+	const auto lhsExpression = as<ast::Expression>(lhs);
+	const auto lhsVariable = representative(mTypes.value(lhsExpression));
+	const auto rhsVariable = representative(mTypes.value(as<ast::Expression>(rhs)));
+	if (lhsVariable == rhsVariable) {
+		return;
+	}
+
+	if (lhsVariable && rhsVariable) {
+		// Every expression that shared a type with lhs shall share the type of rhs now, including expressions
+		// of trees that are not being analyzed, so the whole class of lhs is merged into the class of rhs.
+		mUnifiedVariables.insert(lhsVariable, rhsVariable);
+	}
+
+	mTypes.insert(lhsExpression, rhsVariable);
+	invalidate();
+}
+
+QSharedPointer<types::TypeVariable> SemanticAnalyzer::representative(
+		const QSharedPointer<types::TypeVariable> &typeVariable) const
+{
+	if (!typeVariable) {
+		return typeVariable;
+	}
+
+	QSharedPointer<types::TypeVariable> result = typeVariable;
+	for (auto next = mUnifiedVariables.constFind(result); next != mUnifiedVariables.constEnd()
+			; next = mUnifiedVariables.constFind(result))
+	{
+		result = next.value();
+	}
+
+	// Path compression, so long chains of unifications are walked only once.
+	for (auto current = typeVariable; current != result; ) {
+		auto &next = mUnifiedVariables[current];
+		current = next;
+		next = result;
+	}
+
+	return result;
 }
 
 void SemanticAnalyzer::constrain(QSharedPointer<ast::Node> const &operation
 		, QSharedPointer<ast::Node> const &node, QList<QSharedPointer<types::TypeExpression>> const &types)
 {
-	auto nodeType = mTypes.value(as<ast::Expression>(node));
+	auto nodeType = representative(mTypes.value(as<ast::Expression>(node)));
 	if (!nodeType) {
 		reportError(node, QObject::tr("This construction is not supported by semantic analysis"));
 		return;
 	}
 
-	nodeType->constrain(types, generalizationsTable());
+	if (nodeType->constrain(types, mTypeLattice)) {
+		invalidate();
+	}
+
 	if (nodeType->isEmpty()) {
 		reportError(operation, QObject::tr("Type mismatch."));
 	}
@@ -194,7 +272,13 @@ QSharedPointer<ast::Node> SemanticAnalyzer::declaration(const QString &identifie
 
 void SemanticAnalyzer::addDeclaration(const QString &identifierName, QSharedPointer<ast::Node> const &declaration)
 {
-	mIdentifierDeclarations.insert(identifierName, declaration);
+	const auto previous = mIdentifierDeclarations.value(identifierName);
+	if (previous != declaration) {
+		mDeclarations.remove(previous);
+		mDeclarations.insert(declaration);
+		mIdentifierDeclarations.insert(identifierName, declaration);
+		invalidate();
+	}
 }
 
 const QSharedPointer<types::TypeExpression> &SemanticAnalyzer::any()
@@ -207,14 +291,25 @@ const GeneralizationsTableInterface &SemanticAnalyzer::generalizationsTable() co
 	return *mGeneralizationsTable;
 }
 
+const QSharedPointer<const types::TypeLattice> &SemanticAnalyzer::typeLattice() const
+{
+	return mTypeLattice;
+}
+
 QSharedPointer<types::TypeVariable> SemanticAnalyzer::typeVariable(QSharedPointer<ast::Node> const &expression) const
 {
-	return mTypes.value(as<ast::Expression>(expression));
+	return representative(mTypes.value(as<ast::Expression>(expression)));
 }
 
 void SemanticAnalyzer::requestRecheck()
 {
 	mRecheckNeeded = true;
+	invalidate();
+}
+
+void SemanticAnalyzer::invalidate()
+{
+	++mRevision;
 }
 
 bool SemanticAnalyzer::isGeneralization(const QSharedPointer<types::TypeExpression> &specific
@@ -0,0 +1,89 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "qrtext/core/types/typeLattice.h"
+
+#include <typeinfo>
+
+using namespace qrtext::core;
+using namespace qrtext::core::types;
+
+TypeLattice::TypeLattice(const QSharedPointer<GeneralizationsTableInterface> &generalizationsTable)
+	: mGeneralizationsTable(generalizationsTable)
+	, mTypes(generalizationsTable->simpleTypes().mid(0, maxTypes))
+{
+	const int typesCount = mTypes.size();
+	mGeneralizations.fill(0, typesCount);
+	for (int specific = 0; specific < typesCount; ++specific) {
+		for (int general = 0; general < typesCount; ++general) {
+			if (specific == general || generalizationsTable->isGeneralization(mTypes[specific], mTypes[general])) {
+				mGeneralizations[specific] |= mask(general);
+			}
+		}
+	}
+
+	// Transitive closure, everything reachable through an intermediate type is a generalization too.
+	for (int intermediate = 0; intermediate < typesCount; ++intermediate) {
+		for (int specific = 0; specific < typesCount; ++specific) {
+			if (mGeneralizations[specific] & mask(intermediate)) {
+				mGeneralizations[specific] |= mGeneralizations[intermediate];
+			}
+		}
+	}
+
+	mSpecializations.fill(0, typesCount);
+	for (int specific = 0; specific < typesCount; ++specific) {
+		for (int general = 0; general < typesCount; ++general) {
+			if (mGeneralizations[specific] & mask(general)) {
+				mSpecializations[general] |= mask(specific);
+			}
+		}
+	}
+}
+
+const GeneralizationsTableInterface &TypeLattice::generalizationsTable() const
+{
+	return *mGeneralizationsTable;
+}
+
+int TypeLattice::count() const
+{
+	return mTypes.size();
+}
+
+int TypeLattice::index(const TypeExpression &type) const
+{
+	for (int i = 0; i < mTypes.size(); ++i) {
+		if (typeid(type) == typeid(*mTypes[i])) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+const QSharedPointer<TypeExpression> &TypeLattice::type(int index) const
+{
+	return mTypes[index];
+}
+
+TypeLattice::Mask TypeLattice::generalizations(int index) const
+{
+	return mGeneralizations[index];
+}
+
+TypeLattice::Mask TypeLattice::specializations(int index) const
+{
+	return mSpecializations[index];
+}
@@ -1,4 +1,4 @@
-/* Copyright 2007-2015 QReal Research Group
+/* Copyright 2026 CyberTech Labs Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,111 +15,306 @@
 #include "qrtext/core/types/typeVariable.h"
 
 #include <QtCore/QStringList>
+#include <QtCore/QtAlgorithms>
 
 #include "qrtext/core/types/any.h"
 
 using namespace qrtext::core::types;
 
+bool TypeVariable::TypeSet::operator==(const TypeSet &other) const
+{
+	if (any != other.any || simpleTypes != other.simpleTypes || complexTypes.size() != other.complexTypes.size()) {
+		return false;
+	}
+
+	for (const QSharedPointer<TypeExpression> &type : complexTypes) {
+		if (!other.complexTypes.contains(type)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void TypeVariable::TypeSet::addComplex(const QSharedPointer<TypeExpression> &type)
+{
+	if (!complexTypes.contains(type)) {
+		complexTypes << type;
+	}
+}
+
 TypeVariable::TypeVariable()
 {
-	mAllowedTypes << QSharedPointer<TypeExpression>(new Any());
+	mAllowedTypes.any = QSharedPointer<TypeExpression>(new Any());
 }
 
 TypeVariable::TypeVariable(const QSharedPointer<TypeExpression> &singleType)
 {
-	mAllowedTypes << singleType;
+	mAllowedTypes = split({singleType});
+}
+
+TypeVariable::TypeVariable(const QSharedPointer<TypeExpression> &singleType
+		, const QSharedPointer<const TypeLattice> &lattice)
+	: mLattice(lattice)
+{
+	mAllowedTypes = split({singleType});
 }
 
 bool TypeVariable::isResolved() const
 {
-	return mAllowedTypes.size() == 1 && !mAllowedTypes.values().first()->is<Any>();
+	return !mAllowedTypes.any
+			&& qPopulationCount(mAllowedTypes.simpleTypes) + mAllowedTypes.complexTypes.size() == 1;
 }
 
 bool TypeVariable::isEmpty() const
 {
-	return mAllowedTypes.isEmpty();
+	return !mAllowedTypes.any && !mAllowedTypes.simpleTypes && mAllowedTypes.complexTypes.isEmpty();
 }
 
 QSharedPointer<TypeExpression> TypeVariable::finalType() const
 {
-	if (mAllowedTypes.empty()) {
-		return QSharedPointer<TypeExpression>(new Any());
+	if (mAllowedTypes.simpleTypes) {
+		return mLattice->type(qCountTrailingZeroBits(mAllowedTypes.simpleTypes));
+	} else if (!mAllowedTypes.complexTypes.isEmpty()) {
+		return mAllowedTypes.complexTypes.first();
+	} else if (mAllowedTypes.any) {
+		return mAllowedTypes.any;
 	} else {
-		return mAllowedTypes.begin()->dynamicCast<TypeExpression>();
+		return QSharedPointer<TypeExpression>(new Any());
 	}
 }
 
-void TypeVariable::constrain(const QSharedPointer<TypeVariable> &other
-		, const GeneralizationsTableInterface &generalizationsTable)
+bool TypeVariable::constrain(const QSharedPointer<TypeVariable> &other, const QSharedPointer<const TypeLattice> &lattice)
 {
-	constrain(other->mAllowedTypes.values(), generalizationsTable);
+	attach(lattice);
+	other->attach(lattice);
+	return constrain(other->mAllowedTypes);
 }
 
-void TypeVariable::constrain(const QList<QSharedPointer<TypeExpression>> &types
-		, const GeneralizationsTableInterface &generalizationsTable)
+bool TypeVariable::constrain(const QList<QSharedPointer<TypeExpression>> &types
+		, const QSharedPointer<const TypeLattice> &lattice)
 {
-	QSet<QSharedPointer<TypeExpression>> result;
+	attach(lattice);
+	return constrain(split(types));
+}
 
-	for (auto &&type : mAllowedTypes) {
-		for (auto &&otherType : types) {
-			if (type->is<Any>()) {
-				result << otherType;
-			} else if (otherType->is<Any>()) {
-				result << type;
-			} else if (generalizationsTable.isGeneralization(type, otherType)) {
-				result << type;
-			}
+bool TypeVariable::constrain(const TypeSet &other)
+{
+	TypeSet result;
+
+	if (mAllowedTypes.any) {
+		// Any can be specialized to every type from the other set.
+		result = other;
+	}
+
+	if (other.any) {
+		result.simpleTypes |= mAllowedTypes.simpleTypes;
+		for (const QSharedPointer<TypeExpression> &type : mAllowedTypes.complexTypes) {
+			result.addComplex(type);
 		}
 	}
 
+	for (TypeLattice::Mask rest = mAllowedTypes.simpleTypes; rest; rest &= rest - 1) {
+		const int index = qCountTrailingZeroBits(rest);
+		if (hasGeneralizationIn(index, mLattice->type(index), other)) {
+			result.simpleTypes |= TypeLattice::mask(index);
+		}
+	}
+
+	for (const QSharedPointer<TypeExpression> &type : mAllowedTypes.complexTypes) {
+		if (hasGeneralizationIn(-1, type, other)) {
+			result.addComplex(type);
+		}
+	}
+
+	const bool changed = !(result == mAllowedTypes);
 	mAllowedTypes = result;
+	return changed;
 }
 
-void TypeVariable::constrainAssignment(const QSharedPointer<TypeVariable> &other
-		, const GeneralizationsTableInterface &generalizationsTable
+bool TypeVariable::constrainAssignment(const QSharedPointer<TypeVariable> &other
+		, const QSharedPointer<const TypeLattice> &lattice
 		, bool *wasCoercion)
 {
 	*wasCoercion = false;
-	QSet<QSharedPointer<TypeExpression>> result;
-
-	for (auto &&type : mAllowedTypes) {
-		QSet<QSharedPointer<TypeExpression>> allowedForType;
-
-		for (auto &&otherType : other->mAllowedTypes) {
-			if (type->is<Any>()) {
-				allowedForType << otherType;
-			} else if (otherType->is<Any>()) {
-				result << type;
-			} else if (generalizationsTable.isGeneralization(otherType, type)) {
-				allowedForType << type;
-			}
+	attach(lattice);
+	other->attach(lattice);
+
+	const TypeSet &values = other->mAllowedTypes;
+	TypeSet result;
+
+	if (mAllowedTypes.any) {
+		result = values;
+	}
+
+	if (values.any) {
+		result.simpleTypes |= mAllowedTypes.simpleTypes;
+		for (const QSharedPointer<TypeExpression> &type : mAllowedTypes.complexTypes) {
+			result.addComplex(type);
 		}
+	}
 
-		// If there is no valid subtype for our type between types, maybe it is possible
-		// to promote our type using language coercion rules.
-		// For example, if we assign float value to integer variable and a language
-		// allows implicit casts from integer to float, we'll make our variable float.
-		if (allowedForType.isEmpty()) {
-			for (auto const &otherType : other->mAllowedTypes) {
-				if (generalizationsTable.isGeneralization(type, otherType)) {
-					result << otherType;
-					*wasCoercion = true;
+	// Our type remains if some value type is its subtype. If there is no such type, maybe it is possible to promote
+	// our type using language coercion rules. For example, if we assign float value to integer variable and
+	// a language allows implicit casts from integer to float, we'll make our variable float.
+	const auto keepOrCoerce = [&](int index, const QSharedPointer<TypeExpression> &type) {
+		if (hasSpecializationIn(index, type, values)) {
+			if (index >= 0) {
+				result.simpleTypes |= TypeLattice::mask(index);
+			} else {
+				result.addComplex(type);
+			}
+		} else {
+			TypeSet coerced;
+			addGeneralizationsFrom(index, type, values, coerced);
+			if (coerced.simpleTypes || !coerced.complexTypes.isEmpty()) {
+				*wasCoercion = true;
+				result.simpleTypes |= coerced.simpleTypes;
+				for (const QSharedPointer<TypeExpression> &coercedType : coerced.complexTypes) {
+					result.addComplex(coercedType);
 				}
 			}
 		}
+	};
+
+	for (TypeLattice::Mask rest = mAllowedTypes.simpleTypes; rest; rest &= rest - 1) {
+		const int index = qCountTrailingZeroBits(rest);
+		keepOrCoerce(index, mLattice->type(index));
+	}
 
-		result.unite(allowedForType);
+	for (const QSharedPointer<TypeExpression> &type : mAllowedTypes.complexTypes) {
+		keepOrCoerce(-1, type);
 	}
 
+	const bool changed = !(result == mAllowedTypes);
 	mAllowedTypes = result;
+	return changed;
 }
 
 QString TypeVariable::toString() const
 {
 	QStringList result;
-	for (const QSharedPointer<types::TypeExpression> &type : mAllowedTypes) {
+	for (TypeLattice::Mask rest = mAllowedTypes.simpleTypes; rest; rest &= rest - 1) {
+		result.append(mLattice->type(qCountTrailingZeroBits(rest))->toString());
+	}
+
+	for (const QSharedPointer<types::TypeExpression> &type : mAllowedTypes.complexTypes) {
 		result.append(type->toString());
 	}
 
+	if (mAllowedTypes.any) {
+		result.append(mAllowedTypes.any->toString());
+	}
+
 	return result.join(", ");
 }
+
+void TypeVariable::attach(const QSharedPointer<const TypeLattice> &lattice)
+{
+	if (mLattice) {
+		return;
+	}
+
+	mLattice = lattice;
+	const QList<QSharedPointer<TypeExpression>> complexTypes = mAllowedTypes.complexTypes;
+	mAllowedTypes.complexTypes.clear();
+	for (const QSharedPointer<TypeExpression> &type : complexTypes) {
+		const int index = mLattice->index(*type);
+		if (index >= 0) {
+			mAllowedTypes.simpleTypes |= TypeLattice::mask(index);
+		} else {
+			mAllowedTypes.addComplex(type);
+		}
+	}
+}
+
+TypeVariable::TypeSet TypeVariable::split(const QList<QSharedPointer<TypeExpression>> &types) const
+{
+	TypeSet result;
+	for (const QSharedPointer<TypeExpression> &type : types) {
+		const int index = mLattice ? mLattice->index(*type) : -1;
+		if (type->is<Any>()) {
+			if (!result.any) {
+				result.any = type;
+			}
+		} else if (index >= 0) {
+			result.simpleTypes |= TypeLattice::mask(index);
+		} else {
+			result.addComplex(type);
+		}
+	}
+
+	return result;
+}
+
+bool TypeVariable::hasGeneralizationIn(int index, const QSharedPointer<TypeExpression> &type
+		, const TypeSet &set) const
+{
+	const GeneralizationsTableInterface &table = mLattice->generalizationsTable();
+	if (index >= 0) {
+		if (mLattice->generalizations(index) & set.simpleTypes) {
+			return true;
+		}
+	} else {
+		for (TypeLattice::Mask rest = set.simpleTypes; rest; rest &= rest - 1) {
+			if (table.isGeneralization(type, mLattice->type(qCountTrailingZeroBits(rest)))) {
+				return true;
+			}
+		}
+	}
+
+	for (const QSharedPointer<TypeExpression> &general : set.complexTypes) {
+		if (table.isGeneralization(type, general)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool TypeVariable::hasSpecializationIn(int index, const QSharedPointer<TypeExpression> &type
+		, const TypeSet &set) const
+{
+	const GeneralizationsTableInterface &table = mLattice->generalizationsTable();
+	if (index >= 0) {
+		if (mLattice->specializations(index) & set.simpleTypes) {
+			return true;
+		}
+	} else {
+		for (TypeLattice::Mask rest = set.simpleTypes; rest; rest &= rest - 1) {
+			if (table.isGeneralization(mLattice->type(qCountTrailingZeroBits(rest)), type)) {
+				return true;
+			}
+		}
+	}
+
+	for (const QSharedPointer<TypeExpression> &specific : set.complexTypes) {
+		if (table.isGeneralization(specific, type)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void TypeVariable::addGeneralizationsFrom(int index, const QSharedPointer<TypeExpression> &type
+		, const TypeSet &set, TypeSet &result) const
+{
+	const GeneralizationsTableInterface &table = mLattice->generalizationsTable();
+	if (index >= 0) {
+		result.simpleTypes |= mLattice->generalizations(index) & set.simpleTypes;
+	} else {
+		for (TypeLattice::Mask rest = set.simpleTypes; rest; rest &= rest - 1) {
+			const int general = qCountTrailingZeroBits(rest);
+			if (table.isGeneralization(type, mLattice->type(general))) {
+				result.simpleTypes |= TypeLattice::mask(general);
+			}
+		}
+	}
+
+	for (const QSharedPointer<TypeExpression> &general : set.complexTypes) {
+		if (table.isGeneralization(type, general)) {
+			result.addComplex(general);
+		}
+	}
+}
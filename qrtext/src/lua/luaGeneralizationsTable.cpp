@@ -34,6 +34,17 @@ bool LuaGeneralizationsTable::isGeneralization(const QSharedPointer<TypeExpressi
 	return (specific->is<Integer>() && general->is<Float>()) || isStructurallyEquivalent(specific, general);
 }
 
+QList<QSharedPointer<TypeExpression>> LuaGeneralizationsTable::simpleTypes() const
+{
+	return {
+		qrtext::core::wrap(new Boolean())
+		, qrtext::core::wrap(new Float())
+		, qrtext::core::wrap(new Integer())
+		, qrtext::core::wrap(new Nil())
+		, qrtext::core::wrap(new String())
+	};
+}
+
 bool LuaGeneralizationsTable::isStructurallyEquivalent(const QSharedPointer<TypeExpression> &type1
 		, const QSharedPointer<TypeExpression> &type2) const
 {
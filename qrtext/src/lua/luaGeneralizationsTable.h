@@ -29,6 +29,8 @@ public:
 	bool isGeneralization(QSharedPointer<core::types::TypeExpression> const &specific
 			, QSharedPointer<core::types::TypeExpression> const &general) const override;
 
+	QList<QSharedPointer<core::types::TypeExpression>> simpleTypes() const override;
+
 private:
 	bool isStructurallyEquivalent(QSharedPointer<core::types::TypeExpression> const &type1
 			, QSharedPointer<core::types::TypeExpression> const &type2) const;
@@ -110,7 +110,7 @@ QVariant LuaInterpreter::interpret(const QSharedPointer<core::ast::Node> &root
 				return QVariant();
 			}
 
-			mIdentifierValues.insert(name, interpretedValue);
+			storeValue(name, interpretedValue);
 			return QVariant();
 		} else if (variable->is<ast::IndexingExpression>()) {
 			assignToTableElement(variable, interpretedValue, semanticAnalyzer);
@@ -168,7 +168,9 @@ bool LuaInterpreter::hasIdentifier(const QString &name) const
 
 void LuaInterpreter::forgetIdentifier(const QString &identifier)
 {
-	mIdentifierValues.remove(identifier);
+	if (mIdentifierValues.remove(identifier)) {
+		logChange(identifier);
+	}
 }
 
 QVariant LuaInterpreter::value(const QString &identifier) const
@@ -187,9 +189,9 @@ void LuaInterpreter::setVariableValue(const QString &name, const QVariant &value
 		// It is a string variable, chop off quotes.
 		valueString.remove(0, 1);
 		valueString.chop(1);
-		mIdentifierValues.insert(name, valueString);
+		storeValue(name, valueString);
 	} else {
-		mIdentifierValues.insert(name, value);
+		storeValue(name, value);
 	}
 }
 
@@ -200,10 +202,53 @@ void LuaInterpreter::addReadOnlyVariable(const QString &name)
 
 void LuaInterpreter::clear()
 {
+	for (const QString &identifier : mIdentifierValues.keys()) {
+		logChange(identifier);
+	}
+
 	mIdentifierValues.clear();
 	mReadOnlyVariables.clear();
 }
 
+quint64 LuaInterpreter::revision() const
+{
+	return mRevision;
+}
+
+QStringList LuaInterpreter::changedIdentifiers(quint64 revision) const
+{
+	QStringList result;
+	for (auto change = mChanges.upperBound(revision); change != mChanges.constEnd(); ++change) {
+		result << change.value();
+	}
+
+	return result;
+}
+
+void LuaInterpreter::storeValue(const QString &name, const QVariant &value)
+{
+	const auto current = mIdentifierValues.find(name);
+	if (current == mIdentifierValues.end()) {
+		mIdentifierValues.insert(name, value);
+	} else if (current.value().userType() != value.userType() || current.value() != value) {
+		// QVariant comparison converts between types, so 1, 1.0 and "1" would be equal without the type check.
+		current.value() = value;
+	} else {
+		return;
+	}
+
+	logChange(name);
+}
+
+void LuaInterpreter::logChange(const QString &name)
+{
+	// Only the latest change of each identifier is kept, so the journal does not grow with the number of steps.
+	mChanges.remove(mIdentifierRevisions.value(name));
+	++mRevision;
+	mIdentifierRevisions.insert(name, mRevision);
+	mChanges.insert(mRevision, name);
+}
+
 QVariant LuaInterpreter::interpretUnaryOperator(const QSharedPointer<core::ast::Node> &root
 		, const core::SemanticAnalyzer &semanticAnalyzer)
 {
@@ -425,7 +470,7 @@ void LuaInterpreter::assignToTableElement(const QSharedPointer<core::ast::Node>
 			, const QVector<int> &index
 			, const core::Connection &connection)
 	{
-		mIdentifierValues.insert(name, doAssignToTableElement(table, interpretedValue, index, connection));
+		storeValue(name, doAssignToTableElement(table, interpretedValue, index, connection));
 		return QVariant();
 	};
 
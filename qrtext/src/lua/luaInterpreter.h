@@ -16,6 +16,7 @@
 
 #include <functional>
 #include <QtCore/QHash>
+#include <QtCore/QMap>
 #include <QtCore/QVariantList>
 
 #include "qrtext/core/error.h"
@@ -67,7 +68,19 @@ public:
 	/// Clear all execution state, except added intrinsic functions.
 	void clear();
 
+	/// Returns a number that is increased each time when some identifier gets new value or is removed.
+	quint64 revision() const;
+
+	/// Returns identifiers that got new values or were removed after given revision, in order of changes.
+	QStringList changedIdentifiers(quint64 revision) const;
+
 private:
+	/// Sets a value of identifier and records the change in the journal if the value is actually different.
+	void storeValue(const QString &name, const QVariant &value);
+
+	/// Records that identifier with given name was changed.
+	void logChange(const QString &name);
+
 	QVariant interpretUnaryOperator(const QSharedPointer<core::ast::Node> &root
 			, const core::SemanticAnalyzer &semanticAnalyzer);
 
@@ -103,6 +116,14 @@ private:
 					, const core::Connection &)> &action);
 
 	QHash<QString, QVariant> mIdentifierValues;
+
+	/// Journal of changes of identifier values, maps revision of the last change of an identifier to its name.
+	QMap<quint64, QString> mChanges;
+
+	/// Revision of the last change of each identifier, used to keep one entry per identifier in mChanges.
+	QHash<QString, quint64> mIdentifierRevisions;
+
+	quint64 mRevision = 0;
 	QHash<QString, std::function<QVariant(const QList<QVariant> &)>> mIntrinsicFunctions;
 
 	/// A set of variables which can be modified only by setVariableValue() call (used to support sensor variables and
@@ -0,0 +1,669 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "qrtext/src/lua/luaPrattParser.h"
+
+#include <QtCore/QObject>
+
+#include "qrtext/lua/luaStringEscapeUtils.h"
+
+#include "qrtext/lua/ast/addition.h"
+#include "qrtext/lua/ast/assignment.h"
+#include "qrtext/lua/ast/bitwiseAnd.h"
+#include "qrtext/lua/ast/bitwiseLeftShift.h"
+#include "qrtext/lua/ast/bitwiseNegation.h"
+#include "qrtext/lua/ast/bitwiseOr.h"
+#include "qrtext/lua/ast/bitwiseRightShift.h"
+#include "qrtext/lua/ast/bitwiseXor.h"
+#include "qrtext/lua/ast/block.h"
+#include "qrtext/lua/ast/concatenation.h"
+#include "qrtext/lua/ast/division.h"
+#include "qrtext/lua/ast/equality.h"
+#include "qrtext/lua/ast/exponentiation.h"
+#include "qrtext/lua/ast/false.h"
+#include "qrtext/lua/ast/floatNumber.h"
+#include "qrtext/lua/ast/functionCall.h"
+#include "qrtext/lua/ast/greaterOrEqual.h"
+#include "qrtext/lua/ast/greaterThan.h"
+#include "qrtext/lua/ast/identifier.h"
+#include "qrtext/lua/ast/indexingExpression.h"
+#include "qrtext/lua/ast/inequality.h"
+#include "qrtext/lua/ast/integerDivision.h"
+#include "qrtext/lua/ast/integerNumber.h"
+#include "qrtext/lua/ast/length.h"
+#include "qrtext/lua/ast/lessOrEqual.h"
+#include "qrtext/lua/ast/lessThan.h"
+#include "qrtext/lua/ast/logicalAnd.h"
+#include "qrtext/lua/ast/logicalOr.h"
+#include "qrtext/lua/ast/methodCall.h"
+#include "qrtext/lua/ast/modulo.h"
+#include "qrtext/lua/ast/multiplication.h"
+#include "qrtext/lua/ast/nil.h"
+#include "qrtext/lua/ast/not.h"
+#include "qrtext/lua/ast/string.h"
+#include "qrtext/lua/ast/subtraction.h"
+#include "qrtext/lua/ast/tableConstructor.h"
+#include "qrtext/lua/ast/true.h"
+#include "qrtext/lua/ast/unaryMinus.h"
+
+using namespace qrtext::lua;
+using namespace qrtext::lua::details;
+using namespace qrtext::core;
+
+LuaPrattParser::LuaPrattParser(QList<Error> &errors)
+	: mErrors(errors)
+{
+}
+
+QSharedPointer<qrtext::core::ast::Node> LuaPrattParser::parse(const QList<Token> &tokens
+		, const QHash<LuaTokenTypes, QString> &tokenUserFriendlyNames)
+{
+	mTokens = &tokens;
+	mTokenUserFriendlyNames = &tokenUserFriendlyNames;
+	mPosition = 0;
+
+	const auto result = parseBlock();
+	if (result && !isEnd()) {
+		reportError(next().range().start(), QObject::tr("Unexpected token"));
+	}
+
+	mTokens = nullptr;
+	mTokenUserFriendlyNames = nullptr;
+	return result;
+}
+
+QSharedPointer<qrtext::core::ast::Node> LuaPrattParser::parseBlock()
+{
+	QList<QSharedPointer<ast::Node>> statements;
+	QList<const Token *> semicolons;
+	while (!isEnd() && (check(LuaTokenTypes::semicolon) || isExpressionStart(next().token()))) {
+		if (check(LuaTokenTypes::semicolon)) {
+			semicolons << &next();
+			++mPosition;
+		} else if (!parseStatement(statements)) {
+			return QSharedPointer<ast::Node>();
+		}
+	}
+
+	// Block node is not created for simple expression, but its connection still covers all statement separators.
+	QSharedPointer<ast::Node> result;
+	if (statements.size() == 1) {
+		result = statements.first();
+	} else {
+		result = QSharedPointer<ast::Block>::create(statements);
+		for (const auto &statement : statements) {
+			result->connect(statement);
+		}
+	}
+
+	for (const Token * const semicolon : semicolons) {
+		result->connect(*semicolon);
+	}
+
+	return result;
+}
+
+bool LuaPrattParser::parseStatement(QList<QSharedPointer<ast::Node>> &statements)
+{
+	QList<QSharedPointer<ast::Expression>> variables;
+	if (!parseExpressionList(variables)) {
+		return false;
+	}
+
+	if (!check(LuaTokenTypes::equals)) {
+		if (variables.size() == 1) {
+			statements << variables.first();
+		} else {
+			// It is a list of expressions which we translate as table constructor, to support convenient
+			// lists syntax, for example, for lists of ports in robots.
+			QList<QSharedPointer<ast::FieldInitialization>> fields;
+			for (const auto &expression : variables) {
+				fields << QSharedPointer<ast::FieldInitialization>::create(expression);
+			}
+
+			const auto table = QSharedPointer<ast::TableConstructor>::create(fields);
+			for (const auto &expression : variables) {
+				table->connect(expression);
+			}
+
+			statements << table;
+		}
+
+		return true;
+	}
+
+	++mPosition;
+
+	QList<QSharedPointer<ast::Expression>> values;
+	if (!parseExpressionList(values)) {
+		return false;
+	}
+
+	if (variables.size() != values.size()) {
+		reportError(variables.first()->start(), QObject::tr(
+				"Number of variables in assignment shall be equal to the number of assigned values"));
+		return false;
+	}
+
+	for (int i = 0; i < variables.size(); ++i) {
+		if (variables[i]->is<ast::FunctionCall>()) {
+			reportError(variables.first()->start(), QObject::tr("Assignment to function call is impossible"));
+			continue;
+		}
+
+		statements << QSharedPointer<ast::Assignment>::create(variables[i], values[i]);
+	}
+
+	return true;
+}
+
+bool LuaPrattParser::parseExpressionList(QList<QSharedPointer<ast::Expression>> &expressions)
+{
+	while (true) {
+		const auto expression = parseExpression(0);
+		if (!expression) {
+			return false;
+		}
+
+		expressions << expression;
+		if (!check(LuaTokenTypes::comma)) {
+			return true;
+		}
+
+		++mPosition;
+	}
+}
+
+QSharedPointer<qrtext::lua::ast::Expression> LuaPrattParser::parseExpression(int precedence)
+{
+	QSharedPointer<ast::Expression> result = parsePrimary();
+	if (!result) {
+		return result;
+	}
+
+	while (!isEnd() && mPrecedenceTable.isBinaryOperator(next().token())
+			&& mPrecedenceTable.precedence(next().token(), Arity::binary) >= precedence)
+	{
+		const Token &token = next();
+		const int operatorPrecedence = mPrecedenceTable.precedence(token.token(), Arity::binary);
+		const int rightPrecedence = mPrecedenceTable.associativity(token.token()) == Associativity::left
+				? operatorPrecedence + 1
+				: operatorPrecedence;
+
+		const auto operation = binaryOperator(token.token());
+		if (!operation) {
+			mErrors << Error(token.range().start(), QObject::tr("Binary operator in expression is of the wrong type")
+					, ErrorType::syntaxError, Severity::internalError);
+			return QSharedPointer<ast::Expression>();
+		}
+
+		operation->connect(token);
+		++mPosition;
+
+		const int errorsCount = mErrors.size();
+		const auto rightOperand = parseExpression(rightPrecedence);
+		if (!rightOperand) {
+			if (mErrors.size() == errorsCount) {
+				reportError(next().range().start(), QObject::tr("Right operand required"));
+			}
+
+			return rightOperand;
+		}
+
+		operation->setLeftOperand(result);
+		operation->setRightOperand(rightOperand);
+		result = operation;
+	}
+
+	return result;
+}
+
+QSharedPointer<qrtext::lua::ast::Expression> LuaPrattParser::parsePrimary()
+{
+	if (isEnd()) {
+		reportUnexpected();
+		return QSharedPointer<ast::Expression>();
+	}
+
+	const Token &token = next();
+	QSharedPointer<ast::Expression> result;
+	switch (token.token()) {
+	case LuaTokenTypes::nilKeyword:
+		result = QSharedPointer<ast::Nil>::create();
+		break;
+	case LuaTokenTypes::falseKeyword:
+		result = QSharedPointer<ast::False>::create();
+		break;
+	case LuaTokenTypes::trueKeyword:
+		result = QSharedPointer<ast::True>::create();
+		break;
+	case LuaTokenTypes::integerLiteral:
+		result = QSharedPointer<ast::IntegerNumber>::create(token.lexeme());
+		break;
+	case LuaTokenTypes::floatLiteral:
+		result = QSharedPointer<ast::FloatNumber>::create(token.lexeme());
+		break;
+	case LuaTokenTypes::string:
+		// Cut off quotes and replace escape characters.
+		result = QSharedPointer<ast::String>::create(
+				LuaStringEscapeUtils::unescape(token.lexeme().mid(1, token.lexeme().length() - 2)));
+		break;
+	case LuaTokenTypes::tripleDot:
+		reportError(token.range().start(), QObject::tr("This construction is not supported yet"));
+		return result;
+	case LuaTokenTypes::identifier:
+	case LuaTokenTypes::openingBracket:
+		return parsePrefixExpression();
+	case LuaTokenTypes::openingCurlyBracket:
+		return parseTableConstructor();
+	case LuaTokenTypes::minus:
+	case LuaTokenTypes::notKeyword:
+	case LuaTokenTypes::sharp:
+	case LuaTokenTypes::tilda: {
+		const auto operation = unaryOperator(token.token());
+		operation->connect(token);
+		++mPosition;
+
+		// All unary operators in Lua have the same precedence.
+		const auto operand = parseExpression(mPrecedenceTable.precedence(LuaTokenTypes::minus, Arity::unary));
+		if (!operand) {
+			return operand;
+		}
+
+		operation->setOperand(operand);
+		return operation;
+	}
+	default:
+		reportUnexpected();
+		return result;
+	}
+
+	result->connect(token);
+	++mPosition;
+	return result;
+}
+
+QSharedPointer<qrtext::lua::ast::Expression> LuaPrattParser::parsePrefixExpression()
+{
+	// prefixterm ::= Name | ‘(’ exp(0) ‘)’
+	QSharedPointer<ast::Expression> term;
+	if (check(LuaTokenTypes::identifier)) {
+		term = QSharedPointer<ast::Identifier>::create(next().lexeme());
+		term->connect(next());
+		++mPosition;
+	} else {
+		++mPosition;
+		term = parseExpression(0);
+		if (!term || !expect(LuaTokenTypes::closingBracket)) {
+			return QSharedPointer<ast::Expression>();
+		}
+	}
+
+	// Only the outermost expression gets connections of all parts, like in LuaParser.
+	QList<QSharedPointer<ast::Node>> connectedNodes;
+	QList<const Token *> connectedTokens;
+	QSharedPointer<ast::Expression> result = term;
+	bool isPartsEnd = false;
+	while (!isPartsEnd && !isEnd()) {
+		switch (next().token()) {
+		case LuaTokenTypes::openingSquareBracket: {
+			// varpart ::= ‘[’ exp(0) ‘]’
+			++mPosition;
+			const auto indexer = parseExpression(0);
+			if (!indexer || !expect(LuaTokenTypes::closingSquareBracket)) {
+				return QSharedPointer<ast::Expression>();
+			}
+
+			result = QSharedPointer<ast::IndexingExpression>::create(result, indexer);
+			connectedNodes << indexer;
+			break;
+		}
+		case LuaTokenTypes::dot: {
+			// varpart ::= ‘.’ Name
+			++mPosition;
+			const Token &name = next();
+			if (!expect(LuaTokenTypes::identifier)) {
+				return QSharedPointer<ast::Expression>();
+			}
+
+			const auto indexer = QSharedPointer<ast::String>::create(name.lexeme());
+			indexer->connect(name);
+			result = QSharedPointer<ast::IndexingExpression>::create(result, indexer);
+			connectedNodes << indexer;
+			break;
+		}
+		case LuaTokenTypes::colon: {
+			// functioncallpart ::= ‘:’ Name args
+			++mPosition;
+			const Token &name = next();
+			if (!expect(LuaTokenTypes::identifier)) {
+				return QSharedPointer<ast::Expression>();
+			}
+
+			const auto methodName = QSharedPointer<ast::Identifier>::create(name.lexeme());
+			methodName->connect(name);
+			connectedNodes << methodName;
+
+			QList<QSharedPointer<ast::Expression>> arguments;
+			if (!parseArguments(arguments, connectedNodes, connectedTokens)) {
+				return QSharedPointer<ast::Expression>();
+			}
+
+			result = QSharedPointer<ast::MethodCall>::create(result, methodName, arguments);
+			break;
+		}
+		case LuaTokenTypes::openingBracket:
+		case LuaTokenTypes::openingCurlyBracket:
+		case LuaTokenTypes::string: {
+			// functioncallpart ::= args
+			QList<QSharedPointer<ast::Expression>> arguments;
+			if (!parseArguments(arguments, connectedNodes, connectedTokens)) {
+				return QSharedPointer<ast::Expression>();
+			}
+
+			result = QSharedPointer<ast::FunctionCall>::create(result, arguments);
+			break;
+		}
+		default:
+			isPartsEnd = true;
+			break;
+		}
+	}
+
+	if (result != term) {
+		result->connect(term);
+		for (const auto &node : connectedNodes) {
+			result->connect(node);
+		}
+
+		for (const Token * const token : connectedTokens) {
+			result->connect(*token);
+		}
+	}
+
+	return result;
+}
+
+bool LuaPrattParser::parseArguments(QList<QSharedPointer<ast::Expression>> &arguments
+		, QList<QSharedPointer<ast::Node>> &connectedNodes
+		, QList<const Token *> &connectedTokens)
+{
+	if (isEnd()) {
+		reportUnexpected();
+		return false;
+	}
+
+	const Token &token = next();
+	switch (token.token()) {
+	case LuaTokenTypes::openingBracket: {
+		++mPosition;
+		if (!isEnd() && isExpressionStart(next().token()) && !parseExpressionList(arguments)) {
+			return false;
+		}
+
+		const Token &closingBracket = next();
+		if (!expect(LuaTokenTypes::closingBracket)) {
+			return false;
+		}
+
+		if (arguments.isEmpty()) {
+			connectedTokens << &token << &closingBracket;
+		} else {
+			for (const auto &argument : arguments) {
+				connectedNodes << argument;
+			}
+		}
+
+		return true;
+	}
+	case LuaTokenTypes::openingCurlyBracket: {
+		const auto table = parseTableConstructor();
+		if (!table) {
+			return false;
+		}
+
+		arguments << table;
+		connectedNodes << table;
+		return true;
+	}
+	case LuaTokenTypes::string: {
+		// String argument is taken as is, with quotes, like in LuaParser.
+		const auto argument = QSharedPointer<ast::String>::create(token.lexeme());
+		argument->connect(token);
+		++mPosition;
+		arguments << argument;
+		connectedNodes << argument;
+		return true;
+	}
+	default:
+		reportUnexpected();
+		return false;
+	}
+}
+
+QSharedPointer<qrtext::lua::ast::Expression> LuaPrattParser::parseTableConstructor()
+{
+	const Token &openingBracket = next();
+	++mPosition;
+
+	// fieldlist ::= field {fieldsep field}, separator shall be followed by a field, like in LuaParser.
+	QList<QSharedPointer<ast::FieldInitialization>> fields;
+	if (!isEnd() && (check(LuaTokenTypes::openingSquareBracket) || isExpressionStart(next().token()))) {
+		while (true) {
+			const auto field = parseField();
+			if (!field) {
+				return QSharedPointer<ast::Expression>();
+			}
+
+			fields << field;
+			if (!check(LuaTokenTypes::comma) && !check(LuaTokenTypes::semicolon)) {
+				break;
+			}
+
+			++mPosition;
+		}
+	}
+
+	const Token &closingBracket = next();
+	if (!expect(LuaTokenTypes::closingCurlyBracket)) {
+		return QSharedPointer<ast::Expression>();
+	}
+
+	const auto result = QSharedPointer<ast::TableConstructor>::create(fields);
+	if (fields.isEmpty()) {
+		result->connect(openingBracket);
+		result->connect(closingBracket);
+	} else {
+		for (const auto &field : fields) {
+			result->connect(field);
+		}
+	}
+
+	return result;
+}
+
+QSharedPointer<qrtext::lua::ast::FieldInitialization> LuaPrattParser::parseField()
+{
+	QSharedPointer<ast::FieldInitialization> result;
+	if (isEnd()) {
+		reportUnexpected();
+		return result;
+	}
+
+	QSharedPointer<ast::Expression> key;
+	if (check(LuaTokenTypes::openingSquareBracket)) {
+		++mPosition;
+		key = parseExpression(0);
+		if (!key || !expect(LuaTokenTypes::closingSquareBracket) || !expect(LuaTokenTypes::equals)) {
+			return result;
+		}
+	} else if (isExpressionStart(next().token())) {
+		key = parseExpression(0);
+		if (!key) {
+			return result;
+		}
+
+		if (!check(LuaTokenTypes::equals)) {
+			result = QSharedPointer<ast::FieldInitialization>::create(key);
+			result->connect(key);
+			return result;
+		}
+
+		/// @todo Report error if "key" is something different from Name.
+		++mPosition;
+	} else {
+		reportUnexpected();
+		return result;
+	}
+
+	const auto value = parseExpression(0);
+	if (!value) {
+		return result;
+	}
+
+	result = QSharedPointer<ast::FieldInitialization>::create(key, value);
+	result->connect(key);
+	result->connect(value);
+	return result;
+}
+
+QSharedPointer<qrtext::core::ast::BinaryOperator> LuaPrattParser::binaryOperator(LuaTokenTypes token)
+{
+	switch (token) {
+	case LuaTokenTypes::plus:
+		return QSharedPointer<ast::Addition>::create();
+	case LuaTokenTypes::minus:
+		return QSharedPointer<ast::Subtraction>::create();
+	case LuaTokenTypes::asterick:
+		return QSharedPointer<ast::Multiplication>::create();
+	case LuaTokenTypes::slash:
+		return QSharedPointer<ast::Division>::create();
+	case LuaTokenTypes::doubleSlash:
+		return QSharedPointer<ast::IntegerDivision>::create();
+	case LuaTokenTypes::hat:
+		return QSharedPointer<ast::Exponentiation>::create();
+	case LuaTokenTypes::percent:
+		return QSharedPointer<ast::Modulo>::create();
+	case LuaTokenTypes::ampersand:
+		return QSharedPointer<ast::BitwiseAnd>::create();
+	case LuaTokenTypes::tilda:
+		return QSharedPointer<ast::BitwiseXor>::create();
+	case LuaTokenTypes::verticalLine:
+		return QSharedPointer<ast::BitwiseOr>::create();
+	case LuaTokenTypes::doubleGreater:
+		return QSharedPointer<ast::BitwiseRightShift>::create();
+	case LuaTokenTypes::doubleLess:
+		return QSharedPointer<ast::BitwiseLeftShift>::create();
+	case LuaTokenTypes::doubleDot:
+		return QSharedPointer<ast::Concatenation>::create();
+	case LuaTokenTypes::less:
+		return QSharedPointer<ast::LessThan>::create();
+	case LuaTokenTypes::lessEquals:
+		return QSharedPointer<ast::LessOrEqual>::create();
+	case LuaTokenTypes::greater:
+		return QSharedPointer<ast::GreaterThan>::create();
+	case LuaTokenTypes::greaterEquals:
+		return QSharedPointer<ast::GreaterOrEqual>::create();
+	case LuaTokenTypes::doubleEquals:
+		return QSharedPointer<ast::Equality>::create();
+	case LuaTokenTypes::tildaEquals:
+	case LuaTokenTypes::exclamationMarkEquals:
+		return QSharedPointer<ast::Inequality>::create();
+	case LuaTokenTypes::andKeyword:
+	case LuaTokenTypes::doubleAmpersand:
+		return QSharedPointer<ast::LogicalAnd>::create();
+	case LuaTokenTypes::orKeyword:
+	case LuaTokenTypes::doubleVerticalLine:
+		return QSharedPointer<ast::LogicalOr>::create();
+	default:
+		return QSharedPointer<core::ast::BinaryOperator>();
+	}
+}
+
+QSharedPointer<qrtext::core::ast::UnaryOperator> LuaPrattParser::unaryOperator(LuaTokenTypes token)
+{
+	switch (token) {
+	case LuaTokenTypes::minus:
+		return QSharedPointer<ast::UnaryMinus>::create();
+	case LuaTokenTypes::notKeyword:
+		return QSharedPointer<ast::Not>::create();
+	case LuaTokenTypes::sharp:
+		return QSharedPointer<ast::Length>::create();
+	default:
+		return QSharedPointer<ast::BitwiseNegation>::create();
+	}
+}
+
+bool LuaPrattParser::isExpressionStart(LuaTokenTypes token)
+{
+	switch (token) {
+	case LuaTokenTypes::nilKeyword:
+	case LuaTokenTypes::falseKeyword:
+	case LuaTokenTypes::trueKeyword:
+	case LuaTokenTypes::integerLiteral:
+	case LuaTokenTypes::floatLiteral:
+	case LuaTokenTypes::string:
+	case LuaTokenTypes::tripleDot:
+	case LuaTokenTypes::identifier:
+	case LuaTokenTypes::openingBracket:
+	case LuaTokenTypes::openingCurlyBracket:
+	case LuaTokenTypes::minus:
+	case LuaTokenTypes::notKeyword:
+	case LuaTokenTypes::sharp:
+	case LuaTokenTypes::tilda:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool LuaPrattParser::isEnd() const
+{
+	return mPosition >= mTokens->size();
+}
+
+bool LuaPrattParser::check(LuaTokenTypes token) const
+{
+	return mPosition < mTokens->size() && mTokens->at(mPosition).token() == token;
+}
+
+const LuaPrattParser::Token &LuaPrattParser::next() const
+{
+	return isEnd() ? mTokens->last() : mTokens->at(mPosition);
+}
+
+bool LuaPrattParser::expect(LuaTokenTypes token)
+{
+	if (check(token)) {
+		++mPosition;
+		return true;
+	}
+
+	reportError(next().range().start(), QObject::tr("Expected \"%1\", got \"%2\"")
+			.arg(mTokenUserFriendlyNames->value(token))
+			.arg(mTokenUserFriendlyNames->value(next().token())));
+
+	return false;
+}
+
+void LuaPrattParser::reportError(const Connection &connection, const QString &message)
+{
+	mErrors << Error(connection, message, ErrorType::syntaxError, Severity::error);
+}
+
+void LuaPrattParser::reportUnexpected()
+{
+	const Connection connection = mTokens->isEmpty() ? Connection() : next().range().start();
+	reportError(connection, isEnd() ? QObject::tr("Unexpected end of input") : QObject::tr("Unexpected token"));
+}
@@ -0,0 +1,125 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QSharedPointer>
+
+#include "qrtext/core/error.h"
+#include "qrtext/core/ast/node.h"
+#include "qrtext/core/ast/binaryOperator.h"
+#include "qrtext/core/ast/unaryOperator.h"
+#include "qrtext/core/lexer/token.h"
+#include "qrtext/lua/ast/expression.h"
+#include "qrtext/lua/ast/fieldInitialization.h"
+#include "qrtext/src/lua/luaTokenTypes.h"
+#include "qrtext/src/lua/luaPrecedenceTable.h"
+
+namespace qrtext {
+namespace lua {
+namespace details {
+
+/// Hand-written parser for the same subset of Lua as LuaParser (see its description for grammar). Statements are
+/// parsed by recursive descent with one token lookahead, expressions by Pratt parser driven by LuaPrecedenceTable.
+/// Unlike combinator-based LuaParser it does not build FIRST sets and temporary nodes on each step and does not copy
+/// tokens, every AST node is created together with its reference counter in one allocation.
+/// Produces the same trees with the same connections as LuaParser, so they are interchangeable. Parsing stops at first
+/// syntax error.
+class LuaPrattParser
+{
+public:
+	/// Constructor.
+	/// @param errors - error stream to report errors to.
+	explicit LuaPrattParser(QList<core::Error> &errors);
+
+	/// Parses given stream of tokens and returns AST with results or nullptr if parsing is impossible.
+	/// @param tokens - a stream of tokens to parse.
+	/// @param tokenUserFriendlyNames - map with displayed names of tokens.
+	QSharedPointer<core::ast::Node> parse(const QList<core::Token<LuaTokenTypes>> &tokens
+			, const QHash<LuaTokenTypes, QString> &tokenUserFriendlyNames);
+
+private:
+	typedef core::Token<LuaTokenTypes> Token;
+
+	/// block ::= {stat}
+	QSharedPointer<core::ast::Node> parseBlock();
+
+	/// stat ::= explist [‘=’ explist], appends resulting statements to \a statements.
+	bool parseStatement(QList<QSharedPointer<core::ast::Node>> &statements);
+
+	/// explist ::= exp(0) {‘,’ exp(0)}
+	bool parseExpressionList(QList<QSharedPointer<ast::Expression>> &expressions);
+
+	/// exp(precedence) ::= primary { binop exp(newPrecedence) }
+	QSharedPointer<ast::Expression> parseExpression(int precedence);
+
+	/// primary ::= nil | false | true | Number | String | ‘...’ | prefixexp | tableconstructor | unop exp
+	QSharedPointer<ast::Expression> parsePrimary();
+
+	/// prefixexp ::= prefixterm { functioncallpart | varpart }
+	QSharedPointer<ast::Expression> parsePrefixExpression();
+
+	/// args ::= ‘(’ [explist] ‘)’ | tableconstructor | String
+	/// Nodes and tokens which connections shall be added to a resulting prefix expression are appended to
+	/// \a connectedNodes and \a connectedTokens.
+	bool parseArguments(QList<QSharedPointer<ast::Expression>> &arguments
+			, QList<QSharedPointer<core::ast::Node>> &connectedNodes
+			, QList<const Token *> &connectedTokens);
+
+	/// tableconstructor ::= ‘{’ [fieldlist] ‘}’
+	QSharedPointer<ast::Expression> parseTableConstructor();
+
+	/// field ::= ‘[’ exp(0) ‘]’ ‘=’ exp(0) | exp(0) [ ‘=’ exp(0) ]
+	QSharedPointer<ast::FieldInitialization> parseField();
+
+	/// Creates node for a binary operator denoted by a given token.
+	static QSharedPointer<core::ast::BinaryOperator> binaryOperator(LuaTokenTypes token);
+
+	/// Creates node for a unary operator denoted by a given token.
+	static QSharedPointer<core::ast::UnaryOperator> unaryOperator(LuaTokenTypes token);
+
+	/// Returns true if a given token can start an expression.
+	static bool isExpressionStart(LuaTokenTypes token);
+
+	/// Returns true if all tokens are consumed.
+	bool isEnd() const;
+
+	/// Returns true if next token has given type.
+	bool check(LuaTokenTypes token) const;
+
+	/// Returns next token, or last token if there is end of stream.
+	const Token &next() const;
+
+	/// Advances stream if next token is the expected one, reports error otherwise.
+	bool expect(LuaTokenTypes token);
+
+	/// Reports error at given connection.
+	void reportError(const core::Connection &connection, const QString &message);
+
+	/// Reports "Unexpected token" or "Unexpected end of input" error at next token.
+	void reportUnexpected();
+
+	QList<core::Error> &mErrors;
+	LuaPrecedenceTable mPrecedenceTable;
+
+	const QList<Token> *mTokens = nullptr;
+	const QHash<LuaTokenTypes, QString> *mTokenUserFriendlyNames = nullptr;
+	int mPosition = 0;
+};
+
+}
+}
+}
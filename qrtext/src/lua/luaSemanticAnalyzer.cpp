@@ -85,16 +85,19 @@ LuaSemanticAnalyzer::LuaSemanticAnalyzer(QList<Error> &errors)
 void LuaSemanticAnalyzer::addIntrinsicFunction(const QString &name, const QSharedPointer<types::Function> &type)
 {
 	mIntrinsicFunctions.insert(name, type);
+	invalidate();
 }
 
 void LuaSemanticAnalyzer::addReadOnlyVariable(const QString &name)
 {
 	mReadOnlyVariables.insert(name);
+	invalidate();
 }
 
 void LuaSemanticAnalyzer::removeReadOnlyVariable(const QString &name)
 {
 	mReadOnlyVariables.remove(name);
+	invalidate();
 }
 
 void LuaSemanticAnalyzer::precheck(QSharedPointer<ast::Node> const &node)
@@ -289,7 +292,10 @@ void LuaSemanticAnalyzer::constrainAssignment(const QSharedPointer<core::ast::No
 		return;
 	}
 
-	lhsType->constrainAssignment(rhsType, generalizationsTable(), &wasCoercion);
+	if (lhsType->constrainAssignment(rhsType, typeLattice(), &wasCoercion)) {
+		invalidate();
+	}
+
 	if (lhsType->isEmpty()) {
 		reportError(operation, QObject::tr("Left and right operand have mismatched types."));
 	} else {
@@ -305,10 +311,9 @@ void LuaSemanticAnalyzer::constrainAssignment(const QSharedPointer<core::ast::No
 										new types::Table(rhsType->finalType(), 1))
 									));
 
-					tableType->constrainAssignment(
-							tableTypePattern
-							, generalizationsTable()
-							, &wasCoercion);
+					if (tableType->constrainAssignment(tableTypePattern, typeLattice(), &wasCoercion)) {
+						invalidate();
+					}
 				}
 			}
 
@@ -17,7 +17,7 @@
 #include <QsLog.h>
 
 #include "qrtext/src/lua/luaLexer.h"
-#include "qrtext/src/lua/luaParser.h"
+#include "qrtext/src/lua/luaPrattParser.h"
 #include "qrtext/src/lua/luaSemanticAnalyzer.h"
 #include "qrtext/src/lua/luaInterpreter.h"
 
@@ -27,7 +27,7 @@ using namespace qrtext::core::ast;
 
 LuaToolbox::LuaToolbox()
 	: mLexer(new details::LuaLexer(mErrors))
-	, mParser(new details::LuaParser(mErrors))
+	, mParser(new details::LuaPrattParser(mErrors))
 	, mAnalyzer(new details::LuaSemanticAnalyzer(mErrors))
 	, mInterpreter(new details::LuaInterpreter(mErrors))
 {
@@ -126,6 +126,21 @@ QStringList LuaToolbox::identifiers() const
 	return mAnalyzer->identifiers();
 }
 
+quint64 LuaToolbox::identifiersRevision() const
+{
+	return static_cast<quint64>(mAnalyzer->revision());
+}
+
+quint64 LuaToolbox::valuesRevision() const
+{
+	return mInterpreter->revision();
+}
+
+QStringList LuaToolbox::changedIdentifiers(quint64 valuesRevision) const
+{
+	return mInterpreter->changedIdentifiers(valuesRevision);
+}
+
 QMap<QString, QSharedPointer<qrtext::core::types::TypeExpression>> LuaToolbox::variableTypes() const
 {
 	return mAnalyzer->variableTypes();
@@ -0,0 +1,159 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "blobStore.h"
+
+#include <QtCore/QBuffer>
+#include <QtCore/QCryptographicHash>
+#include <QtGui/QImageReader>
+
+using namespace utils;
+
+/// Expired entries are swept after this many insertions.
+static const int pruneInterval = 64;
+
+/// Number of resolutions of one blob kept decoded.
+static const int decodedImagesLimit = 4;
+
+Blob::Blob(const QString &hash, const QByteArray &bytes)
+	: mHash(hash)
+	, mBytes(bytes)
+	, mDecoded(decodedImagesLimit)
+{
+}
+
+QString Blob::hash() const
+{
+	return mHash;
+}
+
+QByteArray Blob::bytes() const
+{
+	return mBytes;
+}
+
+QSize Blob::imageSize() const
+{
+	QMutexLocker lock(&mMutex);
+	return imageSizeUnlocked();
+}
+
+QSize Blob::imageSizeUnlocked() const
+{
+	if (!mHeaderRead) {
+		QBuffer buffer;
+		buffer.setData(mBytes);
+		QImageReader reader(&buffer);
+		mImageSize = reader.size();
+		if (!mImageSize.isValid() && reader.canRead()) {
+			// Format does not tell the size without decoding, keeping decoded image then.
+			const QImage decoded = reader.read();
+			mImageSize = decoded.size();
+			cacheDecoded(decoded);
+		}
+
+		mHeaderRead = true;
+	}
+
+	return mImageSize;
+}
+
+QImage Blob::image(const QSize &size) const
+{
+	QMutexLocker lock(&mMutex);
+	const QSize fullSize = imageSizeUnlocked();
+	QSize targetSize = fullSize;
+	if (size.isValid() && fullSize.isValid()) {
+		while (targetSize.width() / 2 >= size.width() && targetSize.height() / 2 >= size.height()
+				&& targetSize.width() > 1 && targetSize.height() > 1) {
+			targetSize /= 2;
+		}
+	}
+
+	if (const QImage * const decoded = mDecoded.object(qMakePair(targetSize.width(), targetSize.height()))) {
+		return *decoded;
+	}
+
+	QBuffer buffer;
+	buffer.setData(mBytes);
+	QImageReader reader(&buffer);
+	if (targetSize.isValid() && targetSize != fullSize) {
+		// Some decoders (JPEG, for example) produce downscaled image without decoding full one.
+		reader.setScaledSize(targetSize);
+	}
+
+	const QImage decoded = reader.read();
+	cacheDecoded(decoded);
+	return decoded;
+}
+
+void Blob::cacheDecoded(const QImage &image) const
+{
+	if (!image.isNull()) {
+		mDecoded.insert(qMakePair(image.width(), image.height()), new QImage(image));
+	}
+}
+
+QSharedPointer<const Blob> BlobStore::put(const QByteArray &bytes)
+{
+	const QString key = hash(bytes);
+	QMutexLocker lock(&mMutex);
+	if (const auto existing = mBlobs.value(key).toStrongRef()) {
+		return existing;
+	}
+
+	if (++mPutsSincePrune >= pruneInterval) {
+		prune();
+	}
+
+	const QSharedPointer<const Blob> blob(new Blob(key, bytes));
+	mBlobs.insert(key, blob);
+	return blob;
+}
+
+QSharedPointer<const Blob> BlobStore::find(const QString &hash) const
+{
+	QMutexLocker lock(&mMutex);
+	return mBlobs.value(hash).toStrongRef();
+}
+
+int BlobStore::size() const
+{
+	QMutexLocker lock(&mMutex);
+	int result = 0;
+	for (const auto &blob : mBlobs) {
+		if (!blob.isNull()) {
+			++result;
+		}
+	}
+
+	return result;
+}
+
+QString BlobStore::hash(const QByteArray &bytes)
+{
+	return QString::fromLatin1(QCryptographicHash::hash(bytes, QCryptographicHash::Sha1).toHex());
+}
+
+void BlobStore::prune()
+{
+	mPutsSincePrune = 0;
+	for (auto it = mBlobs.begin(); it != mBlobs.end();) {
+		if (it.value().isNull()) {
+			it = mBlobs.erase(it);
+		} else {
+			++it;
+		}
+	}
+}
@@ -0,0 +1,98 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QCache>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QSharedPointer>
+#include <QtGui/QImage>
+
+#include <qrutils/utilsDeclSpec.h>
+#include <qrutils/singleton.h>
+
+namespace utils {
+
+/// Immutable piece of binary data identified by a hash of its content, typically an encoded image.
+/// Pixels are decoded only when requested and only at the resolution needed, a few recently used resolutions are kept.
+/// All methods are thread-safe.
+class QRUTILS_EXPORT Blob
+{
+	Q_DISABLE_COPY(Blob)
+public:
+	/// Returns hex-encoded SHA-1 of the content.
+	QString hash() const;
+
+	/// Returns the content.
+	QByteArray bytes() const;
+
+	/// Returns size of the encoded image read from its header, invalid size if the content is not a raster image.
+	QSize imageSize() const;
+
+	/// Returns decoded image at least as large as @p size or of full size if @p size is invalid or exceeds it.
+	/// Resolution is chosen among halvings of the full size, so small zoom changes reuse the decoded image
+	/// and the painter scales the rest.
+	QImage image(const QSize &size = QSize()) const;
+
+private:
+	friend class BlobStore;
+	Blob(const QString &hash, const QByteArray &bytes);
+
+	QSize imageSizeUnlocked() const;
+
+	/// Keeps decoded image for later requests of the same resolution.
+	void cacheDecoded(const QImage &image) const;
+
+	const QString mHash;
+	const QByteArray mBytes;
+	mutable QMutex mMutex;
+	mutable bool mHeaderRead = false;
+	mutable QSize mImageSize;
+	/// Decoded images keyed by width and height, drawing the same blob at several zooms does not decode it again.
+	mutable QCache<QPair<int, int>, QImage> mDecoded;
+};
+
+/// Process-wide storage of blobs keyed by content hash. Identical contents put into the store from different
+/// fields or projects share one blob and one decoded image for as long as anyone refers to it.
+/// All methods are thread-safe.
+class QRUTILS_EXPORT BlobStore : public utils::Singleton<BlobStore>
+{
+public:
+	/// Returns the blob with given content, creating it if there is no alive blob with the same content.
+	QSharedPointer<const Blob> put(const QByteArray &bytes);
+
+	/// Returns the blob with given hash if it is still referred somewhere, null pointer otherwise.
+	QSharedPointer<const Blob> find(const QString &hash) const;
+
+	/// Returns the number of blobs that are still referred somewhere.
+	int size() const;
+
+	/// Returns hex-encoded SHA-1 of the given data, the key under which it is stored.
+	static QString hash(const QByteArray &bytes);
+
+private:
+	friend utils::Singleton<BlobStore>;
+	BlobStore() = default;
+
+	void prune();
+
+	mutable QMutex mMutex;
+	QHash<QString, QWeakPointer<const Blob>> mBlobs;
+
+	/// Number of put() calls since the last removal of expired entries.
+	int mPutsSincePrune = 0;
+};
+
+}
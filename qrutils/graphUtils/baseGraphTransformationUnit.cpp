@@ -19,8 +19,67 @@
 
 #include <qrgui/plugins/toolPluginInterface/usedInterfaces/errorReporterInterface.h>
 
+#include "subgraphMatcher.h"
+
 using namespace qReal;
 
+/// Exposes the model to incremental matchers with the same queries and comparisons as full matching uses.
+class BaseGraphTransformationUnit::IncrementalMatchingContext : public IncrementalMatcher::Context
+{
+public:
+	explicit IncrementalMatchingContext(const BaseGraphTransformationUnit &unit)
+		: mUnit(unit)
+	{
+	}
+
+	IdList links(const Id &node) const override
+	{
+		IdList result;
+		if (exists(node)) {
+			for (const Id &link : mUnit.linksInModel(node)) {
+				result << mUnit.graphicalLink(link);
+			}
+		}
+
+		return result;
+	}
+
+	Id linkFrom(const Id &link) const override
+	{
+		return exists(link) ? mUnit.fromInModel(link) : Id::rootId();
+	}
+
+	Id linkTo(const Id &link) const override
+	{
+		return exists(link) ? mUnit.toInModel(link) : Id::rootId();
+	}
+
+	bool isNodeCompatible(const Id &modelNode, const Id &ruleNode) const override
+	{
+		return (mUnit.isTypeWildcard(ruleNode) || sameType(modelNode, ruleNode))
+				&& mUnit.compareElements(modelNode, ruleNode);
+	}
+
+	bool isEdgeCompatible(const Id &modelLink, const Id &ruleLink) const override
+	{
+		return (mUnit.isTypeWildcard(ruleLink) || sameType(modelLink, ruleLink))
+				&& mUnit.compareElementTypesAndProperties(modelLink, ruleLink);
+	}
+
+private:
+	bool exists(const Id &id) const
+	{
+		return mUnit.mLogicalModelApi.isLogicalId(id) || mUnit.mGraphicalModelApi.isGraphicalId(id);
+	}
+
+	static bool sameType(const Id &first, const Id &second)
+	{
+		return first.diagram() == second.diagram() && first.element() == second.element();
+	}
+
+	const BaseGraphTransformationUnit &mUnit;
+};
+
 BaseGraphTransformationUnit::BaseGraphTransformationUnit(
 		qReal::LogicalModelAssistInterface &logicalModelApi
 		, qReal::GraphicalModelAssistInterface &graphicalModelApi
@@ -29,6 +88,7 @@ BaseGraphTransformationUnit::BaseGraphTransformationUnit(
 		, mLogicalModelApi(logicalModelApi)
 		, mGraphicalModelApi(graphicalModelApi)
 		, mHasRuleSyntaxErr(false)
+		, mIncrementalMatchingContext(new IncrementalMatchingContext(*this))
 {
 	mDefaultProperties = (QSet<QString>()
 		<< "from" << "incomingConnections" << "incomingUsages" << "links"
@@ -68,7 +128,6 @@ bool BaseGraphTransformationUnit::checkRuleMatching()
 bool BaseGraphTransformationUnit::checkRuleMatching(const IdList &elements)
 {
 	mMatch = QHash<Id, Id>();
-	bool isMatched = false;
 
 	const Id startElem = startElement();
 	if (startElem == Id::rootId()) {
@@ -79,246 +138,155 @@ bool BaseGraphTransformationUnit::checkRuleMatching(const IdList &elements)
 		return false;
 	}
 
-	mNodesHavingOutsideLinks.append(startElem);
-
-	for (const Id &element : elements) {
-		if (compareElements(element, startElem)) {
-			mCurrentMatchedGraphInRule.clear();
-			mCurrentMatchedGraphInModel.clear();
-			mNodesHavingOutsideLinks.clear();
-			mMatch.clear();
-			mPos = 0;
-
-			mCurrentMatchedGraphInRule.append(startElem);
-			mCurrentMatchedGraphInModel.append(element);
-			mNodesHavingOutsideLinks.append(startElem);
-
-			mMatch.insert(startElem, element);
-
-			if (checkRuleMatchingRecursively()) {
-				isMatched = true;
+	if (mIncrementalMatching) {
+		QSharedPointer<IncrementalMatcher> &matcher = mIncrementalMatchers[mRuleToFind];
+		if (!matcher) {
+			GraphSnapshot rule;
+			if (!buildRuleSnapshot(startElem, rule)) {
+				mIncrementalMatchers.remove(mRuleToFind);
+				return false;
 			}
-		}
-	}
-
-	return isMatched;
-}
-
-bool BaseGraphTransformationUnit::checkRuleMatchingRecursively()
-{
-	if (mNodesHavingOutsideLinks.length() == mPos) {
-		QHash<Id, Id> currentMatch = mMatch;
-		mMatches.append(currentMatch);
-		return true;
-	}
 
-	bool isMatched = false;
-
-	const Id nodeInRule = mNodesHavingOutsideLinks.at(mPos);
-	const Id linkInRule = outsideLink(nodeInRule);
+			matcher.reset(new IncrementalMatcher(rule, *mIncrementalMatchingContext));
+		}
 
-	if (linkInRule != Id::rootId()) {
-		const Id linkEndInRuleElement = linkEndInRule(linkInRule, nodeInRule);
-		if (linkEndInRuleElement == Id::rootId()) {
-			report(tr("Rule '") + property(mRuleToFind, "ruleName").toString() + tr("' has unconnected link"), true);
-			mHasRuleSyntaxErr = true;
+		const QList<QHash<Id, Id>> found = matcher->matches(elements);
+		if (found.isEmpty()) {
 			return false;
 		}
 
-		const Id nodeInModel = mMatch.value(nodeInRule);
-		const IdList linksInModel = properLinks(nodeInModel, linkInRule);
-
-		QHash<Id, Id> matchBackup = mMatch;
-		IdList nodesHavingOutsideLinksBackup = mNodesHavingOutsideLinks;
-		IdList currentMatchedGraphInRuleBackup = mCurrentMatchedGraphInRule;
-		IdList currentMatchedGraphInModelBackup = mCurrentMatchedGraphInModel;
-		const int posBackup = mPos;
-
-		for (const Id &linkInModel : linksInModel) {
-			const Id linkEndInModelElement = linkEndInModel(linkInModel, nodeInModel);
-			if (checkNodeForAddingToMatch(linkEndInModelElement, linkEndInRuleElement)) {
-				if (checkRuleMatchingRecursively()) {
-					isMatched = true;
-					mMatch = QHash<Id, Id>();
-					for (const Id &id : matchBackup.keys()) {
-						mMatch.insert(id, matchBackup.value(id));
-					}
-
-					mNodesHavingOutsideLinks = IdList();
-					for (const Id &id : nodesHavingOutsideLinksBackup) {
-						mNodesHavingOutsideLinks.append(id);
-					}
-					mCurrentMatchedGraphInRule = IdList();
-					for (const Id &id : currentMatchedGraphInRuleBackup) {
-						mCurrentMatchedGraphInRule.append(id);
-					}
-					mCurrentMatchedGraphInModel = IdList();
-					for (const Id &id : currentMatchedGraphInModelBackup) {
-						mCurrentMatchedGraphInModel.append(id);
-					}
-
-					mPos = posBackup;
-				} else {
-					rollback();
-				}
-			}
-		}
-		return isMatched;
-	} else {
-		mPos++;
-		return checkRuleMatchingRecursively();
+		mMatches << found;
+		mMatch = found.first();
+		return true;
 	}
-}
 
-bool BaseGraphTransformationUnit::checkNodeForAddingToMatch(const Id &nodeInModel, const Id &nodeInRule)
-{
-	if (nodeInModel == Id::rootId()) {
+	GraphSnapshot rule;
+	if (!buildRuleSnapshot(startElem, rule)) {
 		return false;
 	}
 
-	QHash<Id, Id> *linksToAddToMatch = new QHash<Id, Id>();
-
-	bool res = checkExistingLinks(nodeInModel, nodeInRule, linksToAddToMatch);
+	GraphSnapshot model;
+	buildModelSnapshot(elements, model);
 
-	if (res) {
-		mMatch.unite(*linksToAddToMatch);
-		mMatch.insert(nodeInRule, nodeInModel);
-		mCurrentMatchedGraphInRule.append(nodeInRule);
-		mCurrentMatchedGraphInModel.append(nodeInModel);
-		mNodesHavingOutsideLinks.append(nodeInRule);
+	// Bucketing model elements by type, so every rule element is compared only with elements of its type.
+	const auto typeKey = [](const Id &id) { return id.diagram() + "/" + id.element(); };
+	QHash<QString, QVector<int>> nodesByType;
+	QVector<int> allNodes;
+	for (int node = 0; node < model.nodesCount(); ++node) {
+		nodesByType[typeKey(model.node(node))] << node;
+		allNodes << node;
 	}
 
-	return res;
-}
-
-bool BaseGraphTransformationUnit::checkExistingLinks(const Id &nodeInModel
-		, const Id &nodeInRule, QHash<Id, Id> *linksToAddInMatch)
-{
-	const IdList linksInRuleElement = linksInRule(nodeInRule);
+	QHash<QString, QVector<int>> edgesByType;
+	QVector<int> allEdges;
+	for (int edge = 0; edge < model.edgesCount(); ++edge) {
+		edgesByType[typeKey(model.edge(edge).id)] << edge;
+		allEdges << edge;
+	}
 
-	for (const Id &linkInRule : linksInRuleElement) {
-		const Id linkEndInR = linkEndInRule(linkInRule, nodeInRule);
-		if (mCurrentMatchedGraphInRule.contains(linkEndInR)) {
-			Id properLinkInModel = properLink(nodeInModel, linkInRule, linkEndInR);
-			if (properLinkInModel == Id::rootId()) {
-				return false;
-			} else {
-				if (mLogicalModelApi.logicalRepoApi().isLogicalElement(properLinkInModel)) {
-					const IdList properGraphicalLinks = mGraphicalModelApi.graphicalIdsByLogicalId(properLinkInModel);
-					if (!properGraphicalLinks.isEmpty()) {
-						properLinkInModel = properGraphicalLinks.first();
-					}
-				}
-				linksToAddInMatch->insert(linkInRule, properLinkInModel);
+	const QSet<Id> startElements = elements.toSet();
+	SubgraphMatcher matcher(rule, model);
+	for (int nodeInRule = 0; nodeInRule < rule.nodesCount(); ++nodeInRule) {
+		const Id ruleNode = rule.node(nodeInRule);
+		QVector<int> candidates;
+		for (const int node : isTypeWildcard(ruleNode) ? allNodes : nodesByType.value(typeKey(ruleNode))) {
+			const Id modelNode = model.node(node);
+			if ((ruleNode != startElem || startElements.contains(modelNode)) && compareElements(modelNode, ruleNode)) {
+				candidates << node;
 			}
 		}
-	}
 
-	return true;
-}
+		matcher.setNodeCandidates(nodeInRule, candidates);
+	}
 
-void BaseGraphTransformationUnit::rollback()
-{
-	const Id nodeToRemove = mCurrentMatchedGraphInRule.last();
+	for (int edgeInRule = 0; edgeInRule < rule.edgesCount(); ++edgeInRule) {
+		const Id ruleEdge = rule.edge(edgeInRule).id;
+		QVector<int> candidates;
+		for (const int edge : isTypeWildcard(ruleEdge) ? allEdges : edgesByType.value(typeKey(ruleEdge))) {
+			if (compareElementTypesAndProperties(model.edge(edge).id, ruleEdge)) {
+				candidates << edge;
+			}
+		}
 
-	mMatch.remove(nodeToRemove);
-	mCurrentMatchedGraphInRule.removeLast();
-	mCurrentMatchedGraphInModel.removeLast();
-	mNodesHavingOutsideLinks.removeLast();
-	if (mPos == mNodesHavingOutsideLinks.length()) {
-		mPos--;
+		matcher.setEdgeCandidates(edgeInRule, candidates);
 	}
 
-	const IdList links = linksToMatchedSubgraph(nodeToRemove);
-	for (const Id &link : links) {
-		mMatch.remove(link);
+	const QList<QHash<Id, Id>> found = matcher.findAll(mParallelMatching);
+	if (found.isEmpty()) {
+		return false;
 	}
-}
 
-IdList BaseGraphTransformationUnit::linksToMatchedSubgraph(const Id &nodeInRule) const
-{
-	IdList result;
-	const IdList lnksInRule = linksInRule(nodeInRule);
-	for (const Id &link : lnksInRule) {
-		const Id linkEnd = linkEndInRule(link, nodeInRule);
-		if (mCurrentMatchedGraphInRule.contains(linkEnd)) {
-			result.append(link);
-		}
-	}
-	return result;
+	mMatches << found;
+	mMatch = found.first();
+	return true;
 }
 
-Id BaseGraphTransformationUnit::outsideLink(const Id &nodeInRule) const
+bool BaseGraphTransformationUnit::buildRuleSnapshot(const Id &startElement, GraphSnapshot &rule)
 {
-	const IdList lnksInRule = linksInRule(nodeInRule);
-	for (const Id &linkInRule : lnksInRule) {
-		const Id linkEndInR = linkEndInRule(linkInRule, nodeInRule);
-		if (!mCurrentMatchedGraphInRule.contains(linkEndInR)) {
-			return linkInRule;
-		}
-	}
+	rule.addNode(startElement);
+	for (int node = 0; node < rule.nodesCount(); ++node) {
+		for (const Id &link : linksInRule(rule.node(node))) {
+			if (rule.edgeIndex(link) >= 0) {
+				continue;
+			}
 
-	return Id::rootId();
-}
+			const Id from = fromInRule(link);
+			const Id to = toInRule(link);
+			if (from == Id::rootId() || to == Id::rootId()) {
+				report(tr("Rule '") + property(mRuleToFind, "ruleName").toString()
+						+ tr("' has unconnected link"), true);
+				mHasRuleSyntaxErr = true;
+				return false;
+			}
 
-Id BaseGraphTransformationUnit::linkEndInModel(const Id &linkInModel, const Id &nodeInModel) const
-{
-	const Id linkTo = toInModel(linkInModel);
-	if (linkTo == nodeInModel) {
-		return fromInModel(linkInModel);
+			const int fromIndex = rule.addNode(from);
+			const int toIndex = rule.addNode(to);
+			rule.addEdge(link, fromIndex, toIndex);
+		}
 	}
-	return linkTo;
+
+	return true;
 }
 
-Id BaseGraphTransformationUnit::linkEndInRule(const Id &linkInRule, const Id &nodeInRule) const
+void BaseGraphTransformationUnit::buildModelSnapshot(const IdList &elements, GraphSnapshot &model) const
 {
-	const Id linkTo = toInRule(linkInRule);
-	if (linkTo == nodeInRule) {
-		return fromInRule(linkInRule);
+	// Elements to start from go first, so matches are enumerated in the order of given elements.
+	for (const Id &element : elements + elementsFromActiveDiagram()) {
+		if (!isEdgeInModel(element)) {
+			model.addNode(element);
+		}
 	}
-	return linkTo;
-}
 
-Id BaseGraphTransformationUnit::properLink(const Id &nodeInModel, const Id &linkInRule, const Id &linkEndInR) const
-{
-	const IdList lnksInModel = linksInModel(nodeInModel);
-	for (const Id &linkInModel : lnksInModel) {
-		if (compareLinks(linkInModel, linkInRule)) {
-			Id linkEndInM = linkEndInModel(linkInModel, nodeInModel);
-			if (!mLogicalModelApi.isLogicalId(linkEndInM)) {
-				linkEndInM = mGraphicalModelApi.logicalId(linkEndInM);
-			}
-			Id linkEndInRValue = mMatch.value(linkEndInR);
-			if (!mLogicalModelApi.isLogicalId(linkEndInRValue)) {
-				linkEndInRValue = mGraphicalModelApi.logicalId(linkEndInRValue);
+	for (int node = 0; node < model.nodesCount(); ++node) {
+		for (const Id &link : linksInModel(model.node(node))) {
+			const Id linkInModel = graphicalLink(link);
+			if (model.edgeIndex(linkInModel) >= 0) {
+				continue;
 			}
-			if (linkEndInM == linkEndInRValue) {
-				return linkInModel;
+
+			const Id from = fromInModel(link);
+			const Id to = toInModel(link);
+			if (from == Id::rootId() || to == Id::rootId()) {
+				continue;
 			}
+
+			const int fromIndex = model.addNode(from);
+			const int toIndex = model.addNode(to);
+			model.addEdge(linkInModel, fromIndex, toIndex);
 		}
 	}
-
-	return Id::rootId();
 }
 
-IdList BaseGraphTransformationUnit::properLinks(const Id &nodeInModel, const Id &linkInRule) const
+Id BaseGraphTransformationUnit::graphicalLink(const Id &link) const
 {
-	IdList result;
-	const IdList lnksInModel = linksInModel(nodeInModel);
-	for (const Id &linkInModel : lnksInModel) {
-		if (mCurrentMatchedGraphInModel.contains(linkEndInModel(linkInModel, nodeInModel))) {
-			continue;
-		}
-
-		if (compareLinks(linkInModel, linkInRule)) {
-			if (!mLogicalModelApi.isLogicalId(linkInModel)) {
-				result.append(linkInModel);
-			} else {
-				result.append(mGraphicalModelApi.graphicalIdsByLogicalId(linkInModel));
-			}
+	if (mLogicalModelApi.isLogicalId(link)) {
+		const IdList graphicalLinks = mGraphicalModelApi.graphicalIdsByLogicalId(link);
+		if (!graphicalLinks.isEmpty()) {
+			return graphicalLinks.first();
 		}
 	}
-	return result;
+
+	return link;
 }
 
 bool BaseGraphTransformationUnit::compareLinks(const Id &first,const Id &second) const
@@ -553,6 +521,49 @@ QList<QHash<Id, Id> > BaseGraphTransformationUnit::matches()
 	return mMatches;
 }
 
+void BaseGraphTransformationUnit::setParallelMatching(bool parallel)
+{
+	mParallelMatching = parallel;
+}
+
+void BaseGraphTransformationUnit::setIncrementalMatching(bool incremental)
+{
+	mIncrementalMatching = incremental;
+	resetMatchCache();
+}
+
+void BaseGraphTransformationUnit::resetMatchCache()
+{
+	mIncrementalMatchers.clear();
+}
+
+void BaseGraphTransformationUnit::elementChanged(const Id &element)
+{
+	if (mIncrementalMatchers.isEmpty()) {
+		return;
+	}
+
+	// Nodes and links of the model are graphical, properties belong to logical elements.
+	IdList ids = {element};
+	if (mGraphicalModelApi.isGraphicalId(element)) {
+		ids << mGraphicalModelApi.logicalId(element);
+	} else if (mLogicalModelApi.isLogicalId(element)) {
+		ids << mGraphicalModelApi.graphicalIdsByLogicalId(element);
+	}
+
+	for (const QSharedPointer<IncrementalMatcher> &matcher : mIncrementalMatchers) {
+		for (const Id &id : ids) {
+			matcher->elementChanged(id);
+		}
+	}
+}
+
+bool BaseGraphTransformationUnit::isTypeWildcard(const Id &elementInRule) const
+{
+	Q_UNUSED(elementInRule)
+	return false;
+}
+
 void BaseGraphTransformationUnit::pause(const int &time)
 {
 	QEventLoop loop;
@@ -14,7 +14,12 @@
 
 #pragma once
 
+#include <QtCore/QScopedPointer>
+#include <QtCore/QSharedPointer>
+
 #include "qrutils/utilsDeclSpec.h"
+#include "qrutils/graphUtils/graphSnapshot.h"
+#include "qrutils/graphUtils/incrementalMatcher.h"
 
 #include <qrgui/plugins/toolPluginInterface/usedInterfaces/mainWindowInterpretersInterface.h>
 #include <qrgui/plugins/toolPluginInterface/usedInterfaces/logicalModelAssistInterface.h>
@@ -40,49 +45,29 @@ public:
 	/// Get all matches of selected rule
 	QList<QHash<Id, Id> > matches();
 
-protected:
-
-	/// Finds first element and starts checking process
-	bool virtual checkRuleMatching();
+	/// Enables or disables enumeration of matches in several threads. Disabled by default.
+	void setParallelMatching(bool parallel);
 
-	/// Finds first element in specified elements and starts checking process
-	bool checkRuleMatching(const IdList &elements);
+	/// Enables or disables keeping matches of every rule between searches and updating them incrementally.
+	/// Disabled by default. When enabled, all modifications of the model must be reported with elementChanged()
+	/// or followed by resetMatchCache().
+	void setIncrementalMatching(bool incremental);
 
-	/// Checks rule matching recursively accordingly to given initial data
-	bool checkRuleMatchingRecursively();
+	/// Forgets all matches kept for incremental matching.
+	void resetMatchCache();
 
-	/// Checks can given node in model be added to match as corresponding node
-	/// to given node in rule at curren step
-	bool checkNodeForAddingToMatch(const Id &nodeInModel, const Id &nodeInRule);
+	/// Reports that an element of the model was created, removed or modified, so kept matches that may be
+	/// affected are searched again. Both logical and graphical ids are accepted.
+	void elementChanged(const Id &element);
 
-	/// Checks if node in model has all links to the current matched subgraph
-	/// as node in rule has
-	bool checkExistingLinks(const Id &nodeInModel, const Id &nodeInRule
-			, QHash<Id, Id> *linksToAddInMatch);
-
-	/// Performs a rollback in match algo, removes last added node to the current
-	/// matched subgraph.
-	void rollback();
-
-	/// Get link from node in rule which leads outside current matched graph
-	Id outsideLink(const Id &nodeInRule) const;
-
-	/// Get second link end
-	Id linkEndInModel(const Id &linkInModel, const Id &nodeInModel) const;
-	Id linkEndInRule(const Id &linkInRule, const Id &nodeInRule) const;
-
-	/// Returns link id in model which has one of its ends given node in model
-	/// and correspond to link in rule and its ends and
-	/// returns root id if it can not be found
-	Id properLink(const Id &nodeInModel, const Id &linkInRule
-			, const Id &linkEndInR) const;
+protected:
 
-	/// Get all links from given node in model which can correspond
-	/// given link in rule
-	IdList properLinks(const Id &nodeInModel, const Id &linkInRule) const;
+	/// Finds first element and starts checking process
+	bool virtual checkRuleMatching();
 
-	/// Get all links from given node in rule to current matched subgraph
-	IdList linksToMatchedSubgraph(const Id &nodeInRule) const;
+	/// Finds all matches of the rule that map start element to one of specified elements.
+	/// Takes snapshots of the rule and of the model first, so matching itself does not touch models.
+	bool checkRuleMatching(const IdList &elements);
 
 	/// Get all elements from active diagram
 	IdList elementsFromActiveDiagram() const;
@@ -90,6 +75,10 @@ protected:
 	/// Get first node from rule to start the algo
 	virtual Id startElement() const = 0;
 
+	/// Returns true if element in rule can be matched with elements of any type, so elements of the model
+	/// must not be bucketed by type for it.
+	virtual bool isTypeWildcard(const Id &elementInRule) const;
+
 	/// Indicates if checked rule has syntax errors
 	bool hasRuleSyntaxError();
 
@@ -145,20 +134,29 @@ protected:
 	/// List contains all matches of rule
 	QList<QHash<Id, Id> > mMatches;
 
-	/// Nodes of rule subgraph which matched model subgraph at current step
-	IdList mCurrentMatchedGraphInRule;
+	/// Set of properties that will not be checked in compare elements
+	QSet<QString> mDefaultProperties;
 
-	/// Nodes of model subgraph which matched model subgraph at current step
-	IdList mCurrentMatchedGraphInModel;
+private:
+	class IncrementalMatchingContext;
 
-	/// Nodes which have links
-	IdList mNodesHavingOutsideLinks;
+	/// Collects connected component of the rule containing start element. Returns false if rule has
+	/// unconnected links.
+	bool buildRuleSnapshot(const Id &startElement, GraphSnapshot &rule);
 
-	/// Current position in mNodesHavingOutsideLinks for quicker access
-	int mPos { -1 };
+	/// Collects given elements, elements of active diagram and everything reachable from them via links.
+	void buildModelSnapshot(const IdList &elements, GraphSnapshot &model) const;
 
-	/// Set of properties that will not be checked in compare elements
-	QSet<QString> mDefaultProperties;
+	/// Returns graphical id of the link if it has one.
+	Id graphicalLink(const Id &link) const;
+
+	bool mParallelMatching = false;
+
+	bool mIncrementalMatching = false;
+	QScopedPointer<IncrementalMatchingContext> mIncrementalMatchingContext;
+
+	/// Incremental matchers for rules, created on first search for a rule.
+	QHash<Id, QSharedPointer<IncrementalMatcher>> mIncrementalMatchers;
 };
 
 }
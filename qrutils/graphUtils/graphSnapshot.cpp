@@ -0,0 +1,83 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "graphSnapshot.h"
+
+using namespace qReal;
+
+int GraphSnapshot::addNode(const Id &id)
+{
+	const auto existing = mNodeIndices.constFind(id);
+	if (existing != mNodeIndices.constEnd()) {
+		return existing.value();
+	}
+
+	const int index = mNodes.size();
+	mNodes << id;
+	mNodeIndices.insert(id, index);
+	mOutEdges.append(QVector<int>());
+	mInEdges.append(QVector<int>());
+	return index;
+}
+
+int GraphSnapshot::addEdge(const Id &id, int from, int to)
+{
+	Q_ASSERT(from >= 0 && from < mNodes.size() && to >= 0 && to < mNodes.size());
+	const int index = mEdges.size();
+	mEdges << Edge{id, from, to};
+	mEdgeIndices.insert(id, index);
+	mOutEdges[from] << index;
+	mInEdges[to] << index;
+	return index;
+}
+
+int GraphSnapshot::nodeIndex(const Id &id) const
+{
+	return mNodeIndices.value(id, -1);
+}
+
+int GraphSnapshot::edgeIndex(const Id &id) const
+{
+	return mEdgeIndices.value(id, -1);
+}
+
+const Id &GraphSnapshot::node(int index) const
+{
+	return mNodes[index];
+}
+
+const GraphSnapshot::Edge &GraphSnapshot::edge(int index) const
+{
+	return mEdges[index];
+}
+
+int GraphSnapshot::nodesCount() const
+{
+	return mNodes.size();
+}
+
+int GraphSnapshot::edgesCount() const
+{
+	return mEdges.size();
+}
+
+const QVector<int> &GraphSnapshot::outEdges(int node) const
+{
+	return mOutEdges[node];
+}
+
+const QVector<int> &GraphSnapshot::inEdges(int node) const
+{
+	return mInEdges[node];
+}
@@ -0,0 +1,77 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QHash>
+#include <QtCore/QVector>
+
+#include <qrkernel/ids.h>
+
+#include "qrutils/utilsDeclSpec.h"
+
+namespace qReal {
+
+/// Immutable adjacency snapshot of a directed multigraph built from model elements. Nodes and edges get dense
+/// indices in order of addition, so graph algorithms may work with plain arrays instead of model queries.
+class QRUTILS_EXPORT GraphSnapshot
+{
+public:
+	/// Edge of a snapshot, ends are indices of nodes.
+	struct Edge
+	{
+		Id id;
+		int from;
+		int to;
+	};
+
+	/// Adds node with given id if it is not added yet.
+	/// @returns index of the node.
+	int addNode(const Id &id);
+
+	/// Adds edge between two already added nodes.
+	/// @returns index of the edge.
+	int addEdge(const Id &id, int from, int to);
+
+	/// Returns index of node with given id or -1 if there is no such node.
+	int nodeIndex(const Id &id) const;
+
+	/// Returns index of edge with given id or -1 if there is no such edge.
+	int edgeIndex(const Id &id) const;
+
+	/// Returns id of node with given index.
+	const Id &node(int index) const;
+
+	/// Returns edge with given index.
+	const Edge &edge(int index) const;
+
+	int nodesCount() const;
+	int edgesCount() const;
+
+	/// Returns indices of edges going from node with given index.
+	const QVector<int> &outEdges(int node) const;
+
+	/// Returns indices of edges going into node with given index.
+	const QVector<int> &inEdges(int node) const;
+
+private:
+	QVector<Id> mNodes;
+	QHash<Id, int> mNodeIndices;
+	QVector<Edge> mEdges;
+	QHash<Id, int> mEdgeIndices;
+	QVector<QVector<int>> mOutEdges;
+	QVector<QVector<int>> mInEdges;
+};
+
+}
@@ -16,8 +16,16 @@ HEADERS += \
 	$$PWD/baseGraphTransformationUnit.h \
 	$$PWD/tree.h \
 	$$PWD/deepFirstSearcher.h \
+	$$PWD/graphSnapshot.h \
+	$$PWD/subgraphMatcher.h \
+	$$PWD/incrementalMatcher.h \
 
 SOURCES += \
 	$$PWD/baseGraphTransformationUnit.cpp \
 	$$PWD/tree.cpp \
 	$$PWD/deepFirstSearcher.cpp \
+	$$PWD/graphSnapshot.cpp \
+	$$PWD/subgraphMatcher.cpp \
+	$$PWD/incrementalMatcher.cpp \
+
+QT += concurrent
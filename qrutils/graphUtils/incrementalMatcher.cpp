@@ -0,0 +1,319 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "incrementalMatcher.h"
+
+using namespace qReal;
+
+IncrementalMatcher::IncrementalMatcher(const GraphSnapshot &pattern, const Context &context)
+	: mPattern(pattern)
+	, mContext(context)
+	, mNodeMemory(pattern.nodesCount())
+	, mEdgeMemory(pattern.edgesCount())
+{
+	if (mPattern.nodesCount() == 0) {
+		return;
+	}
+
+	QVector<int> distances(mPattern.nodesCount(), -1);
+	QVector<int> queue = {0};
+	distances[0] = 0;
+	for (int head = 0; head < queue.size(); ++head) {
+		const int node = queue[head];
+		for (const QVector<int> *edges : { &mPattern.outEdges(node), &mPattern.inEdges(node) }) {
+			for (const int edge : *edges) {
+				const GraphSnapshot::Edge &patternEdge = mPattern.edge(edge);
+				const int other = patternEdge.from == node ? patternEdge.to : patternEdge.from;
+				if (distances[other] < 0) {
+					distances[other] = distances[node] + 1;
+					mRadius = qMax(mRadius, distances[other]);
+					queue << other;
+				}
+			}
+		}
+	}
+}
+
+void IncrementalMatcher::elementChanged(const Id &element)
+{
+	mChanged.insert(element);
+}
+
+void IncrementalMatcher::reset()
+{
+	for (QHash<Id, bool> &memory : mNodeMemory) {
+		memory.clear();
+	}
+
+	for (QHash<Id, bool> &memory : mEdgeMemory) {
+		memory.clear();
+	}
+
+	mMatches.clear();
+	mStartsByElement.clear();
+	mChanged.clear();
+}
+
+QList<SubgraphMatcher::Match> IncrementalMatcher::matches(const IdList &startElements)
+{
+	processChanges();
+
+	IdList starts;
+	IdList missing;
+	QSet<Id> seen;
+	for (const Id &start : startElements) {
+		if (!seen.contains(start)) {
+			seen.insert(start);
+			starts << start;
+			if (!mMatches.contains(start)) {
+				missing << start;
+			}
+		}
+	}
+
+	if (!missing.isEmpty()) {
+		search(missing);
+	}
+
+	QList<SubgraphMatcher::Match> result;
+	for (const Id &start : starts) {
+		result << mMatches.value(start);
+	}
+
+	return result;
+}
+
+int IncrementalMatcher::searchedStarts() const
+{
+	return mSearchedStarts;
+}
+
+void IncrementalMatcher::processChanges()
+{
+	if (mChanged.isEmpty()) {
+		return;
+	}
+
+	IdList affectedNodes;
+	for (const Id &element : mChanged) {
+		for (QHash<Id, bool> &memory : mNodeMemory) {
+			memory.remove(element);
+		}
+
+		for (QHash<Id, bool> &memory : mEdgeMemory) {
+			memory.remove(element);
+		}
+
+		const QSet<Id> starts = mStartsByElement.value(element);
+		for (const Id &start : starts) {
+			forgetStart(start);
+		}
+
+		// For links the nodes they connect now are affected, removed elements have no ends and no links.
+		const Id from = mContext.linkFrom(element);
+		const Id to = mContext.linkTo(element);
+		if (from == Id::rootId() && to == Id::rootId()) {
+			affectedNodes << element;
+		} else {
+			affectedNodes << from << to;
+		}
+	}
+
+	mChanged.clear();
+
+	// New matches contain some changed element, so their start elements are not farther than the radius from it.
+	QSet<Id> visited;
+	IdList layer;
+	for (const Id &node : affectedNodes) {
+		if (node != Id::rootId() && !visited.contains(node)) {
+			visited.insert(node);
+			layer << node;
+		}
+	}
+
+	for (int depth = 0; depth < mRadius && !layer.isEmpty(); ++depth) {
+		IdList nextLayer;
+		for (const Id &node : layer) {
+			for (const Id &link : mContext.links(node)) {
+				for (const Id &end : { mContext.linkFrom(link), mContext.linkTo(link) }) {
+					if (end != Id::rootId() && !visited.contains(end)) {
+						visited.insert(end);
+						nextLayer << end;
+					}
+				}
+			}
+		}
+
+		layer = nextLayer;
+	}
+
+	for (const Id &node : visited) {
+		forgetStart(node);
+	}
+}
+
+void IncrementalMatcher::forgetStart(const Id &start)
+{
+	const auto matches = mMatches.find(start);
+	if (matches == mMatches.end()) {
+		return;
+	}
+
+	for (const SubgraphMatcher::Match &match : matches.value()) {
+		for (const Id &element : match) {
+			const auto starts = mStartsByElement.find(element);
+			if (starts != mStartsByElement.end()) {
+				starts->remove(start);
+				if (starts->isEmpty()) {
+					mStartsByElement.erase(starts);
+				}
+			}
+		}
+	}
+
+	mMatches.erase(matches);
+}
+
+void IncrementalMatcher::search(const IdList &starts)
+{
+	mSearchedStarts += starts.size();
+	for (const Id &start : starts) {
+		mMatches.insert(start, {});
+	}
+
+	if (mPattern.nodesCount() == 0) {
+		return;
+	}
+
+	GraphSnapshot model;
+	buildNeighbourhood(starts, model);
+
+	SubgraphMatcher matcher(mPattern, model);
+	QVector<int> startCandidates;
+	for (const Id &start : starts) {
+		const int node = model.nodeIndex(start);
+		if (node >= 0 && isNodeCompatible(start, 0)) {
+			startCandidates << node;
+		}
+	}
+
+	if (startCandidates.isEmpty()) {
+		return;
+	}
+
+	matcher.setNodeCandidates(0, startCandidates);
+	for (int patternNode = 1; patternNode < mPattern.nodesCount(); ++patternNode) {
+		QVector<int> candidates;
+		if (matcher.isMatched(patternNode)) {
+			for (int node = 0; node < model.nodesCount(); ++node) {
+				if (isNodeCompatible(model.node(node), patternNode)) {
+					candidates << node;
+				}
+			}
+		}
+
+		matcher.setNodeCandidates(patternNode, candidates);
+	}
+
+	for (int patternEdge = 0; patternEdge < mPattern.edgesCount(); ++patternEdge) {
+		QVector<int> candidates;
+		for (int edge = 0; edge < model.edgesCount(); ++edge) {
+			if (isEdgeCompatible(model.edge(edge).id, patternEdge)) {
+				candidates << edge;
+			}
+		}
+
+		matcher.setEdgeCandidates(patternEdge, candidates);
+	}
+
+	const Id patternStart = mPattern.node(0);
+	for (const SubgraphMatcher::Match &match : matcher.findAll()) {
+		const Id start = match.value(patternStart);
+		mMatches[start] << match;
+		for (const Id &element : match) {
+			mStartsByElement[element].insert(start);
+		}
+	}
+}
+
+void IncrementalMatcher::buildNeighbourhood(const IdList &starts, GraphSnapshot &model) const
+{
+	for (const Id &start : starts) {
+		if (mContext.linkFrom(start) == Id::rootId() && mContext.linkTo(start) == Id::rootId()) {
+			model.addNode(start);
+		}
+	}
+
+	QVector<int> depths(model.nodesCount(), 0);
+	for (int node = 0; node < model.nodesCount(); ++node) {
+		const int depth = depths[node];
+		for (const Id &link : mContext.links(model.node(node))) {
+			if (model.edgeIndex(link) >= 0) {
+				continue;
+			}
+
+			const Id from = mContext.linkFrom(link);
+			const Id to = mContext.linkTo(link);
+			if (from == Id::rootId() || to == Id::rootId()) {
+				continue;
+			}
+
+			if (depth >= mRadius) {
+				// On the border only links between already collected nodes are needed.
+				const int fromIndex = model.nodeIndex(from);
+				const int toIndex = model.nodeIndex(to);
+				if (fromIndex >= 0 && toIndex >= 0) {
+					model.addEdge(link, fromIndex, toIndex);
+				}
+
+				continue;
+			}
+
+			const int fromIndex = model.addNode(from);
+			const int toIndex = model.addNode(to);
+			while (depths.size() < model.nodesCount()) {
+				depths << depth + 1;
+			}
+
+			model.addEdge(link, fromIndex, toIndex);
+		}
+	}
+}
+
+bool IncrementalMatcher::isNodeCompatible(const Id &modelNode, int patternNode)
+{
+	QHash<Id, bool> &memory = mNodeMemory[patternNode];
+	const auto known = memory.constFind(modelNode);
+	if (known != memory.constEnd()) {
+		return known.value();
+	}
+
+	const bool result = mContext.isNodeCompatible(modelNode, mPattern.node(patternNode));
+	memory.insert(modelNode, result);
+	return result;
+}
+
+bool IncrementalMatcher::isEdgeCompatible(const Id &modelLink, int patternEdge)
+{
+	QHash<Id, bool> &memory = mEdgeMemory[patternEdge];
+	const auto known = memory.constFind(modelLink);
+	if (known != memory.constEnd()) {
+		return known.value();
+	}
+
+	const bool result = mContext.isEdgeCompatible(modelLink, mPattern.edge(patternEdge).id);
+	memory.insert(modelLink, result);
+	return result;
+}
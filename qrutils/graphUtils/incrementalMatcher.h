@@ -0,0 +1,117 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QSet>
+
+#include "qrutils/utilsDeclSpec.h"
+#include "qrutils/graphUtils/graphSnapshot.h"
+#include "qrutils/graphUtils/subgraphMatcher.h"
+
+namespace qReal {
+
+/// Keeps all matches of one pattern in a changing model and updates them after changes instead of searching
+/// the whole model again, in the spirit of Rete networks. Compatibility of model elements with every pattern
+/// element is memorized (alpha memories), found matches are memorized per model element the first pattern node
+/// is mapped to (beta memories) together with a reverse index from model elements to matches containing them.
+///
+/// The model is not observed directly: every created, removed or modified element must be reported with
+/// elementChanged(). Then matches containing changed elements are dropped and matches are searched again only
+/// for start elements within the pattern radius from changed ones, on a snapshot of this neighbourhood.
+/// Any match that appeared or disappeared because of a change contains a changed element, and all elements of
+/// a match lie within the radius from its start element, so nothing else can be affected.
+class QRUTILS_EXPORT IncrementalMatcher
+{
+public:
+	/// Provides the model graph and compatibility of its elements with pattern elements.
+	class Context
+	{
+	public:
+		virtual ~Context() = default;
+
+		/// Returns ids of links incident to the given model node, each link must be reported with the same id
+		/// from both of its ends.
+		virtual IdList links(const Id &node) const = 0;
+
+		/// Returns a node the given link goes from or root id if the link is hanging.
+		virtual Id linkFrom(const Id &link) const = 0;
+
+		/// Returns a node the given link goes to or root id if the link is hanging.
+		virtual Id linkTo(const Id &link) const = 0;
+
+		/// Returns true if the model node can be matched with the pattern node.
+		virtual bool isNodeCompatible(const Id &modelNode, const Id &patternNode) const = 0;
+
+		/// Returns true if the model link can be matched with the pattern link.
+		virtual bool isEdgeCompatible(const Id &modelLink, const Id &patternLink) const = 0;
+	};
+
+	/// Constructor. Matches are anchored at the first node of \a pattern. Context must outlive the matcher.
+	IncrementalMatcher(const GraphSnapshot &pattern, const Context &context);
+
+	/// Reports that the element was created, removed or modified, including changes of link ends and of
+	/// anything compatibility of the element depends on.
+	void elementChanged(const Id &element);
+
+	/// Forgets everything memorized, for example when the model was modified without notifications.
+	void reset();
+
+	/// Returns all matches that map the first pattern node to one of \a startElements, grouped by start elements
+	/// in the given order. Memorized matches are reused, the rest is searched for.
+	QList<SubgraphMatcher::Match> matches(const IdList &startElements);
+
+	/// Returns how many start elements were searched for matches since construction, for diagnostics.
+	int searchedStarts() const;
+
+private:
+	/// Drops memorized data affected by changes reported since the last call.
+	void processChanges();
+
+	/// Drops matches of the given start element and their entries in the reverse index.
+	void forgetStart(const Id &start);
+
+	/// Searches and memorizes matches for given start elements.
+	void search(const IdList &starts);
+
+	/// Collects nodes and links within the pattern radius from \a starts, which go first.
+	void buildNeighbourhood(const IdList &starts, GraphSnapshot &model) const;
+
+	bool isNodeCompatible(const Id &modelNode, int patternNode);
+	bool isEdgeCompatible(const Id &modelLink, int patternEdge);
+
+	const GraphSnapshot mPattern;
+	const Context &mContext;
+
+	/// Largest distance from the first pattern node to other pattern nodes, ignoring link directions.
+	int mRadius = 0;
+
+	/// Alpha memories: compatibility of model elements with each pattern node and link.
+	QVector<QHash<Id, bool>> mNodeMemory;
+	QVector<QHash<Id, bool>> mEdgeMemory;
+
+	/// Beta memory: matches for each start element searched so far, possibly empty.
+	QHash<Id, QList<SubgraphMatcher::Match>> mMatches;
+
+	/// Start elements of memorized matches containing a model element.
+	QHash<Id, QSet<Id>> mStartsByElement;
+
+	/// Elements changed since the last call of matches().
+	QSet<Id> mChanged;
+
+	int mSearchedStarts = 0;
+};
+
+}
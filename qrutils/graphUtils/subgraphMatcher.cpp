@@ -0,0 +1,309 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "subgraphMatcher.h"
+
+#include <QtCore/QThread>
+#include <QtConcurrent/QtConcurrentRun>
+
+using namespace qReal;
+
+SubgraphMatcher::SubgraphMatcher(const GraphSnapshot &pattern, const GraphSnapshot &target)
+	: mPattern(pattern)
+	, mTarget(target)
+	, mNodeCompatible(pattern.nodesCount(), QVector<bool>(target.nodesCount(), false))
+	, mNodeCandidates(pattern.nodesCount())
+	, mEdgeCompatible(pattern.edgesCount(), QVector<bool>(target.edgesCount(), false))
+	, mPosition(pattern.nodesCount(), -1)
+	, mPatternOutDegree(pattern.nodesCount(), 0)
+	, mPatternInDegree(pattern.nodesCount(), 0)
+{
+	if (mPattern.nodesCount() == 0) {
+		return;
+	}
+
+	// Breadth-first order guarantees that every node except the first one has an already matched neighbour,
+	// so its candidates can be taken from the neighbourhood of the matched subgraph.
+	mOrder << 0;
+	mPosition[0] = 0;
+	mParentEdge << -1;
+	for (int head = 0; head < mOrder.size(); ++head) {
+		const int node = mOrder[head];
+		for (const QVector<int> *edges : { &mPattern.outEdges(node), &mPattern.inEdges(node) }) {
+			for (const int edge : *edges) {
+				const GraphSnapshot::Edge &patternEdge = mPattern.edge(edge);
+				const int other = patternEdge.from == node ? patternEdge.to : patternEdge.from;
+				if (mPosition[other] < 0) {
+					mPosition[other] = mOrder.size();
+					mOrder << other;
+					mParentEdge << edge;
+				}
+			}
+		}
+	}
+
+	mBackEdges.resize(mOrder.size());
+	for (int edge = 0; edge < mPattern.edgesCount(); ++edge) {
+		const GraphSnapshot::Edge &patternEdge = mPattern.edge(edge);
+		const int fromPosition = mPosition[patternEdge.from];
+		const int toPosition = mPosition[patternEdge.to];
+		if (fromPosition < 0 || toPosition < 0) {
+			continue;
+		}
+
+		mBackEdges[qMax(fromPosition, toPosition)] << edge;
+		++mPatternOutDegree[patternEdge.from];
+		++mPatternInDegree[patternEdge.to];
+	}
+}
+
+void SubgraphMatcher::setNodeCandidates(int patternNode, const QVector<int> &targetNodes)
+{
+	QVector<bool> &compatible = mNodeCompatible[patternNode];
+	compatible.fill(false);
+	for (const int node : targetNodes) {
+		compatible[node] = true;
+	}
+
+	mNodeCandidates[patternNode] = targetNodes;
+}
+
+void SubgraphMatcher::setEdgeCandidates(int patternEdge, const QVector<int> &targetEdges)
+{
+	QVector<bool> &compatible = mEdgeCompatible[patternEdge];
+	compatible.fill(false);
+	for (const int edge : targetEdges) {
+		compatible[edge] = true;
+	}
+}
+
+bool SubgraphMatcher::isMatched(int patternNode) const
+{
+	return mPosition[patternNode] >= 0;
+}
+
+QList<SubgraphMatcher::Match> SubgraphMatcher::findAll(bool parallel) const
+{
+	if (mOrder.isEmpty()) {
+		return {};
+	}
+
+	QVector<int> roots;
+	State emptyState;
+	emptyState.nodeMap.fill(-1, mPattern.nodesCount());
+	emptyState.edgeMap.fill(-1, mPattern.edgesCount());
+	emptyState.usedNodes.fill(false, mTarget.nodesCount());
+	emptyState.usedEdges.fill(false, mTarget.edgesCount());
+	for (const int root : mNodeCandidates[mOrder.first()]) {
+		if (isFeasible(mOrder.first(), root, emptyState)) {
+			roots << root;
+		}
+	}
+
+	const int threads = qMin(QThread::idealThreadCount(), roots.size());
+	if (!parallel || threads < 2) {
+		return searchFrom(roots);
+	}
+
+	// Splitting roots into contiguous chunks keeps the order of matches the same as in sequential search.
+	QList<QFuture<QList<Match>>> futures;
+	const int chunkSize = (roots.size() + threads - 1) / threads;
+	for (int start = 0; start < roots.size(); start += chunkSize) {
+		const QVector<int> chunk = roots.mid(start, chunkSize);
+		futures << QtConcurrent::run([this, chunk]() { return searchFrom(chunk); });
+	}
+
+	QList<Match> result;
+	for (QFuture<QList<Match>> &future : futures) {
+		result << future.result();
+	}
+
+	return result;
+}
+
+QList<SubgraphMatcher::Match> SubgraphMatcher::searchFrom(const QVector<int> &roots) const
+{
+	QList<Match> result;
+	State state;
+	state.nodeMap.fill(-1, mPattern.nodesCount());
+	state.edgeMap.fill(-1, mPattern.edgesCount());
+	state.usedNodes.fill(false, mTarget.nodesCount());
+	state.usedEdges.fill(false, mTarget.edgesCount());
+
+	const int first = mOrder.first();
+	for (const int root : roots) {
+		QVector<int> assigned;
+		state.nodeMap[first] = root;
+		state.usedNodes[root] = true;
+		if (assignEdges(0, state, assigned)) {
+			search(1, state, result);
+		}
+
+		releaseEdges(state, assigned);
+		state.usedNodes[root] = false;
+		state.nodeMap[first] = -1;
+	}
+
+	return result;
+}
+
+void SubgraphMatcher::search(int depth, State &state, QList<Match> &result) const
+{
+	if (depth == mOrder.size()) {
+		Match match;
+		for (const int node : mOrder) {
+			match.insert(mPattern.node(node), mTarget.node(state.nodeMap[node]));
+		}
+
+		for (int edge = 0; edge < mPattern.edgesCount(); ++edge) {
+			if (state.edgeMap[edge] >= 0) {
+				match.insert(mPattern.edge(edge).id, mTarget.edge(state.edgeMap[edge]).id);
+			}
+		}
+
+		result << match;
+		return;
+	}
+
+	const int patternNode = mOrder[depth];
+	for (const int targetNode : candidates(depth, state)) {
+		if (!isFeasible(patternNode, targetNode, state)) {
+			continue;
+		}
+
+		QVector<int> assigned;
+		state.nodeMap[patternNode] = targetNode;
+		state.usedNodes[targetNode] = true;
+		if (assignEdges(depth, state, assigned)) {
+			search(depth + 1, state, result);
+		}
+
+		releaseEdges(state, assigned);
+		state.usedNodes[targetNode] = false;
+		state.nodeMap[patternNode] = -1;
+	}
+}
+
+QVector<int> SubgraphMatcher::candidates(int depth, const State &state) const
+{
+	// Candidates are the ends of compatible target edges adjacent to the image of already matched neighbour.
+	const int parentEdge = mParentEdge[depth];
+	const GraphSnapshot::Edge &patternEdge = mPattern.edge(parentEdge);
+	const bool forward = patternEdge.to == mOrder[depth];
+	const int parentImage = state.nodeMap[forward ? patternEdge.from : patternEdge.to];
+	const QVector<int> &targetEdges = forward ? mTarget.outEdges(parentImage) : mTarget.inEdges(parentImage);
+
+	QVector<int> result;
+	for (const int edge : targetEdges) {
+		if (state.usedEdges[edge] || !mEdgeCompatible[parentEdge][edge]) {
+			continue;
+		}
+
+		const int candidate = forward ? mTarget.edge(edge).to : mTarget.edge(edge).from;
+		if (!result.contains(candidate)) {
+			result << candidate;
+		}
+	}
+
+	return result;
+}
+
+bool SubgraphMatcher::isFeasible(int patternNode, int targetNode, const State &state) const
+{
+	if (state.usedNodes[targetNode] || !mNodeCompatible[patternNode][targetNode]) {
+		return false;
+	}
+
+	if (mTarget.outEdges(targetNode).size() < mPatternOutDegree[patternNode]
+			|| mTarget.inEdges(targetNode).size() < mPatternInDegree[patternNode]) {
+		return false;
+	}
+
+	// Look-ahead rule: unmatched neighbours of pattern node must fit into free neighbours of target node.
+	return unmatchedNeighbours(patternNode, state) <= freeNeighbours(targetNode, state);
+}
+
+int SubgraphMatcher::unmatchedNeighbours(int patternNode, const State &state) const
+{
+	int result = 0;
+	for (const int edge : mPattern.outEdges(patternNode)) {
+		const int other = mPattern.edge(edge).to;
+		result += other != patternNode && mPosition[other] >= 0 && state.nodeMap[other] < 0 ? 1 : 0;
+	}
+
+	for (const int edge : mPattern.inEdges(patternNode)) {
+		const int other = mPattern.edge(edge).from;
+		result += other != patternNode && mPosition[other] >= 0 && state.nodeMap[other] < 0 ? 1 : 0;
+	}
+
+	return result;
+}
+
+int SubgraphMatcher::freeNeighbours(int targetNode, const State &state) const
+{
+	int result = 0;
+	for (const int edge : mTarget.outEdges(targetNode)) {
+		const int other = mTarget.edge(edge).to;
+		result += other != targetNode && !state.usedNodes[other] ? 1 : 0;
+	}
+
+	for (const int edge : mTarget.inEdges(targetNode)) {
+		const int other = mTarget.edge(edge).from;
+		result += other != targetNode && !state.usedNodes[other] ? 1 : 0;
+	}
+
+	return result;
+}
+
+bool SubgraphMatcher::assignEdges(int depth, State &state, QVector<int> &assigned) const
+{
+	const QVector<int> &edges = mBackEdges[depth];
+	if (assigned.size() == edges.size()) {
+		return true;
+	}
+
+	// Parallel edges may be compatible with different pattern edges, so taking the first compatible one
+	// for each pattern edge is not enough, other choices are tried if the rest of edges can not be assigned.
+	const int patternEdge = edges[assigned.size()];
+	const GraphSnapshot::Edge &edge = mPattern.edge(patternEdge);
+	const int from = state.nodeMap[edge.from];
+	const int to = state.nodeMap[edge.to];
+	for (const int targetEdge : mTarget.outEdges(from)) {
+		if (mTarget.edge(targetEdge).to != to || state.usedEdges[targetEdge]
+				|| !mEdgeCompatible[patternEdge][targetEdge]) {
+			continue;
+		}
+
+		state.edgeMap[patternEdge] = targetEdge;
+		state.usedEdges[targetEdge] = true;
+		assigned << patternEdge;
+		if (assignEdges(depth, state, assigned)) {
+			return true;
+		}
+
+		assigned.removeLast();
+		state.usedEdges[targetEdge] = false;
+		state.edgeMap[patternEdge] = -1;
+	}
+
+	return false;
+}
+
+void SubgraphMatcher::releaseEdges(State &state, const QVector<int> &assigned) const
+{
+	for (const int patternEdge : assigned) {
+		state.usedEdges[state.edgeMap[patternEdge]] = false;
+		state.edgeMap[patternEdge] = -1;
+	}
+}
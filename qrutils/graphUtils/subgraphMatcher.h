@@ -0,0 +1,98 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QList>
+
+#include "qrutils/utilsDeclSpec.h"
+#include "qrutils/graphUtils/graphSnapshot.h"
+
+namespace qReal {
+
+/// Finds all injective embeddings of a pattern graph into a target graph, VF2-style: pattern nodes are matched
+/// one by one in breadth-first order from the first pattern node, candidates for the next node are taken from
+/// the neighbourhood of already matched nodes and pruned by degree and look-ahead feasibility rules.
+/// Compatibility of elements is not checked here, it must be precomputed and given as candidate sets,
+/// so the matcher works only with immutable snapshots and may enumerate matches in parallel.
+/// Only the connected component of the first pattern node is matched. For each mapping of nodes one consistent
+/// mapping of edges is reported, even if parallel edges allow several.
+class QRUTILS_EXPORT SubgraphMatcher
+{
+public:
+	/// Match map: key - id in pattern, value - id in target. Contains both nodes and edges.
+	typedef QHash<Id, Id> Match;
+
+	/// Constructor. Snapshots must outlive the matcher. By default no element is compatible with any other.
+	SubgraphMatcher(const GraphSnapshot &pattern, const GraphSnapshot &target);
+
+	/// Sets target nodes that can be matched with given pattern node.
+	void setNodeCandidates(int patternNode, const QVector<int> &targetNodes);
+
+	/// Sets target edges that can be matched with given pattern edge.
+	void setEdgeCandidates(int patternEdge, const QVector<int> &targetEdges);
+
+	/// Returns true if pattern node with given index will take part in matching, i.e. is connected with
+	/// the first pattern node.
+	bool isMatched(int patternNode) const;
+
+	/// Enumerates all matches. If \a parallel is true, search subtrees for different candidates of the first
+	/// pattern node are explored in separate threads. Resulting matches are always ordered the same way.
+	QList<Match> findAll(bool parallel = false) const;
+
+private:
+	struct State
+	{
+		QVector<int> nodeMap;
+		QVector<bool> usedNodes;
+		QVector<bool> usedEdges;
+		QVector<int> edgeMap;
+	};
+
+	void search(int depth, State &state, QList<Match> &result) const;
+	QVector<int> candidates(int depth, const State &state) const;
+	bool isFeasible(int patternNode, int targetNode, const State &state) const;
+	/// Maps back edges of the node at given depth to target edges, trying other parallel target edges if some
+	/// pattern edge gets no compatible one. On failure leaves no edges assigned.
+	bool assignEdges(int depth, State &state, QVector<int> &assigned) const;
+	void releaseEdges(State &state, const QVector<int> &assigned) const;
+	QList<Match> searchFrom(const QVector<int> &roots) const;
+	int unmatchedNeighbours(int patternNode, const State &state) const;
+	int freeNeighbours(int targetNode, const State &state) const;
+
+	const GraphSnapshot &mPattern;
+	const GraphSnapshot &mTarget;
+
+	QVector<QVector<bool>> mNodeCompatible;
+	QVector<QVector<int>> mNodeCandidates;
+	QVector<QVector<bool>> mEdgeCompatible;
+
+	/// Pattern nodes in matching order.
+	QVector<int> mOrder;
+
+	/// Position of pattern node in mOrder, -1 for nodes not connected with the first one.
+	QVector<int> mPosition;
+
+	/// For each position in mOrder except the first, pattern edge that connects node with an earlier one.
+	QVector<int> mParentEdge;
+
+	/// For each position in mOrder, pattern edges that connect node with itself or with earlier nodes.
+	QVector<QVector<int>> mBackEdges;
+
+	/// Degrees of pattern nodes counted inside matched component.
+	QVector<int> mPatternOutDegree;
+	QVector<int> mPatternInDegree;
+};
+
+}
@@ -17,7 +17,7 @@
 #include <QtWidgets/QApplication>
 #include <QtCore/QTimer>
 
-#include <qrkernel/settingsManager.h>
+#include <qrkernel/settingsKey.h>
 
 #include <qrutils/interpreter/blocks/receiveThreadMessageBlock.h>
 #include <qrutils/interpreter/blocks/subprogramBlock.h>
@@ -26,6 +26,8 @@
 using namespace qReal;
 using namespace interpretation;
 
+static const SettingsKey<int> interpreterStackSize("interpreterStackSize");
+
 const int blocksCountTillProcessingEvents = 100;
 
 Thread::Thread(const GraphicalModelAssistInterface *graphicalModelApi
@@ -118,7 +120,7 @@ void Thread::stepInto(const Id &diagram)
 		return;
 	}
 
-	if (mStack.count() >= SettingsManager::value("interpreterStackSize").toInt()) {
+	if (mStack.count() >= interpreterStackSize.value()) {
 		error(tr("Stack overflow"));
 		return;
 	}
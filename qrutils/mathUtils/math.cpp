@@ -16,10 +16,12 @@
 
 #include <QtCore/qmath.h>
 
-#include <qrkernel/settingsManager.h>
+#include <qrkernel/settingsKey.h>
 
 using namespace mathUtils;
 
+static const qReal::SettingsKey<int> approximationLevelKey("approximationLevel", 12);
+
 int Math::sign(qreal x, qreal eps)
 {
 	return x > eps ? 1 : (x < -eps? -1 : 0);
@@ -66,7 +68,7 @@ qreal Math::gaussianNoise(qreal variance)
 	const qreal mu = 0.5;
 	const qreal var = 0.083; // 1/12
 
-	const int approximationLevel = qReal::SettingsManager::value("approximationLevel", 12).toInt();
+	const int approximationLevel = approximationLevelKey.value();
 
 	qreal result = 0.0;
 	for (int i = 0; i < approximationLevel; ++i) {
@@ -17,6 +17,7 @@ HEADERS += \
 	$$PWD/utilsDeclSpec.h \
 	$$PWD/xmlUtils.h \
 	$$PWD/watchListWindow.h \
+	$$PWD/watchListModel.h \
 	$$PWD/metamodelGeneratorSupport.h \
 	$$PWD/inFile.h \
 	$$PWD/scalableItem.h \
@@ -34,11 +35,13 @@ HEADERS += \
 	$$PWD/widgetFinder.h \
 	$$PWD/singleton.h \
 	$$PWD/imagesCache.h \
+	$$PWD/blobStore.h \
 
 SOURCES += \
 	$$PWD/outFile.cpp \
 	$$PWD/xmlUtils.cpp \
 	$$PWD/watchListWindow.cpp\
+	$$PWD/watchListModel.cpp \
 	$$PWD/metamodelGeneratorSupport.cpp \
 	$$PWD/inFile.cpp \
 	$$PWD/scalableItem.cpp \
@@ -53,6 +56,7 @@ SOURCES += \
 	$$PWD/generator/abstractGenerator.cpp \
 	$$PWD/widgetFinder.cpp \
 	$$PWD/imagesCache.cpp \
+	$$PWD/blobStore.cpp \
 
 FORMS += \
 	$$PWD/watchListWindow.ui
@@ -0,0 +1,114 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "watchListModel.h"
+
+#include <QtCore/QCoreApplication>
+
+using namespace utils;
+
+WatchListModel::WatchListModel(QObject *parent)
+	: QAbstractTableModel(parent)
+{
+}
+
+int WatchListModel::rowCount(const QModelIndex &parent) const
+{
+	return parent.isValid() ? 0 : mIdentifiers.size();
+}
+
+int WatchListModel::columnCount(const QModelIndex &parent) const
+{
+	return parent.isValid() ? 0 : 2;
+}
+
+QVariant WatchListModel::data(const QModelIndex &index, int role) const
+{
+	if (!index.isValid() || index.row() >= mIdentifiers.size()) {
+		return QVariant();
+	}
+
+	switch (role) {
+	case Qt::DisplayRole:
+	case Qt::ToolTipRole:
+		return index.column() == 0 ? mIdentifiers[index.row()] : mValues[index.row()];
+	case Qt::FontRole:
+		return mFont;
+	default:
+		return QVariant();
+	}
+}
+
+QVariant WatchListModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+	if (orientation != Qt::Horizontal || role != Qt::DisplayRole) {
+		return QAbstractTableModel::headerData(section, orientation, role);
+	}
+
+	// Translations of headers are kept from times when they were defined in watchListWindow.ui.
+	return section == 0
+			? QCoreApplication::translate("watchListWindow", "Name")
+			: QCoreApplication::translate("watchListWindow", "Value");
+}
+
+QStringList WatchListModel::identifiers() const
+{
+	return mIdentifiers;
+}
+
+void WatchListModel::setRows(const QStringList &identifiers, const QStringList &values)
+{
+	const int oldCount = mIdentifiers.size();
+	const int newCount = identifiers.size();
+	if (newCount > oldCount) {
+		beginInsertRows(QModelIndex(), oldCount, newCount - 1);
+	} else if (newCount < oldCount) {
+		beginRemoveRows(QModelIndex(), newCount, oldCount - 1);
+	}
+
+	mIdentifiers = identifiers;
+	mValues = values;
+	mRows.clear();
+	for (int row = 0; row < newCount; ++row) {
+		mRows.insert(mIdentifiers[row], row);
+	}
+
+	if (newCount > oldCount) {
+		endInsertRows();
+	} else if (newCount < oldCount) {
+		endRemoveRows();
+	}
+
+	const int reusedCount = qMin(oldCount, newCount);
+	if (reusedCount > 0) {
+		emit dataChanged(index(0, 0), index(reusedCount - 1, 1));
+	}
+}
+
+void WatchListModel::setValue(const QString &identifier, const QString &value)
+{
+	const auto row = mRows.constFind(identifier);
+	if (row == mRows.constEnd() || mValues[row.value()] == value) {
+		return;
+	}
+
+	mValues[row.value()] = value;
+	const QModelIndex cell = index(row.value(), 1);
+	emit dataChanged(cell, cell);
+}
+
+void WatchListModel::setFont(const QFont &font)
+{
+	mFont = font;
+}
@@ -0,0 +1,63 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QAbstractTableModel>
+#include <QtCore/QHash>
+#include <QtCore/QStringList>
+#include <QtGui/QFont>
+
+#include "utilsDeclSpec.h"
+
+namespace utils {
+
+/// Model of the watch list: names of identifiers in the first column and their values in the second one.
+/// Rows are updated in place, so a view repaints only cells that really changed.
+class QRUTILS_EXPORT WatchListModel : public QAbstractTableModel
+{
+	Q_OBJECT
+
+public:
+	explicit WatchListModel(QObject *parent = nullptr);
+
+	int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+	int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+	QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+	QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+	/// Returns identifiers in order of rows.
+	QStringList identifiers() const;
+
+	/// Shows given \a identifiers with corresponding \a values, rows that already exist are reused.
+	void setRows(const QStringList &identifiers, const QStringList &values);
+
+	/// Updates value of \a identifier, does nothing if it is not shown or its value is the same.
+	void setValue(const QString &identifier, const QString &value);
+
+	/// Sets font used for all cells instead of the font of a view.
+	void setFont(const QFont &font);
+
+private:
+	QStringList mIdentifiers;
+	QStringList mValues;
+
+	/// Maps shown identifier to its row.
+	QHash<QString, int> mRows;
+
+	/// Font of cells, null if the font of a view shall be used.
+	QVariant mFont;
+};
+
+}
@@ -39,9 +39,10 @@ WatchListWindow::WatchListWindow(const utils::ExpressionsParser * const parser
 	, mParser(parser)
 {
 	mUi->setupUi(this);
+	mUi->watchListTableView->setModel(&mModel);
 	connect(&mTimer, &QTimer::timeout, this, &WatchListWindow::updateVariables);
 	mTimer.start(watchWindowRefreshInterval);
-	connect(mUi->watchListTableWidget, &QTableWidget::cellClicked, &focusAction(), &QAction::trigger);
+	connect(mUi->watchListTableView, &QTableView::clicked, &focusAction(), &QAction::trigger);
 }
 
 WatchListWindow::~WatchListWindow()
@@ -52,50 +53,82 @@ WatchListWindow::~WatchListWindow()
 
 void WatchListWindow::updateVariables()
 {
-	int row = 0;
-
-	std::function<QStringList()> identifiers;
-	std::function<QVariant(const QString &)> value;
+	if (!isVisible()) {
+		// Nothing is lost, changes are collected by the interpreter and will be shown when the window appears.
+		return;
+	}
 
 	if (!mNewParser) {
-		identifiers = [this] () { return mParser->variables().keys(); };
-		value = [this] (const QString &name) { return mParser->variables().value(name)->value(); };
-	} else {
-		identifiers = [this] () { return mNewParser->identifiers(); };
-		value = [this] (const QString &name) { return mNewParser->value<QVariant>(name); };
+		// Old parser does not track changes, so everything is refreshed each time.
+		auto sortedIdentifiers = mParser->variables().keys();
+		std::sort(sortedIdentifiers.begin(), sortedIdentifiers.end());
+		fillRows(sortedIdentifiers, [this] (const QString &name) { return mParser->variables().value(name)->value(); });
+		return;
+	}
+
+	if (!updateIdentifiers()) {
+		updateChangedValues();
+	}
+}
+
+bool WatchListWindow::updateIdentifiers()
+{
+	const quint64 identifiersRevision = mNewParser->identifiersRevision();
+	if (!mIdentifiersDirty && identifiersRevision == mIdentifiersRevision) {
+		return false;
 	}
 
-	auto sortedIdentifiers = identifiers();
+	mIdentifiersDirty = false;
+	mIdentifiersRevision = identifiersRevision;
+	auto sortedIdentifiers = mNewParser->identifiers();
 	std::sort(sortedIdentifiers.begin(), sortedIdentifiers.end());
-	auto f = mUi->watchListTableWidget->font();
-	bool ok;
-	auto fontSize = qReal::SettingsManager::value("CustomDockTextSize").toInt(&ok);
-	if (ok) {
-		f.setPointSize(fontSize);
+	if (sortedIdentifiers == mShownIdentifiers) {
+		return false;
 	}
 
-	for (auto &&identifier : sortedIdentifiers) {
-		if (mHiddenVariables.contains(identifier)) {
-			continue;
-		}
+	mValuesRevision = mNewParser->valuesRevision();
+	fillRows(sortedIdentifiers, [this] (const QString &name) { return mNewParser->value<QVariant>(name); });
+	return true;
+}
 
-		if (row >= mUi->watchListTableWidget->rowCount()) {
-			mUi->watchListTableWidget->insertRow(row);
-			mUi->watchListTableWidget->setItem(row, 0, new QTableWidgetItem());
-			mUi->watchListTableWidget->setItem(row, 1, new QTableWidgetItem());
-			mUi->watchListTableWidget->item(row, 0)->setFont(f);
-			mUi->watchListTableWidget->item(row, 1)->setFont(f);
+void WatchListWindow::updateChangedValues()
+{
+	const quint64 valuesRevision = mNewParser->valuesRevision();
+	if (valuesRevision == mValuesRevision) {
+		return;
+	}
+
+	for (const QString &identifier : mNewParser->changedIdentifiers(mValuesRevision)) {
+		if (!mHiddenVariables.contains(identifier)) {
+			mModel.setValue(identifier, toString(mNewParser->value<QVariant>(identifier)));
 		}
+	}
 
-		mUi->watchListTableWidget->item(row, 0)->setText(identifier);
-		mUi->watchListTableWidget->item(row, 1)->setText(toString(value(identifier)));
+	mValuesRevision = valuesRevision;
+}
 
-		++row;
+void WatchListWindow::fillRows(const QStringList &identifiers
+		, const std::function<QVariant(const QString &)> &value)
+{
+	bool ok;
+	const auto fontSize = qReal::SettingsManager::value("CustomDockTextSize").toInt(&ok);
+	if (ok) {
+		auto font = mUi->watchListTableView->font();
+		font.setPointSize(fontSize);
+		mModel.setFont(font);
 	}
 
-	for (int i = row; i < mUi->watchListTableWidget->rowCount(); ++i) {
-		mUi->watchListTableWidget->removeRow(row);
+	mShownIdentifiers = identifiers;
+	QStringList shownIdentifiers;
+	QStringList values;
+	for (auto &&identifier : identifiers) {
+		if (!mHiddenVariables.contains(identifier)) {
+			shownIdentifiers << identifier;
+			values << toString(value(identifier));
+		}
 	}
+
+	mModel.setRows(shownIdentifiers, values);
 }
 
 QString WatchListWindow::toString(const QVariant &value) const
@@ -128,11 +161,20 @@ void WatchListWindow::focusInEvent(QFocusEvent *event)
 	onFocusIn();
 }
 
+void WatchListWindow::showEvent(QShowEvent *event)
+{
+	QDockWidget::showEvent(event);
+	updateVariables();
+}
+
 void WatchListWindow::hideVariables(const QStringList &variableNames)
 {
 	for (const QString &variableName : variableNames) {
 		mHiddenVariables.insert(variableName);
 	}
+
+	mShownIdentifiers.clear();
+	mIdentifiersDirty = true;
 }
 
 QString WatchListWindow::editorId() const
@@ -147,9 +189,9 @@ bool WatchListWindow::supportsCopying() const
 
 void WatchListWindow::copy()
 {
-	QTableWidgetItem * const currentItem = mUi->watchListTableWidget->currentItem();
-	if (currentItem && !currentItem->text().isEmpty()) {
+	const QString text = mUi->watchListTableView->currentIndex().data().toString();
+	if (!text.isEmpty()) {
 		QClipboard *clipboard = QApplication::clipboard();
-		clipboard->setText(currentItem->text());
+		clipboard->setText(text);
 	}
 }
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include <QtCore/QTimer>
 #include <QtCore/QSet>
 #include <QtWidgets/QDialog>
@@ -23,6 +25,7 @@
 #include <qrgui/plugins/toolPluginInterface/usedInterfaces/editorInterface.h>
 
 #include "expressionsParser/expressionsParser.h"
+#include "watchListModel.h"
 
 namespace Ui {
 	class watchListWindow;
@@ -63,18 +66,40 @@ private slots:
 	void updateVariables();
 
 private:
+	/// Pulls identifiers from the interpreter if they may have changed since the last update and rebuilds rows if
+	/// the list of shown identifiers is really different. Returns true if rows were rebuilt.
+	bool updateIdentifiers();
+
+	/// Refreshes values of identifiers that were changed in the interpreter since the last update.
+	void updateChangedValues();
+
+	/// Fills the model with given identifiers except hidden ones, reusing existing rows.
+	void fillRows(const QStringList &identifiers, const std::function<QVariant(const QString &)> &value);
+
 	QString toString(const QVariant &value) const;
 	void focusInEvent(QFocusEvent *event) override;
+	void showEvent(QShowEvent *event) override;
 
 	WatchListWindow(const utils::ExpressionsParser * const parser
 			, const qrtext::DebuggerInterface * const newParser
 			, QWidget *parent);
 
 	Ui::watchListWindow *mUi;
+	WatchListModel mModel;
 	QTimer mTimer;
 	const qrtext::DebuggerInterface * const mNewParser;  // Does not have ownership.
 	const utils::ExpressionsParser * const mParser;  // Does not have ownership.
 	QSet<QString> mHiddenVariables;
+
+	/// Sorted identifiers pulled from the interpreter at the last update, including hidden ones.
+	QStringList mShownIdentifiers;
+
+	/// Revisions of the interpreter seen at the last update, identifiers are pulled again only when they change.
+	quint64 mIdentifiersRevision = 0;
+	quint64 mValuesRevision = 0;
+
+	/// True if identifiers shall be pulled from the interpreter regardless of revision.
+	bool mIdentifiersDirty = true;
 };
 
 }